@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/advanced_sync.dir/advanced_sync.cpp.o"
+  "CMakeFiles/advanced_sync.dir/advanced_sync.cpp.o.d"
+  "advanced_sync"
+  "advanced_sync.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/advanced_sync.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
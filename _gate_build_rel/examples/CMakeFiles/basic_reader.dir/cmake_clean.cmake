@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/basic_reader.dir/basic_reader.cpp.o"
+  "CMakeFiles/basic_reader.dir/basic_reader.cpp.o.d"
+  "basic_reader"
+  "basic_reader.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/basic_reader.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/basic_writer.dir/basic_writer.cpp.o"
+  "CMakeFiles/basic_writer.dir/basic_writer.cpp.o.d"
+  "basic_writer"
+  "basic_writer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/basic_writer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
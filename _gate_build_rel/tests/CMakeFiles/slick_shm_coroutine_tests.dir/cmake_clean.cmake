@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/slick_shm_coroutine_tests.dir/test_notification_coroutine.cpp.o"
+  "CMakeFiles/slick_shm_coroutine_tests.dir/test_notification_coroutine.cpp.o.d"
+  "slick_shm_coroutine_tests"
+  "slick_shm_coroutine_tests.pdb"
+  "slick_shm_coroutine_tests_tests-b12d07c.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/slick_shm_coroutine_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
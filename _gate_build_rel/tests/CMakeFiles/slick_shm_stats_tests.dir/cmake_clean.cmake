@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/slick_shm_stats_tests.dir/test_stats.cpp.o"
+  "CMakeFiles/slick_shm_stats_tests.dir/test_stats.cpp.o.d"
+  "slick_shm_stats_tests"
+  "slick_shm_stats_tests.pdb"
+  "slick_shm_stats_tests_tests-b12d07c.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/slick_shm_stats_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,53 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/test_anonymous.cpp" "tests/CMakeFiles/slick_shm_tests.dir/test_anonymous.cpp.o" "gcc" "tests/CMakeFiles/slick_shm_tests.dir/test_anonymous.cpp.o.d"
+  "/root/repo/tests/test_arena.cpp" "tests/CMakeFiles/slick_shm_tests.dir/test_arena.cpp.o" "gcc" "tests/CMakeFiles/slick_shm_tests.dir/test_arena.cpp.o.d"
+  "/root/repo/tests/test_broadcast_ring.cpp" "tests/CMakeFiles/slick_shm_tests.dir/test_broadcast_ring.cpp.o" "gcc" "tests/CMakeFiles/slick_shm_tests.dir/test_broadcast_ring.cpp.o.d"
+  "/root/repo/tests/test_bulk_copy.cpp" "tests/CMakeFiles/slick_shm_tests.dir/test_bulk_copy.cpp.o" "gcc" "tests/CMakeFiles/slick_shm_tests.dir/test_bulk_copy.cpp.o.d"
+  "/root/repo/tests/test_copy_on_write.cpp" "tests/CMakeFiles/slick_shm_tests.dir/test_copy_on_write.cpp.o" "gcc" "tests/CMakeFiles/slick_shm_tests.dir/test_copy_on_write.cpp.o.d"
+  "/root/repo/tests/test_create_open.cpp" "tests/CMakeFiles/slick_shm_tests.dir/test_create_open.cpp.o" "gcc" "tests/CMakeFiles/slick_shm_tests.dir/test_create_open.cpp.o.d"
+  "/root/repo/tests/test_cross_process.cpp" "tests/CMakeFiles/slick_shm_tests.dir/test_cross_process.cpp.o" "gcc" "tests/CMakeFiles/slick_shm_tests.dir/test_cross_process.cpp.o.d"
+  "/root/repo/tests/test_epoch_buffer.cpp" "tests/CMakeFiles/slick_shm_tests.dir/test_epoch_buffer.cpp.o" "gcc" "tests/CMakeFiles/slick_shm_tests.dir/test_epoch_buffer.cpp.o.d"
+  "/root/repo/tests/test_error_handling.cpp" "tests/CMakeFiles/slick_shm_tests.dir/test_error_handling.cpp.o" "gcc" "tests/CMakeFiles/slick_shm_tests.dir/test_error_handling.cpp.o.d"
+  "/root/repo/tests/test_event.cpp" "tests/CMakeFiles/slick_shm_tests.dir/test_event.cpp.o" "gcc" "tests/CMakeFiles/slick_shm_tests.dir/test_event.cpp.o.d"
+  "/root/repo/tests/test_file_backed.cpp" "tests/CMakeFiles/slick_shm_tests.dir/test_file_backed.cpp.o" "gcc" "tests/CMakeFiles/slick_shm_tests.dir/test_file_backed.cpp.o.d"
+  "/root/repo/tests/test_fixed_address.cpp" "tests/CMakeFiles/slick_shm_tests.dir/test_fixed_address.cpp.o" "gcc" "tests/CMakeFiles/slick_shm_tests.dir/test_fixed_address.cpp.o.d"
+  "/root/repo/tests/test_growable_segment.cpp" "tests/CMakeFiles/slick_shm_tests.dir/test_growable_segment.cpp.o" "gcc" "tests/CMakeFiles/slick_shm_tests.dir/test_growable_segment.cpp.o.d"
+  "/root/repo/tests/test_huge_pages.cpp" "tests/CMakeFiles/slick_shm_tests.dir/test_huge_pages.cpp.o" "gcc" "tests/CMakeFiles/slick_shm_tests.dir/test_huge_pages.cpp.o.d"
+  "/root/repo/tests/test_interprocess_mutex.cpp" "tests/CMakeFiles/slick_shm_tests.dir/test_interprocess_mutex.cpp.o" "gcc" "tests/CMakeFiles/slick_shm_tests.dir/test_interprocess_mutex.cpp.o.d"
+  "/root/repo/tests/test_is_creator.cpp" "tests/CMakeFiles/slick_shm_tests.dir/test_is_creator.cpp.o" "gcc" "tests/CMakeFiles/slick_shm_tests.dir/test_is_creator.cpp.o.d"
+  "/root/repo/tests/test_lifetime.cpp" "tests/CMakeFiles/slick_shm_tests.dir/test_lifetime.cpp.o" "gcc" "tests/CMakeFiles/slick_shm_tests.dir/test_lifetime.cpp.o.d"
+  "/root/repo/tests/test_main.cpp" "tests/CMakeFiles/slick_shm_tests.dir/test_main.cpp.o" "gcc" "tests/CMakeFiles/slick_shm_tests.dir/test_main.cpp.o.d"
+  "/root/repo/tests/test_managed_segment.cpp" "tests/CMakeFiles/slick_shm_tests.dir/test_managed_segment.cpp.o" "gcc" "tests/CMakeFiles/slick_shm_tests.dir/test_managed_segment.cpp.o.d"
+  "/root/repo/tests/test_memory_lock.cpp" "tests/CMakeFiles/slick_shm_tests.dir/test_memory_lock.cpp.o" "gcc" "tests/CMakeFiles/slick_shm_tests.dir/test_memory_lock.cpp.o.d"
+  "/root/repo/tests/test_message_ring.cpp" "tests/CMakeFiles/slick_shm_tests.dir/test_message_ring.cpp.o" "gcc" "tests/CMakeFiles/slick_shm_tests.dir/test_message_ring.cpp.o.d"
+  "/root/repo/tests/test_mirror.cpp" "tests/CMakeFiles/slick_shm_tests.dir/test_mirror.cpp.o" "gcc" "tests/CMakeFiles/slick_shm_tests.dir/test_mirror.cpp.o.d"
+  "/root/repo/tests/test_move_semantics.cpp" "tests/CMakeFiles/slick_shm_tests.dir/test_move_semantics.cpp.o" "gcc" "tests/CMakeFiles/slick_shm_tests.dir/test_move_semantics.cpp.o.d"
+  "/root/repo/tests/test_notification_channel.cpp" "tests/CMakeFiles/slick_shm_tests.dir/test_notification_channel.cpp.o" "gcc" "tests/CMakeFiles/slick_shm_tests.dir/test_notification_channel.cpp.o.d"
+  "/root/repo/tests/test_numa.cpp" "tests/CMakeFiles/slick_shm_tests.dir/test_numa.cpp.o" "gcc" "tests/CMakeFiles/slick_shm_tests.dir/test_numa.cpp.o.d"
+  "/root/repo/tests/test_offset_ptr.cpp" "tests/CMakeFiles/slick_shm_tests.dir/test_offset_ptr.cpp.o" "gcc" "tests/CMakeFiles/slick_shm_tests.dir/test_offset_ptr.cpp.o.d"
+  "/root/repo/tests/test_prefault.cpp" "tests/CMakeFiles/slick_shm_tests.dir/test_prefault.cpp.o" "gcc" "tests/CMakeFiles/slick_shm_tests.dir/test_prefault.cpp.o.d"
+  "/root/repo/tests/test_segment_batch.cpp" "tests/CMakeFiles/slick_shm_tests.dir/test_segment_batch.cpp.o" "gcc" "tests/CMakeFiles/slick_shm_tests.dir/test_segment_batch.cpp.o.d"
+  "/root/repo/tests/test_segment_cache.cpp" "tests/CMakeFiles/slick_shm_tests.dir/test_segment_cache.cpp.o" "gcc" "tests/CMakeFiles/slick_shm_tests.dir/test_segment_cache.cpp.o.d"
+  "/root/repo/tests/test_segment_layout.cpp" "tests/CMakeFiles/slick_shm_tests.dir/test_segment_layout.cpp.o" "gcc" "tests/CMakeFiles/slick_shm_tests.dir/test_segment_layout.cpp.o.d"
+  "/root/repo/tests/test_seqlock.cpp" "tests/CMakeFiles/slick_shm_tests.dir/test_seqlock.cpp.o" "gcc" "tests/CMakeFiles/slick_shm_tests.dir/test_seqlock.cpp.o.d"
+  "/root/repo/tests/test_shared_memory_window.cpp" "tests/CMakeFiles/slick_shm_tests.dir/test_shared_memory_window.cpp.o" "gcc" "tests/CMakeFiles/slick_shm_tests.dir/test_shared_memory_window.cpp.o.d"
+  "/root/repo/tests/test_shm_hash_map.cpp" "tests/CMakeFiles/slick_shm_tests.dir/test_shm_hash_map.cpp.o" "gcc" "tests/CMakeFiles/slick_shm_tests.dir/test_shm_hash_map.cpp.o.d"
+  "/root/repo/tests/test_spsc_ring.cpp" "tests/CMakeFiles/slick_shm_tests.dir/test_spsc_ring.cpp.o" "gcc" "tests/CMakeFiles/slick_shm_tests.dir/test_spsc_ring.cpp.o.d"
+  "/root/repo/tests/test_typed_view.cpp" "tests/CMakeFiles/slick_shm_tests.dir/test_typed_view.cpp.o" "gcc" "tests/CMakeFiles/slick_shm_tests.dir/test_typed_view.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
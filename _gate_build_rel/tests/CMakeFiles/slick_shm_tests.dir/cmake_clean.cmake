@@ -0,0 +1,80 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/slick_shm_tests.dir/test_anonymous.cpp.o"
+  "CMakeFiles/slick_shm_tests.dir/test_anonymous.cpp.o.d"
+  "CMakeFiles/slick_shm_tests.dir/test_arena.cpp.o"
+  "CMakeFiles/slick_shm_tests.dir/test_arena.cpp.o.d"
+  "CMakeFiles/slick_shm_tests.dir/test_broadcast_ring.cpp.o"
+  "CMakeFiles/slick_shm_tests.dir/test_broadcast_ring.cpp.o.d"
+  "CMakeFiles/slick_shm_tests.dir/test_bulk_copy.cpp.o"
+  "CMakeFiles/slick_shm_tests.dir/test_bulk_copy.cpp.o.d"
+  "CMakeFiles/slick_shm_tests.dir/test_copy_on_write.cpp.o"
+  "CMakeFiles/slick_shm_tests.dir/test_copy_on_write.cpp.o.d"
+  "CMakeFiles/slick_shm_tests.dir/test_create_open.cpp.o"
+  "CMakeFiles/slick_shm_tests.dir/test_create_open.cpp.o.d"
+  "CMakeFiles/slick_shm_tests.dir/test_cross_process.cpp.o"
+  "CMakeFiles/slick_shm_tests.dir/test_cross_process.cpp.o.d"
+  "CMakeFiles/slick_shm_tests.dir/test_epoch_buffer.cpp.o"
+  "CMakeFiles/slick_shm_tests.dir/test_epoch_buffer.cpp.o.d"
+  "CMakeFiles/slick_shm_tests.dir/test_error_handling.cpp.o"
+  "CMakeFiles/slick_shm_tests.dir/test_error_handling.cpp.o.d"
+  "CMakeFiles/slick_shm_tests.dir/test_event.cpp.o"
+  "CMakeFiles/slick_shm_tests.dir/test_event.cpp.o.d"
+  "CMakeFiles/slick_shm_tests.dir/test_file_backed.cpp.o"
+  "CMakeFiles/slick_shm_tests.dir/test_file_backed.cpp.o.d"
+  "CMakeFiles/slick_shm_tests.dir/test_fixed_address.cpp.o"
+  "CMakeFiles/slick_shm_tests.dir/test_fixed_address.cpp.o.d"
+  "CMakeFiles/slick_shm_tests.dir/test_growable_segment.cpp.o"
+  "CMakeFiles/slick_shm_tests.dir/test_growable_segment.cpp.o.d"
+  "CMakeFiles/slick_shm_tests.dir/test_huge_pages.cpp.o"
+  "CMakeFiles/slick_shm_tests.dir/test_huge_pages.cpp.o.d"
+  "CMakeFiles/slick_shm_tests.dir/test_interprocess_mutex.cpp.o"
+  "CMakeFiles/slick_shm_tests.dir/test_interprocess_mutex.cpp.o.d"
+  "CMakeFiles/slick_shm_tests.dir/test_is_creator.cpp.o"
+  "CMakeFiles/slick_shm_tests.dir/test_is_creator.cpp.o.d"
+  "CMakeFiles/slick_shm_tests.dir/test_lifetime.cpp.o"
+  "CMakeFiles/slick_shm_tests.dir/test_lifetime.cpp.o.d"
+  "CMakeFiles/slick_shm_tests.dir/test_main.cpp.o"
+  "CMakeFiles/slick_shm_tests.dir/test_main.cpp.o.d"
+  "CMakeFiles/slick_shm_tests.dir/test_managed_segment.cpp.o"
+  "CMakeFiles/slick_shm_tests.dir/test_managed_segment.cpp.o.d"
+  "CMakeFiles/slick_shm_tests.dir/test_memory_lock.cpp.o"
+  "CMakeFiles/slick_shm_tests.dir/test_memory_lock.cpp.o.d"
+  "CMakeFiles/slick_shm_tests.dir/test_message_ring.cpp.o"
+  "CMakeFiles/slick_shm_tests.dir/test_message_ring.cpp.o.d"
+  "CMakeFiles/slick_shm_tests.dir/test_mirror.cpp.o"
+  "CMakeFiles/slick_shm_tests.dir/test_mirror.cpp.o.d"
+  "CMakeFiles/slick_shm_tests.dir/test_move_semantics.cpp.o"
+  "CMakeFiles/slick_shm_tests.dir/test_move_semantics.cpp.o.d"
+  "CMakeFiles/slick_shm_tests.dir/test_notification_channel.cpp.o"
+  "CMakeFiles/slick_shm_tests.dir/test_notification_channel.cpp.o.d"
+  "CMakeFiles/slick_shm_tests.dir/test_numa.cpp.o"
+  "CMakeFiles/slick_shm_tests.dir/test_numa.cpp.o.d"
+  "CMakeFiles/slick_shm_tests.dir/test_offset_ptr.cpp.o"
+  "CMakeFiles/slick_shm_tests.dir/test_offset_ptr.cpp.o.d"
+  "CMakeFiles/slick_shm_tests.dir/test_prefault.cpp.o"
+  "CMakeFiles/slick_shm_tests.dir/test_prefault.cpp.o.d"
+  "CMakeFiles/slick_shm_tests.dir/test_segment_batch.cpp.o"
+  "CMakeFiles/slick_shm_tests.dir/test_segment_batch.cpp.o.d"
+  "CMakeFiles/slick_shm_tests.dir/test_segment_cache.cpp.o"
+  "CMakeFiles/slick_shm_tests.dir/test_segment_cache.cpp.o.d"
+  "CMakeFiles/slick_shm_tests.dir/test_segment_layout.cpp.o"
+  "CMakeFiles/slick_shm_tests.dir/test_segment_layout.cpp.o.d"
+  "CMakeFiles/slick_shm_tests.dir/test_seqlock.cpp.o"
+  "CMakeFiles/slick_shm_tests.dir/test_seqlock.cpp.o.d"
+  "CMakeFiles/slick_shm_tests.dir/test_shared_memory_window.cpp.o"
+  "CMakeFiles/slick_shm_tests.dir/test_shared_memory_window.cpp.o.d"
+  "CMakeFiles/slick_shm_tests.dir/test_shm_hash_map.cpp.o"
+  "CMakeFiles/slick_shm_tests.dir/test_shm_hash_map.cpp.o.d"
+  "CMakeFiles/slick_shm_tests.dir/test_spsc_ring.cpp.o"
+  "CMakeFiles/slick_shm_tests.dir/test_spsc_ring.cpp.o.d"
+  "CMakeFiles/slick_shm_tests.dir/test_typed_view.cpp.o"
+  "CMakeFiles/slick_shm_tests.dir/test_typed_view.cpp.o.d"
+  "slick_shm_tests"
+  "slick_shm_tests.pdb"
+  "slick_shm_tests_tests-b12d07c.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/slick_shm_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_process_reader.dir/test_process_reader.cpp.o"
+  "CMakeFiles/test_process_reader.dir/test_process_reader.cpp.o.d"
+  "test_process_reader"
+  "test_process_reader.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_process_reader.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
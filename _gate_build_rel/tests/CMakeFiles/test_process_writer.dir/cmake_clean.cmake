@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_process_writer.dir/test_process_writer.cpp.o"
+  "CMakeFiles/test_process_writer.dir/test_process_writer.cpp.o.d"
+  "test_process_writer"
+  "test_process_writer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_process_writer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests
+# Build directory: /root/repo/_gate_build_rel/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+include("/root/repo/_gate_build_rel/tests/slick_shm_tests_include-b12d07c.cmake")
+include("/root/repo/_gate_build_rel/tests/slick_shm_stats_tests_include-b12d07c.cmake")
+include("/root/repo/_gate_build_rel/tests/slick_shm_coroutine_tests_include-b12d07c.cmake")
@@ -0,0 +1,5 @@
+add_test( [==[co_await readable() on an spsc_ring]==] /root/repo/_gate_build_rel/tests/slick_shm_coroutine_tests [==[co_await readable() on an spsc_ring]==]  )
+set_tests_properties( [==[co_await readable() on an spsc_ring]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[co_await readable() on a broadcast_ring]==] /root/repo/_gate_build_rel/tests/slick_shm_coroutine_tests [==[co_await readable() on a broadcast_ring]==]  )
+set_tests_properties( [==[co_await readable() on a broadcast_ring]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+set( slick_shm_coroutine_tests_TESTS [==[co_await readable() on an spsc_ring]==] [==[co_await readable() on a broadcast_ring]==])
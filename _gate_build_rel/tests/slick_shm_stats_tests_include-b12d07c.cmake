@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_gate_build_rel/tests/slick_shm_stats_tests_tests-b12d07c.cmake")
+  include("/root/repo/_gate_build_rel/tests/slick_shm_stats_tests_tests-b12d07c.cmake")
+else()
+  add_test(slick_shm_stats_tests_NOT_BUILT-b12d07c slick_shm_stats_tests_NOT_BUILT-b12d07c)
+endif()
@@ -0,0 +1,13 @@
+add_test( [==[Stats are compiled in]==] /root/repo/_gate_build_rel/tests/slick_shm_stats_tests [==[Stats are compiled in]==]  )
+set_tests_properties( [==[Stats are compiled in]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[spsc_ring counters]==] /root/repo/_gate_build_rel/tests/slick_shm_stats_tests [==[spsc_ring counters]==]  )
+set_tests_properties( [==[spsc_ring counters]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Moving a ring doesn't count as a detach]==] /root/repo/_gate_build_rel/tests/slick_shm_stats_tests [==[Moving a ring doesn't count as a detach]==]  )
+set_tests_properties( [==[Moving a ring doesn't count as a detach]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[message_ring counters]==] /root/repo/_gate_build_rel/tests/slick_shm_stats_tests [==[message_ring counters]==]  )
+set_tests_properties( [==[message_ring counters]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[broadcast_ring counters]==] /root/repo/_gate_build_rel/tests/slick_shm_stats_tests [==[broadcast_ring counters]==]  )
+set_tests_properties( [==[broadcast_ring counters]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[managed_segment counters]==] /root/repo/_gate_build_rel/tests/slick_shm_stats_tests [==[managed_segment counters]==]  )
+set_tests_properties( [==[managed_segment counters]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+set( slick_shm_stats_tests_TESTS [==[Stats are compiled in]==] [==[spsc_ring counters]==] [==[Moving a ring doesn't count as a detach]==] [==[message_ring counters]==] [==[broadcast_ring counters]==] [==[managed_segment counters]==])
@@ -0,0 +1,403 @@
+add_test( [==[Create shared memory with create_only]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Create shared memory with create_only]==]  )
+set_tests_properties( [==[Create shared memory with create_only]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Open existing shared memory]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Open existing shared memory]==]  )
+set_tests_properties( [==[Open existing shared memory]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Open or create shared memory]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Open or create shared memory]==]  )
+set_tests_properties( [==[Open or create shared memory]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Read/write access modes]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Read/write access modes]==]  )
+set_tests_properties( [==[Read/write access modes]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Read-only create and open_or_create]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Read-only create and open_or_create]==]  )
+set_tests_properties( [==[Read-only create and open_or_create]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[RAII cleanup]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[RAII cleanup]==]  )
+set_tests_properties( [==[RAII cleanup]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Manual unmap and close]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Manual unmap and close]==]  )
+set_tests_properties( [==[Manual unmap and close]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Static utility functions]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Static utility functions]==]  )
+set_tests_properties( [==[Static utility functions]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Exception variants throw on error]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Exception variants throw on error]==]  )
+set_tests_properties( [==[Exception variants throw on error]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[No-throw variants return error codes]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[No-throw variants return error codes]==]  )
+set_tests_properties( [==[No-throw variants return error codes]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Error code conversions]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Error code conversions]==]  )
+set_tests_properties( [==[Error code conversions]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Name validation]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Name validation]==]  )
+set_tests_properties( [==[Name validation]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Move constructor transfers ownership]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Move constructor transfers ownership]==]  )
+set_tests_properties( [==[Move constructor transfers ownership]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Move assignment transfers ownership]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Move assignment transfers ownership]==]  )
+set_tests_properties( [==[Move assignment transfers ownership]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Self-move assignment is safe]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Self-move assignment is safe]==]  )
+set_tests_properties( [==[Self-move assignment is safe]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Moved-from object can be destroyed safely]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Moved-from object can be destroyed safely]==]  )
+set_tests_properties( [==[Moved-from object can be destroyed safely]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Move enables return from function]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Move enables return from function]==]  )
+set_tests_properties( [==[Move enables return from function]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Names survive moves]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Names survive moves]==]  )
+set_tests_properties( [==[Names survive moves]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Longest valid name is stored inline]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Longest valid name is stored inline]==]  )
+set_tests_properties( [==[Longest valid name is stored inline]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Views are trivially copyable]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Views are trivially copyable]==]  )
+set_tests_properties( [==[Views are trivially copyable]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Cross-process communication]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Cross-process communication]==]  )
+set_tests_properties( [==[Cross-process communication]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[is_creator() returns true for create_only]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[is_creator() returns true for create_only]==]  )
+set_tests_properties( [==[is_creator() returns true for create_only]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[is_creator() returns false for open_existing]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[is_creator() returns false for open_existing]==]  )
+set_tests_properties( [==[is_creator() returns false for open_existing]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[is_creator() for open_or_create - creates new]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[is_creator() for open_or_create - creates new]==]  )
+set_tests_properties( [==[is_creator() for open_or_create - creates new]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[is_creator() for open_or_create - opens existing]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[is_creator() for open_or_create - opens existing]==]  )
+set_tests_properties( [==[is_creator() for open_or_create - opens existing]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[is_creator() for open_always - creates new]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[is_creator() for open_always - creates new]==]  )
+set_tests_properties( [==[is_creator() for open_always - creates new]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[is_creator() for open_always - opens existing]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[is_creator() for open_always - opens existing]==]  )
+set_tests_properties( [==[is_creator() for open_always - opens existing]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[is_creator() preserved after move constructor]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[is_creator() preserved after move constructor]==]  )
+set_tests_properties( [==[is_creator() preserved after move constructor]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[is_creator() preserved after move assignment]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[is_creator() preserved after move assignment]==]  )
+set_tests_properties( [==[is_creator() preserved after move assignment]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[is_creator() with no-throw constructors]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[is_creator() with no-throw constructors]==]  )
+set_tests_properties( [==[is_creator() with no-throw constructors]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[is_creator() returns false for invalid object]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[is_creator() returns false for invalid object]==]  )
+set_tests_properties( [==[is_creator() returns false for invalid object]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Standard pages by default]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Standard pages by default]==]  )
+set_tests_properties( [==[Standard pages by default]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Preferred huge pages always succeed]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Preferred huge pages always succeed]==]  )
+set_tests_properties( [==[Preferred huge pages always succeed]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Required huge pages succeed or report huge_pages_unavailable]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Required huge pages succeed or report huge_pages_unavailable]==]  )
+set_tests_properties( [==[Required huge pages succeed or report huge_pages_unavailable]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Unsupported huge page size]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Unsupported huge page size]==]  )
+set_tests_properties( [==[Unsupported huge page size]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Huge and standard segments share one namespace]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Huge and standard segments share one namespace]==]  )
+set_tests_properties( [==[Huge and standard segments share one namespace]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Prefault option on construction]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Prefault option on construction]==]  )
+set_tests_properties( [==[Prefault option on construction]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Explicit prefault of a range]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Explicit prefault of a range]==]  )
+set_tests_properties( [==[Explicit prefault of a range]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Lock and unlock a mapping]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Lock and unlock a mapping]==]  )
+set_tests_properties( [==[Lock and unlock a mapping]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Lock option on construction]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Lock option on construction]==]  )
+set_tests_properties( [==[Lock option on construction]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Lock errors are distinct]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Lock errors are distinct]==]  )
+set_tests_properties( [==[Lock errors are distinct]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[NUMA policy requires a node mask]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[NUMA policy requires a node mask]==]  )
+set_tests_properties( [==[NUMA policy requires a node mask]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Bind to node 0 and query placement]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Bind to node 0 and query placement]==]  )
+set_tests_properties( [==[Bind to node 0 and query placement]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Preferred node]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Preferred node]==]  )
+set_tests_properties( [==[Preferred node]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Interleave across nodes]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Interleave across nodes]==]  )
+set_tests_properties( [==[Interleave across nodes]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[NUMA placement of an unmapped segment]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[NUMA placement of an unmapped segment]==]  )
+set_tests_properties( [==[NUMA placement of an unmapped segment]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[spsc_ring basic push/pop]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[spsc_ring basic push/pop]==]  )
+set_tests_properties( [==[spsc_ring basic push/pop]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[spsc_ring batch push/pop wraps around]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[spsc_ring batch push/pop wraps around]==]  )
+set_tests_properties( [==[spsc_ring batch push/pop wraps around]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[spsc_ring open validates layout]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[spsc_ring open validates layout]==]  )
+set_tests_properties( [==[spsc_ring open validates layout]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[spsc_ring move leaves source invalid]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[spsc_ring move leaves source invalid]==]  )
+set_tests_properties( [==[spsc_ring move leaves source invalid]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[spsc_ring concurrent producer and consumer]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[spsc_ring concurrent producer and consumer]==]  )
+set_tests_properties( [==[spsc_ring concurrent producer and consumer]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[broadcast_ring fan-out to independent readers]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[broadcast_ring fan-out to independent readers]==]  )
+set_tests_properties( [==[broadcast_ring fan-out to independent readers]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[broadcast_ring late reader starts at the head]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[broadcast_ring late reader starts at the head]==]  )
+set_tests_properties( [==[broadcast_ring late reader starts at the head]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[broadcast_ring lapped reader resyncs]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[broadcast_ring lapped reader resyncs]==]  )
+set_tests_properties( [==[broadcast_ring lapped reader resyncs]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[broadcast_ring layout validation]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[broadcast_ring layout validation]==]  )
+set_tests_properties( [==[broadcast_ring layout validation]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[broadcast_ring concurrent writer and readers]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[broadcast_ring concurrent writer and readers]==]  )
+set_tests_properties( [==[broadcast_ring concurrent writer and readers]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[message_ring claim/commit and read/release]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[message_ring claim/commit and read/release]==]  )
+set_tests_properties( [==[message_ring claim/commit and read/release]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[message_ring full ring and oversized messages]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[message_ring full ring and oversized messages]==]  )
+set_tests_properties( [==[message_ring full ring and oversized messages]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[message_ring ignores commits of failed claims]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[message_ring ignores commits of failed claims]==]  )
+set_tests_properties( [==[message_ring ignores commits of failed claims]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[message_ring wraps with a padding record]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[message_ring wraps with a padding record]==]  )
+set_tests_properties( [==[message_ring wraps with a padding record]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[message_ring 64-byte alignment]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[message_ring 64-byte alignment]==]  )
+set_tests_properties( [==[message_ring 64-byte alignment]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[message_ring layout validation]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[message_ring layout validation]==]  )
+set_tests_properties( [==[message_ring layout validation]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[message_ring concurrent producer and consumer]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[message_ring concurrent producer and consumer]==]  )
+set_tests_properties( [==[message_ring concurrent producer and consumer]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[message_ring records stay within 32-bit lengths]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[message_ring records stay within 32-bit lengths]==]  )
+set_tests_properties( [==[message_ring records stay within 32-bit lengths]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[shared_event timeout without notification]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[shared_event timeout without notification]==]  )
+set_tests_properties( [==[shared_event timeout without notification]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[shared_event wakes a blocked waiter through another mapping]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[shared_event wakes a blocked waiter through another mapping]==]  )
+set_tests_properties( [==[shared_event wakes a blocked waiter through another mapping]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[shared_event predicate wait]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[shared_event predicate wait]==]  )
+set_tests_properties( [==[shared_event predicate wait]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[shared_event notify_all wakes every waiter]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[shared_event notify_all wakes every waiter]==]  )
+set_tests_properties( [==[shared_event notify_all wakes every waiter]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[interprocess_mutex in a zero-filled segment]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[interprocess_mutex in a zero-filled segment]==]  )
+set_tests_properties( [==[interprocess_mutex in a zero-filled segment]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[interprocess_mutex initialized once by the creator]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[interprocess_mutex initialized once by the creator]==]  )
+set_tests_properties( [==[interprocess_mutex initialized once by the creator]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[interprocess_mutex mutual exclusion across mappings]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[interprocess_mutex mutual exclusion across mappings]==]  )
+set_tests_properties( [==[interprocess_mutex mutual exclusion across mappings]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[interprocess_mutex recovers from owner death]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[interprocess_mutex recovers from owner death]==]  )
+set_tests_properties( [==[interprocess_mutex recovers from owner death]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[seqlock in a zero-filled segment]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[seqlock in a zero-filled segment]==]  )
+set_tests_properties( [==[seqlock in a zero-filled segment]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[seqlock readers never see torn values]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[seqlock readers never see torn values]==]  )
+set_tests_properties( [==[seqlock readers never see torn values]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[offset_ptr null semantics]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[offset_ptr null semantics]==]  )
+set_tests_properties( [==[offset_ptr null semantics]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[offset_ptr dereference and arithmetic]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[offset_ptr dereference and arithmetic]==]  )
+set_tests_properties( [==[offset_ptr dereference and arithmetic]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[offset_ptr stays valid when the memory moves]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[offset_ptr stays valid when the memory moves]==]  )
+set_tests_properties( [==[offset_ptr stays valid when the memory moves]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[offset_ptr copies recompute the distance]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[offset_ptr copies recompute the distance]==]  )
+set_tests_properties( [==[offset_ptr copies recompute the distance]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[offset_ptr conversions and casts]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[offset_ptr conversions and casts]==]  )
+set_tests_properties( [==[offset_ptr conversions and casts]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[arena allocate and reuse]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[arena allocate and reuse]==]  )
+set_tests_properties( [==[arena allocate and reuse]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[arena alignment]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[arena alignment]==]  )
+set_tests_properties( [==[arena alignment]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[arena exhaustion]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[arena exhaustion]==]  )
+set_tests_properties( [==[arena exhaustion]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[arena construct and root across mappings]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[arena construct and root across mappings]==]  )
+set_tests_properties( [==[arena construct and root across mappings]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[arena concurrent allocation]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[arena concurrent allocation]==]  )
+set_tests_properties( [==[arena concurrent allocation]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[arena open and create errors]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[arena open and create errors]==]  )
+set_tests_properties( [==[arena open and create errors]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[shm_hash_map insert and find]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[shm_hash_map insert and find]==]  )
+set_tests_properties( [==[shm_hash_map insert and find]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[shm_hash_map readers attach read-only]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[shm_hash_map readers attach read-only]==]  )
+set_tests_properties( [==[shm_hash_map readers attach read-only]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[shm_hash_map probes past full buckets]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[shm_hash_map probes past full buckets]==]  )
+set_tests_properties( [==[shm_hash_map probes past full buckets]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[shm_hash_map concurrent writers]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[shm_hash_map concurrent writers]==]  )
+set_tests_properties( [==[shm_hash_map concurrent writers]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[shm_hash_map open errors]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[shm_hash_map open errors]==]  )
+set_tests_properties( [==[shm_hash_map open errors]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[growable_segment grows in place]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[growable_segment grows in place]==]  )
+set_tests_properties( [==[growable_segment grows in place]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[growable_segment growth is visible to other mappings]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[growable_segment growth is visible to other mappings]==]  )
+set_tests_properties( [==[growable_segment growth is visible to other mappings]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[growable_segment concurrent growers]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[growable_segment concurrent growers]==]  )
+set_tests_properties( [==[growable_segment concurrent growers]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[growable_segment errors]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[growable_segment errors]==]  )
+set_tests_properties( [==[growable_segment errors]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[growable_segment move]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[growable_segment move]==]  )
+set_tests_properties( [==[growable_segment move]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[growable_segment open racing with the creator]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[growable_segment open racing with the creator]==]  )
+set_tests_properties( [==[growable_segment open racing with the creator]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[growable_segment open of an unsized object is retryable]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[growable_segment open of an unsized object is retryable]==]  )
+set_tests_properties( [==[growable_segment open of an unsized object is retryable]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[shared_memory_window maps a slice at any offset]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[shared_memory_window maps a slice at any offset]==]  )
+set_tests_properties( [==[shared_memory_window maps a slice at any offset]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[shared_memory_window remaps to another slice]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[shared_memory_window remaps to another slice]==]  )
+set_tests_properties( [==[shared_memory_window remaps to another slice]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[shared_memory_window writes are visible in the segment]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[shared_memory_window writes are visible in the segment]==]  )
+set_tests_properties( [==[shared_memory_window writes are visible in the segment]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[shared_memory_window rejects slices outside the segment]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[shared_memory_window rejects slices outside the segment]==]  )
+set_tests_properties( [==[shared_memory_window rejects slices outside the segment]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[shared_memory_window reports missing segments]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[shared_memory_window reports missing segments]==]  )
+set_tests_properties( [==[shared_memory_window reports missing segments]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[shared_memory_window move semantics]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[shared_memory_window move semantics]==]  )
+set_tests_properties( [==[shared_memory_window move semantics]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[sliding_window streams through a segment]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[sliding_window streams through a segment]==]  )
+set_tests_properties( [==[sliding_window streams through a segment]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[sliding_window random access and long ranges]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[sliding_window random access and long ranges]==]  )
+set_tests_properties( [==[sliding_window random access and long ranges]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[sliding_window error handling]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[sliding_window error handling]==]  )
+set_tests_properties( [==[sliding_window error handling]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Segments are not mirrored by default]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Segments are not mirrored by default]==]  )
+set_tests_properties( [==[Segments are not mirrored by default]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Mirrored mapping aliases the second view]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Mirrored mapping aliases the second view]==]  )
+set_tests_properties( [==[Mirrored mapping aliases the second view]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Mirrored size is rounded up to the mapping granularity]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Mirrored size is rounded up to the mapping granularity]==]  )
+set_tests_properties( [==[Mirrored size is rounded up to the mapping granularity]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Openers can map a segment mirrored or plain]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Openers can map a segment mirrored or plain]==]  )
+set_tests_properties( [==[Openers can map a segment mirrored or plain]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Mirrored byte stream never splits a copy]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Mirrored byte stream never splits a copy]==]  )
+set_tests_properties( [==[Mirrored byte stream never splits a copy]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Mirrored mapping with prefault and lock]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Mirrored mapping with prefault and lock]==]  )
+set_tests_properties( [==[Mirrored mapping with prefault and lock]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Mirrored mapping of a moved segment]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Mirrored mapping of a moved segment]==]  )
+set_tests_properties( [==[Mirrored mapping of a moved segment]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Growable segments can't be mirrored]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Growable segments can't be mirrored]==]  )
+set_tests_properties( [==[Growable segments can't be mirrored]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Create an anonymous segment]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Create an anonymous segment]==]  )
+set_tests_properties( [==[Create an anonymous segment]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Anonymous segment errors]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Anonymous segment errors]==]  )
+set_tests_properties( [==[Anonymous segment errors]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Anonymous segment with mapping options]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Anonymous segment with mapping options]==]  )
+set_tests_properties( [==[Anonymous segment with mapping options]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Anonymous segment with preferred huge pages]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Anonymous segment with preferred huge pages]==]  )
+set_tests_properties( [==[Anonymous segment with preferred huge pages]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Adopt a duplicated descriptor]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Adopt a duplicated descriptor]==]  )
+set_tests_properties( [==[Adopt a duplicated descriptor]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Adopted descriptor is owned by the segment]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Adopted descriptor is owned by the segment]==]  )
+set_tests_properties( [==[Adopted descriptor is owned by the segment]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Sealed anonymous segments can't be resized]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Sealed anonymous segments can't be resized]==]  )
+set_tests_properties( [==[Sealed anonymous segments can't be resized]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Pass an anonymous segment over a Unix socket]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Pass an anonymous segment over a Unix socket]==]  )
+set_tests_properties( [==[Pass an anonymous segment over a Unix socket]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[send_handle to a closed peer fails without SIGPIPE]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[send_handle to a closed peer fails without SIGPIPE]==]  )
+set_tests_properties( [==[send_handle to a closed peer fails without SIGPIPE]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[receive_handle closes descriptors it rejects]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[receive_handle closes descriptors it rejects]==]  )
+set_tests_properties( [==[receive_handle closes descriptors it rejects]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Import a descriptor from another process]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Import a descriptor from another process]==]  )
+set_tests_properties( [==[Import a descriptor from another process]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Import from a missing process]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Import from a missing process]==]  )
+set_tests_properties( [==[Import from a missing process]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[File-backed segment persists its contents]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[File-backed segment persists its contents]==]  )
+set_tests_properties( [==[File-backed segment persists its contents]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[File-backed segment create and open modes]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[File-backed segment create and open modes]==]  )
+set_tests_properties( [==[File-backed segment create and open modes]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[File-backed segment argument errors]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[File-backed segment argument errors]==]  )
+set_tests_properties( [==[File-backed segment argument errors]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Flush ranges of a file-backed segment]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Flush ranges of a file-backed segment]==]  )
+set_tests_properties( [==[Flush ranges of a file-backed segment]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Flush is harmless on shared memory segments]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Flush is harmless on shared memory segments]==]  )
+set_tests_properties( [==[Flush is harmless on shared memory segments]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Synchronous mapping needs a DAX file system]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Synchronous mapping needs a DAX file system]==]  )
+set_tests_properties( [==[Synchronous mapping needs a DAX file system]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Mirrored file-backed segment]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Mirrored file-backed segment]==]  )
+set_tests_properties( [==[Mirrored file-backed segment]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Window over a file-backed segment]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Window over a file-backed segment]==]  )
+set_tests_properties( [==[Window over a file-backed segment]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Growable segments can't be file-backed]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Growable segments can't be file-backed]==]  )
+set_tests_properties( [==[Growable segments can't be file-backed]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[segment_layout accessors over a segment]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[segment_layout accessors over a segment]==]  )
+set_tests_properties( [==[segment_layout accessors over a segment]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[segment_layout construct initializes every region]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[segment_layout construct initializes every region]==]  )
+set_tests_properties( [==[segment_layout construct initializes every region]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[segment_layout regions are shared across mappings]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[segment_layout regions are shared across mappings]==]  )
+set_tests_properties( [==[segment_layout regions are shared across mappings]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[segment_layout rejects segments that are too small]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[segment_layout rejects segments that are too small]==]  )
+set_tests_properties( [==[segment_layout rejects segments that are too small]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[managed_segment creator writes the header]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[managed_segment creator writes the header]==]  )
+set_tests_properties( [==[managed_segment creator writes the header]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[managed_segment opener waits for mark_ready]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[managed_segment opener waits for mark_ready]==]  )
+set_tests_properties( [==[managed_segment opener waits for mark_ready]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[managed_segment read-only openers poll]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[managed_segment read-only openers poll]==]  )
+set_tests_properties( [==[managed_segment read-only openers poll]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[managed_segment rejects other layouts]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[managed_segment rejects other layouts]==]  )
+set_tests_properties( [==[managed_segment rejects other layouts]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[managed_segment errors]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[managed_segment errors]==]  )
+set_tests_properties( [==[managed_segment errors]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Opening an object that is not sized yet]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Opening an object that is not sized yet]==]  )
+set_tests_properties( [==[Opening an object that is not sized yet]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[managed_segment attach across processes]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[managed_segment attach across processes]==]  )
+set_tests_properties( [==[managed_segment attach across processes]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[segment_cache reuses mappings]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[segment_cache reuses mappings]==]  )
+set_tests_properties( [==[segment_cache reuses mappings]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[segment_cache keeps modes apart]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[segment_cache keeps modes apart]==]  )
+set_tests_properties( [==[segment_cache keeps modes apart]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[segment_cache evicts idle mappings over the cap]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[segment_cache evicts idle mappings over the cap]==]  )
+set_tests_properties( [==[segment_cache evicts idle mappings over the cap]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[segment_cache invalidate reopens recreated segments]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[segment_cache invalidate reopens recreated segments]==]  )
+set_tests_properties( [==[segment_cache invalidate reopens recreated segments]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[segment_cache errors and handles]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[segment_cache errors and handles]==]  )
+set_tests_properties( [==[segment_cache errors and handles]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[segment_cache concurrent acquire]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[segment_cache concurrent acquire]==]  )
+set_tests_properties( [==[segment_cache concurrent acquire]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[segment_cache concurrent first acquire keeps one mapping]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[segment_cache concurrent first acquire keeps one mapping]==]  )
+set_tests_properties( [==[segment_cache concurrent first acquire keeps one mapping]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Map a segment at a chosen address]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Map a segment at a chosen address]==]  )
+set_tests_properties( [==[Map a segment at a chosen address]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Fixed address already in use]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Fixed address already in use]==]  )
+set_tests_properties( [==[Fixed address already in use]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Fixed address option errors]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Fixed address option errors]==]  )
+set_tests_properties( [==[Fixed address option errors]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Attach at the creator's address]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Attach at the creator's address]==]  )
+set_tests_properties( [==[Attach at the creator's address]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Share raw pointers across processes]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Share raw pointers across processes]==]  )
+set_tests_properties( [==[Share raw pointers across processes]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Remap a managed segment at the creator's address]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Remap a managed segment at the creator's address]==]  )
+set_tests_properties( [==[Remap a managed segment at the creator's address]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Create and open many segments]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Create and open many segments]==]  )
+set_tests_properties( [==[Create and open many segments]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Create many segments on several threads]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Create many segments on several threads]==]  )
+set_tests_properties( [==[Create many segments on several threads]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Batch entries fail independently]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Batch entries fail independently]==]  )
+set_tests_properties( [==[Batch entries fail independently]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Empty batch]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Empty batch]==]  )
+set_tests_properties( [==[Empty batch]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[open_always resizes an existing segment]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[open_always resizes an existing segment]==]  )
+set_tests_properties( [==[open_always resizes an existing segment]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[as<T>() checks size and alignment]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[as<T>() checks size and alignment]==]  )
+set_tests_properties( [==[as<T>() checks size and alignment]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[as_array<T>() covers the segment or a range]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[as_array<T>() covers the segment or a range]==]  )
+set_tests_properties( [==[as_array<T>() covers the segment or a range]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[as_matrix<T>() maps rows x cols]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[as_matrix<T>() maps rows x cols]==]  )
+set_tests_properties( [==[as_matrix<T>() maps rows x cols]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Views of a view]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Views of a view]==]  )
+set_tests_properties( [==[Views of a view]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Instruction set is picked]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Instruction set is picked]==]  )
+set_tests_properties( [==[Instruction set is picked]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[stream_copy() copies every length and alignment]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[stream_copy() copies every length and alignment]==]  )
+set_tests_properties( [==[stream_copy() copies every length and alignment]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[stream_read() copies every length]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[stream_read() copies every length]==]  )
+set_tests_properties( [==[stream_read() copies every length]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Streaming into and out of a segment]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Streaming into and out of a segment]==]  )
+set_tests_properties( [==[Streaming into and out of a segment]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Copy-on-write writes stay private]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Copy-on-write writes stay private]==]  )
+set_tests_properties( [==[Copy-on-write writes stay private]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[make_private() freezes a range]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[make_private() freezes a range]==]  )
+set_tests_properties( [==[make_private() freezes a range]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Prefaulting a copy-on-write mapping doesn't copy it]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Prefaulting a copy-on-write mapping doesn't copy it]==]  )
+set_tests_properties( [==[Prefaulting a copy-on-write mapping doesn't copy it]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Copy-on-write file mapping leaves the file alone]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Copy-on-write file mapping leaves the file alone]==]  )
+set_tests_properties( [==[Copy-on-write file mapping leaves the file alone]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[Copy-on-write errors]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[Copy-on-write errors]==]  )
+set_tests_properties( [==[Copy-on-write errors]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[epoch_buffer publishes whole values]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[epoch_buffer publishes whole values]==]  )
+set_tests_properties( [==[epoch_buffer publishes whole values]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[epoch_buffer waits for readers of the buffer it reuses]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[epoch_buffer waits for readers of the buffer it reuses]==]  )
+set_tests_properties( [==[epoch_buffer waits for readers of the buffer it reuses]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[epoch_buffer with three buffers runs two epochs ahead]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[epoch_buffer with three buffers runs two epochs ahead]==]  )
+set_tests_properties( [==[epoch_buffer with three buffers runs two epochs ahead]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[epoch_buffer open_or_create initializes once]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[epoch_buffer open_or_create initializes once]==]  )
+set_tests_properties( [==[epoch_buffer open_or_create initializes once]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[epoch_buffer reader slots]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[epoch_buffer reader slots]==]  )
+set_tests_properties( [==[epoch_buffer reader slots]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[epoch_buffer readers never see a torn value]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[epoch_buffer readers never see a torn value]==]  )
+set_tests_properties( [==[epoch_buffer readers never see a torn value]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[epoch_buffer frees the slot of a dead reader]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[epoch_buffer frees the slot of a dead reader]==]  )
+set_tests_properties( [==[epoch_buffer frees the slot of a dead reader]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[notification_channel wakes armed listeners]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[notification_channel wakes armed listeners]==]  )
+set_tests_properties( [==[notification_channel wakes armed listeners]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[notification_channel prepare_wait re-checks the data]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[notification_channel prepare_wait re-checks the data]==]  )
+set_tests_properties( [==[notification_channel prepare_wait re-checks the data]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[notification_channel drives an event-loop consumer]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[notification_channel drives an event-loop consumer]==]  )
+set_tests_properties( [==[notification_channel drives an event-loop consumer]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[notification_channel notify() from several threads]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[notification_channel notify() from several threads]==]  )
+set_tests_properties( [==[notification_channel notify() from several threads]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[notification_channel listener slots]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[notification_channel listener slots]==]  )
+set_tests_properties( [==[notification_channel listener slots]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[notification_channel rejects other segments]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[notification_channel rejects other segments]==]  )
+set_tests_properties( [==[notification_channel rejects other segments]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[notification_channel cross-process wake-up]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[notification_channel cross-process wake-up]==]  )
+set_tests_properties( [==[notification_channel cross-process wake-up]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[notification_channel survives a dead listener]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[notification_channel survives a dead listener]==]  )
+set_tests_properties( [==[notification_channel survives a dead listener]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[ref_counted segment is removed by the last detach]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[ref_counted segment is removed by the last detach]==]  )
+set_tests_properties( [==[ref_counted segment is removed by the last detach]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[manual segments outlive their processes]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[manual segments outlive their processes]==]  )
+set_tests_properties( [==[manual segments outlive their processes]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[read-only openers of a ref_counted segment]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[read-only openers of a ref_counted segment]==]  )
+set_tests_properties( [==[read-only openers of a ref_counted segment]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[ref_counted rejects unsupported options]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[ref_counted rejects unsupported options]==]  )
+set_tests_properties( [==[ref_counted rejects unsupported options]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[open_or_create racing with the last detach]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[open_or_create racing with the last detach]==]  )
+set_tests_properties( [==[open_or_create racing with the last detach]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[ref_counted opener of a manual segment]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[ref_counted opener of a manual segment]==]  )
+set_tests_properties( [==[ref_counted opener of a manual segment]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[sweep() removes segments whose processes died]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[sweep() removes segments whose processes died]==]  )
+set_tests_properties( [==[sweep() removes segments whose processes died]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[sweep() keeps segments with live processes]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[sweep() keeps segments with live processes]==]  )
+set_tests_properties( [==[sweep() keeps segments with live processes]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+add_test( [==[attach reclaims the slots of dead processes]==] /root/repo/_gate_build_rel/tests/slick_shm_tests [==[attach reclaims the slots of dead processes]==]  )
+set_tests_properties( [==[attach reclaims the slots of dead processes]==] PROPERTIES WORKING_DIRECTORY /root/repo/_gate_build_rel/tests)
+set( slick_shm_tests_TESTS [==[Create shared memory with create_only]==] [==[Open existing shared memory]==] [==[Open or create shared memory]==] [==[Read/write access modes]==] [==[Read-only create and open_or_create]==] [==[RAII cleanup]==] [==[Manual unmap and close]==] [==[Static utility functions]==] [==[Exception variants throw on error]==] [==[No-throw variants return error codes]==] [==[Error code conversions]==] [==[Name validation]==] [==[Move constructor transfers ownership]==] [==[Move assignment transfers ownership]==] [==[Self-move assignment is safe]==] [==[Moved-from object can be destroyed safely]==] [==[Move enables return from function]==] [==[Names survive moves]==] [==[Longest valid name is stored inline]==] [==[Views are trivially copyable]==] [==[Cross-process communication]==] [==[is_creator() returns true for create_only]==] [==[is_creator() returns false for open_existing]==] [==[is_creator() for open_or_create - creates new]==] [==[is_creator() for open_or_create - opens existing]==] [==[is_creator() for open_always - creates new]==] [==[is_creator() for open_always - opens existing]==] [==[is_creator() preserved after move constructor]==] [==[is_creator() preserved after move assignment]==] [==[is_creator() with no-throw constructors]==] [==[is_creator() returns false for invalid object]==] [==[Standard pages by default]==] [==[Preferred huge pages always succeed]==] [==[Required huge pages succeed or report huge_pages_unavailable]==] [==[Unsupported huge page size]==] [==[Huge and standard segments share one namespace]==] [==[Prefault option on construction]==] [==[Explicit prefault of a range]==] [==[Lock and unlock a mapping]==] [==[Lock option on construction]==] [==[Lock errors are distinct]==] [==[NUMA policy requires a node mask]==] [==[Bind to node 0 and query placement]==] [==[Preferred node]==] [==[Interleave across nodes]==] [==[NUMA placement of an unmapped segment]==] [==[spsc_ring basic push/pop]==] [==[spsc_ring batch push/pop wraps around]==] [==[spsc_ring open validates layout]==] [==[spsc_ring move leaves source invalid]==] [==[spsc_ring concurrent producer and consumer]==] [==[broadcast_ring fan-out to independent readers]==] [==[broadcast_ring late reader starts at the head]==] [==[broadcast_ring lapped reader resyncs]==] [==[broadcast_ring layout validation]==] [==[broadcast_ring concurrent writer and readers]==] [==[message_ring claim/commit and read/release]==] [==[message_ring full ring and oversized messages]==] [==[message_ring ignores commits of failed claims]==] [==[message_ring wraps with a padding record]==] [==[message_ring 64-byte alignment]==] [==[message_ring layout validation]==] [==[message_ring concurrent producer and consumer]==] [==[message_ring records stay within 32-bit lengths]==] [==[shared_event timeout without notification]==] [==[shared_event wakes a blocked waiter through another mapping]==] [==[shared_event predicate wait]==] [==[shared_event notify_all wakes every waiter]==] [==[interprocess_mutex in a zero-filled segment]==] [==[interprocess_mutex initialized once by the creator]==] [==[interprocess_mutex mutual exclusion across mappings]==] [==[interprocess_mutex recovers from owner death]==] [==[seqlock in a zero-filled segment]==] [==[seqlock readers never see torn values]==] [==[offset_ptr null semantics]==] [==[offset_ptr dereference and arithmetic]==] [==[offset_ptr stays valid when the memory moves]==] [==[offset_ptr copies recompute the distance]==] [==[offset_ptr conversions and casts]==] [==[arena allocate and reuse]==] [==[arena alignment]==] [==[arena exhaustion]==] [==[arena construct and root across mappings]==] [==[arena concurrent allocation]==] [==[arena open and create errors]==] [==[shm_hash_map insert and find]==] [==[shm_hash_map readers attach read-only]==] [==[shm_hash_map probes past full buckets]==] [==[shm_hash_map concurrent writers]==] [==[shm_hash_map open errors]==] [==[growable_segment grows in place]==] [==[growable_segment growth is visible to other mappings]==] [==[growable_segment concurrent growers]==] [==[growable_segment errors]==] [==[growable_segment move]==] [==[growable_segment open racing with the creator]==] [==[growable_segment open of an unsized object is retryable]==] [==[shared_memory_window maps a slice at any offset]==] [==[shared_memory_window remaps to another slice]==] [==[shared_memory_window writes are visible in the segment]==] [==[shared_memory_window rejects slices outside the segment]==] [==[shared_memory_window reports missing segments]==] [==[shared_memory_window move semantics]==] [==[sliding_window streams through a segment]==] [==[sliding_window random access and long ranges]==] [==[sliding_window error handling]==] [==[Segments are not mirrored by default]==] [==[Mirrored mapping aliases the second view]==] [==[Mirrored size is rounded up to the mapping granularity]==] [==[Openers can map a segment mirrored or plain]==] [==[Mirrored byte stream never splits a copy]==] [==[Mirrored mapping with prefault and lock]==] [==[Mirrored mapping of a moved segment]==] [==[Growable segments can't be mirrored]==] [==[Create an anonymous segment]==] [==[Anonymous segment errors]==] [==[Anonymous segment with mapping options]==] [==[Anonymous segment with preferred huge pages]==] [==[Adopt a duplicated descriptor]==] [==[Adopted descriptor is owned by the segment]==] [==[Sealed anonymous segments can't be resized]==] [==[Pass an anonymous segment over a Unix socket]==] [==[send_handle to a closed peer fails without SIGPIPE]==] [==[receive_handle closes descriptors it rejects]==] [==[Import a descriptor from another process]==] [==[Import from a missing process]==] [==[File-backed segment persists its contents]==] [==[File-backed segment create and open modes]==] [==[File-backed segment argument errors]==] [==[Flush ranges of a file-backed segment]==] [==[Flush is harmless on shared memory segments]==] [==[Synchronous mapping needs a DAX file system]==] [==[Mirrored file-backed segment]==] [==[Window over a file-backed segment]==] [==[Growable segments can't be file-backed]==] [==[segment_layout accessors over a segment]==] [==[segment_layout construct initializes every region]==] [==[segment_layout regions are shared across mappings]==] [==[segment_layout rejects segments that are too small]==] [==[managed_segment creator writes the header]==] [==[managed_segment opener waits for mark_ready]==] [==[managed_segment read-only openers poll]==] [==[managed_segment rejects other layouts]==] [==[managed_segment errors]==] [==[Opening an object that is not sized yet]==] [==[managed_segment attach across processes]==] [==[segment_cache reuses mappings]==] [==[segment_cache keeps modes apart]==] [==[segment_cache evicts idle mappings over the cap]==] [==[segment_cache invalidate reopens recreated segments]==] [==[segment_cache errors and handles]==] [==[segment_cache concurrent acquire]==] [==[segment_cache concurrent first acquire keeps one mapping]==] [==[Map a segment at a chosen address]==] [==[Fixed address already in use]==] [==[Fixed address option errors]==] [==[Attach at the creator's address]==] [==[Share raw pointers across processes]==] [==[Remap a managed segment at the creator's address]==] [==[Create and open many segments]==] [==[Create many segments on several threads]==] [==[Batch entries fail independently]==] [==[Empty batch]==] [==[open_always resizes an existing segment]==] [==[as<T>() checks size and alignment]==] [==[as_array<T>() covers the segment or a range]==] [==[as_matrix<T>() maps rows x cols]==] [==[Views of a view]==] [==[Instruction set is picked]==] [==[stream_copy() copies every length and alignment]==] [==[stream_read() copies every length]==] [==[Streaming into and out of a segment]==] [==[Copy-on-write writes stay private]==] [==[make_private() freezes a range]==] [==[Prefaulting a copy-on-write mapping doesn't copy it]==] [==[Copy-on-write file mapping leaves the file alone]==] [==[Copy-on-write errors]==] [==[epoch_buffer publishes whole values]==] [==[epoch_buffer waits for readers of the buffer it reuses]==] [==[epoch_buffer with three buffers runs two epochs ahead]==] [==[epoch_buffer open_or_create initializes once]==] [==[epoch_buffer reader slots]==] [==[epoch_buffer readers never see a torn value]==] [==[epoch_buffer frees the slot of a dead reader]==] [==[notification_channel wakes armed listeners]==] [==[notification_channel prepare_wait re-checks the data]==] [==[notification_channel drives an event-loop consumer]==] [==[notification_channel notify() from several threads]==] [==[notification_channel listener slots]==] [==[notification_channel rejects other segments]==] [==[notification_channel cross-process wake-up]==] [==[notification_channel survives a dead listener]==] [==[ref_counted segment is removed by the last detach]==] [==[manual segments outlive their processes]==] [==[read-only openers of a ref_counted segment]==] [==[ref_counted rejects unsupported options]==] [==[open_or_create racing with the last detach]==] [==[ref_counted opener of a manual segment]==] [==[sweep() removes segments whose processes died]==] [==[sweep() keeps segments with live processes]==] [==[attach reclaims the slots of dead processes]==])
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/slick-shm-stat.dir/slick_shm_stat.cpp.o"
+  "CMakeFiles/slick-shm-stat.dir/slick_shm_stat.cpp.o.d"
+  "slick-shm-stat"
+  "slick-shm-stat.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/slick-shm-stat.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,154 @@
+#pragma once
+
+#include <slick/shm/shared_memory.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Shared helpers for the benchmark executables
+
+namespace bench {
+
+using clock = std::chrono::steady_clock;
+
+inline std::uint64_t now_ns() {
+    return static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now().time_since_epoch())
+            .count());
+}
+
+inline std::string unique_name(const char* prefix) {
+    static unsigned counter = 0;
+    auto now = std::chrono::system_clock::now().time_since_epoch();
+    auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(now).count();
+    // Keep names short (macOS has a 31-char limit)
+    return std::string(prefix) + std::to_string(millis % 100000000) + "_" +
+           std::to_string(counter++);
+}
+
+/**
+ * Collects latency samples (ns) and reports percentiles.
+ * Samples are kept and sorted, so percentiles are exact.
+ */
+class latency_recorder {
+public:
+    void reserve(std::size_t n) { samples_.reserve(n); }
+    void record(std::uint64_t ns) { samples_.push_back(ns); }
+    std::size_t count() const { return samples_.size(); }
+
+    // Ordered list of (metric name, value) pairs
+    std::vector<std::pair<std::string, double>> summary() {
+        std::vector<std::pair<std::string, double>> result;
+        if (samples_.empty()) {
+            return result;
+        }
+        std::sort(samples_.begin(), samples_.end());
+        double sum = 0;
+        for (std::uint64_t s : samples_) {
+            sum += static_cast<double>(s);
+        }
+        result.emplace_back("count", static_cast<double>(samples_.size()));
+        result.emplace_back("min_ns", static_cast<double>(samples_.front()));
+        result.emplace_back("mean_ns", sum / static_cast<double>(samples_.size()));
+        result.emplace_back("p50_ns", percentile(50.0));
+        result.emplace_back("p90_ns", percentile(90.0));
+        result.emplace_back("p99_ns", percentile(99.0));
+        result.emplace_back("p99_9_ns", percentile(99.9));
+        result.emplace_back("p99_99_ns", percentile(99.99));
+        result.emplace_back("max_ns", static_cast<double>(samples_.back()));
+        return result;
+    }
+
+    double median() {
+        std::sort(samples_.begin(), samples_.end());
+        return percentile(50.0);
+    }
+
+private:
+    std::vector<std::uint64_t> samples_;
+
+    // Nearest-rank percentile on sorted samples
+    double percentile(double p) const {
+        std::size_t rank = static_cast<std::size_t>(p / 100.0 * static_cast<double>(samples_.size()));
+        if (rank >= samples_.size()) {
+            rank = samples_.size() - 1;
+        }
+        return static_cast<double>(samples_[rank]);
+    }
+};
+
+/**
+ * One benchmark result: a name, string/number parameters and numeric metrics
+ */
+struct result {
+    std::string name;
+    std::vector<std::pair<std::string, std::string>> params;
+    std::vector<std::pair<std::string, double>> metrics;
+
+    result& param(const std::string& key, const std::string& value) {
+        params.emplace_back(key, "\"" + value + "\"");
+        return *this;
+    }
+    result& param(const std::string& key, const char* value) {
+        return param(key, std::string(value));
+    }
+    result& param(const std::string& key, std::uint64_t value) {
+        params.emplace_back(key, std::to_string(value));
+        return *this;
+    }
+    result& param(const std::string& key, bool value) {
+        params.emplace_back(key, value ? "true" : "false");
+        return *this;
+    }
+    result& metric(const std::string& key, double value) {
+        metrics.emplace_back(key, value);
+        return *this;
+    }
+    result& metrics_from(const std::vector<std::pair<std::string, double>>& values) {
+        metrics.insert(metrics.end(), values.begin(), values.end());
+        return *this;
+    }
+};
+
+inline std::string format_number(double value) {
+    std::ostringstream out;
+    out.precision(15);
+    out << value;
+    return out.str();
+}
+
+inline std::string to_json(const std::vector<result>& results, const std::string& platform,
+                           const std::string& version) {
+    std::ostringstream out;
+    auto epoch = std::chrono::duration_cast<std::chrono::seconds>(
+                     std::chrono::system_clock::now().time_since_epoch())
+                     .count();
+    out << "{\n";
+    out << "  \"library\": \"slick-shm\",\n";
+    out << "  \"version\": \"" << version << "\",\n";
+    out << "  \"platform\": \"" << platform << "\",\n";
+    out << "  \"timestamp\": " << epoch << ",\n";
+    out << "  \"benchmarks\": [";
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const result& r = results[i];
+        out << (i == 0 ? "\n" : ",\n");
+        out << "    {\n      \"name\": \"" << r.name << "\",\n      \"params\": {";
+        for (std::size_t p = 0; p < r.params.size(); ++p) {
+            out << (p == 0 ? "" : ", ") << "\"" << r.params[p].first << "\": " << r.params[p].second;
+        }
+        out << "},\n      \"metrics\": {";
+        for (std::size_t m = 0; m < r.metrics.size(); ++m) {
+            out << (m == 0 ? "" : ", ") << "\"" << r.metrics[m].first
+                << "\": " << format_number(r.metrics[m].second);
+        }
+        out << "}\n    }";
+    }
+    out << "\n  ]\n}\n";
+    return out.str();
+}
+
+}  // namespace bench
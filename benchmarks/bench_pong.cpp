@@ -0,0 +1,37 @@
+#include "pingpong.hpp"
+
+#include <slick/shm/shared_memory.hpp>
+
+#include <iostream>
+
+// Helper executable for the ping-pong benchmark: echoes every ping back as a pong
+// Usage: bench_pong <shm_name> <spin|hybrid|block>
+
+int main(int argc, char* argv[]) {
+    bench::pingpong_mode mode;
+    if (argc != 3 || !bench::parse_mode(argv[2], mode)) {
+        std::cerr << "Usage: bench_pong <shm_name> <spin|hybrid|block>" << std::endl;
+        return 1;
+    }
+
+    try {
+        using namespace slick::shm;
+
+        shared_memory shm(argv[1], open_existing);
+        auto* block = static_cast<bench::pingpong_block*>(shm.data());
+        block->ready.store(1, std::memory_order_release);
+
+        std::uint64_t last = 0;
+        for (;;) {
+            last = bench::wait_change(block->ping, block->ping_event, last, mode);
+            if (last == bench::PINGPONG_STOP) {
+                return 0;
+            }
+            bench::signal(block->pong, block->pong_event, last, mode);
+        }
+
+    } catch (const std::exception& e) {
+        std::cerr << "bench_pong error: " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <slick/shm/event.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <thread>
+
+// Segment layout and wait loop shared by the ping-pong benchmark and bench_pong
+
+namespace bench {
+
+constexpr std::uint64_t PINGPONG_STOP = ~std::uint64_t(0);
+
+enum class pingpong_mode {
+    spin,    // Busy-poll the peer's counter
+    hybrid,  // shared_event with the default spin budget
+    block    // shared_event with no spinning (pure kernel wake-up)
+};
+
+inline const char* to_string(pingpong_mode mode) {
+    switch (mode) {
+        case pingpong_mode::spin: return "spin";
+        case pingpong_mode::hybrid: return "hybrid";
+        case pingpong_mode::block: return "block";
+    }
+    return "unknown";
+}
+
+inline bool parse_mode(const char* text, pingpong_mode& mode) {
+    for (pingpong_mode m : {pingpong_mode::spin, pingpong_mode::hybrid, pingpong_mode::block}) {
+        if (std::strcmp(text, to_string(m)) == 0) {
+            mode = m;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Each side writes its own cache line
+struct pingpong_block {
+    alignas(64) std::atomic<std::uint64_t> ping;
+    alignas(64) std::atomic<std::uint64_t> pong;
+    alignas(64) slick::shm::shared_event ping_event;
+    alignas(64) slick::shm::shared_event pong_event;
+    alignas(64) std::atomic<std::uint32_t> ready;
+};
+
+inline void signal(std::atomic<std::uint64_t>& counter, slick::shm::shared_event& event,
+                   std::uint64_t value, pingpong_mode mode) {
+    counter.store(value, std::memory_order_release);
+    if (mode != pingpong_mode::spin) {
+        event.notify_one();
+    }
+}
+
+// Wait until counter != last and return the new value
+inline std::uint64_t wait_change(const std::atomic<std::uint64_t>& counter,
+                                 slick::shm::shared_event& event, std::uint64_t last,
+                                 pingpong_mode mode) {
+    if (mode == pingpong_mode::spin) {
+        for (std::uint32_t spins = 0;; ++spins) {
+            std::uint64_t value = counter.load(std::memory_order_acquire);
+            if (value != last) {
+                return value;
+            }
+            // Yield now and then so an oversubscribed machine still makes progress
+            if ((spins & 0xFFF) == 0xFFF) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    slick::shm::wait_policy policy;
+    if (mode == pingpong_mode::block) {
+        policy.spin_count = 0;
+    }
+    std::uint64_t value = last;
+    event.wait([&] {
+        value = counter.load(std::memory_order_acquire);
+        return value != last;
+    }, policy);
+    return value;
+}
+
+}  // namespace bench
@@ -0,0 +1,558 @@
+#include "bench_common.hpp"
+#include "pingpong.hpp"
+
+#include <slick/shm/broadcast_ring.hpp>
+#include <slick/shm/bulk_copy.hpp>
+#include <slick/shm/message_ring.hpp>
+#include <slick/shm/shared_memory.hpp>
+#include <slick/shm/spsc_ring.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// slick-shm benchmark suite
+// Usage: slick_shm_bench [--quick] [--json <file>] [--filter <substring>]
+//
+// Results are written as JSON (to stdout unless --json is given); a short
+// human-readable summary goes to stderr.
+
+#ifndef SLICK_SHM_VERSION
+#define SLICK_SHM_VERSION "unknown"
+#endif
+
+using namespace slick::shm;
+
+namespace {
+
+struct config {
+    bool quick = false;
+    std::string json_path;
+    std::string filter;
+    std::string helper_dir;  // Directory of this executable (for bench_pong)
+};
+
+const char* platform_name() {
+#if defined(SLICK_SHM_WINDOWS)
+    return "windows";
+#elif defined(SLICK_SHM_LINUX)
+    return "linux";
+#elif defined(SLICK_SHM_MACOS)
+    return "macos";
+#else
+    return "posix";
+#endif
+}
+
+void report(std::vector<bench::result>& results, bench::result r) {
+    std::cerr << "  " << r.name;
+    for (const auto& p : r.params) {
+        std::cerr << " " << p.first << "=" << p.second;
+    }
+    for (const auto& m : r.metrics) {
+        if (m.first.find("p50") != std::string::npos || m.first.find("per_sec") != std::string::npos ||
+            m.first.find("per_4k") != std::string::npos) {
+            std::cerr << " " << m.first << "=" << bench::format_number(m.second);
+        }
+    }
+    std::cerr << std::endl;
+    results.push_back(std::move(r));
+}
+
+// Prefix every metric of a latency summary
+std::vector<std::pair<std::string, double>> prefixed(
+    const std::string& prefix, const std::vector<std::pair<std::string, double>>& metrics) {
+    std::vector<std::pair<std::string, double>> result;
+    for (const auto& m : metrics) {
+        result.emplace_back(prefix + "_" + m.first, m.second);
+    }
+    return result;
+}
+
+// ============================================================================
+// Segment create / open / close / remove cost versus size
+// ============================================================================
+
+void bench_segment_lifecycle(const config& cfg, std::vector<bench::result>& results) {
+    std::vector<std::size_t> sizes = {4096, 64 * 1024, 1024 * 1024, 16 * 1024 * 1024};
+    if (!cfg.quick) {
+        sizes.push_back(64 * 1024 * 1024);
+    }
+    const int iterations = cfg.quick ? 50 : 500;
+
+    for (std::size_t size : sizes) {
+        bench::latency_recorder create, open, close, remove;
+        for (int i = 0; i < iterations; ++i) {
+            std::string name = bench::unique_name("bench_life");
+
+            std::uint64_t t0 = bench::now_ns();
+            shared_memory creator(name.c_str(), size, create_only);
+            std::uint64_t t1 = bench::now_ns();
+            shared_memory opener(name.c_str(), open_existing);
+            std::uint64_t t2 = bench::now_ns();
+            opener.close();
+            creator.close();
+            std::uint64_t t3 = bench::now_ns();
+            shared_memory::remove(name.c_str());
+            std::uint64_t t4 = bench::now_ns();
+
+            create.record(t1 - t0);
+            open.record(t2 - t1);
+            close.record((t3 - t2) / 2);
+            remove.record(t4 - t3);
+        }
+
+        bench::result r;
+        r.name = "segment_lifecycle";
+        r.param("size", static_cast<std::uint64_t>(size));
+        r.metrics_from(prefixed("create", create.summary()));
+        r.metrics_from(prefixed("open", open.summary()));
+        r.metrics_from(prefixed("close", close.summary()));
+        r.metrics_from(prefixed("remove", remove.summary()));
+        report(results, std::move(r));
+    }
+}
+
+// ============================================================================
+// First-touch page fault cost with and without prefault / huge pages
+// ============================================================================
+
+void bench_first_touch(const config& cfg, std::vector<bench::result>& results) {
+    const std::size_t size = (cfg.quick ? 16 : 64) * 1024 * 1024;
+    const int iterations = cfg.quick ? 2 : 5;
+
+    struct variant {
+        const char* label;
+        bool prefault;
+        huge_pages huge;
+    };
+    const variant variants[] = {
+        {"standard", false, huge_pages::none},
+        {"prefault", true, huge_pages::none},
+        {"huge_pages", false, huge_pages::preferred},
+        {"huge_pages_prefault", true, huge_pages::preferred},
+    };
+
+    for (const variant& v : variants) {
+        segment_options options;
+        options.prefault = v.prefault;
+        options.huge_page_policy = v.huge;
+
+        bench::latency_recorder create, touch;
+        bool used_huge_pages = false;
+        for (int i = 0; i < iterations; ++i) {
+            std::string name = bench::unique_name("bench_touch");
+
+            std::uint64_t t0 = bench::now_ns();
+            shared_memory shm(name.c_str(), size, create_only, access_mode::read_write, options);
+            std::uint64_t t1 = bench::now_ns();
+            volatile unsigned char* bytes = static_cast<volatile unsigned char*>(shm.data());
+            for (std::size_t offset = 0; offset < shm.size(); offset += 4096) {
+                bytes[offset] = 1;
+            }
+            std::uint64_t t2 = bench::now_ns();
+
+            used_huge_pages = shm.uses_huge_pages();
+            create.record(t1 - t0);
+            touch.record(t2 - t1);
+            shm.close();
+            shared_memory::remove(name.c_str());
+        }
+
+        double touch_ns = touch.median();
+        bench::result r;
+        r.name = "first_touch";
+        r.param("variant", v.label).param("size", static_cast<std::uint64_t>(size));
+        r.param("uses_huge_pages", used_huge_pages);
+        r.metric("create_p50_ns", create.median());
+        r.metric("touch_p50_ns", touch_ns);
+        r.metric("touch_ns_per_4k", touch_ns / static_cast<double>(size / 4096));
+        r.metric("total_p50_ns", create.median() + touch_ns);
+        report(results, std::move(r));
+    }
+}
+
+// ============================================================================
+// Cross-process ping-pong round trip latency
+// ============================================================================
+
+std::string helper_command(const config& cfg, const std::string& name, bench::pingpong_mode mode) {
+#ifdef SLICK_SHM_WINDOWS
+    std::string exe = cfg.helper_dir + "bench_pong.exe";
+    // cmd.exe strips the outer quotes, so quote the whole command line
+    return "\"\"" + exe + "\" " + name + " " + bench::to_string(mode) + "\"";
+#else
+    std::string exe = cfg.helper_dir + "bench_pong";
+    return "\"" + exe + "\" " + name + " " + bench::to_string(mode);
+#endif
+}
+
+void bench_pingpong(const config& cfg, std::vector<bench::result>& results) {
+    const int warmup = cfg.quick ? 200 : 10000;
+    const int round_trips = cfg.quick ? 2000 : 100000;
+
+    for (bench::pingpong_mode mode :
+         {bench::pingpong_mode::spin, bench::pingpong_mode::hybrid, bench::pingpong_mode::block}) {
+        std::string name = bench::unique_name("bench_pp");
+        shared_memory shm(name.c_str(), sizeof(bench::pingpong_block), create_only);
+        auto* block = static_cast<bench::pingpong_block*>(shm.data());
+
+        int helper_result = -1;
+        std::string cmd = helper_command(cfg, name, mode);
+        std::thread helper([&cmd, &helper_result] { helper_result = std::system(cmd.c_str()); });
+
+        // Wait for the helper process to attach
+        auto deadline = bench::clock::now() + std::chrono::seconds(10);
+        while (block->ready.load(std::memory_order_acquire) == 0 &&
+               bench::clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        if (block->ready.load(std::memory_order_acquire) == 0) {
+            std::cerr << "  pingpong: helper did not start (" << cmd << ")" << std::endl;
+            block->ping.store(bench::PINGPONG_STOP, std::memory_order_release);
+            block->ping_event.notify_all();
+            helper.join();
+            shm.close();
+            shared_memory::remove(name.c_str());
+            continue;
+        }
+
+        bench::latency_recorder rtt;
+        rtt.reserve(static_cast<std::size_t>(round_trips));
+        std::uint64_t last = 0;
+        for (int i = 1; i <= warmup + round_trips; ++i) {
+            std::uint64_t t0 = bench::now_ns();
+            bench::signal(block->ping, block->ping_event, static_cast<std::uint64_t>(i), mode);
+            last = bench::wait_change(block->pong, block->pong_event, last, mode);
+            std::uint64_t t1 = bench::now_ns();
+            if (i > warmup) {
+                rtt.record(t1 - t0);
+            }
+        }
+
+        bench::signal(block->ping, block->ping_event, bench::PINGPONG_STOP, mode);
+        block->ping_event.notify_all();
+        helper.join();
+        shm.close();
+        shared_memory::remove(name.c_str());
+
+        bench::result r;
+        r.name = "pingpong_rtt";
+        r.param("mode", bench::to_string(mode));
+        r.metrics_from(rtt.summary());
+        r.metric("helper_exit_code", static_cast<double>(helper_result));
+        report(results, std::move(r));
+    }
+}
+
+// ============================================================================
+// Ring throughput (producer and consumer threads)
+// ============================================================================
+
+template <typename Producer, typename Consumer>
+double run_pair(Producer producer, Consumer consumer) {
+    std::uint64_t t0 = bench::now_ns();
+    std::thread p(producer);
+    consumer();
+    p.join();
+    return static_cast<double>(bench::now_ns() - t0);
+}
+
+void bench_rings(const config& cfg, std::vector<bench::result>& results) {
+    const std::uint64_t count = cfg.quick ? 1000000 : 20000000;
+    const std::size_t capacity = 65536;
+
+    {
+        std::string name = bench::unique_name("bench_spsc");
+        spsc_ring<std::uint64_t> producer(name.c_str(), capacity, create_only);
+        spsc_ring<std::uint64_t> consumer(name.c_str(), open_existing);
+        std::uint64_t checksum = 0;
+        double ns = run_pair(
+            [&] {
+                for (std::uint64_t i = 0; i < count; ++i) {
+                    while (!producer.try_push(i)) {
+                        std::this_thread::yield();
+                    }
+                }
+            },
+            [&] {
+                std::uint64_t value;
+                for (std::uint64_t i = 0; i < count; ++i) {
+                    while (!consumer.try_pop(value)) {
+                        std::this_thread::yield();
+                    }
+                    checksum += value;
+                }
+            });
+        shared_memory::remove(name.c_str());
+
+        bench::result r;
+        r.name = "spsc_ring_throughput";
+        r.param("element_size", static_cast<std::uint64_t>(sizeof(std::uint64_t)));
+        r.param("capacity", static_cast<std::uint64_t>(capacity)).param("batch", std::uint64_t(1));
+        r.metric("messages", static_cast<double>(count));
+        r.metric("msgs_per_sec", static_cast<double>(count) * 1e9 / ns);
+        r.metric("ns_per_msg", ns / static_cast<double>(count));
+        r.metric("checksum_ok", checksum == count * (count - 1) / 2 ? 1 : 0);
+        report(results, std::move(r));
+    }
+
+    {
+        constexpr std::size_t batch = 64;
+        std::string name = bench::unique_name("bench_spscb");
+        spsc_ring<std::uint64_t> producer(name.c_str(), capacity, create_only);
+        spsc_ring<std::uint64_t> consumer(name.c_str(), open_existing);
+        double ns = run_pair(
+            [&] {
+                std::uint64_t items[batch];
+                for (std::uint64_t i = 0; i < count;) {
+                    std::size_t n = static_cast<std::size_t>(std::min<std::uint64_t>(batch, count - i));
+                    for (std::size_t k = 0; k < n; ++k) {
+                        items[k] = i + k;
+                    }
+                    std::size_t pushed = 0;
+                    while (pushed < n) {
+                        std::size_t done = producer.try_push_n(items + pushed, n - pushed);
+                        if (done == 0) {
+                            std::this_thread::yield();
+                        }
+                        pushed += done;
+                    }
+                    i += n;
+                }
+            },
+            [&] {
+                std::uint64_t items[batch];
+                for (std::uint64_t received = 0; received < count;) {
+                    std::size_t n = consumer.try_pop_n(items, batch);
+                    if (n == 0) {
+                        std::this_thread::yield();
+                    }
+                    received += n;
+                }
+            });
+        shared_memory::remove(name.c_str());
+
+        bench::result r;
+        r.name = "spsc_ring_throughput";
+        r.param("element_size", static_cast<std::uint64_t>(sizeof(std::uint64_t)));
+        r.param("capacity", static_cast<std::uint64_t>(capacity))
+            .param("batch", static_cast<std::uint64_t>(batch));
+        r.metric("messages", static_cast<double>(count));
+        r.metric("msgs_per_sec", static_cast<double>(count) * 1e9 / ns);
+        r.metric("ns_per_msg", ns / static_cast<double>(count));
+        report(results, std::move(r));
+    }
+
+    {
+        std::string name = bench::unique_name("bench_bcast");
+        broadcast_ring<std::uint64_t> writer(name.c_str(), capacity, create_only);
+        broadcast_ring<std::uint64_t> reader(name.c_str(), open_existing);
+        std::atomic<bool> done{false};
+        std::uint64_t received = 0;
+        double ns = run_pair(
+            [&] {
+                for (std::uint64_t i = 0; i < count; ++i) {
+                    writer.publish(i);
+                }
+                done.store(true, std::memory_order_release);
+            },
+            [&] {
+                std::uint64_t value;
+                for (;;) {
+                    read_status status = reader.try_read(value);
+                    if (status == read_status::ok) {
+                        ++received;
+                    } else if (status == read_status::empty) {
+                        if (done.load(std::memory_order_acquire) &&
+                            reader.read_sequence() == reader.write_sequence()) {
+                            break;
+                        }
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        shared_memory::remove(name.c_str());
+
+        bench::result r;
+        r.name = "broadcast_ring_throughput";
+        r.param("element_size", static_cast<std::uint64_t>(sizeof(std::uint64_t)));
+        r.param("capacity", static_cast<std::uint64_t>(capacity)).param("readers", std::uint64_t(1));
+        r.metric("messages", static_cast<double>(count));
+        r.metric("msgs_per_sec", static_cast<double>(count) * 1e9 / ns);
+        r.metric("ns_per_msg", ns / static_cast<double>(count));
+        r.metric("received", static_cast<double>(received));
+        r.metric("lost", static_cast<double>(reader.lost()));
+        report(results, std::move(r));
+    }
+
+    for (std::size_t message_size : {std::size_t(64), std::size_t(1024)}) {
+        const std::uint64_t messages = message_size > 64 ? count / 8 : count;
+        std::string name = bench::unique_name("bench_msg");
+        message_ring producer(name.c_str(), 4 * 1024 * 1024, create_only);
+        message_ring consumer(name.c_str(), open_existing);
+        std::vector<unsigned char> payload(message_size, 0x5A);
+        double ns = run_pair(
+            [&] {
+                for (std::uint64_t i = 0; i < messages; ++i) {
+                    message_span span;
+                    while (!(span = producer.claim(message_size))) {
+                        std::this_thread::yield();
+                    }
+                    std::memcpy(span.data(), payload.data(), message_size);
+                    producer.commit(span);
+                }
+            },
+            [&] {
+                for (std::uint64_t i = 0; i < messages; ++i) {
+                    message_view view;
+                    while (!(view = consumer.read())) {
+                        std::this_thread::yield();
+                    }
+                    consumer.release();
+                }
+            });
+        shared_memory::remove(name.c_str());
+
+        bench::result r;
+        r.name = "message_ring_throughput";
+        r.param("message_size", static_cast<std::uint64_t>(message_size));
+        r.metric("messages", static_cast<double>(messages));
+        r.metric("msgs_per_sec", static_cast<double>(messages) * 1e9 / ns);
+        r.metric("mb_per_sec",
+                 static_cast<double>(messages * message_size) * 1e9 / ns / (1024.0 * 1024.0));
+        r.metric("ns_per_msg", ns / static_cast<double>(messages));
+        report(results, std::move(r));
+    }
+}
+
+// ============================================================================
+// Snapshot copies into and out of a segment: memcpy versus streaming copies
+// ============================================================================
+
+void bench_bulk_copy(const config& cfg, std::vector<bench::result>& results) {
+    std::vector<std::size_t> sizes = {1024 * 1024, 16 * 1024 * 1024};
+    if (!cfg.quick) {
+        sizes.push_back(64 * 1024 * 1024);
+    }
+    const int iterations = cfg.quick ? 5 : 20;
+
+    struct variant {
+        const char* label;
+        bool into_segment;
+        void (*copy)(void*, const void*, std::size_t);
+    };
+    const variant variants[] = {
+        {"memcpy_write", true, [](void* d, const void* s, std::size_t n) { std::memcpy(d, s, n); }},
+        {"stream_write", true, [](void* d, const void* s, std::size_t n) { stream_copy(d, s, n); }},
+        {"memcpy_read", false, [](void* d, const void* s, std::size_t n) { std::memcpy(d, s, n); }},
+        {"stream_read", false, [](void* d, const void* s, std::size_t n) { stream_read(d, s, n); }},
+    };
+
+    for (std::size_t size : sizes) {
+        std::string name = bench::unique_name("bench_bulk");
+        shared_memory shm(name.c_str(), size, create_only);
+        std::vector<unsigned char> local(size, 1);
+        std::memset(shm.data(), 2, size);
+
+        for (const variant& v : variants) {
+            bench::latency_recorder copy;
+            for (int i = 0; i < iterations; ++i) {
+                std::uint64_t t0 = bench::now_ns();
+                if (v.into_segment) {
+                    v.copy(shm.data(), local.data(), size);
+                } else {
+                    v.copy(local.data(), shm.data(), size);
+                }
+                copy.record(bench::now_ns() - t0);
+            }
+
+            double ns = copy.median();
+            bench::result r;
+            r.name = "bulk_copy";
+            r.param("variant", v.label).param("size", static_cast<std::uint64_t>(size));
+            r.param("isa", stream_copy_isa());
+            r.metric("copy_p50_ns", ns);
+            r.metric("bytes_per_sec", static_cast<double>(size) * 1e9 / ns);
+            report(results, std::move(r));
+        }
+
+        shm.close();
+        shared_memory::remove(name.c_str());
+    }
+}
+
+bool parse_args(int argc, char* argv[], config& cfg) {
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--quick") == 0) {
+            cfg.quick = true;
+        } else if (std::strcmp(argv[i], "--json") == 0 && i + 1 < argc) {
+            cfg.json_path = argv[++i];
+        } else if (std::strcmp(argv[i], "--filter") == 0 && i + 1 < argc) {
+            cfg.filter = argv[++i];
+        } else {
+            return false;
+        }
+    }
+
+    std::string self = argv[0];
+    std::size_t slash = self.find_last_of("/\\");
+    cfg.helper_dir = slash == std::string::npos ? std::string("./") : self.substr(0, slash + 1);
+    return true;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    config cfg;
+    if (!parse_args(argc, argv, cfg)) {
+        std::cerr << "Usage: slick_shm_bench [--quick] [--json <file>] [--filter <substring>]"
+                  << std::endl;
+        return 1;
+    }
+
+    struct suite {
+        const char* name;
+        void (*run)(const config&, std::vector<bench::result>&);
+    };
+    const suite suites[] = {
+        {"segment_lifecycle", bench_segment_lifecycle},
+        {"first_touch", bench_first_touch},
+        {"pingpong", bench_pingpong},
+        {"rings", bench_rings},
+        {"bulk_copy", bench_bulk_copy},
+    };
+
+    std::vector<bench::result> results;
+    try {
+        for (const suite& s : suites) {
+            if (!cfg.filter.empty() && std::string(s.name).find(cfg.filter) == std::string::npos) {
+                continue;
+            }
+            std::cerr << s.name << std::endl;
+            s.run(cfg, results);
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Benchmark error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    std::string json = bench::to_json(results, platform_name(), SLICK_SHM_VERSION);
+    if (cfg.json_path.empty()) {
+        std::cout << json;
+    } else {
+        std::ofstream out(cfg.json_path);
+        if (!out) {
+            std::cerr << "Cannot write " << cfg.json_path << std::endl;
+            return 1;
+        }
+        out << json;
+    }
+    return 0;
+}
@@ -1,4 +1,5 @@
 #include <slick/shm/shared_memory_view.hpp>
+#include <slick/shm/event.hpp>
 
 #include <iostream>
 #include <thread>
@@ -11,6 +12,7 @@
 struct shared_data {
     std::atomic<int> counter;
     std::atomic<bool> done;
+    slick::shm::shared_event updated;  // Valid as soon as the segment is zero-filled
     char message[256];
 };
 
@@ -20,17 +22,21 @@ void writer_thread(slick::shm::shared_memory_view view) {
     std::cout << "[Writer] Starting..." << std::endl;
 
     for (int i = 0; i < 10; ++i) {
-        data->counter.store(i, std::memory_order_release);
-
+        // Write the message first: a reader that sees the new counter (acquire)
+        // also sees everything written before the release store
         std::string msg = "Message " + std::to_string(i);
         std::snprintf(data->message, sizeof(data->message), "%s", msg.c_str());
 
+        data->counter.store(i, std::memory_order_release);
+        data->updated.notify_all();
+
         std::cout << "[Writer] Wrote: " << msg << std::endl;
 
         std::this_thread::sleep_for(std::chrono::milliseconds(200));
     }
 
     data->done.store(true, std::memory_order_release);
+    data->updated.notify_all();
     std::cout << "[Writer] Done." << std::endl;
 }
 
@@ -49,7 +55,11 @@ void reader_thread(slick::shm::shared_memory_view view) {
             last_count = current;
         }
 
-        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        // Sleep in the kernel until the writer publishes something new
+        data->updated.wait([&] {
+            return data->done.load(std::memory_order_acquire) ||
+                   data->counter.load(std::memory_order_acquire) != last_count;
+        });
     }
 
     std::cout << "[Reader] Done." << std::endl;
@@ -0,0 +1,545 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 Slick Quant
+
+#pragma once
+
+#include "offset_ptr.hpp"
+#include "shared_memory.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace slick {
+namespace shm {
+
+namespace detail {
+
+constexpr std::uint64_t ARENA_MAGIC = 0x616e657261736d73ULL;  // "smsarena"
+constexpr std::uint32_t ARENA_VERSION = 1;
+
+// Pooled size classes are the powers of two from 16 bytes to 1 MiB
+constexpr std::size_t ARENA_MIN_BLOCK_SHIFT = 4;
+constexpr std::size_t ARENA_SIZE_CLASSES = 17;
+constexpr std::size_t ARENA_MAX_POOLED_SIZE = std::size_t(1) << (ARENA_MIN_BLOCK_SHIFT + ARENA_SIZE_CLASSES - 1);
+constexpr std::size_t ARENA_MAX_BLOCK_ALIGNMENT = 4096;
+
+// Free list heads pack the block offset (in 16-byte units) with a counter that
+// changes on every update, so a pop racing with pop+push of the same block fails
+// its compare-and-swap instead of linking a stale next pointer (ABA)
+constexpr unsigned ARENA_OFFSET_BITS = 40;
+constexpr std::uint64_t ARENA_OFFSET_MASK = (std::uint64_t(1) << ARENA_OFFSET_BITS) - 1;
+constexpr std::uint64_t ARENA_MAX_SIZE = ARENA_OFFSET_MASK << ARENA_MIN_BLOCK_SHIFT;
+
+}  // namespace detail
+
+/**
+ * @brief Lock-free memory allocator living inside a shared memory region
+ *
+ * The arena object itself sits at the start of the region it manages, so every
+ * process that maps the region sees the same allocator state. Allocation carves
+ * blocks off the free end of the region with an atomic bump pointer. Sizes up
+ * to 1 MiB are rounded up to a power of two, and freed blocks go to a per-size
+ * free list that later allocations of that size reuse. Larger blocks are never
+ * reused: deallocate() ignores them, and their space comes back only when the
+ * segment is recreated.
+ *
+ * Addresses differ between processes, so store offset_ptr rather than raw
+ * pointers in the segment. Use arena_allocator<T> to put standard containers in
+ * the segment, and root() / set_root() to let other processes find them.
+ *
+ * @code
+ * // Creator
+ * shared_arena heap("orders", 64 * 1024 * 1024, create_only);
+ * using order_vector = std::vector<order, arena_allocator<order>>;
+ * auto* orders = heap->construct<order_vector>(arena_allocator<order>(*heap));
+ * orders->push_back(o);
+ * heap->set_root(orders);
+ *
+ * // Other process
+ * shared_arena heap("orders", open_existing);
+ * auto* orders = heap->root<order_vector>();
+ * @endcode
+ *
+ * Thread safety: allocate() and deallocate() may be called concurrently from any
+ * threads in any processes. Containers built on top need their own locking
+ * (for example an interprocess_mutex stored next to them).
+ *
+ * @note A container in the segment must only be used from processes built with
+ *       the same standard library, since its layout is implementation defined.
+ */
+class arena {
+public:
+    /**
+     * @brief Initialize a new arena at the start of memory
+     * @param memory Start of the region, aligned to a cache line (segment data always is)
+     * @param size Size of the region in bytes
+     * @return The arena, or nullptr if the region is misaligned or too small
+     * @note Call once, in the process that created the segment, before anyone
+     *       else attaches.
+     */
+    static arena* create(void* memory, std::size_t size) noexcept {
+        if (memory == nullptr || reinterpret_cast<std::uintptr_t>(memory) % alignof(arena) != 0 ||
+            size < heap_offset() || size > detail::ARENA_MAX_SIZE) {
+            return nullptr;
+        }
+        arena* a = new (memory) arena();
+        a->size_ = size;
+        a->top_.store(heap_offset(), std::memory_order_relaxed);
+        a->magic_.store(detail::ARENA_MAGIC, std::memory_order_release);
+        return a;
+    }
+
+    /**
+     * @brief Attach to an arena created by another process (or mapping)
+     * @param memory Start of the region
+     * @param size Size of the region as mapped by this process
+     * @return The arena, or nullptr if the region doesn't hold a compatible arena
+     */
+    static arena* attach(void* memory, std::size_t size) noexcept {
+        if (memory == nullptr || reinterpret_cast<std::uintptr_t>(memory) % alignof(arena) != 0 ||
+            size < sizeof(arena)) {
+            return nullptr;
+        }
+        auto* a = static_cast<arena*>(memory);
+        if (a->magic_.load(std::memory_order_acquire) != detail::ARENA_MAGIC ||
+            a->version_ != detail::ARENA_VERSION || a->size_ > size) {
+            return nullptr;
+        }
+        return a;
+    }
+
+    /**
+     * @brief Segment size needed to hold at least usable_bytes of allocations
+     */
+    static constexpr std::size_t required_size(std::size_t usable_bytes) noexcept {
+        return heap_offset() + usable_bytes;
+    }
+
+    arena(const arena&) = delete;
+    arena& operator=(const arena&) = delete;
+
+    /**
+     * @brief Allocate a block
+     * @param bytes Requested size
+     * @param alignment Requested alignment (a power of two)
+     * @return The block, or nullptr if the arena is exhausted or alignment is invalid
+     */
+    void* allocate(std::size_t bytes, std::size_t alignment = alignof(std::max_align_t)) noexcept {
+        if (alignment == 0 || (alignment & (alignment - 1)) != 0) {
+            return nullptr;
+        }
+        std::size_t cls = size_class(bytes, alignment);
+        if (cls >= detail::ARENA_SIZE_CLASSES) {
+            return bump(bytes == 0 ? 1 : bytes, alignment);
+        }
+
+        std::uint64_t offset = pop(cls);
+        if (offset != 0) {
+            return base() + offset;
+        }
+        std::size_t block = class_size(cls);
+        return bump(block, block < detail::ARENA_MAX_BLOCK_ALIGNMENT
+                               ? block
+                               : detail::ARENA_MAX_BLOCK_ALIGNMENT);
+    }
+
+    /**
+     * @brief Return a block to the arena
+     * @param ptr Block from allocate() (nullptr is ignored)
+     * @param bytes Size passed to allocate()
+     * @param alignment Alignment passed to allocate()
+     */
+    void deallocate(void* ptr, std::size_t bytes,
+                    std::size_t alignment = alignof(std::max_align_t)) noexcept {
+        if (ptr == nullptr) {
+            return;
+        }
+        std::size_t cls = size_class(bytes, alignment);
+        if (cls < detail::ARENA_SIZE_CLASSES) {
+            push(cls, static_cast<std::uint64_t>(static_cast<char*>(ptr) - base()));
+        }
+    }
+
+    /**
+     * @brief Allocate and construct a T
+     * @return The object, or nullptr if the arena is exhausted
+     */
+    template <typename T, typename... Args>
+    T* construct(Args&&... args) {
+        void* memory = allocate(sizeof(T), alignof(T));
+        if (memory == nullptr) {
+            return nullptr;
+        }
+        try {
+            return new (memory) T(std::forward<Args>(args)...);
+        } catch (...) {
+            deallocate(memory, sizeof(T), alignof(T));
+            throw;
+        }
+    }
+
+    /**
+     * @brief Destroy and deallocate an object from construct()
+     */
+    template <typename T>
+    void destroy(T* object) noexcept {
+        if (object != nullptr) {
+            object->~T();
+            deallocate(object, sizeof(T), alignof(T));
+        }
+    }
+
+    /**
+     * @brief Publish the entry point of the data in the arena (nullptr clears it)
+     */
+    void set_root(const void* object) noexcept {
+        std::uint64_t offset = object ? static_cast<std::uint64_t>(
+                                            static_cast<const char*>(object) - base())
+                                      : 0;
+        root_.store(offset, std::memory_order_release);
+    }
+
+    /**
+     * @brief The object passed to set_root(), or nullptr if none
+     */
+    template <typename T = void>
+    T* root() const noexcept {
+        std::uint64_t offset = root_.load(std::memory_order_acquire);
+        return offset ? reinterpret_cast<T*>(base() + offset) : nullptr;
+    }
+
+    /**
+     * @brief Size of the managed region, including the arena header
+     */
+    std::size_t capacity() const noexcept {
+        return static_cast<std::size_t>(size_);
+    }
+
+    /**
+     * @brief Bytes never handed out yet (blocks on the free lists are not counted)
+     */
+    std::size_t available() const noexcept {
+        return static_cast<std::size_t>(size_ - top_.load(std::memory_order_relaxed));
+    }
+
+private:
+    std::atomic<std::uint64_t> magic_{0};  // Published last by create()
+    std::uint32_t version_ = detail::ARENA_VERSION;
+    std::uint32_t reserved_ = 0;
+    std::uint64_t size_ = 0;
+    std::atomic<std::uint64_t> root_{0};  // Offset of the root object, 0 if none
+
+    alignas(detail::cache_line_size) std::atomic<std::uint64_t> top_{0};  // Bump pointer
+    alignas(detail::cache_line_size) std::atomic<std::uint64_t>
+        free_lists_[detail::ARENA_SIZE_CLASSES] = {};
+
+    arena() noexcept = default;
+
+    static_assert(std::atomic<std::uint64_t>::is_always_lock_free,
+                  "arena requires lock-free 64-bit atomics for cross-process use");
+
+    static constexpr std::size_t heap_offset() noexcept {
+        return detail::align_up(sizeof(arena), detail::cache_line_size);
+    }
+
+    char* base() const noexcept {
+        return reinterpret_cast<char*>(const_cast<arena*>(this));
+    }
+
+    static constexpr std::size_t class_size(std::size_t cls) noexcept {
+        return std::size_t(1) << (cls + detail::ARENA_MIN_BLOCK_SHIFT);
+    }
+
+    // Index of the smallest class that fits, ARENA_SIZE_CLASSES if none does
+    static std::size_t size_class(std::size_t bytes, std::size_t alignment) noexcept {
+        if (bytes > detail::ARENA_MAX_POOLED_SIZE ||
+            alignment > detail::ARENA_MAX_BLOCK_ALIGNMENT) {
+            return detail::ARENA_SIZE_CLASSES;
+        }
+        std::size_t need = bytes > alignment ? bytes : alignment;
+        std::size_t cls = 0;
+        while (class_size(cls) < need) {
+            ++cls;
+        }
+        return cls;
+    }
+
+    void* bump(std::size_t bytes, std::size_t alignment) noexcept {
+        std::uint64_t top = top_.load(std::memory_order_relaxed);
+        for (;;) {
+            std::uint64_t start = detail::align_up(static_cast<std::size_t>(top), alignment);
+            if (start > size_ || bytes > size_ - start) {
+                return nullptr;
+            }
+            if (top_.compare_exchange_weak(top, start + bytes, std::memory_order_relaxed)) {
+                return base() + start;
+            }
+        }
+    }
+
+    // A free block's first 8 bytes hold the offset of the next free block
+    std::atomic<std::uint64_t>& next_of(std::uint64_t offset) noexcept {
+        return *reinterpret_cast<std::atomic<std::uint64_t>*>(base() + offset);
+    }
+
+    static std::uint64_t pack(std::uint64_t head, std::uint64_t offset) noexcept {
+        std::uint64_t counter = (head >> detail::ARENA_OFFSET_BITS) + 1;
+        return (counter << detail::ARENA_OFFSET_BITS) | (offset >> detail::ARENA_MIN_BLOCK_SHIFT);
+    }
+
+    static std::uint64_t unpack(std::uint64_t head) noexcept {
+        return (head & detail::ARENA_OFFSET_MASK) << detail::ARENA_MIN_BLOCK_SHIFT;
+    }
+
+    std::uint64_t pop(std::size_t cls) noexcept {
+        std::atomic<std::uint64_t>& list = free_lists_[cls];
+        std::uint64_t head = list.load(std::memory_order_acquire);
+        for (;;) {
+            std::uint64_t offset = unpack(head);
+            if (offset == 0) {
+                return 0;
+            }
+            // May read a block that was just popped and reused elsewhere; the
+            // counter in head makes the exchange below fail in that case
+            std::uint64_t next = next_of(offset).load(std::memory_order_relaxed);
+            if (list.compare_exchange_weak(head, pack(head, next), std::memory_order_acquire,
+                                           std::memory_order_acquire)) {
+                return offset;
+            }
+        }
+    }
+
+    void push(std::size_t cls, std::uint64_t offset) noexcept {
+        std::atomic<std::uint64_t>& list = free_lists_[cls];
+        std::uint64_t head = list.load(std::memory_order_relaxed);
+        do {
+            next_of(offset).store(unpack(head), std::memory_order_relaxed);
+        } while (!list.compare_exchange_weak(head, pack(head, offset), std::memory_order_release,
+                                             std::memory_order_relaxed));
+    }
+};
+
+/**
+ * @brief std::allocator-compatible adapter that allocates from an arena
+ *
+ * Uses offset_ptr<T> as its pointer type and refers to the arena through an
+ * offset_ptr, so a container (and the allocator inside it) may itself live in the
+ * segment and be used from every process that maps it.
+ *
+ * @code
+ * using shm_vector = std::vector<int, arena_allocator<int>>;
+ * auto* v = heap->construct<shm_vector>(arena_allocator<int>(*heap));
+ * @endcode
+ *
+ * @throws std::bad_alloc from allocate() when the arena is exhausted
+ */
+template <typename T>
+class arena_allocator {
+public:
+    using value_type = T;
+    using pointer = offset_ptr<T>;
+    using const_pointer = offset_ptr<const T>;
+    using void_pointer = offset_ptr<void>;
+    using const_void_pointer = offset_ptr<const void>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    template <typename U>
+    struct rebind {
+        using other = arena_allocator<U>;
+    };
+
+    explicit arena_allocator(arena& a) noexcept : arena_(&a) {}
+
+    template <typename U>
+    arena_allocator(const arena_allocator<U>& other) noexcept : arena_(other.get_arena()) {}
+
+    pointer allocate(size_type n) {
+        if (n > std::numeric_limits<size_type>::max() / sizeof(T)) {
+            throw std::bad_array_new_length();
+        }
+        void* memory = arena_->allocate(n * sizeof(T), alignof(T));
+        if (memory == nullptr) {
+            throw std::bad_alloc();
+        }
+        return pointer(static_cast<T*>(memory));
+    }
+
+    void deallocate(pointer p, size_type n) noexcept {
+        arena_->deallocate(p.get(), n * sizeof(T), alignof(T));
+    }
+
+    arena* get_arena() const noexcept {
+        return arena_.get();
+    }
+
+    template <typename U>
+    friend bool operator==(const arena_allocator& a, const arena_allocator<U>& b) noexcept {
+        return a.get_arena() == b.get_arena();
+    }
+
+    template <typename U>
+    friend bool operator!=(const arena_allocator& a, const arena_allocator<U>& b) noexcept {
+        return a.get_arena() != b.get_arena();
+    }
+
+private:
+    offset_ptr<arena> arena_;
+};
+
+/**
+ * @brief Named segment holding an arena
+ *
+ * One process creates it with create_only, others attach with open_existing.
+ * Access the allocator with get() or operator->.
+ */
+class shared_arena {
+public:
+    /**
+     * @brief Default constructor - creates an invalid shared_arena
+     */
+    shared_arena() = default;
+
+    /**
+     * @brief Create a new segment and initialize an arena in it
+     * @param name Name of the shared memory segment
+     * @param size Segment size in bytes (including the arena header)
+     * @param tag create_only tag
+     * @param options Segment options (huge pages, prefault, lock, ...)
+     * @throws shared_memory_error if creation fails
+     */
+    shared_arena(const char* name, std::size_t size, create_only_t tag,
+                 const segment_options& options = segment_options()) {
+        (void)tag;
+        last_error_ = create_impl(name, size, options);
+        if (last_error_) {
+            throw shared_memory_error(last_error_);
+        }
+    }
+
+    /**
+     * @brief Attach to an existing arena
+     * @param name Name of the shared memory segment
+     * @param tag open_existing tag
+     * @param options Segment options (mapping related options only)
+     * @throws shared_memory_error if the segment doesn't exist or holds no arena
+     */
+    shared_arena(const char* name, open_existing_t tag,
+                 const segment_options& options = segment_options()) {
+        (void)tag;
+        last_error_ = open_impl(name, options);
+        if (last_error_) {
+            throw shared_memory_error(last_error_);
+        }
+    }
+
+    /**
+     * @brief Create a new arena - no-throw version
+     * @note Check is_valid() and last_error() after construction
+     */
+    shared_arena(const char* name, std::size_t size, create_only_t tag,
+                 const segment_options& options, const std::nothrow_t& nt) noexcept {
+        (void)tag;
+        (void)nt;
+        last_error_ = create_impl(name, size, options);
+    }
+
+    /**
+     * @brief Attach to an existing arena - no-throw version
+     * @note Check is_valid() and last_error() after construction
+     */
+    shared_arena(const char* name, open_existing_t tag, const segment_options& options,
+                 const std::nothrow_t& nt) noexcept {
+        (void)tag;
+        (void)nt;
+        last_error_ = open_impl(name, options);
+    }
+
+    shared_arena(const shared_arena&) = delete;
+    shared_arena& operator=(const shared_arena&) = delete;
+
+    shared_arena(shared_arena&& other) noexcept {
+        *this = std::move(other);
+    }
+
+    shared_arena& operator=(shared_arena&& other) noexcept {
+        if (this != &other) {
+            shm_ = std::move(other.shm_);
+            arena_ = other.arena_;
+            last_error_ = other.last_error_;
+            other.arena_ = nullptr;
+        }
+        return *this;
+    }
+
+    arena& get() const noexcept {
+        return *arena_;
+    }
+
+    arena* operator->() const noexcept {
+        return arena_;
+    }
+
+    arena& operator*() const noexcept {
+        return *arena_;
+    }
+
+    bool is_valid() const noexcept {
+        return arena_ != nullptr;
+    }
+
+    std::error_code last_error() const noexcept {
+        return last_error_;
+    }
+
+    /**
+     * @brief The underlying shared memory segment
+     */
+    const shared_memory& segment() const noexcept {
+        return shm_;
+    }
+
+private:
+    shared_memory shm_;
+    arena* arena_ = nullptr;
+    std::error_code last_error_;
+
+    std::error_code create_impl(const char* name, std::size_t size,
+                                const segment_options& options) {
+        if (size < arena::required_size(0) || size > detail::ARENA_MAX_SIZE) {
+            return make_error_code(errc::invalid_size);
+        }
+        shared_memory shm(name, size, create_only, access_mode::read_write, options,
+                          std::nothrow);
+        if (!shm.is_valid()) {
+            return shm.last_error();
+        }
+        arena_ = arena::create(shm.data(), shm.size());
+        if (arena_ == nullptr) {
+            return make_error_code(errc::invalid_size);
+        }
+        shm_ = std::move(shm);
+        return {};
+    }
+
+    std::error_code open_impl(const char* name, const segment_options& options) {
+        shared_memory shm(name, open_existing, access_mode::read_write, options, std::nothrow);
+        if (!shm.is_valid()) {
+            return shm.last_error();
+        }
+        arena_ = arena::attach(shm.data(), shm.size());
+        if (arena_ == nullptr) {
+            return make_error_code(errc::incompatible_layout);
+        }
+        shm_ = std::move(shm);
+        return {};
+    }
+};
+
+}  // namespace shm
+}  // namespace slick
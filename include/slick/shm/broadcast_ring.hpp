@@ -0,0 +1,417 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 Slick Quant
+
+#pragma once
+
+#include "shared_memory.hpp"
+#include "stats.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <type_traits>
+
+namespace slick {
+namespace shm {
+
+namespace detail {
+
+// In-segment control block of a broadcast_ring
+struct broadcast_ring_header {
+    std::atomic<std::uint64_t> magic;  // Published last by the creator
+    std::uint32_t version;
+    std::uint32_t element_size;
+    std::uint64_t capacity;            // Power of two
+
+    alignas(cache_line_size) std::atomic<std::uint64_t> write_seq;  // Next sequence to publish
+
+    stats_block stats;  // See stats.hpp; readers count only with a read_write mapping
+};
+
+// Each slot is a tiny seqlock: seq is odd while the writer copies data in and
+// 2 * (sequence + 1) once the message with that sequence is complete
+template <typename T>
+struct broadcast_slot {
+    std::atomic<std::uint64_t> seq;
+    T data;
+};
+
+constexpr std::uint64_t BROADCAST_RING_MAGIC = 0x7473616364616f72ULL;  // "roadcast"
+constexpr std::uint32_t BROADCAST_RING_VERSION = 1;
+
+}  // namespace detail
+
+// Result of broadcast_ring::try_read()
+enum class read_status {
+    ok,      // A message was read
+    empty,   // No new message yet
+    lapped   // The writer overwrote unread messages; the reader was moved forward
+};
+
+/**
+ * @brief Single-writer, multi-reader broadcast queue living in a named segment
+ *
+ * The writer publishes into a power-of-two array of seqlocked slots and never
+ * waits for readers. Every reader keeps its own process-local cursor, so any number
+ * of readers can consume the stream at their own pace. A reader that falls more
+ * than capacity() messages behind detects it from the slot sequence numbers
+ * (read_status::lapped), is moved to the oldest message still available and can
+ * see how many messages it lost via lost().
+ *
+ * Readers never write to the segment, so they can (and by default do) attach with
+ * access_mode::read_only, which guarantees that consumers can't corrupt the stream.
+ *
+ * Thread safety: one publishing thread at a time. Each reader object must be used
+ * by one thread at a time; create one object per consuming thread.
+ */
+template <typename T>
+class broadcast_ring {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "broadcast_ring elements must be trivially copyable");
+
+public:
+    using value_type = T;
+
+    /**
+     * @brief Default constructor - creates an invalid ring
+     */
+    broadcast_ring() = default;
+
+    /**
+     * @brief Create a new ring (writer side)
+     * @param name Name of the shared memory segment
+     * @param capacity Number of slots (rounded up to a power of two)
+     * @param tag create_only tag
+     * @param options Segment options (huge pages, prefault, lock, ...)
+     * @throws shared_memory_error if creation fails
+     */
+    broadcast_ring(const char* name, std::size_t capacity, create_only_t tag,
+                   const segment_options& options = segment_options()) {
+        (void)tag;
+        last_error_ = create_impl(name, capacity, options);
+        if (last_error_) {
+            throw shared_memory_error(last_error_);
+        }
+    }
+
+    /**
+     * @brief Attach to an existing ring (reader side)
+     * @param name Name of the shared memory segment
+     * @param tag open_existing tag
+     * @param mode Access mode (default: read_only)
+     * @param options Segment options (mapping related options only)
+     * @throws shared_memory_error if the segment doesn't exist or is not a ring of T
+     * @note The reader starts at the next message to be published.
+     */
+    broadcast_ring(const char* name, open_existing_t tag,
+                   access_mode mode = access_mode::read_only,
+                   const segment_options& options = segment_options()) {
+        (void)tag;
+        last_error_ = open_impl(name, mode, options);
+        if (last_error_) {
+            throw shared_memory_error(last_error_);
+        }
+    }
+
+    /**
+     * @brief Create a new ring - no-throw version
+     * @note Check is_valid() and last_error() after construction
+     */
+    broadcast_ring(const char* name, std::size_t capacity, create_only_t tag,
+                   const segment_options& options, const std::nothrow_t& nt) noexcept {
+        (void)tag;
+        (void)nt;
+        last_error_ = create_impl(name, capacity, options);
+    }
+
+    /**
+     * @brief Attach to an existing ring - no-throw version
+     * @note Check is_valid() and last_error() after construction
+     */
+    broadcast_ring(const char* name, open_existing_t tag, access_mode mode,
+                   const segment_options& options, const std::nothrow_t& nt) noexcept {
+        (void)tag;
+        (void)nt;
+        last_error_ = open_impl(name, mode, options);
+    }
+
+    broadcast_ring(const broadcast_ring&) = delete;
+    broadcast_ring& operator=(const broadcast_ring&) = delete;
+
+    broadcast_ring(broadcast_ring&& other) noexcept {
+        *this = std::move(other);
+    }
+
+    ~broadcast_ring() {
+        count_detach();
+    }
+
+    broadcast_ring& operator=(broadcast_ring&& other) noexcept {
+        if (this != &other) {
+            count_detach();
+            shm_ = std::move(other.shm_);
+            header_ = other.header_;
+            slots_ = other.slots_;
+            capacity_ = other.capacity_;
+            mask_ = other.mask_;
+            cursor_ = other.cursor_;
+            lost_ = other.lost_;
+            last_error_ = other.last_error_;
+
+            other.header_ = nullptr;
+            other.slots_ = nullptr;
+            other.capacity_ = 0;
+            other.mask_ = 0;
+        }
+        return *this;
+    }
+
+    // ========================================================================
+    // Writer side
+    // ========================================================================
+
+    /**
+     * @brief Publish a message, overwriting the oldest one if the ring is full
+     * @return Sequence number of the published message
+     * @note Requires a read_write mapping (the creator, or a read_write opener
+     *       taking over as the single writer).
+     */
+    std::uint64_t publish(const T& item) noexcept {
+        std::uint64_t seq = header_->write_seq.load(std::memory_order_relaxed);
+        detail::broadcast_slot<T>& slot = slots_[seq & mask_];
+
+        slot.seq.store(2 * seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        std::memcpy(&slot.data, &item, sizeof(T));
+        slot.seq.store(2 * seq + 2, std::memory_order_release);
+
+        header_->write_seq.store(seq + 1, std::memory_order_release);
+        detail::stat_add(header_->stats.enqueues);
+        return seq;
+    }
+
+    // ========================================================================
+    // Reader side
+    // ========================================================================
+
+    /**
+     * @brief Read the next message
+     * @param[out] item Receives the message when read_status::ok is returned
+     * @return ok, empty (nothing new) or lapped (messages were lost, see lost();
+     *         the cursor now points at the oldest message still available)
+     */
+    read_status try_read(T& item) noexcept {
+        const detail::broadcast_slot<T>& slot = slots_[cursor_ & mask_];
+        const std::uint64_t expected = 2 * cursor_ + 2;
+
+        std::uint64_t before = slot.seq.load(std::memory_order_acquire);
+        if (before < expected) {
+            if (counts_stats()) {
+                detail::stat_add_shared(header_->stats.empty_events);
+            }
+            return read_status::empty;  // Not published yet (or being written)
+        }
+        if (before == expected) {
+            std::memcpy(&item, &slot.data, sizeof(T));
+            std::atomic_thread_fence(std::memory_order_acquire);
+            std::uint64_t after = slot.seq.load(std::memory_order_relaxed);
+            if (after == before) {
+                ++cursor_;
+                if (counts_stats()) {
+                    count_read();
+                }
+                return read_status::ok;
+            }
+        }
+
+        // The slot already holds (or is being overwritten with) a newer message
+        resync();
+        return read_status::lapped;
+    }
+
+    /**
+     * @brief Skip all pending messages and continue with the next one published
+     */
+    void seek_latest() noexcept {
+        cursor_ = header_->write_seq.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Sequence number of the next message this reader will read
+     */
+    std::uint64_t read_sequence() const noexcept {
+        return cursor_;
+    }
+
+    /**
+     * @brief Sequence number the writer will publish next
+     */
+    std::uint64_t write_sequence() const noexcept {
+        return header_->write_seq.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Total number of messages this reader lost by being lapped
+     */
+    std::uint64_t lost() const noexcept {
+        return lost_;
+    }
+
+    // ========================================================================
+    // Accessors
+    // ========================================================================
+
+    /**
+     * @brief Counters of the ring (see stats.hpp)
+     * @note Only readers with a read_write mapping count dequeues, empty reads
+     *       and their lag; read_only readers leave the segment untouched.
+     */
+    segment_stats stats_snapshot() const noexcept {
+        return header_ ? detail::load_stats(header_->stats) : segment_stats();
+    }
+
+    std::size_t capacity() const noexcept {
+        return capacity_;
+    }
+
+    bool is_valid() const noexcept {
+        return header_ != nullptr;
+    }
+
+    std::error_code last_error() const noexcept {
+        return last_error_;
+    }
+
+    const shared_memory& segment() const noexcept {
+        return shm_;
+    }
+
+    /**
+     * @brief Segment size needed for a ring of the given capacity
+     */
+    static std::size_t required_size(std::size_t capacity) noexcept {
+        return slots_offset() + detail::round_up_pow2(capacity) * sizeof(slot_type);
+    }
+
+private:
+    using slot_type = detail::broadcast_slot<T>;
+
+    shared_memory shm_;
+    detail::broadcast_ring_header* header_ = nullptr;
+    slot_type* slots_ = nullptr;
+    std::size_t capacity_ = 0;
+    std::size_t mask_ = 0;
+    std::uint64_t cursor_ = 0;  // Process-local read position
+    std::uint64_t lost_ = 0;
+    std::error_code last_error_;
+
+    static constexpr std::size_t slots_offset() noexcept {
+        return detail::align_up(sizeof(detail::broadcast_ring_header),
+                                alignof(slot_type) > detail::cache_line_size
+                                    ? alignof(slot_type)
+                                    : detail::cache_line_size);
+    }
+
+    bool counts_stats() const noexcept {
+        return stats_enabled && shm_.mode() == access_mode::read_write;
+    }
+
+    void count_read() noexcept {
+        detail::stat_add_shared(header_->stats.dequeues);
+        std::uint64_t write_seq = header_->write_seq.load(std::memory_order_relaxed);
+        detail::stat_max_shared(header_->stats.max_consumer_lag, write_seq - cursor_ + 1);
+    }
+
+    void count_detach() noexcept {
+        if (header_ != nullptr && shm_.mode() == access_mode::read_write) {
+            detail::stat_add_shared(header_->stats.detaches);
+        }
+    }
+
+    // Move to the oldest message that can't be overwritten before the writer
+    // publishes capacity() more messages
+    void resync() noexcept {
+        std::uint64_t write_seq = header_->write_seq.load(std::memory_order_acquire);
+        std::uint64_t oldest = write_seq > capacity_ ? write_seq - capacity_ + 1 : 0;
+        if (oldest > cursor_) {
+            lost_ += oldest - cursor_;
+            cursor_ = oldest;
+        }
+    }
+
+    std::error_code create_impl(const char* name, std::size_t capacity,
+                                const segment_options& options) {
+        if (capacity == 0) {
+            return make_error_code(errc::invalid_size);
+        }
+        capacity = detail::round_up_pow2(capacity);
+        if (capacity == 0 ||
+            capacity > (std::numeric_limits<std::size_t>::max() - slots_offset()) / sizeof(slot_type)) {
+            return make_error_code(errc::invalid_size);
+        }
+
+        shared_memory shm(name, required_size(capacity), create_only, access_mode::read_write,
+                          options, std::nothrow);
+        if (!shm.is_valid()) {
+            return shm.last_error();
+        }
+
+        // The segment is zero-filled, so all slot sequences start at 0 (empty)
+        auto* header = static_cast<detail::broadcast_ring_header*>(shm.data());
+        header->version = detail::BROADCAST_RING_VERSION;
+        header->element_size = static_cast<std::uint32_t>(sizeof(T));
+        header->capacity = capacity;
+        header->write_seq.store(0, std::memory_order_relaxed);
+        header->magic.store(detail::BROADCAST_RING_MAGIC, std::memory_order_release);
+
+        attach(std::move(shm), capacity);
+        return {};
+    }
+
+    std::error_code open_impl(const char* name, access_mode mode,
+                              const segment_options& options) {
+        shared_memory shm(name, open_existing, mode, options, std::nothrow);
+        if (!shm.is_valid()) {
+            return shm.last_error();
+        }
+
+        if (shm.size() < sizeof(detail::broadcast_ring_header)) {
+            return make_error_code(errc::incompatible_layout);
+        }
+        auto* header = static_cast<const detail::broadcast_ring_header*>(shm.data());
+        if (header->magic.load(std::memory_order_acquire) != detail::BROADCAST_RING_MAGIC ||
+            header->version != detail::BROADCAST_RING_VERSION ||
+            header->element_size != sizeof(T)) {
+            return make_error_code(errc::incompatible_layout);
+        }
+        std::size_t capacity = static_cast<std::size_t>(header->capacity);
+        if (capacity == 0 || (capacity & (capacity - 1)) != 0 ||
+            shm.size() < required_size(capacity)) {
+            return make_error_code(errc::incompatible_layout);
+        }
+
+        attach(std::move(shm), capacity);
+        return {};
+    }
+
+    void attach(shared_memory&& shm, std::size_t capacity) {
+        shm_ = std::move(shm);
+        // Readers only ever load through these pointers, which is fine on a
+        // read-only mapping
+        header_ = static_cast<detail::broadcast_ring_header*>(const_cast<void*>(
+            static_cast<const shared_memory&>(shm_).data()));
+        slots_ = reinterpret_cast<slot_type*>(reinterpret_cast<char*>(header_) + slots_offset());
+        capacity_ = capacity;
+        mask_ = capacity - 1;
+        cursor_ = header_->write_seq.load(std::memory_order_acquire);
+        lost_ = 0;
+        if (shm_.mode() == access_mode::read_write) {
+            detail::stat_add_shared(header_->stats.attaches);
+        }
+    }
+};
+
+}  // namespace shm
+}  // namespace slick
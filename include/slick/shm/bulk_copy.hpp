@@ -0,0 +1,331 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 Slick Quant
+
+#pragma once
+
+#include "shared_memory.hpp"
+#include "shared_memory_view.hpp"
+#include "detail/platform.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <system_error>
+
+#if defined(__x86_64__) || defined(_M_X64)
+    #define SLICK_SHM_BULK_X86
+    #include <immintrin.h>
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #include <intrin.h>
+        #define SLICK_SHM_TARGET(isa)
+    #else
+        #define SLICK_SHM_TARGET(isa) __attribute__((target(isa)))
+    #endif
+#elif defined(__aarch64__) && (defined(__GNUC__) || defined(__clang__))
+    #define SLICK_SHM_BULK_ARM64
+    #include <arm_neon.h>
+#endif
+
+namespace slick {
+namespace shm {
+
+/**
+ * Bulk copies into and out of segments that bypass or spare the caller's caches.
+ *
+ * stream_copy() writes with non-temporal stores (MOVNTDQ / VMOVNTDQ on x86,
+ * STNP on AArch64): the destination lines go to memory without being read
+ * into the cache first, so publishing a large snapshot doesn't evict the
+ * writer's working set. It ends with a store fence, so a release store that
+ * publishes the data afterwards orders after the copied bytes.
+ *
+ * stream_read() copies out of a segment with non-temporal prefetches of the
+ * source, so data that is read once doesn't displace the reader's L2 / L3.
+ *
+ * The widest instruction set the CPU supports is picked at run time (AVX-512F,
+ * AVX or SSE2 on x86-64; NEON on AArch64), so the library needs no -march
+ * flags. Other targets fall back to std::memcpy.
+ *
+ * @note Non-temporal stores pay off for copies well beyond the L2 size (a
+ *       MiB or more). Small copies are faster with std::memcpy, and the
+ *       destination should not be read again right after the copy.
+ */
+
+namespace detail {
+
+// Bytes a streaming store loop handles per iteration (one cache line), and the
+// chunk stream_read() copies while prefetching the next one
+constexpr std::size_t BULK_BLOCK = 64;
+constexpr std::size_t BULK_READ_CHUNK = 1024;
+
+using bulk_copy_fn = void (*)(unsigned char*, const unsigned char*, std::size_t);
+
+struct bulk_copy_impl {
+    bulk_copy_fn stream;  // dst aligned to BULK_BLOCK, n a multiple of BULK_BLOCK
+    const char* name;
+};
+
+#if defined(SLICK_SHM_BULK_X86)
+
+SLICK_SHM_TARGET("avx512f")
+inline void stream_avx512(unsigned char* dst, const unsigned char* src, std::size_t n) {
+    for (std::size_t i = 0; i < n; i += 64) {
+        __m512i a = _mm512_loadu_si512(reinterpret_cast<const void*>(src + i));
+        _mm512_stream_si512(reinterpret_cast<__m512i*>(dst + i), a);
+    }
+}
+
+SLICK_SHM_TARGET("avx")
+inline void stream_avx(unsigned char* dst, const unsigned char* src, std::size_t n) {
+    for (std::size_t i = 0; i < n; i += 64) {
+        __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i + 32));
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(dst + i), a);
+        _mm256_stream_si256(reinterpret_cast<__m256i*>(dst + i + 32), b);
+    }
+}
+
+inline void stream_sse2(unsigned char* dst, const unsigned char* src, std::size_t n) {
+    for (std::size_t i = 0; i < n; i += 64) {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 16));
+        __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 32));
+        __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 48));
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dst + i), a);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dst + i + 16), b);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dst + i + 32), c);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dst + i + 48), d);
+    }
+}
+
+inline bool cpu_has_avx512f() noexcept {
+#if defined(_MSC_VER) && !defined(__clang__)
+    int regs[4];
+    __cpuid(regs, 0);
+    if (regs[0] < 7) {
+        return false;
+    }
+    __cpuid(regs, 1);
+    if ((regs[2] & (1 << 27)) == 0) {  // OSXSAVE
+        return false;
+    }
+    // The OS saves the opmask and upper ZMM state
+    if ((_xgetbv(0) & 0xe6) != 0xe6) {
+        return false;
+    }
+    __cpuidex(regs, 7, 0);
+    return (regs[1] & (1 << 16)) != 0;
+#else
+    return __builtin_cpu_supports("avx512f");
+#endif
+}
+
+inline bool cpu_has_avx() noexcept {
+#if defined(_MSC_VER) && !defined(__clang__)
+    int regs[4];
+    __cpuid(regs, 1);
+    bool avx = (regs[2] & (1 << 28)) != 0;
+    bool osxsave = (regs[2] & (1 << 27)) != 0;
+    return avx && osxsave && (_xgetbv(0) & 0x6) == 0x6;  // The OS saves YMM state
+#else
+    return __builtin_cpu_supports("avx");
+#endif
+}
+
+inline bulk_copy_impl select_bulk_copy() noexcept {
+#if !defined(_MSC_VER) || defined(__clang__)
+    __builtin_cpu_init();
+#endif
+    if (cpu_has_avx512f()) {
+        return {stream_avx512, "avx512"};
+    }
+    if (cpu_has_avx()) {
+        return {stream_avx, "avx"};
+    }
+    return {stream_sse2, "sse2"};
+}
+
+inline void stream_fence() noexcept {
+    _mm_sfence();
+}
+
+inline void prefetch_nta(const unsigned char* p) noexcept {
+    _mm_prefetch(reinterpret_cast<const char*>(p), _MM_HINT_NTA);
+}
+
+#elif defined(SLICK_SHM_BULK_ARM64)
+
+inline void stream_neon(unsigned char* dst, const unsigned char* src, std::size_t n) {
+    for (std::size_t i = 0; i < n; i += 64) {
+        uint8x16_t a = vld1q_u8(src + i);
+        uint8x16_t b = vld1q_u8(src + i + 16);
+        uint8x16_t c = vld1q_u8(src + i + 32);
+        uint8x16_t d = vld1q_u8(src + i + 48);
+        __asm__ __volatile__("stnp %q0, %q1, [%2]" : : "w"(a), "w"(b), "r"(dst + i) : "memory");
+        __asm__ __volatile__("stnp %q0, %q1, [%2]" : : "w"(c), "w"(d), "r"(dst + i + 32)
+                             : "memory");
+    }
+}
+
+inline bulk_copy_impl select_bulk_copy() noexcept {
+    return {stream_neon, "neon"};  // NEON is part of the AArch64 baseline
+}
+
+inline void stream_fence() noexcept {
+    __asm__ __volatile__("dmb ishst" : : : "memory");
+}
+
+inline void prefetch_nta(const unsigned char* p) noexcept {
+    __builtin_prefetch(p, 0, 0);  // PRFM PLDL1STRM
+}
+
+#else
+
+inline void stream_memcpy(unsigned char* dst, const unsigned char* src, std::size_t n) {
+    std::memcpy(dst, src, n);
+}
+
+inline bulk_copy_impl select_bulk_copy() noexcept {
+    return {stream_memcpy, "memcpy"};
+}
+
+inline void stream_fence() noexcept {
+    std::atomic_thread_fence(std::memory_order_release);
+}
+
+inline void prefetch_nta(const unsigned char* p) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(p, 0, 0);
+#else
+    (void)p;
+#endif
+}
+
+#endif
+
+// Picked once, on first use
+inline const bulk_copy_impl& bulk_copy() noexcept {
+    static const bulk_copy_impl impl = select_bulk_copy();
+    return impl;
+}
+
+}  // namespace detail
+
+/**
+ * @brief Copy n bytes with non-temporal stores, then fence
+ *
+ * The unaligned head and tail of dst (less than 64 bytes each) are copied
+ * with std::memcpy; dst and src may not overlap.
+ */
+inline void stream_copy(void* dst, const void* src, std::size_t n) noexcept {
+    auto* d = static_cast<unsigned char*>(dst);
+    auto* s = static_cast<const unsigned char*>(src);
+    std::size_t misalign = reinterpret_cast<std::uintptr_t>(d) % detail::BULK_BLOCK;
+    std::size_t head = misalign == 0 ? 0 : detail::BULK_BLOCK - misalign;
+    if (n < head + detail::BULK_BLOCK) {
+        std::memcpy(d, s, n);
+        return;
+    }
+    std::memcpy(d, s, head);
+    std::size_t body = (n - head) / detail::BULK_BLOCK * detail::BULK_BLOCK;
+    detail::bulk_copy().stream(d + head, s + head, body);
+    std::memcpy(d + head + body, s + head + body, n - head - body);
+    detail::stream_fence();
+}
+
+/**
+ * @brief Copy n bytes, prefetching the source with a non-temporal hint
+ *
+ * Meant for the consumer side: lines of src are brought in for this copy
+ * only, so a large read doesn't evict the reader's working set. dst is
+ * written normally.
+ */
+inline void stream_read(void* dst, const void* src, std::size_t n) noexcept {
+    auto* d = static_cast<unsigned char*>(dst);
+    auto* s = static_cast<const unsigned char*>(src);
+    const std::size_t chunk = detail::BULK_READ_CHUNK;
+    auto prefetch_chunk = [&](std::size_t begin) {
+        std::size_t end = n - begin > chunk ? begin + chunk : n;
+        for (std::size_t line = begin; line < end; line += detail::BULK_BLOCK) {
+            detail::prefetch_nta(s + line);
+        }
+    };
+
+    // Prefetch one chunk ahead of the one being copied
+    if (n != 0) {
+        prefetch_chunk(0);
+    }
+    for (std::size_t i = 0; i < n; i += chunk) {
+        if (n - i > chunk) {
+            prefetch_chunk(i + chunk);
+        }
+        std::memcpy(d + i, s + i, n - i < chunk ? n - i : chunk);
+    }
+}
+
+/**
+ * @brief Instruction set stream_copy() uses on this CPU
+ * @return "avx512", "avx", "sse2", "neon" or "memcpy"
+ */
+inline const char* stream_copy_isa() noexcept {
+    return detail::bulk_copy().name;
+}
+
+/**
+ * @brief stream_copy() length bytes from src into a segment at offset
+ * @return Error code, empty on success. errc::mapping_failed for an invalid view,
+ *         errc::permission_denied for a read_only view, errc::invalid_argument if
+ *         the range is out of bounds.
+ *
+ * @code
+ * // Publisher: write the snapshot without pulling it into the cache
+ * stream_write(view, sizeof(header), snapshot.data(), snapshot.size());
+ * header->version.store(next, std::memory_order_release);
+ * @endcode
+ */
+inline std::error_code stream_write(shared_memory_view view, std::size_t offset, const void* src,
+                                    std::size_t length) noexcept {
+    if (!view.is_valid()) {
+        return make_error_code(errc::mapping_failed);
+    }
+    if (view.mode() == access_mode::read_only) {
+        return make_error_code(errc::permission_denied);
+    }
+    if (offset > view.size() || length > view.size() - offset) {
+        return make_error_code(errc::invalid_argument);
+    }
+    stream_copy(static_cast<unsigned char*>(view.data()) + offset, src, length);
+    return {};
+}
+
+/**
+ * @brief stream_read() length bytes at offset of a segment into dst
+ * @return Error code, empty on success. errc::mapping_failed for an invalid view,
+ *         errc::invalid_argument if the range is out of bounds.
+ */
+inline std::error_code stream_read(shared_memory_view view, std::size_t offset, void* dst,
+                                   std::size_t length) noexcept {
+    if (!view.is_valid()) {
+        return make_error_code(errc::mapping_failed);
+    }
+    if (offset > view.size() || length > view.size() - offset) {
+        return make_error_code(errc::invalid_argument);
+    }
+    stream_read(dst, static_cast<const unsigned char*>(view.data()) + offset, length);
+    return {};
+}
+
+inline std::error_code stream_write(shared_memory& shm, std::size_t offset, const void* src,
+                                    std::size_t length) noexcept {
+    return stream_write(shared_memory_view(shm), offset, src, length);
+}
+
+inline std::error_code stream_read(const shared_memory& shm, std::size_t offset, void* dst,
+                                   std::size_t length) noexcept {
+    return stream_read(shared_memory_view(shm), offset, dst, length);
+}
+
+}  // namespace shm
+}  // namespace slick
+
+#undef SLICK_SHM_TARGET
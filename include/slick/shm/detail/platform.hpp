@@ -4,7 +4,11 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
+#include <mutex>
+#include <string>
+#include <unordered_set>
 #include "../error.hpp"
 #include "../types.hpp"
 
@@ -22,6 +26,10 @@
     #error "Unsupported platform"
 #endif
 
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#endif
+
 namespace slick {
 namespace shm {
 namespace detail {
@@ -29,6 +37,37 @@ namespace detail {
 // Platform constants
 constexpr std::size_t MAX_NAME_LENGTH = 255;
 
+// Cache line size used to separate fields written by different processes.
+// A fixed value (rather than std::hardware_destructive_interference_size) keeps
+// in-segment layouts identical across compilers and compiler flags.
+#if defined(__APPLE__) && defined(__aarch64__)
+constexpr std::size_t cache_line_size = 128;
+#else
+constexpr std::size_t cache_line_size = 64;
+#endif
+
+// Smallest power of two not below value; 0 if that doesn't fit in a size_t
+constexpr std::size_t round_up_pow2(std::size_t value) noexcept {
+    constexpr std::size_t largest = ~(~std::size_t(0) >> 1);
+    if (value > largest) {
+        return 0;
+    }
+    std::size_t result = 1;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+constexpr std::size_t align_up(std::size_t value, std::size_t alignment) noexcept {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+// Path validation for file-backed segments (the file system checks the rest)
+inline bool is_valid_path(const char* path) {
+    return path != nullptr && *path != '\0';
+}
+
 // Name validation
 inline bool is_valid_name(const char* name) {
     if (!name || !*name) {
@@ -65,6 +104,105 @@ inline bool is_valid_name(const char* name) {
     return true;
 }
 
+// NUL-terminated string of up to Capacity characters stored inline, so segment
+// objects keep their names without allocating
+template <typename Char, std::size_t Capacity>
+class fixed_name {
+public:
+    static constexpr std::size_t capacity = Capacity;
+
+    // Copy str behind an optional prefix character; false (and empty) if it doesn't fit
+    bool assign(const Char* str, Char prefix = Char()) noexcept {
+        std::size_t length = 0;
+        if (prefix != Char()) {
+            data_[length++] = prefix;
+        }
+        for (; *str != Char(); ++str) {
+            if (length == Capacity) {
+                clear();
+                return false;
+            }
+            data_[length++] = *str;
+        }
+        data_[length] = Char();
+        length_ = length;
+        return true;
+    }
+
+    void clear() noexcept {
+        data_[0] = Char();
+        length_ = 0;
+    }
+
+    // For conversions that write into the buffer; set_size() records the result
+    Char* data() noexcept { return data_; }
+    void set_size(std::size_t length) noexcept {
+        data_[length] = Char();
+        length_ = length;
+    }
+
+    const Char* c_str() const noexcept { return data_; }
+    std::size_t size() const noexcept { return length_; }
+    bool empty() const noexcept { return length_ == 0; }
+
+private:
+    Char data_[Capacity + 1] = {};
+    std::size_t length_ = 0;
+};
+
+// Copy of name that lives until the process exits, shared by every segment
+// object with that name: views can hold on to it after the segment object is
+// moved or closed. Allocates once per distinct name; nullptr if out of memory
+inline const char* intern_name(const char* name) noexcept {
+    static std::mutex mutex;
+    static auto* names = new std::unordered_set<std::string>();  // Never freed
+    try {
+        std::lock_guard<std::mutex> lock(mutex);
+        return names->insert(name).first->c_str();
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+// Fault in every page of [addr, addr + length) by reading one byte per page
+inline void touch_pages(const void* addr, std::size_t length, std::size_t page_size) noexcept {
+    const volatile unsigned char* p = static_cast<const volatile unsigned char*>(addr);
+    for (std::size_t offset = 0; offset < length; offset += page_size) {
+        (void)p[offset];
+    }
+    if (length != 0) {
+        (void)p[length - 1];
+    }
+}
+
+// Write-fault every page of [addr, addr + length) without changing its contents,
+// so a copy-on-write mapping takes a private copy of each page. addr must be
+// page aligned. An atomic OR of zero stores the value the new private copy
+// holds, so a concurrent writer's change can't slip in between copy and store
+inline void break_cow_pages(void* addr, std::size_t length, std::size_t page_size) noexcept {
+    unsigned char* p = static_cast<unsigned char*>(addr);
+    for (std::size_t offset = 0; offset < length; offset += page_size) {
+#if defined(_MSC_VER)
+        _InterlockedOr(reinterpret_cast<volatile long*>(p + offset), 0);
+#else
+        __atomic_fetch_or(reinterpret_cast<std::uint32_t*>(p + offset), 0u, __ATOMIC_RELAXED);
+#endif
+    }
+}
+
+// CPU hint for spin-wait loops (pause / yield)
+inline void cpu_relax() noexcept {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    _mm_pause();
+#elif defined(_MSC_VER) && defined(_M_ARM64)
+    __yield();
+#elif defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    __asm__ __volatile__("yield");
+#endif
+}
+
 }  // namespace detail
 }  // namespace shm
 }  // namespace slick
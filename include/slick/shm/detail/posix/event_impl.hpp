@@ -0,0 +1,152 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 Slick Quant
+
+#pragma once
+
+#ifdef SLICK_SHM_POSIX
+
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <cstdint>
+#include <cerrno>
+#include <ctime>
+
+#if defined(SLICK_SHM_LINUX)
+    #include <linux/futex.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#elif defined(SLICK_SHM_MACOS)
+    #include <AvailabilityMacros.h>
+    #if defined(__has_include)
+        #if __has_include(<os/os_sync_wait_on_address.h>) && \
+            MAC_OS_X_VERSION_MIN_REQUIRED >= 140400
+            #include <os/os_sync_wait_on_address.h>
+            #define SLICK_SHM_HAS_OS_SYNC_WAIT
+        #endif
+    #endif
+#endif
+
+#ifndef SLICK_SHM_HAS_OS_SYNC_WAIT
+    #if defined(SLICK_SHM_MACOS)
+// Private but stable libSystem entry points behind os_sync_wait_on_address (macOS 10.12+)
+extern "C" int __ulock_wait(std::uint32_t operation, void* addr, std::uint64_t value,
+                            std::uint32_t timeout_us);
+extern "C" int __ulock_wake(std::uint32_t operation, void* addr, std::uint64_t wake_value);
+    #endif
+#endif
+
+namespace slick {
+namespace shm {
+namespace detail {
+
+static_assert(sizeof(std::atomic<std::uint32_t>) == sizeof(std::uint32_t),
+              "address waits need a plain 32-bit atomic");
+
+#if defined(SLICK_SHM_MACOS) && !defined(SLICK_SHM_HAS_OS_SYNC_WAIT)
+constexpr std::uint32_t UL_COMPARE_AND_WAIT_SHARED = 3;
+constexpr std::uint32_t ULF_WAKE_ALL = 0x00000100;
+constexpr std::uint32_t ULF_NO_ERRNO = 0x01000000;
+#endif
+
+/**
+ * Block until word != expected, a wake-up or the timeout (nullptr: none).
+ * Keyed by the physical page, so waiters and wakers may live in different
+ * processes and map the page at different addresses. Spurious returns are
+ * allowed; the caller re-checks the word.
+ *
+ * @return false if the timeout expired
+ */
+inline bool event_wait(std::atomic<std::uint32_t>& word, std::uint32_t expected,
+                       std::atomic<std::uint64_t>& key,
+                       const std::chrono::nanoseconds* timeout) noexcept {
+    (void)key;
+    void* addr = static_cast<void*>(&word);
+
+#if defined(SLICK_SHM_LINUX)
+    // No FUTEX_PRIVATE_FLAG: private futexes are keyed by mm + virtual address
+    struct timespec ts;
+    struct timespec* ts_ptr = nullptr;
+    if (timeout) {
+        ts.tv_sec = static_cast<time_t>(timeout->count() / 1000000000);
+        ts.tv_nsec = static_cast<long>(timeout->count() % 1000000000);
+        ts_ptr = &ts;
+    }
+    long rc = syscall(SYS_futex, addr, FUTEX_WAIT, expected, ts_ptr, nullptr, 0);
+    return !(rc == -1 && errno == ETIMEDOUT);
+
+#elif defined(SLICK_SHM_HAS_OS_SYNC_WAIT)
+    int rc;
+    if (timeout) {
+        rc = os_sync_wait_on_address_with_timeout(
+            addr, expected, sizeof(std::uint32_t), OS_SYNC_WAIT_ON_ADDRESS_SHARED,
+            OS_CLOCK_MACH_ABSOLUTE_TIME, static_cast<std::uint64_t>(timeout->count()));
+    } else {
+        rc = os_sync_wait_on_address(addr, expected, sizeof(std::uint32_t),
+                                     OS_SYNC_WAIT_ON_ADDRESS_SHARED);
+    }
+    return !(rc < 0 && errno == ETIMEDOUT);
+
+#elif defined(SLICK_SHM_MACOS)
+    // __ulock_wait takes microseconds and treats 0 as "no timeout"
+    std::uint32_t timeout_us = 0;
+    if (timeout) {
+        auto us = (timeout->count() + 999) / 1000;
+        timeout_us = us <= 0 ? 1 : (us > UINT32_MAX ? UINT32_MAX : static_cast<std::uint32_t>(us));
+    }
+    int rc = __ulock_wait(UL_COMPARE_AND_WAIT_SHARED | ULF_NO_ERRNO, addr, expected, timeout_us);
+    return rc != -ETIMEDOUT;
+
+#else
+    // Other POSIX systems: no shared address wait, nap briefly and let the caller re-check
+    (void)expected;
+    (void)addr;
+    std::chrono::nanoseconds nap(std::chrono::microseconds(50));
+    if (timeout && *timeout < nap) {
+        nap = *timeout;
+    }
+    struct timespec ts;
+    ts.tv_sec = 0;
+    ts.tv_nsec = static_cast<long>(nap.count());
+    nanosleep(&ts, nullptr);
+    return true;
+#endif
+}
+
+/**
+ * Wake up to count threads blocked in event_wait() on word
+ */
+inline void event_wake(std::atomic<std::uint32_t>& word, std::atomic<std::uint64_t>& key,
+                       std::uint32_t count) noexcept {
+    (void)key;
+    void* addr = static_cast<void*>(&word);
+
+#if defined(SLICK_SHM_LINUX)
+    int n = count > static_cast<std::uint32_t>(INT_MAX) ? INT_MAX : static_cast<int>(count);
+    syscall(SYS_futex, addr, FUTEX_WAKE, n, nullptr, nullptr, 0);
+
+#elif defined(SLICK_SHM_HAS_OS_SYNC_WAIT)
+    if (count > 1) {
+        os_sync_wake_by_address_all(addr, sizeof(std::uint32_t), OS_SYNC_WAKE_BY_ADDRESS_SHARED);
+    } else {
+        os_sync_wake_by_address_any(addr, sizeof(std::uint32_t), OS_SYNC_WAKE_BY_ADDRESS_SHARED);
+    }
+
+#elif defined(SLICK_SHM_MACOS)
+    std::uint32_t operation = UL_COMPARE_AND_WAIT_SHARED | ULF_NO_ERRNO;
+    if (count > 1) {
+        operation |= ULF_WAKE_ALL;
+    }
+    __ulock_wake(operation, addr, 0);
+
+#else
+    (void)addr;
+    (void)count;
+#endif
+}
+
+}  // namespace detail
+}  // namespace shm
+}  // namespace slick
+
+#endif  // SLICK_SHM_POSIX
@@ -0,0 +1,364 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 Slick Quant
+
+#pragma once
+
+#ifdef SLICK_SHM_POSIX
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstdint>
+
+#include <string>
+#include <system_error>
+#include <utility>
+
+namespace slick {
+namespace shm {
+namespace detail {
+
+// Shared memory object mapped into a fixed virtual reservation.
+//
+// The whole reservation is mapped PROT_NONE up front, and committed ranges of the
+// object are mapped over it with MAP_FIXED, so the base address never changes
+// while the segment grows. Sizes passed in are rounded up to the page size.
+class platform_growable_segment {
+public:
+    platform_growable_segment() = default;
+
+    ~platform_growable_segment() {
+        close_impl();
+    }
+
+    platform_growable_segment(const platform_growable_segment&) = delete;
+    platform_growable_segment& operator=(const platform_growable_segment&) = delete;
+
+    platform_growable_segment(platform_growable_segment&& other) noexcept {
+        *this = std::move(other);
+    }
+
+    platform_growable_segment& operator=(platform_growable_segment&& other) noexcept {
+        if (this != &other) {
+            close_impl();
+
+            shm_fd_ = other.shm_fd_;
+            base_ = other.base_;
+            name_ = std::move(other.name_);
+            original_name_ = std::move(other.original_name_);
+            reserved_ = other.reserved_;
+            mapped_ = other.mapped_;
+            probe_size_ = other.probe_size_;
+            page_size_ = other.page_size_;
+            mode_ = other.mode_;
+            owns_shm_ = other.owns_shm_;
+            options_ = other.options_;
+
+            other.shm_fd_ = -1;
+            other.base_ = nullptr;
+            other.reserved_ = 0;
+            other.mapped_ = 0;
+            other.probe_size_ = 0;
+            other.owns_shm_ = false;
+        }
+        return *this;
+    }
+
+    // Create the object with initial bytes and reserve room for reserve bytes
+    std::error_code create(const char* name, std::size_t initial, std::size_t reserve,
+                           const segment_options& options) {
+        if (!is_valid_name(name)) {
+            return make_error_code(errc::invalid_name);
+        }
+        std::error_code ec = check_options(options);
+        if (ec) {
+            return ec;
+        }
+
+        original_name_ = name;
+        name_ = name[0] == '/' ? std::string(name) : std::string("/") + name;
+        mode_ = access_mode::read_write;
+        options_ = options;
+        page_size_ = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+        initial = round_to_page(initial);
+        reserve = round_to_page(reserve);
+
+        shm_fd_ = shm_open(name_.c_str(), O_CREAT | O_EXCL | O_RDWR, 0666);
+        if (shm_fd_ == -1) {
+            if (errno == EEXIST) {
+                return make_error_code(errc::already_exists);
+            }
+            return get_errno_error();
+        }
+        owns_shm_ = true;
+
+#ifdef SLICK_SHM_MACOS
+        // macOS only lets a shm object be sized once, so size it for the whole
+        // reservation; pages that are never touched take no memory
+        ec = resize_object_to(reserve);
+#else
+        ec = resize_object_to(initial);
+#endif
+        if (!ec) {
+            ec = reserve_range(reserve);
+        }
+        if (!ec) {
+            ec = map_to(initial);
+        }
+        if (ec) {
+            close_impl();
+            shm_unlink(name_.c_str());
+            owns_shm_ = false;
+        }
+        return ec;
+    }
+
+    // Open the object and map its first probe_size bytes (the header) so the
+    // caller can read the reservation size and pass it to reserve()
+    std::error_code open(const char* name, access_mode access, const segment_options& options,
+                         std::size_t probe_size) {
+        if (!is_valid_name(name)) {
+            return make_error_code(errc::invalid_name);
+        }
+        std::error_code ec = check_options(options);
+        if (ec) {
+            return ec;
+        }
+
+        original_name_ = name;
+        name_ = name[0] == '/' ? std::string(name) : std::string("/") + name;
+        mode_ = access;
+        options_ = options;
+        owns_shm_ = false;
+        page_size_ = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+
+        shm_fd_ = shm_open(name_.c_str(), access == access_mode::read_only ? O_RDONLY : O_RDWR, 0);
+        if (shm_fd_ == -1) {
+            if (errno == ENOENT) {
+                return make_error_code(errc::not_found);
+            }
+            return get_errno_error();
+        }
+
+        struct stat sb;
+        if (fstat(shm_fd_, &sb) == -1) {
+            ec = get_errno_error();
+            close_impl();
+            return ec;
+        }
+        if (sb.st_size == 0) {
+            // The creator hasn't sized the object yet (between shm_open() and ftruncate())
+            close_impl();
+            return make_error_code(errc::invalid_size);
+        }
+        if (static_cast<std::size_t>(sb.st_size) < probe_size) {
+            close_impl();
+            return make_error_code(errc::incompatible_layout);
+        }
+
+        void* probe = mmap(nullptr, probe_size, prot(), MAP_SHARED, shm_fd_, 0);
+        if (probe == MAP_FAILED) {
+            ec = get_errno_error();
+            close_impl();
+            return ec;
+        }
+        base_ = probe;
+        probe_size_ = probe_size;
+        return {};
+    }
+
+    // Replace the probe mapping of an opened object by a reservation
+    std::error_code reserve(std::size_t bytes) {
+        if (probe_size_ != 0) {
+            munmap(base_, probe_size_);
+            base_ = nullptr;
+            probe_size_ = 0;
+        }
+        return reserve_range(round_to_page(bytes));
+    }
+
+    // Grow the backing object to at least bytes (never shrinks it)
+    std::error_code grow_object(std::size_t bytes) {
+#ifdef SLICK_SHM_MACOS
+        (void)bytes;  // Sized for the whole reservation at creation
+        return {};
+#else
+        bytes = round_to_page(bytes);
+        struct stat sb;
+        if (fstat(shm_fd_, &sb) == -1) {
+            return get_errno_error();
+        }
+        if (static_cast<std::size_t>(sb.st_size) >= bytes) {
+            return {};
+        }
+        return resize_object_to(bytes);
+#endif
+    }
+
+    // Extend this process's view to the first bytes of the object
+    std::error_code map_to(std::size_t bytes) {
+        bytes = round_to_page(bytes);
+        if (bytes <= mapped_) {
+            return {};
+        }
+        if (bytes > reserved_) {
+            return make_error_code(errc::invalid_size);
+        }
+
+        int flags = MAP_SHARED | MAP_FIXED;
+#ifdef SLICK_SHM_LINUX
+        if (options_.prefault) {
+            flags |= MAP_POPULATE;
+        }
+#endif
+        char* begin = static_cast<char*>(base_) + mapped_;
+        std::size_t length = bytes - mapped_;
+        if (mmap(begin, length, prot(), flags, shm_fd_, static_cast<off_t>(mapped_)) == MAP_FAILED) {
+            return get_errno_error();
+        }
+#ifndef SLICK_SHM_LINUX
+        if (options_.prefault) {
+            touch_pages(begin, length, page_size_);
+        }
+#endif
+        if (options_.lock != memory_lock::none && mlock(begin, length) != 0) {
+            std::error_code ec = (errno == ENOMEM || errno == EPERM || errno == EAGAIN)
+                                     ? make_error_code(errc::lock_limit_exceeded)
+                                     : get_errno_error();
+            // Put the range back to reserved so the view stays consistent. If even
+            // that fails the view no longer matches mapped_, so drop all of it.
+            if (mmap(begin, length, PROT_NONE, reserve_flags(), -1, 0) == MAP_FAILED) {
+                close_impl();
+            }
+            return ec;
+        }
+        mapped_ = bytes;
+        return {};
+    }
+
+    void* data() const noexcept {
+        return base_;
+    }
+
+    std::size_t mapped_size() const noexcept {
+        return mapped_;
+    }
+
+    std::size_t reserved_size() const noexcept {
+        return reserved_;
+    }
+
+    std::size_t page_size() const noexcept {
+        return page_size_;
+    }
+
+    const char* name() const noexcept {
+        return original_name_.c_str();
+    }
+
+    access_mode mode() const noexcept {
+        return mode_;
+    }
+
+    bool is_creator() const noexcept {
+        return owns_shm_;
+    }
+
+    static bool remove(const char* name) noexcept {
+        if (!is_valid_name(name)) {
+            return false;
+        }
+        std::string formatted = name[0] == '/' ? std::string(name) : std::string("/") + name;
+        return shm_unlink(formatted.c_str()) == 0;
+    }
+
+private:
+    int shm_fd_ = -1;
+    void* base_ = nullptr;
+    std::string name_;           // Formatted name with "/" prefix for POSIX API
+    std::string original_name_;  // Original name for the public accessor
+    std::size_t reserved_ = 0;   // Size of the virtual reservation at base_
+    std::size_t mapped_ = 0;     // Bytes of the object mapped at base_
+    std::size_t probe_size_ = 0; // Size of the header mapping made by open()
+    std::size_t page_size_ = 0;
+    access_mode mode_ = access_mode::read_write;
+    bool owns_shm_ = false;
+    segment_options options_;
+
+    // Growable segments are built from standard pages, and the NUMA policy of
+    // a shm object can't be set before it has a mapping. A mirrored view would
+    // have to move when the segment grows. File-backed growth and
+    // placing the reservation at a fixed address are not implemented
+    static std::error_code check_options(const segment_options& options) {
+        if (options.huge_page_policy == huge_pages::required ||
+            options.numa != numa_policy::none || options.mirror ||
+            options.file_backed || options.base_address || options.copy_on_write) {
+            return make_error_code(errc::not_supported);
+        }
+        return {};
+    }
+
+    static int reserve_flags() noexcept {
+        int flags = MAP_PRIVATE | MAP_ANON | MAP_FIXED;
+#ifdef MAP_NORESERVE
+        flags |= MAP_NORESERVE;
+#endif
+        return flags;
+    }
+
+    std::error_code reserve_range(std::size_t bytes) {
+        int flags = MAP_PRIVATE | MAP_ANON;
+#ifdef MAP_NORESERVE
+        flags |= MAP_NORESERVE;
+#endif
+        void* range = mmap(nullptr, bytes, PROT_NONE, flags, -1, 0);
+        if (range == MAP_FAILED) {
+            return get_errno_error();
+        }
+        base_ = range;
+        reserved_ = bytes;
+        mapped_ = 0;
+        return {};
+    }
+
+    std::error_code resize_object_to(std::size_t bytes) {
+        if (ftruncate(shm_fd_, static_cast<off_t>(bytes)) == -1) {
+            return get_errno_error();
+        }
+        return {};
+    }
+
+    std::size_t round_to_page(std::size_t bytes) const noexcept {
+        return (bytes + page_size_ - 1) / page_size_ * page_size_;
+    }
+
+    int prot() const noexcept {
+        return mode_ == access_mode::read_only ? PROT_READ : PROT_READ | PROT_WRITE;
+    }
+
+    void close_impl() noexcept {
+        if (base_ != nullptr) {
+            munmap(base_, probe_size_ != 0 ? probe_size_ : reserved_);  // Also releases mlock()
+            base_ = nullptr;
+        }
+        if (shm_fd_ != -1) {
+            ::close(shm_fd_);
+            shm_fd_ = -1;
+        }
+        reserved_ = 0;
+        mapped_ = 0;
+        probe_size_ = 0;
+    }
+
+    static std::error_code get_errno_error() {
+        return std::error_code(errno, std::system_category());
+    }
+};
+
+}  // namespace detail
+}  // namespace shm
+}  // namespace slick
+
+#endif  // SLICK_SHM_POSIX
@@ -0,0 +1,159 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 Slick Quant
+
+#pragma once
+
+#ifdef SLICK_SHM_POSIX
+
+#include <sys/socket.h>
+#include <sys/uio.h>
+#ifdef SLICK_SHM_LINUX
+#include <sys/syscall.h>
+#endif
+#include <unistd.h>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <system_error>
+
+namespace slick {
+namespace shm {
+namespace detail {
+
+// Send one descriptor as SCM_RIGHTS ancillary data with a one-byte payload
+inline std::error_code send_handle(int socket, int handle) noexcept {
+    char payload = 0;
+    iovec iov;
+    iov.iov_base = &payload;
+    iov.iov_len = 1;
+
+    alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int))];
+    std::memset(control, 0, sizeof(control));
+    msghdr msg;
+    std::memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+
+    cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type = SCM_RIGHTS;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(int));
+    std::memcpy(CMSG_DATA(cmsg), &handle, sizeof(int));
+
+    // A stream socket whose peer has gone away would raise SIGPIPE
+    int flags = 0;
+#ifdef MSG_NOSIGNAL
+    flags |= MSG_NOSIGNAL;
+#endif
+    ssize_t sent;
+    do {
+        sent = sendmsg(socket, &msg, flags);
+    } while (sent == -1 && errno == EINTR);
+    if (sent == -1) {
+        return std::error_code(errno, std::system_category());
+    }
+    return {};
+}
+
+// Close every descriptor the kernel installed from a message we reject
+inline void close_received_handles(msghdr& msg) noexcept {
+    for (cmsghdr* cmsg = CMSG_FIRSTHDR(&msg); cmsg != nullptr; cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+        if (cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_RIGHTS ||
+            cmsg->cmsg_len < CMSG_LEN(0)) {
+            continue;
+        }
+        std::size_t count = (cmsg->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+        for (std::size_t i = 0; i < count; ++i) {
+            int fd;
+            std::memcpy(&fd, CMSG_DATA(cmsg) + i * sizeof(int), sizeof(int));
+            ::close(fd);
+        }
+    }
+}
+
+inline std::error_code receive_handle(int socket, int& handle) noexcept {
+    handle = -1;
+    char payload = 0;
+    iovec iov;
+    iov.iov_base = &payload;
+    iov.iov_len = 1;
+
+    alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int))];
+    msghdr msg;
+    std::memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+
+    int flags = 0;
+#ifdef MSG_CMSG_CLOEXEC
+    flags |= MSG_CMSG_CLOEXEC;
+#endif
+    ssize_t received;
+    do {
+        received = recvmsg(socket, &msg, flags);
+    } while (received == -1 && errno == EINTR);
+    if (received == -1) {
+        return std::error_code(errno, std::system_category());
+    }
+    if (received == 0) {
+        return make_error_code(errc::not_found);  // Peer closed without sending
+    }
+
+    cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+    if (cmsg == nullptr || cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_RIGHTS ||
+        cmsg->cmsg_len != CMSG_LEN(sizeof(int)) || (msg.msg_flags & MSG_CTRUNC)) {
+        close_received_handles(msg);
+        return make_error_code(errc::invalid_argument);
+    }
+    std::memcpy(&handle, CMSG_DATA(cmsg), sizeof(int));
+    return {};
+}
+
+// pidfd_getfd() (Linux 5.6+) copies a descriptor out of another process. It
+// needs ptrace access to that process (same user and a permissive
+// kernel.yama.ptrace_scope, or CAP_SYS_PTRACE).
+inline std::error_code import_handle(std::uint32_t pid, int remote, int& handle) noexcept {
+    handle = -1;
+#if defined(SLICK_SHM_LINUX) && defined(SYS_pidfd_open) && defined(SYS_pidfd_getfd)
+    int pidfd = static_cast<int>(syscall(SYS_pidfd_open, static_cast<pid_t>(pid), 0));
+    if (pidfd == -1) {
+        if (errno == ESRCH) {
+            return make_error_code(errc::not_found);
+        }
+        return errno == ENOSYS ? make_error_code(errc::not_supported)
+                               : std::error_code(errno, std::system_category());
+    }
+    handle = static_cast<int>(syscall(SYS_pidfd_getfd, pidfd, remote, 0));
+    int err = errno;
+    ::close(pidfd);
+    if (handle == -1) {
+        switch (err) {
+            case ENOSYS:
+                return make_error_code(errc::not_supported);
+            case EPERM:
+                return make_error_code(errc::permission_denied);
+            case EBADF:
+                return make_error_code(errc::not_found);
+            default:
+                return std::error_code(err, std::system_category());
+        }
+    }
+    return {};
+#else
+    (void)pid;
+    (void)remote;
+    return make_error_code(errc::not_supported);
+#endif
+}
+
+}  // namespace detail
+}  // namespace shm
+}  // namespace slick
+
+#endif  // SLICK_SHM_POSIX
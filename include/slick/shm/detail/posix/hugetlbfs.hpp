@@ -0,0 +1,100 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 Slick Quant
+
+#pragma once
+
+#ifdef SLICK_SHM_LINUX
+
+#include <mntent.h>
+#include <sys/vfs.h>
+#include <unistd.h>
+#include <cstdio>
+
+#include <string>
+
+namespace slick {
+namespace shm {
+namespace detail {
+
+// Filesystem magic reported by statfs() for hugetlbfs mounts (see linux/magic.h)
+constexpr long HUGETLBFS_MAGIC_NUMBER = 0x958458f6;
+
+// Returns the huge page size of a hugetlbfs mount, or 0 if path is not on hugetlbfs
+inline std::size_t hugetlbfs_page_size(const char* path) noexcept {
+    struct statfs sfs;
+    if (statfs(path, &sfs) != 0 || static_cast<long>(sfs.f_type) != HUGETLBFS_MAGIC_NUMBER) {
+        return 0;
+    }
+    return static_cast<std::size_t>(sfs.f_bsize);
+}
+
+// Same as hugetlbfs_page_size() for an open descriptor
+inline std::size_t hugetlbfs_page_size(int fd) noexcept {
+    struct statfs sfs;
+    if (fstatfs(fd, &sfs) != 0 || static_cast<long>(sfs.f_type) != HUGETLBFS_MAGIC_NUMBER) {
+        return 0;
+    }
+    return static_cast<std::size_t>(sfs.f_bsize);
+}
+
+/**
+ * @brief Invoke fn(mount_dir, page_size) for every hugetlbfs mount in /proc/mounts
+ * @note Iteration stops as soon as fn returns true
+ * @return true if fn returned true for some mount
+ */
+template <typename Fn>
+bool for_each_hugetlbfs_mount(Fn&& fn) {
+    FILE* mounts = setmntent("/proc/mounts", "r");
+    if (!mounts) {
+        return false;
+    }
+
+    bool found = false;
+    struct mntent entry;
+    char buf[4096];
+    while (!found && getmntent_r(mounts, &entry, buf, sizeof(buf))) {
+        if (std::string(entry.mnt_type) != "hugetlbfs") {
+            continue;
+        }
+        std::size_t page_size = hugetlbfs_page_size(entry.mnt_dir);
+        if (page_size != 0) {
+            found = fn(entry.mnt_dir, page_size);
+        }
+    }
+
+    endmntent(mounts);
+    return found;
+}
+
+/**
+ * @brief Find a writable hugetlbfs mount
+ * @param page_size Requested huge page size (0 = first mount found)
+ * @param[out] mount_dir Mount directory
+ * @param[out] actual_page_size Page size of the mount
+ * @return true if a suitable mount was found
+ */
+inline bool find_hugetlbfs_mount(std::size_t page_size, std::string& mount_dir,
+                                 std::size_t& actual_page_size) {
+    return for_each_hugetlbfs_mount([&](const char* dir, std::size_t mount_page_size) {
+        if (page_size != 0 && mount_page_size != page_size) {
+            return false;
+        }
+        if (access(dir, W_OK) != 0) {
+            return false;
+        }
+        mount_dir = dir;
+        actual_page_size = mount_page_size;
+        return true;
+    });
+}
+
+// Path of a segment inside a hugetlbfs mount (formatted_name starts with '/')
+inline std::string hugetlbfs_path(const std::string& mount_dir, const char* formatted_name) {
+    return mount_dir + formatted_name;
+}
+
+}  // namespace detail
+}  // namespace shm
+}  // namespace slick
+
+#endif  // SLICK_SHM_LINUX
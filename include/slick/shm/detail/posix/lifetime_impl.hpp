@@ -0,0 +1,174 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 Slick Quant
+
+#pragma once
+
+#ifdef SLICK_SHM_POSIX
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include <system_error>
+
+#include "../../error.hpp"
+#include "process_impl.hpp"
+
+namespace slick {
+namespace shm {
+namespace detail {
+
+// Reference count of a segment_lifetime::ref_counted segment, kept in the last
+// bytes of the object so that data() stays page aligned. Every process mapping
+// the segment for writing owns one slot ((pid << 32) | handles); attached counts
+// the owned slots, and the process that releases the last one unlinks the name.
+// Slots of processes that died are reclaimed by attach() and sweep().
+constexpr std::uint64_t LIFETIME_MAGIC = 0x656d69746566696cULL;  // "lifetime"
+constexpr std::uint32_t LIFETIME_VERSION = 1;
+constexpr std::size_t LIFETIME_SLOTS = 120;
+constexpr std::uint64_t LIFETIME_RETIRED = 1ULL << 63;  // Set once the count dropped to zero
+
+struct lifetime_table {
+    std::atomic<std::uint64_t> magic;  // Published last, with release
+    std::uint32_t version;
+    std::uint32_t slot_count;
+    std::atomic<std::uint64_t> attached;  // Owned slots, plus LIFETIME_RETIRED
+    std::uint64_t reserved[5];
+    std::atomic<std::uint64_t> slots[LIFETIME_SLOTS];
+};
+
+static_assert(sizeof(lifetime_table) % 64 == 0, "lifetime_table must keep the tail aligned");
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free,
+              "lifetime_table requires lock-free 64-bit atomics");
+
+inline std::uint64_t lifetime_slot_value(std::uint32_t pid, std::uint32_t handles) noexcept {
+    return (static_cast<std::uint64_t>(pid) << 32) | handles;
+}
+
+// The table at the end of a mapping of size bytes, if the creator published one
+inline lifetime_table* find_lifetime_table(void* base, std::size_t size) noexcept {
+    if (base == nullptr || size < sizeof(lifetime_table) || size % 64 != 0) {
+        return nullptr;
+    }
+    auto* table = reinterpret_cast<lifetime_table*>(static_cast<char*>(base) + size -
+                                                    sizeof(lifetime_table));
+    if (table->magic.load(std::memory_order_acquire) != LIFETIME_MAGIC ||
+        table->version != LIFETIME_VERSION || table->slot_count != LIFETIME_SLOTS) {
+        return nullptr;
+    }
+    return table;
+}
+
+// Creator side: the new object is zero-filled, so only the first slot and the
+// count need to be written before the magic
+inline lifetime_table* init_lifetime_table(void* base, std::size_t size) noexcept {
+    auto* table = reinterpret_cast<lifetime_table*>(static_cast<char*>(base) + size -
+                                                    sizeof(lifetime_table));
+    table->version = LIFETIME_VERSION;
+    table->slot_count = LIFETIME_SLOTS;
+    table->slots[0].store(lifetime_slot_value(current_process_id(), 1),
+                          std::memory_order_relaxed);
+    table->attached.store(1, std::memory_order_relaxed);
+    table->magic.store(LIFETIME_MAGIC, std::memory_order_release);
+    return table;
+}
+
+// Drop one owned slot from the count; true if it was the last one, in which
+// case the caller must unlink the segment
+inline bool lifetime_release(lifetime_table& table) noexcept {
+    std::uint64_t attached = table.attached.load(std::memory_order_acquire);
+    for (;;) {
+        std::uint64_t next = attached == 1 ? LIFETIME_RETIRED : attached - 1;
+        if (table.attached.compare_exchange_weak(attached, next, std::memory_order_acq_rel,
+                                                 std::memory_order_acquire)) {
+            return next == LIFETIME_RETIRED;
+        }
+    }
+}
+
+// Free the slot of a process that died; true if that released the last slot
+inline bool lifetime_reclaim(lifetime_table& table, std::size_t i) noexcept {
+    std::uint64_t value = table.slots[i].load(std::memory_order_acquire);
+    if (value == 0 || is_process_alive(static_cast<std::uint32_t>(value >> 32))) {
+        return false;
+    }
+    if (!table.slots[i].compare_exchange_strong(value, 0, std::memory_order_acq_rel)) {
+        return false;  // Reclaimed by someone else meanwhile
+    }
+    return lifetime_release(table);
+}
+
+// Count one more handle of this process. errc::not_found if the segment is
+// being removed, errc::too_many_readers if every slot is owned by a live process
+inline std::error_code lifetime_attach(lifetime_table& table) noexcept {
+    const std::uint32_t pid = current_process_id();
+
+    // Another handle in this process already owns a slot
+    for (auto& slot : table.slots) {
+        std::uint64_t value = slot.load(std::memory_order_acquire);
+        while (value != 0 && static_cast<std::uint32_t>(value >> 32) == pid) {
+            if (slot.compare_exchange_weak(value, value + 1, std::memory_order_acq_rel)) {
+                return {};
+            }
+        }
+    }
+
+    // Reserve a count first, so that reclaiming dead slots below can't retire
+    // the segment under us
+    std::uint64_t attached = table.attached.load(std::memory_order_acquire);
+    do {
+        if (attached & LIFETIME_RETIRED) {
+            return make_error_code(errc::not_found);
+        }
+    } while (!table.attached.compare_exchange_weak(attached, attached + 1,
+                                                   std::memory_order_acq_rel,
+                                                   std::memory_order_acquire));
+
+    for (int pass = 0; pass < 2; ++pass) {
+        for (std::size_t i = 0; i < LIFETIME_SLOTS; ++i) {
+            std::uint64_t value = table.slots[i].load(std::memory_order_acquire);
+            if (value == 0 && table.slots[i].compare_exchange_strong(
+                                  value, lifetime_slot_value(pid, 1), std::memory_order_acq_rel)) {
+                return {};
+            }
+            if (pass == 1) {
+                continue;
+            }
+            lifetime_reclaim(table, i);  // Can't be the last one, we hold a count
+        }
+    }
+
+    lifetime_release(table);  // Can't be the last one either: every slot is owned
+    return make_error_code(errc::too_many_readers);
+}
+
+// Drop one handle of this process; true if the segment must be unlinked now
+inline bool lifetime_detach(lifetime_table& table) noexcept {
+    const std::uint32_t pid = current_process_id();
+    for (auto& slot : table.slots) {
+        std::uint64_t value = slot.load(std::memory_order_acquire);
+        while (value != 0 && static_cast<std::uint32_t>(value >> 32) == pid) {
+            std::uint64_t next = (value & 0xffffffffULL) == 1 ? 0 : value - 1;
+            if (slot.compare_exchange_weak(value, next, std::memory_order_acq_rel)) {
+                return next == 0 && lifetime_release(table);
+            }
+        }
+    }
+    return false;  // Not counted in this process (a child after fork(), or reclaimed)
+}
+
+// Sweeper side: reclaim every dead slot; true if the segment must be unlinked
+inline bool lifetime_sweep(lifetime_table& table) noexcept {
+    bool last = false;
+    for (std::size_t i = 0; i < LIFETIME_SLOTS; ++i) {
+        last = lifetime_reclaim(table, i) || last;
+    }
+    // Retired by a process that died before unlinking
+    return last || table.attached.load(std::memory_order_acquire) == LIFETIME_RETIRED;
+}
+
+}  // namespace detail
+}  // namespace shm
+}  // namespace slick
+
+#endif  // SLICK_SHM_POSIX
@@ -0,0 +1,178 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 Slick Quant
+
+#pragma once
+
+#ifdef SLICK_SHM_POSIX
+
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <time.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+#include <system_error>
+
+namespace slick {
+namespace shm {
+namespace detail {
+
+// A listener is a non-blocking Unix datagram socket bound to an address derived
+// from the channel key and its slot. Notifiers send it one byte with sendto(),
+// which never raises SIGPIPE and fails harmlessly once the listener is gone.
+// eventfd and EVFILT_USER can't be reached from another process by name.
+using notify_handle = int;
+constexpr notify_handle invalid_notify_handle = -1;
+
+inline std::uint64_t new_notify_key() noexcept {
+    timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    std::uint64_t key = static_cast<std::uint64_t>(ts.tv_sec) * 1000000000ULL +
+                        static_cast<std::uint64_t>(ts.tv_nsec);
+    key ^= static_cast<std::uint64_t>(getpid()) << 32;
+    return key | 1;  // Never 0
+}
+
+// Linux uses the abstract namespace, so nothing is left behind in the file
+// system; elsewhere the socket is a file in /tmp
+inline socklen_t notify_address(std::uint64_t key, std::uint32_t slot, std::uint32_t generation,
+                                sockaddr_un& addr) noexcept {
+    std::memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+#ifdef SLICK_SHM_LINUX
+    int n = std::snprintf(addr.sun_path + 1, sizeof(addr.sun_path) - 1,
+                          "slick_shm_notify_%016llx_%u_%u",
+                          static_cast<unsigned long long>(key), slot, generation);
+    return static_cast<socklen_t>(offsetof(sockaddr_un, sun_path) + 1 + n);
+#else
+    int n = std::snprintf(addr.sun_path, sizeof(addr.sun_path),
+                          "/tmp/slick_shm_notify_%016llx_%u_%u",
+                          static_cast<unsigned long long>(key), slot, generation);
+    return static_cast<socklen_t>(offsetof(sockaddr_un, sun_path) + n + 1);
+#endif
+}
+
+inline int notify_socket() noexcept {
+#ifdef SLICK_SHM_LINUX
+    return socket(AF_UNIX, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+#else
+    int fd = socket(AF_UNIX, SOCK_DGRAM, 0);
+    if (fd != -1 && (fcntl(fd, F_SETFD, FD_CLOEXEC) == -1 ||
+                     fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK) == -1)) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+#endif
+}
+
+inline std::error_code open_listener(std::uint64_t key, std::uint32_t slot,
+                                     std::uint32_t generation, notify_handle& handle) noexcept {
+    handle = notify_socket();
+    if (handle == -1) {
+        return std::error_code(errno, std::system_category());
+    }
+    sockaddr_un addr;
+#ifndef SLICK_SHM_LINUX
+    // Left behind by a previous listener of the slot that crashed
+    notify_address(key, slot, generation - 1, addr);
+    unlink(addr.sun_path);
+#endif
+    socklen_t length = notify_address(key, slot, generation, addr);
+    if (bind(handle, reinterpret_cast<const sockaddr*>(&addr), length) == -1) {
+        int err = errno;
+        close(handle);
+        handle = -1;
+        return std::error_code(err, std::system_category());
+    }
+    return {};
+}
+
+inline void close_listener(notify_handle handle, std::uint64_t key, std::uint32_t slot,
+                           std::uint32_t generation) noexcept {
+#ifndef SLICK_SHM_LINUX
+    sockaddr_un addr;
+    notify_address(key, slot, generation, addr);
+    unlink(addr.sun_path);
+#else
+    (void)key;
+    (void)slot;
+    (void)generation;
+#endif
+    close(handle);
+}
+
+// Consume every pending notification
+inline void drain_listener(notify_handle handle) noexcept {
+    char buffer[64];
+    for (;;) {
+        if (recv(handle, buffer, sizeof(buffer), 0) == -1 && errno != EINTR) {
+            return;  // EAGAIN: nothing left
+        }
+    }
+}
+
+// Notifier side: one unbound socket per channel, created by open() so that
+// signal() only reads it and may be called from several threads at once
+class notify_sender {
+public:
+    notify_sender() = default;
+    notify_sender(const notify_sender&) = delete;
+    notify_sender& operator=(const notify_sender&) = delete;
+
+    ~notify_sender() {
+        reset();
+    }
+
+    std::error_code open() noexcept {
+        if (fd_ == -1) {
+            fd_ = notify_socket();
+            if (fd_ == -1) {
+                return std::error_code(errno, std::system_category());
+            }
+        }
+        return {};
+    }
+
+    void reset() noexcept {
+        if (fd_ != -1) {
+            close(fd_);
+            fd_ = -1;
+        }
+    }
+
+    void swap(notify_sender& other) noexcept {
+        int fd = fd_;
+        fd_ = other.fd_;
+        other.fd_ = fd;
+    }
+
+    // A full socket buffer already holds a pending notification, and a
+    // listener that is gone has nothing to wake, so send errors are ignored
+    void signal(std::uint64_t key, std::uint32_t slot, std::uint32_t generation) const noexcept {
+        if (fd_ == -1) {
+            return;
+        }
+        sockaddr_un addr;
+        socklen_t length = notify_address(key, slot, generation, addr);
+        char byte = 1;
+        ssize_t sent;
+        do {
+            sent = sendto(fd_, &byte, 1, 0, reinterpret_cast<const sockaddr*>(&addr), length);
+        } while (sent == -1 && errno == EINTR);
+    }
+
+private:
+    int fd_ = -1;
+};
+
+}  // namespace detail
+}  // namespace shm
+}  // namespace slick
+
+#endif  // SLICK_SHM_POSIX
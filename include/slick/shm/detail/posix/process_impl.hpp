@@ -0,0 +1,37 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 Slick Quant
+
+#pragma once
+
+#ifdef SLICK_SHM_POSIX
+
+#include <cerrno>
+#include <cstdint>
+#include <signal.h>
+#include <unistd.h>
+
+namespace slick {
+namespace shm {
+namespace detail {
+
+inline std::uint32_t current_process_id() noexcept {
+    return static_cast<std::uint32_t>(getpid());
+}
+
+// false only if the process is known to be gone. A process we may not signal
+// (EPERM) is alive. PIDs can be reused, so a very old PID may report a stranger.
+inline bool is_process_alive(std::uint32_t pid) noexcept {
+    if (pid == 0) {
+        return false;
+    }
+    if (kill(static_cast<pid_t>(pid), 0) == 0) {
+        return true;
+    }
+    return errno != ESRCH;
+}
+
+}  // namespace detail
+}  // namespace shm
+}  // namespace slick
+
+#endif  // SLICK_SHM_POSIX
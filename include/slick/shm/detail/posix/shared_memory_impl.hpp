@@ -7,18 +7,33 @@
 
 #include <sys/mman.h>
 #include <sys/stat.h>
+#ifdef SLICK_SHM_LINUX
+#include <sys/syscall.h>
+#include <dirent.h>
+#endif
 #include <fcntl.h>
 #include <unistd.h>
+#include <algorithm>
+#include <atomic>
 #include <cerrno>
+#include <chrono>
+#include <cstdint>
 #include <cstring>
 
 #include <string>
 #include <system_error>
+#include <thread>
+#include <vector>
+
+#include "hugetlbfs.hpp"
+#include "lifetime_impl.hpp"
 
 namespace slick {
 namespace shm {
 namespace detail {
 
+using native_handle_type = int;
+
 class platform_shared_memory {
 public:
     platform_shared_memory() = default;
@@ -35,15 +50,26 @@ public:
     platform_shared_memory(platform_shared_memory&& other) noexcept
         : shm_fd_(other.shm_fd_),
           mapped_addr_(other.mapped_addr_),
-          name_(std::move(other.name_)),
-          original_name_(std::move(other.original_name_)),
+          name_(other.name_),
+          prefixed_(other.prefixed_),
+          interned_name_(other.interned_name_),
+          path_(std::move(other.path_)),
           size_(other.size_),
+          page_size_(other.page_size_),
           mode_(other.mode_),
-          owns_shm_(other.owns_shm_) {
+          owns_shm_(other.owns_shm_),
+          huge_pages_(other.huge_pages_),
+          locked_(other.locked_),
+          mirrored_(other.mirrored_),
+          options_(other.options_),
+          lifetime_(other.lifetime_),
+          tail_(other.tail_) {
         other.shm_fd_ = -1;
         other.mapped_addr_ = nullptr;
         other.size_ = 0;
         other.owns_shm_ = false;
+        other.lifetime_ = nullptr;
+        other.tail_ = 0;
     }
 
     platform_shared_memory& operator=(platform_shared_memory&& other) noexcept {
@@ -52,21 +78,47 @@ public:
 
             shm_fd_ = other.shm_fd_;
             mapped_addr_ = other.mapped_addr_;
-            name_ = std::move(other.name_);
-            original_name_ = std::move(other.original_name_);
+            name_ = other.name_;
+            prefixed_ = other.prefixed_;
+            interned_name_ = other.interned_name_;
+            path_ = std::move(other.path_);
             size_ = other.size_;
+            page_size_ = other.page_size_;
             mode_ = other.mode_;
             owns_shm_ = other.owns_shm_;
+            huge_pages_ = other.huge_pages_;
+            locked_ = other.locked_;
+            mirrored_ = other.mirrored_;
+            options_ = other.options_;
+            lifetime_ = other.lifetime_;
+            tail_ = other.tail_;
 
             other.shm_fd_ = -1;
             other.mapped_addr_ = nullptr;
             other.size_ = 0;
             other.owns_shm_ = false;
+            other.lifetime_ = nullptr;
+            other.tail_ = 0;
         }
         return *this;
     }
 
-    std::error_code create(const char* name, std::size_t size, create_mode mode, access_mode access) {
+    std::error_code create(const char* name, std::size_t size, create_mode mode, access_mode access,
+                           const segment_options& options = segment_options()) {
+        if (options.copy_on_write) {
+            // A creator's writes would never reach the segment
+            return make_error_code(errc::invalid_argument);
+        }
+        bool ref_counted = options.lifetime == segment_lifetime::ref_counted;
+        if (ref_counted &&
+            (options.file_backed || options.mirror || mode == create_mode::open_always)) {
+            // Files are meant to persist, a mirror would wrap around the table, and
+            // truncating an existing segment would move it
+            return make_error_code(errc::invalid_argument);
+        }
+        if (options.file_backed) {
+            return create_file(name, size, mode, access, options);
+        }
         if (!is_valid_name(name)) {
             return make_error_code(errc::invalid_name);
         }
@@ -75,10 +127,600 @@ public:
             return make_error_code(errc::invalid_size);
         }
 
-        original_name_ = name;  // Store original name for accessor
-        name_ = format_name(name);  // Store formatted name for POSIX API
-        size_ = size;
+        set_name(name);
+        mode_ = access;
+        options_ = options;
+        if (ref_counted) {
+            // Room for the lifetime table in the last bytes of the object
+            size = (size + 63) / 64 * 64 + sizeof(lifetime_table);
+        }
+
+        if (options.huge_page_policy != huge_pages::none) {
+            std::error_code ec = create_huge(size, mode, options);
+            if (!ec || options.huge_page_policy == huge_pages::required) {
+                return ec;
+            }
+            // huge_pages::preferred - fall back to standard pages
+        }
+
+        path_.clear();
+        huge_pages_ = false;
+        page_size_ = system_page_size();
+        if (options.mirror) {
+            // Both views of a mirrored mapping must start on a page boundary
+            size = (size + page_size_ - 1) / page_size_ * page_size_;
+        }
+        return create_object(size, mode);
+    }
+
+    std::error_code open(const char* name, access_mode access,
+                         const segment_options& options = segment_options()) {
+        if (options.file_backed) {
+            return open_file(name, access, options);
+        }
+        if (!is_valid_name(name)) {
+            return make_error_code(errc::invalid_name);
+        }
+
+        set_name(name);
+        path_.clear();
         mode_ = access;
+        options_ = options;
+        owns_shm_ = false;  // We didn't create it, so don't unlink it
+
+        // A copy-on-write mapping never writes to the object
+        int flags = (access == access_mode::read_only || options.copy_on_write) ? O_RDONLY : O_RDWR;
+
+        shm_fd_ = shm_open(name_.c_str(), flags, 0);
+
+        if (shm_fd_ == -1) {
+            if (errno != ENOENT) {
+                return get_errno_error();
+            }
+            // Not in the shm namespace - it may be a hugetlbfs-backed segment
+            shm_fd_ = open_hugetlbfs(name_.c_str(), flags, path_);
+            if (shm_fd_ == -1) {
+                return make_error_code(errc::not_found);
+            }
+        }
+
+        detect_page_size();
+
+        // Get the size using fstat
+        struct stat sb;
+        if (fstat(shm_fd_, &sb) == -1) {
+            std::error_code ec = get_errno_error();
+            ::close(shm_fd_);
+            shm_fd_ = -1;
+            return ec;
+        }
+        if (sb.st_size == 0) {
+            // The creator hasn't sized the object yet (between shm_open() and ftruncate())
+            ::close(shm_fd_);
+            shm_fd_ = -1;
+            return make_error_code(errc::invalid_size);
+        }
+
+        size_ = static_cast<std::size_t>(sb.st_size);
+
+        std::error_code ec = map_impl();
+        if (!ec) {
+            ec = attach_lifetime(false);
+            if (ec) {
+                close_impl();
+            }
+        }
+        return ec;
+    }
+
+    // Unnamed segment: a sealed memfd on Linux, an shm object that is unlinked
+    // right after creation elsewhere
+    std::error_code create_anonymous(std::size_t size, const segment_options& options) {
+        if (size == 0) {
+            return make_error_code(errc::invalid_size);
+        }
+        if (options.copy_on_write) {
+            return make_error_code(errc::invalid_argument);
+        }
+
+        clear_name();
+        path_.clear();
+        mode_ = access_mode::read_write;
+        options_ = options;
+        owns_shm_ = true;
+
+        std::error_code ec;
+        if (options.huge_page_policy != huge_pages::none) {
+            ec = create_anonymous_object(size, true);
+            if (!ec || options.huge_page_policy == huge_pages::required) {
+                return ec;
+            }
+            // huge_pages::preferred - fall back to standard pages
+        }
+        return create_anonymous_object(size, false);
+    }
+
+    // Take ownership of a descriptor (from create_anonymous() in this or another
+    // process) and map it; the descriptor is closed on failure
+    std::error_code adopt(native_handle_type handle, access_mode access,
+                          const segment_options& options = segment_options()) {
+        if (handle < 0) {
+            return make_error_code(errc::invalid_argument);
+        }
+
+        shm_fd_ = handle;
+        clear_name();
+        path_.clear();
+        mode_ = access;
+        options_ = options;
+        owns_shm_ = false;
+        detect_page_size();
+
+        struct stat sb;
+        std::error_code ec;
+        if (fstat(shm_fd_, &sb) == -1) {
+            ec = get_errno_error();
+        } else if (sb.st_size == 0) {
+            ec = make_error_code(errc::invalid_size);
+        } else {
+            size_ = static_cast<std::size_t>(sb.st_size);
+            ec = map_impl();
+        }
+        if (ec) {
+            close_impl();
+        }
+        return ec;
+    }
+
+    std::error_code prefault(std::size_t offset, std::size_t length) noexcept {
+        if (!is_valid()) {
+            return make_error_code(errc::mapping_failed);
+        }
+        if (offset > size_ || length > size_ - offset) {
+            return make_error_code(errc::invalid_argument);
+        }
+        if (length == 0) {
+            return {};
+        }
+
+        char* begin = static_cast<char*>(mapped_addr_) + offset;
+        std::error_code ec = prefault_range(begin, length);
+        if (!ec && mirrored_) {
+            ec = prefault_range(begin + size_, length);
+        }
+        return ec;
+    }
+
+    std::error_code make_private(std::size_t offset, std::size_t length) noexcept {
+        if (!is_valid()) {
+            return make_error_code(errc::mapping_failed);
+        }
+        if (!options_.copy_on_write) {
+            return make_error_code(errc::not_supported);
+        }
+        if (mode_ == access_mode::read_only) {
+            return make_error_code(errc::permission_denied);
+        }
+        if (offset > size_ || length > size_ - offset) {
+            return make_error_code(errc::invalid_argument);
+        }
+        if (length == 0) {
+            return {};
+        }
+
+        char* begin = static_cast<char*>(mapped_addr_) + offset;
+        std::size_t misalignment = reinterpret_cast<std::uintptr_t>(begin) % page_size_;
+        begin -= misalignment;
+        length += misalignment;
+#ifdef SLICK_SHM_LINUX
+        // Write-populating a private mapping copies the pages without touching data
+        if (madvise(begin, length, MADV_POPULATE_WRITE_ADVICE) == 0) {
+            return {};
+        }
+        if (errno != EINVAL) {
+            return get_errno_error();
+        }
+        // Older kernel - fall back to write-faulting every page
+#endif
+        break_cow_pages(begin, length, page_size_);
+        return {};
+    }
+
+    bool is_copy_on_write() const noexcept {
+        return options_.copy_on_write;
+    }
+
+    std::error_code flush(std::size_t offset, std::size_t length, bool async) noexcept {
+        if (!is_valid()) {
+            return make_error_code(errc::mapping_failed);
+        }
+        if (offset > size_ || length > size_ - offset) {
+            return make_error_code(errc::invalid_argument);
+        }
+        if (length == 0) {
+            return {};
+        }
+
+        // msync() needs a page-aligned start address. Both views of a mirrored
+        // mapping share their pages, so flushing one is enough.
+        char* begin = static_cast<char*>(mapped_addr_) + offset;
+        std::size_t misalignment = reinterpret_cast<std::uintptr_t>(begin) % system_page_size();
+        if (msync(begin - misalignment, length + misalignment, async ? MS_ASYNC : MS_SYNC) != 0) {
+            return get_errno_error();
+        }
+        return {};
+    }
+
+    std::error_code lock(std::size_t offset, std::size_t length, memory_lock policy) noexcept {
+        if (!is_valid()) {
+            return make_error_code(errc::mapping_failed);
+        }
+        if (offset > size_ || length > size_ - offset) {
+            return make_error_code(errc::invalid_argument);
+        }
+        if (policy == memory_lock::none || length == 0) {
+            return {};
+        }
+
+        char* begin = static_cast<char*>(mapped_addr_) + offset;
+        std::error_code ec = lock_range(begin, length, policy);
+        if (!ec && mirrored_) {
+            ec = lock_range(begin + size_, length, policy);
+        }
+        if (ec) {
+            return ec;
+        }
+
+        locked_ = true;
+        return {};
+    }
+
+    std::error_code unlock(std::size_t offset, std::size_t length) noexcept {
+        if (!is_valid()) {
+            return make_error_code(errc::mapping_failed);
+        }
+        if (offset > size_ || length > size_ - offset) {
+            return make_error_code(errc::invalid_argument);
+        }
+        if (length == 0) {
+            return {};
+        }
+        char* begin = static_cast<char*>(mapped_addr_) + offset;
+        if (munlock(begin, length) != 0 || (mirrored_ && munlock(begin + size_, length) != 0)) {
+            return get_errno_error();
+        }
+        if (offset == 0 && length == size_) {
+            locked_ = false;
+        }
+        return {};
+    }
+
+    bool is_locked() const noexcept {
+        return locked_;
+    }
+
+    std::error_code numa_placement(std::vector<std::size_t>& pages_per_node) const {
+        pages_per_node.clear();
+        if (!is_valid()) {
+            return make_error_code(errc::mapping_failed);
+        }
+#ifdef SLICK_SHM_LINUX
+        // move_pages() without target nodes only reports where each page lives
+        constexpr std::size_t batch = 1024;
+        void* pages[batch];
+        int status[batch];
+        std::size_t page_count = (size_ + page_size_ - 1) / page_size_;
+        for (std::size_t first = 0; first < page_count; first += batch) {
+            std::size_t count = std::min(batch, page_count - first);
+            for (std::size_t i = 0; i < count; ++i) {
+                pages[i] = static_cast<char*>(mapped_addr_) + (first + i) * page_size_;
+            }
+            if (syscall(SYS_move_pages, 0, count, pages, nullptr, status, 0) != 0) {
+                return get_errno_error();
+            }
+            for (std::size_t i = 0; i < count; ++i) {
+                if (status[i] < 0) {
+                    continue;  // Not faulted in yet (-ENOENT)
+                }
+                std::size_t node = static_cast<std::size_t>(status[i]);
+                if (pages_per_node.size() <= node) {
+                    pages_per_node.resize(node + 1, 0);
+                }
+                ++pages_per_node[node];
+            }
+        }
+        return {};
+#else
+        return make_error_code(errc::not_supported);
+#endif
+    }
+
+    void unmap() noexcept {
+        unmap_impl();
+    }
+
+    void close() noexcept {
+        close_impl();
+    }
+
+    void* data() noexcept {
+        return mapped_addr_;
+    }
+
+    const void* data() const noexcept {
+        return mapped_addr_;
+    }
+
+    std::size_t size() const noexcept {
+        return size_;
+    }
+
+    const char* name() const noexcept {
+        if (interned_name_ != nullptr) {
+            return interned_name_;
+        }
+        if (options_.file_backed) {
+            return path_.c_str();
+        }
+        return name_.c_str() + (prefixed_ ? 1 : 0);
+    }
+
+    bool is_valid() const noexcept {
+        return mapped_addr_ != nullptr && mapped_addr_ != MAP_FAILED;
+    }
+
+    access_mode mode() const noexcept {
+        return mode_;
+    }
+
+    bool is_creator() const noexcept {
+        return owns_shm_;
+    }
+
+    bool uses_huge_pages() const noexcept {
+        return huge_pages_;
+    }
+
+    std::size_t page_size() const noexcept {
+        return page_size_;
+    }
+
+    bool is_mirrored() const noexcept {
+        return mirrored_;
+    }
+
+    native_handle_type native_handle() const noexcept {
+        return shm_fd_;
+    }
+
+    // The size is sealed (F_SEAL_SHRINK and F_SEAL_GROW), so it can't change
+    bool is_sealed() const noexcept {
+#ifdef SLICK_SHM_LINUX
+        int seals = shm_fd_ == -1 ? -1 : fcntl(shm_fd_, F_GET_SEALS_CMD);
+        return seals != -1 && (seals & (F_SEAL_SHRINK_FLAG | F_SEAL_GROW_FLAG)) ==
+                                  (F_SEAL_SHRINK_FLAG | F_SEAL_GROW_FLAG);
+#else
+        return false;
+#endif
+    }
+
+    static bool remove(const char* name) noexcept {
+        if (!is_valid_name(name)) {
+            return false;
+        }
+
+        formatted_name formatted = format_name(name);
+        if (shm_unlink(formatted.c_str()) == 0) {
+            return true;
+        }
+
+        std::string path;
+        int fd = open_hugetlbfs(formatted.c_str(), O_RDONLY, path);
+        if (fd == -1) {
+            return false;
+        }
+        ::close(fd);
+        return ::unlink(path.c_str()) == 0;
+    }
+
+    // Remove the ref_counted segments whose name starts with prefix and whose
+    // processes are all gone; returns how many were removed
+    static std::size_t sweep(const char* prefix) noexcept {
+        if (prefix == nullptr) {
+            return 0;
+        }
+        if (prefix[0] == '/') {
+            ++prefix;
+        }
+#ifdef SLICK_SHM_LINUX
+        std::size_t removed = sweep_directory("/dev/shm", prefix);
+        for_each_hugetlbfs_mount([&](const char* dir, std::size_t) {
+            removed += sweep_directory(dir, prefix);
+            return false;
+        });
+        return removed;
+#else
+        // The shm namespace can't be listed
+        return 0;
+#endif
+    }
+
+    static bool exists(const char* name) noexcept {
+        if (!is_valid_name(name)) {
+            return false;
+        }
+
+        formatted_name formatted = format_name(name);
+        int fd = shm_open(formatted.c_str(), O_RDONLY, 0);
+        if (fd == -1) {
+            std::string path;
+            fd = open_hugetlbfs(formatted.c_str(), O_RDONLY, path);
+        }
+        if (fd != -1) {
+            ::close(fd);
+            return true;
+        }
+        return false;
+    }
+
+    // Name with the "/" prefix POSIX requires, stored inline
+    using formatted_name = fixed_name<char, MAX_NAME_LENGTH + 1>;
+
+    static formatted_name format_name(const char* name) noexcept {
+        // name is guaranteed non-null, non-empty and short enough by is_valid_name() checks
+        formatted_name formatted;
+        formatted.assign(name, name[0] == '/' ? '\0' : '/');
+        return formatted;
+    }
+
+    // Opens an existing hugetlbfs-backed segment, returns -1 if there is none
+    static int open_hugetlbfs(const char* formatted_name, int flags, std::string& path) {
+#ifdef SLICK_SHM_LINUX
+        int fd = -1;
+        for_each_hugetlbfs_mount([&](const char* dir, std::size_t) {
+            std::string candidate = hugetlbfs_path(dir, formatted_name);
+            fd = ::open(candidate.c_str(), flags, 0);
+            if (fd == -1) {
+                return false;
+            }
+            path = candidate;
+            return true;
+        });
+        return fd;
+#else
+        (void)formatted_name;
+        (void)flags;
+        (void)path;
+        return -1;
+#endif
+    }
+
+private:
+    int shm_fd_ = -1;
+    void* mapped_addr_ = nullptr;
+    formatted_name name_;  // Formatted name with "/" prefix for POSIX API
+    bool prefixed_ = false;  // name_ has a "/" the caller didn't pass; name() skips it
+    const char* interned_name_ = nullptr;  // What name() returns, see intern_name()
+    std::string path_;  // hugetlbfs or regular file path, empty for shm_open objects
+    std::size_t size_ = 0;
+    std::size_t page_size_ = 0;
+    access_mode mode_ = access_mode::read_write;
+    bool owns_shm_ = false;  // Track if we created it (for unlinking)
+    bool huge_pages_ = false;  // Backed by huge pages
+    bool locked_ = false;  // mlock() succeeded on (part of) the mapping
+    bool mirrored_ = false;  // Mapped twice back-to-back (2 * size_ bytes)
+    segment_options options_;  // Options used to create/open the segment
+    lifetime_table* lifetime_ = nullptr;  // Set while this handle is counted (ref_counted)
+    std::size_t tail_ = 0;  // Bytes mapped past size_ (the lifetime table)
+
+#ifdef SLICK_SHM_LINUX
+    static constexpr unsigned int MLOCK_ONFAULT_FLAG = 0x01;  // MLOCK_ONFAULT
+
+    // Values from linux/mempolicy.h (libnuma is not required)
+    static constexpr int MPOL_PREFERRED_MODE = 1;
+    static constexpr int MPOL_BIND_MODE = 2;
+    static constexpr int MPOL_INTERLEAVE_MODE = 3;
+    static constexpr unsigned int MPOL_MF_MOVE_FLAG = 1u << 1;
+#endif
+
+#ifdef SLICK_SHM_LINUX
+    // Values from linux/mman.h, not exposed by older C library headers
+    static constexpr int MADV_POPULATE_READ_ADVICE = 22;
+    static constexpr int MADV_POPULATE_WRITE_ADVICE = 23;
+
+    // Values from linux/memfd.h and linux/fcntl.h
+    static constexpr unsigned int MFD_CLOEXEC_FLAG = 0x0001;
+    static constexpr unsigned int MFD_ALLOW_SEALING_FLAG = 0x0002;
+    static constexpr unsigned int MFD_HUGETLB_FLAG = 0x0004;
+    static constexpr unsigned int MFD_HUGE_SHIFT = 26;
+    static constexpr int F_ADD_SEALS_CMD = 1033;
+    static constexpr int F_GET_SEALS_CMD = 1034;
+    static constexpr int F_SEAL_SEAL_FLAG = 0x0001;
+    static constexpr int F_SEAL_SHRINK_FLAG = 0x0002;
+    static constexpr int F_SEAL_GROW_FLAG = 0x0004;
+
+    // Values from linux/mman.h (Linux 4.15+)
+    static constexpr int MAP_SHARED_VALIDATE_FLAG = 0x03;
+    static constexpr int MAP_SYNC_FLAG = 0x80000;
+
+    // Value from linux/mman.h (Linux 4.17+); older kernels treat it as a hint
+    static constexpr int MAP_FIXED_NOREPLACE_FLAG = 0x100000;
+#endif
+
+    void set_name(const char* name) noexcept {
+        name_ = format_name(name);
+        prefixed_ = name[0] != '/';
+        interned_name_ = intern_name(name);
+    }
+
+    void set_path(const char* path) {
+        clear_name();
+        path_ = path;
+        interned_name_ = intern_name(path);
+    }
+
+    void clear_name() noexcept {
+        name_.clear();
+        prefixed_ = false;
+        interned_name_ = nullptr;
+    }
+
+    // shm_open() or, for hugetlbfs-backed segments, open() on path_
+    int open_object(int flags, mode_t perms) const {
+        if (path_.empty()) {
+            return shm_open(name_.c_str(), flags, perms);
+        }
+        return ::open(path_.c_str(), flags, perms);
+    }
+
+    int unlink_object() const {
+        if (path_.empty()) {
+            return shm_unlink(name_.c_str());
+        }
+        return ::unlink(path_.c_str());
+    }
+
+    // Named segments live in the shm namespace, or on a hugetlbfs mount when
+    // created with huge pages, and a name must refer to a single object across
+    // both. Points open_object() at the other one if the name exists there
+    bool use_existing_namespace() {
+        if (options_.file_backed) {
+            return false;
+        }
+        if (path_.empty()) {
+            std::string path;
+            int fd = open_hugetlbfs(name_.c_str(), O_RDONLY, path);
+            if (fd == -1) {
+                return false;
+            }
+            ::close(fd);
+            path_ = std::move(path);
+            return true;
+        }
+        int fd = shm_open(name_.c_str(), O_RDONLY, 0);
+        if (fd == -1) {
+            return false;
+        }
+        ::close(fd);
+        path_.clear();
+        return true;
+    }
+
+    std::error_code create_object(std::size_t size, create_mode mode) {
+        // An existing object can be unlinked between the O_EXCL attempt and the
+        // open (a ref_counted segment whose last process just detached can't be
+        // opened either); once it is gone the next attempt creates a new one
+        for (int attempt = 0;; ++attempt) {
+            std::error_code ec = create_object_once(size, mode);
+            if (ec != errc::not_found || mode == create_mode::create_only || attempt == 100) {
+                return ec;
+            }
+            std::this_thread::yield();
+        }
+    }
+
+    std::error_code create_object_once(std::size_t size, create_mode mode) {
+        size_ = size;
 
         int perms = 0666;  // Default permissions (modified by umask)
         bool created = false;
@@ -89,14 +731,21 @@ public:
                 shm_fd_ = -1;
             }
             if (owns_shm_) {
-                shm_unlink(name_.c_str());
+                unlink_object();
                 owns_shm_ = false;
             }
             return ec;
         };
 
+        // An object of this name on the other side (hugetlbfs or the shm
+        // namespace) is the one to open, so creators and openers can't split
+        bool switched = use_existing_namespace();
+        if (switched && mode == create_mode::create_only) {
+            return make_error_code(errc::already_exists);
+        }
+
         if (mode == create_mode::create_only) {
-            shm_fd_ = shm_open(name_.c_str(), O_CREAT | O_EXCL | O_RDWR, perms);
+            shm_fd_ = open_object(O_CREAT | O_EXCL | O_RDWR, perms);
             if (shm_fd_ == -1) {
                 if (errno == EEXIST) {
                     return make_error_code(errc::already_exists);
@@ -105,28 +754,31 @@ public:
             }
             created = true;
         } else if (mode == create_mode::open_or_create) {
-            shm_fd_ = shm_open(name_.c_str(), O_CREAT | O_EXCL | O_RDWR, perms);
+            shm_fd_ = open_object(O_CREAT | O_EXCL | O_RDWR, perms);
             if (shm_fd_ == -1) {
                 if (errno != EEXIST) {
                     return get_errno_error();
                 }
-                int flags = (access == access_mode::read_only) ? O_RDONLY : O_RDWR;
-                shm_fd_ = shm_open(name_.c_str(), flags, 0);
+                int flags = (mode_ == access_mode::read_only) ? O_RDONLY : O_RDWR;
+                shm_fd_ = open_object(flags, 0);
                 if (shm_fd_ == -1) {
-                    return get_errno_error();
+                    // Unlinked since the O_EXCL attempt: create_object() tries again
+                    return errno == ENOENT ? make_error_code(errc::not_found)
+                                           : get_errno_error();
                 }
             } else {
                 created = true;
             }
         } else {  // open_always
-            shm_fd_ = shm_open(name_.c_str(), O_CREAT | O_EXCL | O_RDWR, perms);
+            shm_fd_ = open_object(O_CREAT | O_EXCL | O_RDWR, perms);
             if (shm_fd_ == -1) {
                 if (errno != EEXIST) {
                     return get_errno_error();
                 }
-                shm_fd_ = shm_open(name_.c_str(), O_RDWR, 0);
+                shm_fd_ = open_object(O_RDWR, 0);
                 if (shm_fd_ == -1) {
-                    return get_errno_error();
+                    return errno == ENOENT ? make_error_code(errc::not_found)
+                                           : get_errno_error();
                 }
             } else {
                 created = true;
@@ -134,9 +786,16 @@ public:
         }
 
         owns_shm_ = created;
+        if (switched) {
+            // The existing object decides the page size
+            detect_page_size();
+            size_ = (size_ + page_size_ - 1) / page_size_ * page_size_;
+        }
 
+        // A new object has size 0, so only an existing one needs fstat()
         struct stat sb;
-        if (fstat(shm_fd_, &sb) == -1) {
+        sb.st_size = 0;
+        if (!created && fstat(shm_fd_, &sb) == -1) {
             return cleanup_error(get_errno_error());
         }
 
@@ -152,149 +811,616 @@ public:
                     return cleanup_error(get_errno_error());
                 }
             } else {
-                // ftruncate succeeded, update size
+#ifdef SLICK_SHM_MACOS
+                // macOS rounds shm objects up to the page size
                 if (fstat(shm_fd_, &sb) == -1) {
                     return cleanup_error(get_errno_error());
                 }
+#else
+                sb.st_size = static_cast<off_t>(size_);
+#endif
             }
         }
 
         size_ = static_cast<std::size_t>(sb.st_size);
 
-        return map_impl();
+        std::error_code ec = map_impl();
+        if (!ec) {
+            ec = attach_lifetime(created);
+            if (ec) {
+                unmap_impl();
+            }
+        }
+        if (ec) {
+            return cleanup_error(ec);
+        }
+        return {};
     }
 
-    std::error_code open(const char* name, access_mode access) {
-        if (!is_valid_name(name)) {
+    // Finds the lifetime table at the end of the mapping (writes it in a new
+    // ref_counted object) and counts this handle. Read-only and copy-on-write
+    // mappings can't update the table; they stay valid after the unlink anyway
+    std::error_code attach_lifetime(bool created) {
+        if (created) {
+            if (options_.lifetime == segment_lifetime::ref_counted) {
+                tail_ = sizeof(lifetime_table);
+                lifetime_ = init_lifetime_table(mapped_addr_, size_);
+                size_ -= tail_;
+            }
+            return {};
+        }
+
+        lifetime_table* table = find_lifetime_table(mapped_addr_, size_);
+        if (table == nullptr && options_.lifetime == segment_lifetime::ref_counted) {
+            // The creator publishes the table right after mapping the new object
+            auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+            while (table == nullptr && std::chrono::steady_clock::now() < deadline) {
+                std::this_thread::yield();
+                table = find_lifetime_table(mapped_addr_, size_);
+            }
+            if (table == nullptr) {
+                return make_error_code(errc::incompatible_layout);
+            }
+        }
+        if (table == nullptr) {
+            return {};
+        }
+        if (mirrored_) {
+            return make_error_code(errc::not_supported);
+        }
+
+        if (mode_ == access_mode::read_write && !options_.copy_on_write) {
+            std::error_code ec = lifetime_attach(*table);
+            if (ec) {
+                return ec;
+            }
+            lifetime_ = table;
+        }
+        tail_ = sizeof(lifetime_table);
+        size_ -= tail_;
+        return {};
+    }
+
+    // Unlinks the name only if it still refers to our object: after the count
+    // dropped to zero, a new segment may already have been created under it
+    void unlink_if_same() const noexcept {
+        struct stat ours;
+        struct stat named;
+        if (shm_fd_ == -1 || fstat(shm_fd_, &ours) == -1) {
+            return;
+        }
+        int fd = open_object(O_RDONLY, 0);
+        if (fd == -1) {
+            return;
+        }
+        bool same = fstat(fd, &named) == 0 && named.st_dev == ours.st_dev &&
+                    named.st_ino == ours.st_ino;
+        ::close(fd);
+        if (same) {
+            unlink_object();
+        }
+    }
+
+#ifdef SLICK_SHM_LINUX
+    static std::size_t sweep_directory(const char* dir, const char* prefix) noexcept {
+        DIR* d = opendir(dir);
+        if (d == nullptr) {
+            return 0;
+        }
+        std::size_t removed = 0;
+        std::size_t prefix_length = std::strlen(prefix);
+        std::string path;
+        while (dirent* entry = readdir(d)) {
+            if (entry->d_name[0] == '.' ||
+                std::strncmp(entry->d_name, prefix, prefix_length) != 0) {
+                continue;
+            }
+            path.assign(dir).append("/").append(entry->d_name);
+            removed += sweep_object(path.c_str()) ? 1 : 0;
+        }
+        closedir(d);
+        return removed;
+    }
+
+    // Maps only the pages holding the table, so huge segments cost nothing to check
+    static bool sweep_object(const char* path) noexcept {
+        int fd = ::open(path, O_RDWR | O_CLOEXEC | O_NOFOLLOW);
+        if (fd == -1) {
+            return false;
+        }
+        struct stat ours;
+        if (fstat(fd, &ours) == -1 || !S_ISREG(ours.st_mode) ||
+            static_cast<std::size_t>(ours.st_size) < sizeof(lifetime_table)) {
+            ::close(fd);
+            return false;
+        }
+        std::size_t page_size = hugetlbfs_page_size(fd);
+        if (page_size == 0) {
+            page_size = system_page_size();
+        }
+        std::size_t size = static_cast<std::size_t>(ours.st_size);
+        std::size_t offset = (size - sizeof(lifetime_table)) / page_size * page_size;
+        std::size_t length = size - offset;
+        void* tail = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED, fd,
+                          static_cast<off_t>(offset));
+        bool removed = false;
+        if (tail != MAP_FAILED) {
+            lifetime_table* table = find_lifetime_table(tail, length);
+            if (table != nullptr && lifetime_sweep(*table)) {
+                struct stat named;
+                removed = ::stat(path, &named) == 0 && named.st_dev == ours.st_dev &&
+                          named.st_ino == ours.st_ino && ::unlink(path) == 0;
+            }
+            munmap(tail, length);
+        }
+        ::close(fd);
+        return removed;
+    }
+#endif
+
+    // Regular file at the path given as name. path_ is set, so open_object()
+    // and unlink_object() work on the file and create_object() does the rest
+    std::error_code create_file(const char* path, std::size_t size, create_mode mode,
+                                access_mode access, const segment_options& options) {
+        if (!is_valid_path(path)) {
             return make_error_code(errc::invalid_name);
         }
+        if (size == 0) {
+            return make_error_code(errc::invalid_size);
+        }
+        if (options.huge_page_policy == huge_pages::required) {
+            return make_error_code(errc::not_supported);
+        }
 
-        original_name_ = name;  // Store original name for accessor
-        name_ = format_name(name);  // Store formatted name for POSIX API
+        set_path(path);
         mode_ = access;
-        owns_shm_ = false;  // We didn't create it, so don't unlink it
+        options_ = options;
+        huge_pages_ = false;
+        page_size_ = system_page_size();
+        if (options.mirror) {
+            size = (size + page_size_ - 1) / page_size_ * page_size_;
+        }
+        std::error_code ec = create_object(size, mode);
+        if (ec) {
+            path_.clear();
+            interned_name_ = nullptr;
+        }
+        return ec;
+    }
 
-        int flags = (access == access_mode::read_only) ? O_RDONLY : O_RDWR;
+    std::error_code open_file(const char* path, access_mode access,
+                              const segment_options& options) {
+        if (!is_valid_path(path)) {
+            return make_error_code(errc::invalid_name);
+        }
 
-        shm_fd_ = shm_open(name_.c_str(), flags, 0);
+        set_path(path);
+        mode_ = access;
+        options_ = options;
+        owns_shm_ = false;
 
+        bool read_only = access == access_mode::read_only || options.copy_on_write;
+        shm_fd_ = open_object(read_only ? O_RDONLY : O_RDWR, 0);
         if (shm_fd_ == -1) {
-            if (errno == ENOENT) {
-                return make_error_code(errc::not_found);
-            }
-            return get_errno_error();
+            std::error_code ec = errno == ENOENT ? make_error_code(errc::not_found)
+                                                 : get_errno_error();
+            path_.clear();
+            interned_name_ = nullptr;
+            return ec;
         }
+        detect_page_size();
 
-        // Get the size using fstat
         struct stat sb;
+        std::error_code ec;
         if (fstat(shm_fd_, &sb) == -1) {
-            std::error_code ec = get_errno_error();
-            ::close(shm_fd_);
-            shm_fd_ = -1;
-            return ec;
+            ec = get_errno_error();
+        } else if (sb.st_size == 0) {
+            ec = make_error_code(errc::invalid_size);
+        } else {
+            size_ = static_cast<std::size_t>(sb.st_size);
+            ec = map_impl();
         }
+        if (ec) {
+            close_impl();
+            path_.clear();
+            interned_name_ = nullptr;
+        }
+        return ec;
+    }
 
-        size_ = static_cast<std::size_t>(sb.st_size);
+    // Creates, sizes and maps the object behind create_anonymous()
+    std::error_code create_anonymous_object(std::size_t size, bool huge) {
+        huge_pages_ = false;
+        page_size_ = system_page_size();
 
-        return map_impl();
-    }
+        std::error_code ec = huge ? open_anonymous_huge() : open_anonymous();
+        if (ec) {
+            return ec;
+        }
+        if (huge_pages_ || options_.mirror) {
+            size = (size + page_size_ - 1) / page_size_ * page_size_;
+        }
+        size_ = size;
 
-    void unmap() noexcept {
-        unmap_impl();
+        if (ftruncate(shm_fd_, static_cast<off_t>(size_)) == -1) {
+            ec = get_errno_error();
+        }
+#ifdef SLICK_SHM_LINUX
+        // Sealing the size lets every process that maps the descriptor trust it
+        if (!ec && fcntl(shm_fd_, F_ADD_SEALS_CMD,
+                         F_SEAL_SHRINK_FLAG | F_SEAL_GROW_FLAG | F_SEAL_SEAL_FLAG) == -1) {
+            ec = get_errno_error();
+        }
+#endif
+        if (!ec) {
+            ec = map_impl();
+        }
+        if (ec) {
+            close_impl();
+            if (huge && (ec == std::errc::not_enough_memory || ec == std::errc::invalid_argument)) {
+                return make_error_code(errc::huge_pages_unavailable);
+            }
+        }
+        return ec;
     }
 
-    void close() noexcept {
-        close_impl();
+    std::error_code open_anonymous() {
+#if defined(SLICK_SHM_LINUX) && defined(SYS_memfd_create)
+        shm_fd_ = static_cast<int>(
+            syscall(SYS_memfd_create, "slick_shm", MFD_CLOEXEC_FLAG | MFD_ALLOW_SEALING_FLAG));
+        if (shm_fd_ != -1) {
+            return {};
+        }
+        if (errno != ENOSYS) {
+            return get_errno_error();
+        }
+        // Kernel older than 3.17 - use an unlinked shm object
+#endif
+        // Unique within the process, short enough for macOS (31 characters)
+        static std::atomic<unsigned int> counter{0};
+        for (int attempt = 0; attempt < 16; ++attempt) {
+            std::string name = "/slick_anon_" + std::to_string(getpid()) + "_" +
+                               std::to_string(counter.fetch_add(1, std::memory_order_relaxed));
+            shm_fd_ = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+            if (shm_fd_ != -1) {
+                shm_unlink(name.c_str());
+                return {};
+            }
+            if (errno != EEXIST) {
+                break;
+            }
+        }
+        return get_errno_error();
     }
 
-    void* data() noexcept {
-        return mapped_addr_;
+    std::error_code open_anonymous_huge() {
+#if defined(SLICK_SHM_LINUX) && defined(SYS_memfd_create)
+        unsigned int flags = MFD_CLOEXEC_FLAG | MFD_ALLOW_SEALING_FLAG | MFD_HUGETLB_FLAG;
+        if (options_.huge_page_size != 0) {
+            std::size_t bits = 0;
+            while ((std::size_t(1) << bits) < options_.huge_page_size) {
+                ++bits;
+            }
+            if ((std::size_t(1) << bits) != options_.huge_page_size) {
+                return make_error_code(errc::huge_pages_unavailable);
+            }
+            flags |= static_cast<unsigned int>(bits) << MFD_HUGE_SHIFT;
+        }
+        shm_fd_ = static_cast<int>(syscall(SYS_memfd_create, "slick_shm", flags));
+        if (shm_fd_ == -1) {
+            return make_error_code(errc::huge_pages_unavailable);
+        }
+        detect_page_size();
+        return {};
+#else
+        return make_error_code(errc::huge_pages_unavailable);
+#endif
     }
 
-    const void* data() const noexcept {
-        return mapped_addr_;
-    }
+    std::error_code create_huge(std::size_t size, create_mode mode,
+                                const segment_options& options) {
+#ifdef SLICK_SHM_LINUX
+        // Named huge page segments live on a hugetlbfs mount (e.g. /dev/hugepages)
+        // so that other processes can open them by name.
+        std::string mount_dir;
+        std::size_t huge_page_size = 0;
+        if (!find_hugetlbfs_mount(options.huge_page_size, mount_dir, huge_page_size)) {
+            return make_error_code(errc::huge_pages_unavailable);
+        }
 
-    std::size_t size() const noexcept {
-        return size_;
-    }
+        path_ = hugetlbfs_path(mount_dir, name_.c_str());
+        page_size_ = huge_page_size;
+        huge_pages_ = true;
 
-    const char* name() const noexcept {
-        return original_name_.c_str();
+        // hugetlbfs requires the size to be a multiple of the huge page size
+        std::size_t rounded = (size + huge_page_size - 1) / huge_page_size * huge_page_size;
+        std::error_code ec = create_object(rounded, mode);
+        if (ec) {
+            path_.clear();
+            huge_pages_ = false;
+            // The huge page pool is exhausted or not reserved
+            if (ec == std::errc::not_enough_memory || ec == std::errc::invalid_argument) {
+                return make_error_code(errc::huge_pages_unavailable);
+            }
+        }
+        return ec;
+#else
+        // macOS superpages (VM_FLAGS_SUPERPAGE_SIZE_*) are only available for anonymous
+        // memory, not for named shm_open objects.
+        (void)size;
+        (void)mode;
+        (void)options;
+        return make_error_code(errc::huge_pages_unavailable);
+#endif
     }
 
-    bool is_valid() const noexcept {
-        return mapped_addr_ != nullptr && mapped_addr_ != MAP_FAILED;
+    void detect_page_size() {
+#ifdef SLICK_SHM_LINUX
+        std::size_t huge_page_size = hugetlbfs_page_size(shm_fd_);
+        if (huge_page_size != 0) {
+            huge_pages_ = true;
+            page_size_ = huge_page_size;
+            return;
+        }
+#endif
+        huge_pages_ = false;
+        page_size_ = system_page_size();
     }
 
-    access_mode mode() const noexcept {
-        return mode_;
+    static std::size_t system_page_size() {
+        static const std::size_t page_size = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+        return page_size;
     }
 
-    bool is_creator() const noexcept {
-        return owns_shm_;
-    }
+    std::error_code map_impl() {
+        if (shm_fd_ == -1) {
+            return make_error_code(errc::mapping_failed);
+        }
 
-    static bool remove(const char* name) noexcept {
-        if (!is_valid_name(name)) {
-            return false;
+        if (options_.numa != numa_policy::none && options_.numa_nodes == 0) {
+            return make_error_code(errc::invalid_argument);
+        }
+#ifndef SLICK_SHM_LINUX
+        if (options_.numa != numa_policy::none) {
+            return make_error_code(errc::not_supported);
         }
+#endif
 
-        std::string formatted_name = format_name(name);
-        return shm_unlink(formatted_name.c_str()) == 0;
-    }
+        if (options_.copy_on_write && (options_.mirror || options_.sync_mapping)) {
+            // The two views of a private mirror would diverge on their first write
+            return make_error_code(errc::not_supported);
+        }
 
-    static bool exists(const char* name) noexcept {
-        if (!is_valid_name(name)) {
-            return false;
+        int prot = get_mmap_prot(mode_);
+        // Share with other processes, or see their pages until this one writes
+        int flags = options_.copy_on_write ? MAP_PRIVATE : MAP_SHARED;
+        bool populated = false;
+#ifdef SLICK_SHM_LINUX
+        // With a NUMA policy, pages must not be faulted before mbind(). On a
+        // writable private mapping MAP_POPULATE would copy every page
+        if (options_.prefault && options_.numa == numa_policy::none && !options_.copy_on_write) {
+            flags |= MAP_POPULATE;
+            populated = true;
+        }
+        if (options_.sync_mapping) {
+            // Writes reach persistent memory without msync() of file metadata
+            flags |= MAP_SHARED_VALIDATE_FLAG | MAP_SYNC_FLAG;
         }
+#else
+        if (options_.sync_mapping) {
+            return make_error_code(errc::not_supported);
+        }
+#endif
 
-        std::string formatted_name = format_name(name);
-        int fd = shm_open(formatted_name.c_str(), O_RDONLY, 0);
-        if (fd != -1) {
-            ::close(fd);
-            return true;
+        void* base = options_.base_address;
+        if (base) {
+            if (options_.mirror) {
+                return make_error_code(errc::not_supported);
+            }
+            if (reinterpret_cast<std::uintptr_t>(base) % page_size_ != 0) {
+                return make_error_code(errc::invalid_argument);
+            }
+#ifdef SLICK_SHM_LINUX
+            // Fail instead of replacing whatever is mapped there (MAP_FIXED would)
+            flags |= MAP_FIXED_NOREPLACE_FLAG;
+#endif
         }
-        return false;
+
+        std::error_code ec;
+        if (options_.mirror) {
+            ec = map_mirrored(prot, flags);
+        } else {
+            mapped_addr_ = mmap(
+                base,              // nullptr lets the kernel choose the address
+                size_,
+                prot,
+                flags,
+                shm_fd_,
+                0                  // Offset
+            );
+
+            if (mapped_addr_ == MAP_FAILED) {
+                mapped_addr_ = nullptr;
+                ec = get_errno_error();
+                if (base && ec == std::errc::file_exists) {
+                    return make_error_code(errc::address_in_use);
+                }
+            } else if (base && mapped_addr_ != base) {
+                // The address was only taken as a hint (not Linux, or before 4.17)
+                munmap(mapped_addr_, size_);
+                mapped_addr_ = nullptr;
+                return make_error_code(errc::address_in_use);
+            }
+        }
+        if (ec) {
+            // MAP_SYNC is refused (EOPNOTSUPP) outside DAX file systems
+            if (options_.sync_mapping && ec == std::errc::operation_not_supported) {
+                return make_error_code(errc::not_supported);
+            }
+            return ec;
+        }
+
+#ifdef SLICK_SHM_LINUX
+        if (options_.numa != numa_policy::none) {
+            std::error_code ec = apply_numa_policy();
+            if (ec) {
+                unmap_impl();
+                return ec;
+            }
+        }
+#endif
+        if (options_.prefault && !populated) {
+            std::error_code ec = prefault(0, size_);
+            if (ec) {
+                unmap_impl();
+                return ec;
+            }
+        }
+
+        if (options_.lock != memory_lock::none) {
+            std::error_code ec = lock(0, size_, options_.lock);
+            if (ec) {
+                unmap_impl();
+                return ec;
+            }
+        }
+
+        return {};
     }
 
-private:
-    int shm_fd_ = -1;
-    void* mapped_addr_ = nullptr;
-    std::string name_;  // Formatted name with "/" prefix for POSIX API
-    std::string original_name_;  // Original name without prefix for public accessor
-    std::size_t size_ = 0;
-    access_mode mode_ = access_mode::read_write;
-    bool owns_shm_ = false;  // Track if we created it (for unlinking)
+    // Reserve twice the size (plus room to align the start to the page size,
+    // which matters for huge pages), then map the object over both halves
+    std::error_code map_mirrored(int prot, int flags) {
+        if (size_ % page_size_ != 0) {
+            return make_error_code(errc::invalid_size);
+        }
 
-    std::error_code map_impl() {
-        if (shm_fd_ == -1) {
-            return make_error_code(errc::mapping_failed);
+        int reserve_flags = MAP_PRIVATE | MAP_ANON;
+#ifdef MAP_NORESERVE
+        reserve_flags |= MAP_NORESERVE;
+#endif
+        std::size_t reserved = 2 * size_ + page_size_ - system_page_size();
+        void* range = mmap(nullptr, reserved, PROT_NONE, reserve_flags, -1, 0);
+        if (range == MAP_FAILED) {
+            return get_errno_error();
+        }
+        char* begin = static_cast<char*>(range);
+        char* base = reinterpret_cast<char*>(
+            (reinterpret_cast<std::uintptr_t>(begin) + page_size_ - 1) / page_size_ * page_size_);
+        char* end = base + 2 * size_;
+        if (base != begin) {
+            munmap(begin, static_cast<std::size_t>(base - begin));
+        }
+        if (end != begin + reserved) {
+            munmap(end, static_cast<std::size_t>(begin + reserved - end));
         }
 
-        int prot = get_mmap_prot(mode_);
+        for (char* half : {base, base + size_}) {
+            if (mmap(half, size_, prot, flags | MAP_FIXED, shm_fd_, 0) == MAP_FAILED) {
+                std::error_code ec = get_errno_error();
+                munmap(base, 2 * size_);
+                return ec;
+            }
+        }
+        mapped_addr_ = base;
+        mirrored_ = true;
+        return {};
+    }
 
-        mapped_addr_ = mmap(
-            nullptr,           // Let kernel choose address
-            size_,
-            prot,
-            MAP_SHARED,        // Share with other processes
-            shm_fd_,
-            0                  // Offset
-        );
+    std::error_code prefault_range(char* begin, std::size_t length) noexcept {
+        // madvise() needs a page-aligned start address
+        std::size_t misalignment = reinterpret_cast<std::uintptr_t>(begin) % page_size_;
+        begin -= misalignment;
+        length += misalignment;
 
-        if (mapped_addr_ == MAP_FAILED) {
-            mapped_addr_ = nullptr;
+#ifdef SLICK_SHM_LINUX
+        // MADV_POPULATE_* (Linux 5.14+) populates page tables without touching data
+        // Populating a copy-on-write mapping for writing would copy every page
+        int advice = (mode_ == access_mode::read_write && !options_.copy_on_write)
+                         ? MADV_POPULATE_WRITE_ADVICE
+                         : MADV_POPULATE_READ_ADVICE;
+        if (madvise(begin, length, advice) == 0) {
+            return {};
+        }
+        if (errno != EINVAL) {
             return get_errno_error();
         }
+        // Older kernel - fall back to touching every page
+#else
+        // Start asynchronous read-ahead, then fault the pages in
+        madvise(begin, length, MADV_WILLNEED);
+#endif
+        touch_pages(begin, length, page_size_);
+        return {};
+    }
 
+    std::error_code lock_range(char* begin, std::size_t length, memory_lock policy) noexcept {
+        int result = -1;
+#if defined(SLICK_SHM_LINUX) && defined(SYS_mlock2)
+        if (policy == memory_lock::on_fault) {
+            result = static_cast<int>(syscall(SYS_mlock2, begin, length, MLOCK_ONFAULT_FLAG));
+            if (result != 0 && errno != ENOSYS && errno != EINVAL) {
+                return get_lock_error();
+            }
+        }
+#else
+        (void)policy;
+#endif
+        if (result != 0) {
+            result = mlock(begin, length);
+        }
+        if (result != 0) {
+            return get_lock_error();
+        }
         return {};
     }
 
+#ifdef SLICK_SHM_LINUX
+    // For shm objects the policy is stored with the object, so it also applies to
+    // pages that other processes fault in later
+    std::error_code apply_numa_policy() {
+        int mpol_mode = MPOL_BIND_MODE;
+        if (options_.numa == numa_policy::interleave) {
+            mpol_mode = MPOL_INTERLEAVE_MODE;
+        } else if (options_.numa == numa_policy::preferred) {
+            mpol_mode = MPOL_PREFERRED_MODE;
+        }
+
+        // The kernel reads maxnode - 1 bits, so pass one extra word
+        unsigned long nodemask[2] = {static_cast<unsigned long>(options_.numa_nodes), 0};
+        if (options_.numa == numa_policy::preferred) {
+            // MPOL_PREFERRED takes a single node - use the lowest one
+            nodemask[0] &= ~nodemask[0] + 1;
+        }
+        unsigned long maxnode = sizeof(unsigned long) * 8 + 1;
+
+        if (syscall(SYS_mbind, mapped_addr_, size_, mpol_mode, nodemask, maxnode,
+                    MPOL_MF_MOVE_FLAG) != 0) {
+            if (errno == EINVAL) {
+                return make_error_code(errc::invalid_argument);
+            }
+            if (errno == ENOSYS) {
+                return make_error_code(errc::not_supported);
+            }
+            return get_errno_error();
+        }
+        return {};
+    }
+#endif
+
     void unmap_impl() noexcept {
         if (mapped_addr_ != nullptr && mapped_addr_ != MAP_FAILED) {
-            munmap(mapped_addr_, size_);
+            bool last = lifetime_ != nullptr && lifetime_detach(*lifetime_);
+            lifetime_ = nullptr;
+            // Also releases any mlock()
+            munmap(mapped_addr_, mirrored_ ? 2 * size_ : size_ + tail_);
             mapped_addr_ = nullptr;
+            locked_ = false;
+            mirrored_ = false;
+            tail_ = 0;
+            if (last) {
+                unlink_if_same();
+            }
         }
     }
 
@@ -306,21 +1432,13 @@ private:
             shm_fd_ = -1;
         }
 
-        // Only unlink if we created it
-        // Note: In typical usage, you might not want to unlink here
-        // because other processes might still be using it.
-        // We leave unlinking to the user via the remove() static method.
+        huge_pages_ = false;
 
-        size_ = 0;
-    }
+        // Segments are never unlinked here, other processes might still be
+        // using them: that is left to remove(), or to the last process that
+        // detaches from a ref_counted segment (in unmap_impl())
 
-    static std::string format_name(const char* name) {
-        // POSIX requires name to start with '/'
-        // name is guaranteed non-null and non-empty by is_valid_name() checks
-        if (name[0] == '/') {
-            return std::string(name);
-        }
-        return std::string("/") + name;
+        size_ = 0;
     }
 
 
@@ -338,6 +1456,15 @@ private:
     static std::error_code get_errno_error() {
         return std::error_code(errno, std::system_category());
     }
+
+    // mlock() reports RLIMIT_MEMLOCK exhaustion as ENOMEM (or EPERM with a zero
+    // limit on Linux, EAGAIN on macOS)
+    static std::error_code get_lock_error() {
+        if (errno == ENOMEM || errno == EPERM || errno == EAGAIN) {
+            return make_error_code(errc::lock_limit_exceeded);
+        }
+        return get_errno_error();
+    }
 };
 
 }  // namespace detail
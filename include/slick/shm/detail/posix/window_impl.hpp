@@ -0,0 +1,243 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 Slick Quant
+
+#pragma once
+
+#ifdef SLICK_SHM_POSIX
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstdint>
+
+#include <string>
+#include <system_error>
+#include <utility>
+
+#include "shared_memory_impl.hpp"
+
+namespace slick {
+namespace shm {
+namespace detail {
+
+// Open segment with one mapped view of [offset, offset + length) of it.
+//
+// Offsets passed to map() must be multiples of granularity(): the system page
+// size, or the huge page size for hugetlbfs-backed segments.
+class platform_shared_window {
+public:
+    platform_shared_window() = default;
+
+    ~platform_shared_window() {
+        close_impl();
+    }
+
+    platform_shared_window(const platform_shared_window&) = delete;
+    platform_shared_window& operator=(const platform_shared_window&) = delete;
+
+    platform_shared_window(platform_shared_window&& other) noexcept {
+        *this = std::move(other);
+    }
+
+    platform_shared_window& operator=(platform_shared_window&& other) noexcept {
+        if (this != &other) {
+            close_impl();
+
+            shm_fd_ = other.shm_fd_;
+            view_ = other.view_;
+            view_offset_ = other.view_offset_;
+            view_size_ = other.view_size_;
+            segment_size_ = other.segment_size_;
+            granularity_ = other.granularity_;
+            original_name_ = std::move(other.original_name_);
+            mode_ = other.mode_;
+            options_ = other.options_;
+
+            other.shm_fd_ = -1;
+            other.view_ = nullptr;
+            other.view_offset_ = 0;
+            other.view_size_ = 0;
+            other.segment_size_ = 0;
+        }
+        return *this;
+    }
+
+    // Open the segment without mapping any of it
+    std::error_code open(const char* name, access_mode access, const segment_options& options) {
+        if (options.file_backed ? !is_valid_path(name) : !is_valid_name(name)) {
+            return make_error_code(errc::invalid_name);
+        }
+
+        original_name_ = name;
+        mode_ = access;
+        options_ = options;
+
+        int flags = access == access_mode::read_only ? O_RDONLY : O_RDWR;
+        if (options.file_backed) {
+            shm_fd_ = ::open(name, flags | O_CLOEXEC);
+            if (shm_fd_ == -1) {
+                return errno == ENOENT ? make_error_code(errc::not_found) : get_errno_error();
+            }
+        } else {
+            platform_shared_memory::formatted_name formatted =
+                platform_shared_memory::format_name(name);
+            shm_fd_ = shm_open(formatted.c_str(), flags, 0);
+            if (shm_fd_ == -1) {
+                if (errno != ENOENT) {
+                    return get_errno_error();
+                }
+                std::string path;
+                shm_fd_ = platform_shared_memory::open_hugetlbfs(formatted.c_str(), flags, path);
+                if (shm_fd_ == -1) {
+                    return make_error_code(errc::not_found);
+                }
+            }
+        }
+
+        struct stat sb;
+        if (fstat(shm_fd_, &sb) == -1) {
+            std::error_code ec = get_errno_error();
+            close_impl();
+            return ec;
+        }
+        segment_size_ = static_cast<std::size_t>(sb.st_size);
+
+        granularity_ = 0;
+#ifdef SLICK_SHM_LINUX
+        granularity_ = hugetlbfs_page_size(shm_fd_);
+#endif
+        if (granularity_ == 0) {
+            granularity_ = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+        }
+        return {};
+    }
+
+    // Replace the current view by [offset, offset + length) of the segment
+    std::error_code map(std::size_t offset, std::size_t length) {
+        int flags = MAP_SHARED;
+#ifdef SLICK_SHM_LINUX
+        if (options_.prefault) {
+            flags |= MAP_POPULATE;
+        }
+#endif
+        void* view = MAP_FAILED;
+        if (view_ != nullptr && length <= view_size_) {
+            // Map over the start of the old view (one VMA update instead of an
+            // unmap and a map), then drop the tail the new view doesn't cover
+            view = mmap(view_, length, prot(), flags | MAP_FIXED, shm_fd_,
+                        static_cast<off_t>(offset));
+            if (view == MAP_FAILED) {
+                return fail(get_errno_error());
+            }
+            std::size_t mapped_length = round_to_page(length);
+            if (mapped_length < view_size_) {
+                munmap(static_cast<char*>(view_) + mapped_length, view_size_ - mapped_length);
+            }
+        } else {
+            unmap_impl();
+            view = mmap(nullptr, length, prot(), flags, shm_fd_, static_cast<off_t>(offset));
+            if (view == MAP_FAILED) {
+                return get_errno_error();
+            }
+        }
+        view_ = view;
+        view_offset_ = offset;
+        view_size_ = round_to_page(length);
+
+#ifndef SLICK_SHM_LINUX
+        if (options_.prefault) {
+            touch_pages(view_, length, granularity_);
+        }
+#endif
+        if (options_.lock != memory_lock::none && mlock(view_, length) != 0) {
+            std::error_code ec = (errno == ENOMEM || errno == EPERM || errno == EAGAIN)
+                                     ? make_error_code(errc::lock_limit_exceeded)
+                                     : get_errno_error();
+            return fail(ec);
+        }
+        return {};
+    }
+
+    void* view() const noexcept {
+        return view_;
+    }
+
+    std::size_t view_offset() const noexcept {
+        return view_offset_;
+    }
+
+    std::size_t segment_size() const noexcept {
+        return segment_size_;
+    }
+
+    std::size_t granularity() const noexcept {
+        return granularity_;
+    }
+
+    const char* name() const noexcept {
+        return original_name_.c_str();
+    }
+
+    access_mode mode() const noexcept {
+        return mode_;
+    }
+
+    bool is_open() const noexcept {
+        return shm_fd_ != -1;
+    }
+
+private:
+    int shm_fd_ = -1;
+    void* view_ = nullptr;
+    std::size_t view_offset_ = 0;   // Segment offset of view_
+    std::size_t view_size_ = 0;     // Mapped bytes at view_ (whole pages)
+    std::size_t segment_size_ = 0;
+    std::size_t granularity_ = 0;
+    std::string original_name_;
+    access_mode mode_ = access_mode::read_write;
+    segment_options options_;
+
+    std::size_t round_to_page(std::size_t bytes) const noexcept {
+        return (bytes + granularity_ - 1) / granularity_ * granularity_;
+    }
+
+    int prot() const noexcept {
+        return mode_ == access_mode::read_only ? PROT_READ : PROT_READ | PROT_WRITE;
+    }
+
+    // A failed remap leaves no view rather than a half-updated one
+    std::error_code fail(std::error_code ec) noexcept {
+        unmap_impl();
+        return ec;
+    }
+
+    void unmap_impl() noexcept {
+        if (view_ != nullptr) {
+            munmap(view_, view_size_);  // Also releases mlock()
+            view_ = nullptr;
+        }
+        view_offset_ = 0;
+        view_size_ = 0;
+    }
+
+    void close_impl() noexcept {
+        unmap_impl();
+        if (shm_fd_ != -1) {
+            ::close(shm_fd_);
+            shm_fd_ = -1;
+        }
+        segment_size_ = 0;
+    }
+
+    static std::error_code get_errno_error() {
+        return std::error_code(errno, std::system_category());
+    }
+};
+
+}  // namespace detail
+}  // namespace shm
+}  // namespace slick
+
+#endif  // SLICK_SHM_POSIX
@@ -0,0 +1,112 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 Slick Quant
+
+#pragma once
+
+#ifdef SLICK_SHM_WINDOWS
+
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <unordered_map>
+
+namespace slick {
+namespace shm {
+namespace detail {
+
+// WaitOnAddress() only wakes threads of the calling process, so cross-process
+// waits use a named semaphore. Its name is derived from a key stored next to
+// the event word, picked by whichever process blocks or wakes first.
+inline std::uint64_t event_key(std::atomic<std::uint64_t>& key) noexcept {
+    std::uint64_t current = key.load(std::memory_order_acquire);
+    if (current != 0) {
+        return current;
+    }
+
+    LARGE_INTEGER counter;
+    QueryPerformanceCounter(&counter);
+    std::uint64_t candidate = static_cast<std::uint64_t>(counter.QuadPart) ^
+                              (static_cast<std::uint64_t>(GetCurrentProcessId()) << 32) ^
+                              reinterpret_cast<std::uintptr_t>(&key);
+    candidate |= 1;  // Never 0
+    if (key.compare_exchange_strong(current, candidate, std::memory_order_acq_rel)) {
+        return candidate;
+    }
+    return current;  // Another process won the race
+}
+
+// Process-wide cache of opened semaphores; handles stay open until process exit
+inline HANDLE event_semaphore(std::atomic<std::uint64_t>& key) noexcept {
+    static std::mutex mutex;
+    static std::unordered_map<std::uint64_t, HANDLE> handles;
+
+    std::uint64_t k = event_key(key);
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = handles.find(k);
+    if (it != handles.end()) {
+        return it->second;
+    }
+
+    char name[64];
+    std::snprintf(name, sizeof(name), "slick_shm_event_%016llx",
+                  static_cast<unsigned long long>(k));
+    HANDLE handle = CreateSemaphoreA(nullptr, 0, LONG_MAX, name);
+    if (handle) {
+        handles.emplace(k, handle);
+    }
+    return handle;
+}
+
+/**
+ * Block until a wake-up or the timeout (nullptr: none). Spurious returns are
+ * allowed; the caller re-checks the word.
+ *
+ * @return false if the timeout expired
+ */
+inline bool event_wait(std::atomic<std::uint32_t>& word, std::uint32_t expected,
+                       std::atomic<std::uint64_t>& key,
+                       const std::chrono::nanoseconds* timeout) noexcept {
+    DWORD ms = INFINITE;
+    if (timeout) {
+        auto rounded = (timeout->count() + 999999) / 1000000;
+        ms = rounded >= static_cast<long long>(INFINITE) ? INFINITE - 1
+                                                         : static_cast<DWORD>(rounded);
+    }
+
+    HANDLE semaphore = event_semaphore(key);
+    if (!semaphore) {
+        // Couldn't create the semaphore: degrade to polling
+        if (word.load(std::memory_order_acquire) == expected) {
+            Sleep(ms < 1 ? 0 : 1);
+        }
+        return true;
+    }
+    return WaitForSingleObject(semaphore, ms) != WAIT_TIMEOUT;
+}
+
+/**
+ * Wake up to count threads blocked in event_wait() on word
+ */
+inline void event_wake(std::atomic<std::uint32_t>& word, std::atomic<std::uint64_t>& key,
+                       std::uint32_t count) noexcept {
+    (void)word;
+    HANDLE semaphore = event_semaphore(key);
+    if (semaphore) {
+        LONG n = count > static_cast<std::uint32_t>(LONG_MAX) ? LONG_MAX : static_cast<LONG>(count);
+        ReleaseSemaphore(semaphore, n, nullptr);
+    }
+}
+
+}  // namespace detail
+}  // namespace shm
+}  // namespace slick
+
+#endif  // SLICK_SHM_WINDOWS
@@ -0,0 +1,289 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 Slick Quant
+
+#pragma once
+
+#ifdef SLICK_SHM_WINDOWS
+
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+
+#include <cstdint>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#include "shared_memory_impl.hpp"
+
+namespace slick {
+namespace shm {
+namespace detail {
+
+// Pagefile-backed SEC_RESERVE section sized for the whole reservation.
+//
+// Every view covers the whole section but only reserves address space; committing
+// pages (VirtualAlloc(MEM_COMMIT)) through any view allocates them in the section,
+// and each process commits the same range in its own view to make it accessible.
+// The base address never changes while the segment grows.
+class platform_growable_segment {
+public:
+    platform_growable_segment() = default;
+
+    ~platform_growable_segment() {
+        close_impl();
+    }
+
+    platform_growable_segment(const platform_growable_segment&) = delete;
+    platform_growable_segment& operator=(const platform_growable_segment&) = delete;
+
+    platform_growable_segment(platform_growable_segment&& other) noexcept {
+        *this = std::move(other);
+    }
+
+    platform_growable_segment& operator=(platform_growable_segment&& other) noexcept {
+        if (this != &other) {
+            close_impl();
+
+            mapping_handle_ = other.mapping_handle_;
+            base_ = other.base_;
+            name_ = std::move(other.name_);
+            name_utf8_ = std::move(other.name_utf8_);
+            reserved_ = other.reserved_;
+            mapped_ = other.mapped_;
+            page_size_ = other.page_size_;
+            mode_ = other.mode_;
+            is_creator_ = other.is_creator_;
+            options_ = other.options_;
+
+            other.mapping_handle_ = nullptr;
+            other.base_ = nullptr;
+            other.reserved_ = 0;
+            other.mapped_ = 0;
+            other.is_creator_ = false;
+        }
+        return *this;
+    }
+
+    std::error_code create(const char* name, std::size_t initial, std::size_t reserve,
+                           const segment_options& options) {
+        if (!is_valid_name(name)) {
+            return make_error_code(errc::invalid_name);
+        }
+        std::error_code ec = check_options(options);
+        if (ec) {
+            return ec;
+        }
+
+        name_ = to_platform_string(name);
+        name_utf8_ = name;
+        mode_ = access_mode::read_write;
+        options_ = options;
+        page_size_ = system_page_size();
+        initial = round_to_page(initial);
+        reserve = round_to_page(reserve);
+
+        mapping_handle_ = CreateFileMapping(INVALID_HANDLE_VALUE, nullptr,
+                                            PAGE_READWRITE | SEC_RESERVE,
+                                            static_cast<DWORD>((reserve >> 32) & 0xFFFFFFFF),
+                                            static_cast<DWORD>(reserve & 0xFFFFFFFF),
+                                            name_.c_str());
+        if (mapping_handle_ == nullptr) {
+            return get_last_error();
+        }
+        if (GetLastError() == ERROR_ALREADY_EXISTS) {
+            close_impl();
+            return make_error_code(errc::already_exists);
+        }
+        is_creator_ = true;
+
+        ec = map_view(FILE_MAP_ALL_ACCESS);
+        if (!ec) {
+            reserved_ = reserve;
+            ec = map_to(initial);
+        }
+        if (ec) {
+            close_impl();
+        }
+        return ec;
+    }
+
+    std::error_code open(const char* name, access_mode access, const segment_options& options,
+                         std::size_t probe_size) {
+        if (!is_valid_name(name)) {
+            return make_error_code(errc::invalid_name);
+        }
+        std::error_code ec = check_options(options);
+        if (ec) {
+            return ec;
+        }
+
+        name_ = to_platform_string(name);
+        name_utf8_ = name;
+        mode_ = access;
+        options_ = options;
+        is_creator_ = false;
+        page_size_ = system_page_size();
+
+        DWORD map_access = access == access_mode::read_only ? FILE_MAP_READ : FILE_MAP_ALL_ACCESS;
+        mapping_handle_ = OpenFileMapping(map_access, FALSE, name_.c_str());
+        if (mapping_handle_ == nullptr) {
+            DWORD err = GetLastError();
+            if (err == ERROR_FILE_NOT_FOUND) {
+                return make_error_code(errc::not_found);
+            }
+            return std::error_code(static_cast<int>(err), std::system_category());
+        }
+
+        ec = map_view(map_access);
+        if (!ec) {
+            // Commit the header; reserve() sets the real reservation size
+            reserved_ = round_to_page(probe_size);
+            ec = map_to(probe_size);
+        }
+        if (ec) {
+            close_impl();
+        }
+        return ec;
+    }
+
+    // The view already spans the whole section
+    std::error_code reserve(std::size_t bytes) {
+        reserved_ = round_to_page(bytes);
+        return {};
+    }
+
+    // The section is sized for the whole reservation at creation
+    std::error_code grow_object(std::size_t bytes) {
+        (void)bytes;
+        return {};
+    }
+
+    std::error_code map_to(std::size_t bytes) {
+        bytes = round_to_page(bytes);
+        if (bytes <= mapped_) {
+            return {};
+        }
+        if (bytes > reserved_) {
+            return make_error_code(errc::invalid_size);
+        }
+
+        char* begin = static_cast<char*>(base_) + mapped_;
+        std::size_t length = bytes - mapped_;
+        DWORD protect = mode_ == access_mode::read_only ? PAGE_READONLY : PAGE_READWRITE;
+        if (VirtualAlloc(begin, length, MEM_COMMIT, protect) == nullptr) {
+            return get_last_error();
+        }
+        if (options_.prefault) {
+            touch_pages(begin, length, page_size_);
+        }
+        if (options_.lock != memory_lock::none && !VirtualLock(begin, length)) {
+            return GetLastError() == ERROR_WORKING_SET_QUOTA
+                       ? make_error_code(errc::working_set_quota_exceeded)
+                       : get_last_error();
+        }
+        mapped_ = bytes;
+        return {};
+    }
+
+    void* data() const noexcept {
+        return base_;
+    }
+
+    std::size_t mapped_size() const noexcept {
+        return mapped_;
+    }
+
+    std::size_t reserved_size() const noexcept {
+        return reserved_;
+    }
+
+    std::size_t page_size() const noexcept {
+        return page_size_;
+    }
+
+    const char* name() const noexcept {
+        return name_utf8_.c_str();
+    }
+
+    access_mode mode() const noexcept {
+        return mode_;
+    }
+
+    bool is_creator() const noexcept {
+        return is_creator_;
+    }
+
+    // The section goes away with its last handle
+    static bool remove(const char* name) noexcept {
+        (void)name;
+        return true;
+    }
+
+private:
+    HANDLE mapping_handle_ = nullptr;
+    void* base_ = nullptr;
+    platform_string name_;
+    std::string name_utf8_;
+    std::size_t reserved_ = 0;  // Bytes of the section available to this view
+    std::size_t mapped_ = 0;    // Bytes committed in this view
+    std::size_t page_size_ = 0;
+    access_mode mode_ = access_mode::read_write;
+    bool is_creator_ = false;
+    segment_options options_;
+
+    // SEC_RESERVE can't be combined with SEC_LARGE_PAGES, and NUMA placement
+    // of the committed pages is not controllable per commit. A mirrored view
+    // would have to move when the segment grows. File-backed growth and
+    // placing the reservation at a fixed address are not implemented
+    static std::error_code check_options(const segment_options& options) {
+        if (options.huge_page_policy == huge_pages::required ||
+            options.numa != numa_policy::none || options.mirror ||
+            options.file_backed || options.base_address || options.copy_on_write) {
+            return make_error_code(errc::not_supported);
+        }
+        return {};
+    }
+
+    std::error_code map_view(DWORD access) {
+        base_ = MapViewOfFile(mapping_handle_, access, 0, 0, 0);
+        if (base_ == nullptr) {
+            return get_last_error();
+        }
+        return {};
+    }
+
+    std::size_t round_to_page(std::size_t bytes) const noexcept {
+        return (bytes + page_size_ - 1) / page_size_ * page_size_;
+    }
+
+    void close_impl() noexcept {
+        if (base_ != nullptr) {
+            UnmapViewOfFile(base_);  // Also releases any VirtualLock()
+            base_ = nullptr;
+        }
+        if (mapping_handle_ != nullptr) {
+            CloseHandle(mapping_handle_);
+            mapping_handle_ = nullptr;
+        }
+        reserved_ = 0;
+        mapped_ = 0;
+    }
+
+    static std::size_t system_page_size() noexcept {
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+        return info.dwPageSize;
+    }
+
+    static std::error_code get_last_error() {
+        return std::error_code(static_cast<int>(GetLastError()), std::system_category());
+    }
+};
+
+}  // namespace detail
+}  // namespace shm
+}  // namespace slick
+
+#endif  // SLICK_SHM_WINDOWS
@@ -0,0 +1,61 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 Slick Quant
+
+#pragma once
+
+#ifdef SLICK_SHM_WINDOWS
+
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+
+#include <cstdint>
+#include <system_error>
+
+namespace slick {
+namespace shm {
+namespace detail {
+
+// DuplicateHandle() between this process and pid, in either direction
+inline std::error_code duplicate_handle(std::uint32_t pid, HANDLE handle, HANDLE& result,
+                                        bool to_remote) noexcept {
+    result = nullptr;
+    HANDLE process = OpenProcess(PROCESS_DUP_HANDLE, FALSE, static_cast<DWORD>(pid));
+    if (process == nullptr) {
+        DWORD err = GetLastError();
+        if (err == ERROR_INVALID_PARAMETER) {
+            return make_error_code(errc::not_found);
+        }
+        if (err == ERROR_ACCESS_DENIED) {
+            return make_error_code(errc::permission_denied);
+        }
+        return std::error_code(static_cast<int>(err), std::system_category());
+    }
+
+    HANDLE self = GetCurrentProcess();
+    BOOL ok = to_remote
+                  ? DuplicateHandle(self, handle, process, &result, 0, FALSE, DUPLICATE_SAME_ACCESS)
+                  : DuplicateHandle(process, handle, self, &result, 0, FALSE, DUPLICATE_SAME_ACCESS);
+    DWORD err = GetLastError();
+    CloseHandle(process);
+    if (!ok) {
+        result = nullptr;
+        return std::error_code(static_cast<int>(err), std::system_category());
+    }
+    return {};
+}
+
+inline std::error_code share_handle(std::uint32_t pid, HANDLE handle, HANDLE& remote) noexcept {
+    return duplicate_handle(pid, handle, remote, true);
+}
+
+inline std::error_code import_handle(std::uint32_t pid, HANDLE remote, HANDLE& handle) noexcept {
+    return duplicate_handle(pid, remote, handle, false);
+}
+
+}  // namespace detail
+}  // namespace shm
+}  // namespace slick
+
+#endif  // SLICK_SHM_WINDOWS
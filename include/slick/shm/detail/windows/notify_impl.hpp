@@ -0,0 +1,100 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 Slick Quant
+
+#pragma once
+
+#ifdef SLICK_SHM_WINDOWS
+
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+
+#include <cstdint>
+#include <cstdio>
+
+#include <system_error>
+
+namespace slick {
+namespace shm {
+namespace detail {
+
+// A listener is a named manual-reset event, usable with WaitForMultipleObjects(),
+// RegisterWaitForSingleObject() or a thread pool wait feeding an IOCP loop.
+// The name includes the slot generation, so a reused slot gets a fresh event.
+using notify_handle = HANDLE;
+const notify_handle invalid_notify_handle = nullptr;
+
+inline std::uint64_t new_notify_key() noexcept {
+    LARGE_INTEGER counter;
+    QueryPerformanceCounter(&counter);
+    std::uint64_t key = static_cast<std::uint64_t>(counter.QuadPart) ^
+                        (static_cast<std::uint64_t>(GetCurrentProcessId()) << 32);
+    return key | 1;  // Never 0
+}
+
+inline void notify_event_name(std::uint64_t key, std::uint32_t slot, std::uint32_t generation,
+                              char (&name)[80]) noexcept {
+    std::snprintf(name, sizeof(name), "slick_shm_notify_%016llx_%u_%u",
+                  static_cast<unsigned long long>(key), slot, generation);
+}
+
+inline std::error_code open_listener(std::uint64_t key, std::uint32_t slot,
+                                     std::uint32_t generation, notify_handle& handle) noexcept {
+    char name[80];
+    notify_event_name(key, slot, generation, name);
+    handle = CreateEventA(nullptr, TRUE, FALSE, name);
+    if (handle == nullptr) {
+        return std::error_code(static_cast<int>(GetLastError()), std::system_category());
+    }
+    return {};
+}
+
+inline void close_listener(notify_handle handle, std::uint64_t key, std::uint32_t slot,
+                           std::uint32_t generation) noexcept {
+    (void)key;
+    (void)slot;
+    (void)generation;
+    CloseHandle(handle);
+}
+
+inline void drain_listener(notify_handle handle) noexcept {
+    ResetEvent(handle);
+}
+
+// Notifier side: the event is opened for each signal, so that signal() keeps
+// no state and may be called from several threads at once. Only armed (i.e.
+// sleeping) listeners are signaled, so the extra open is small next to the wake-up
+class notify_sender {
+public:
+    notify_sender() = default;
+    notify_sender(const notify_sender&) = delete;
+    notify_sender& operator=(const notify_sender&) = delete;
+
+    std::error_code open() noexcept {
+        return {};
+    }
+
+    void reset() noexcept {}
+
+    void swap(notify_sender& other) noexcept {
+        (void)other;
+    }
+
+    void signal(std::uint64_t key, std::uint32_t slot, std::uint32_t generation) const noexcept {
+        char name[80];
+        notify_event_name(key, slot, generation, name);
+        HANDLE event = OpenEventA(EVENT_MODIFY_STATE, FALSE, name);
+        if (event == nullptr) {
+            return;  // The listener is gone
+        }
+        SetEvent(event);
+        CloseHandle(event);
+    }
+};
+
+}  // namespace detail
+}  // namespace shm
+}  // namespace slick
+
+#endif  // SLICK_SHM_WINDOWS
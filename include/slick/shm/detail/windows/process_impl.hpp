@@ -0,0 +1,42 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 Slick Quant
+
+#pragma once
+
+#ifdef SLICK_SHM_WINDOWS
+
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+
+#include <cstdint>
+
+namespace slick {
+namespace shm {
+namespace detail {
+
+inline std::uint32_t current_process_id() noexcept {
+    return static_cast<std::uint32_t>(GetCurrentProcessId());
+}
+
+// false only if the process is known to be gone. A process we may not open
+// (access denied) is alive. PIDs can be reused, so a very old PID may report a stranger.
+inline bool is_process_alive(std::uint32_t pid) noexcept {
+    if (pid == 0) {
+        return false;
+    }
+    HANDLE process = OpenProcess(SYNCHRONIZE, FALSE, static_cast<DWORD>(pid));
+    if (!process) {
+        return GetLastError() != ERROR_INVALID_PARAMETER;
+    }
+    bool alive = WaitForSingleObject(process, 0) == WAIT_TIMEOUT;
+    CloseHandle(process);
+    return alive;
+}
+
+}  // namespace detail
+}  // namespace shm
+}  // namespace slick
+
+#endif  // SLICK_SHM_WINDOWS
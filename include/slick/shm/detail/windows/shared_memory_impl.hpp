@@ -9,9 +9,13 @@
 #define WIN32_LEAN_AND_MEAN
 #endif
 #include <windows.h>
+#include <psapi.h>
 
+#include <algorithm>
+#include <cstdint>
 #include <string>
 #include <system_error>
+#include <vector>
 
 namespace slick {
 namespace shm {
@@ -39,6 +43,29 @@ inline std::string to_platform_string(const char* str) {
 }
 #endif
 
+// Section name in the platform character type, stored inline
+#ifdef UNICODE
+using platform_name = fixed_name<wchar_t, MAX_NAME_LENGTH>;
+inline bool to_platform_name(const char* str, platform_name& out) noexcept {
+    // A valid name has at most MAX_NAME_LENGTH bytes, so it fits in as many UTF-16 units
+    int written = MultiByteToWideChar(CP_UTF8, 0, str, -1, out.data(),
+                                      static_cast<int>(platform_name::capacity + 1));
+    if (written == 0) {
+        out.clear();
+        return false;
+    }
+    out.set_size(static_cast<std::size_t>(written - 1));
+    return true;
+}
+#else
+using platform_name = fixed_name<char, MAX_NAME_LENGTH>;
+inline bool to_platform_name(const char* str, platform_name& out) noexcept {
+    return out.assign(str);
+}
+#endif
+
+using native_handle_type = HANDLE;
+
 class platform_shared_memory {
 public:
     platform_shared_memory() = default;
@@ -54,13 +81,23 @@ public:
     // Moveable
     platform_shared_memory(platform_shared_memory&& other) noexcept
         : file_mapping_handle_(other.file_mapping_handle_),
+          file_handle_(other.file_handle_),
           mapped_view_(other.mapped_view_),
-          name_(std::move(other.name_)),
-          name_utf8_(std::move(other.name_utf8_)),
+          name_(other.name_),
+          name_utf8_(other.name_utf8_),
+          interned_name_(other.interned_name_),
+          path_(std::move(other.path_)),
           size_(other.size_),
+          file_size_(other.file_size_),
+          page_size_(other.page_size_),
           mode_(other.mode_),
-          is_creator_(other.is_creator_) {
+          is_creator_(other.is_creator_),
+          huge_pages_(other.huge_pages_),
+          locked_(other.locked_),
+          mirrored_(other.mirrored_),
+          options_(other.options_) {
         other.file_mapping_handle_ = INVALID_HANDLE_VALUE;
+        other.file_handle_ = INVALID_HANDLE_VALUE;
         other.mapped_view_ = nullptr;
         other.size_ = 0;
         other.is_creator_ = false;
@@ -71,14 +108,24 @@ public:
             close_impl();
 
             file_mapping_handle_ = other.file_mapping_handle_;
+            file_handle_ = other.file_handle_;
             mapped_view_ = other.mapped_view_;
-            name_ = std::move(other.name_);
-            name_utf8_ = std::move(other.name_utf8_);
+            name_ = other.name_;
+            name_utf8_ = other.name_utf8_;
+            interned_name_ = other.interned_name_;
+            path_ = std::move(other.path_);
             size_ = other.size_;
+            file_size_ = other.file_size_;
+            page_size_ = other.page_size_;
             mode_ = other.mode_;
             is_creator_ = other.is_creator_;
+            huge_pages_ = other.huge_pages_;
+            locked_ = other.locked_;
+            mirrored_ = other.mirrored_;
+            options_ = other.options_;
 
             other.file_mapping_handle_ = INVALID_HANDLE_VALUE;
+            other.file_handle_ = INVALID_HANDLE_VALUE;
             other.mapped_view_ = nullptr;
             other.size_ = 0;
             other.is_creator_ = false;
@@ -86,84 +133,93 @@ public:
         return *this;
     }
 
-    std::error_code create(const char* name, std::size_t size, create_mode mode, access_mode access) {
+    std::error_code create(const char* name, std::size_t size, create_mode mode, access_mode access,
+                           const segment_options& options = segment_options()) {
+        if (options.copy_on_write) {
+            return make_error_code(errc::invalid_argument);
+        }
+        if (options.lifetime == segment_lifetime::ref_counted &&
+            (options.file_backed || options.mirror || mode == create_mode::open_always)) {
+            // Rejected like on POSIX; named sections are reference counted already
+            return make_error_code(errc::invalid_argument);
+        }
+        if (options.file_backed) {
+            return create_file(name, size, mode, access, options);
+        }
         if (!is_valid_name(name)) {
             return make_error_code(errc::invalid_name);
         }
 
-        if (size == 0) {
-            return make_error_code(errc::invalid_size);
+        if (!to_platform_name(name, name_)) {
+            return make_error_code(errc::invalid_name);
         }
+        name_utf8_.assign(name);
+        interned_name_ = intern_name(name);
+        path_.clear();
+        return create_section(size, mode, access, options);
+    }
 
-        name_ = to_platform_string(name);
-        name_utf8_ = name;
-        size_ = size;
-        mode_ = access;
-
-        DWORD protect = get_protection_flags(access);
-
-        // Split 64-bit size into high and low 32-bit parts
-        DWORD size_high = static_cast<DWORD>((size >> 32) & 0xFFFFFFFF);
-        DWORD size_low = static_cast<DWORD>(size & 0xFFFFFFFF);
-
-        if (mode == create_mode::create_only) {
-            // Try to create, fail if exists
-            file_mapping_handle_ = CreateFileMapping(
-                INVALID_HANDLE_VALUE,  // Use paging file
-                nullptr,               // Default security
-                protect,
-                size_high,
-                size_low,
-                name_.c_str()
-            );
-
-            if (file_mapping_handle_ == nullptr || file_mapping_handle_ == INVALID_HANDLE_VALUE) {
-                file_mapping_handle_ = INVALID_HANDLE_VALUE;
-                return get_last_error();
-            }
-
-            // Check if it already existed
-            if (GetLastError() == ERROR_ALREADY_EXISTS) {
-                CloseHandle(file_mapping_handle_);
-                file_mapping_handle_ = INVALID_HANDLE_VALUE;
-                return make_error_code(errc::already_exists);
-            }
+    // Unnamed section, only reachable through its handle
+    std::error_code create_anonymous(std::size_t size, const segment_options& options) {
+        name_.clear();
+        name_utf8_.clear();
+        interned_name_ = nullptr;
+        path_.clear();
+        return create_section(size, create_mode::create_only, access_mode::read_write, options);
+    }
 
-            is_creator_ = true;
-        } else {
-            // open_or_create or open_always
-            file_mapping_handle_ = CreateFileMapping(
-                INVALID_HANDLE_VALUE,
-                nullptr,
-                protect,
-                size_high,
-                size_low,
-                name_.c_str()
-            );
+    // Take ownership of a section handle (from create_anonymous() or
+    // DuplicateHandle()) and map it; the handle is closed on failure
+    std::error_code adopt(native_handle_type handle, access_mode access,
+                          const segment_options& options = segment_options()) {
+        if (handle == nullptr || handle == INVALID_HANDLE_VALUE) {
+            return make_error_code(errc::invalid_argument);
+        }
 
-            if (file_mapping_handle_ == nullptr || file_mapping_handle_ == INVALID_HANDLE_VALUE) {
-                file_mapping_handle_ = INVALID_HANDLE_VALUE;
-                return get_last_error();
-            }
+        file_mapping_handle_ = handle;
+        name_.clear();
+        name_utf8_.clear();
+        interned_name_ = nullptr;
+        path_.clear();
+        mode_ = access;
+        options_ = options;
+        is_creator_ = false;
+        huge_pages_ = false;
+        page_size_ = system_page_size();
 
-            // Check if we created it or opened existing
-            is_creator_ = (GetLastError() != ERROR_ALREADY_EXISTS);
+        std::error_code ec = map_impl();
+        if (ec) {
+            close_impl();
+            return ec;
         }
-
-        return map_impl();
+        detect_large_pages();
+        return {};
     }
 
-    std::error_code open(const char* name, access_mode access) {
+    std::error_code open(const char* name, access_mode access,
+                         const segment_options& options = segment_options()) {
+        if (options.file_backed) {
+            return open_file(name, access, options);
+        }
         if (!is_valid_name(name)) {
             return make_error_code(errc::invalid_name);
         }
 
-        name_ = to_platform_string(name);
-        name_utf8_ = name;
+        if (!to_platform_name(name, name_)) {
+            return make_error_code(errc::invalid_name);
+        }
+        name_utf8_.assign(name);
+        interned_name_ = intern_name(name);
+        path_.clear();
         mode_ = access;
+        options_ = options;
         is_creator_ = false;  // Opening existing shared memory
+        huge_pages_ = false;
+        page_size_ = system_page_size();
 
-        DWORD desired_access = get_map_access(access);
+        // A copy-on-write view only needs read access to the section
+        DWORD desired_access = options.copy_on_write ? FILE_MAP_READ | FILE_MAP_COPY
+                                                     : get_map_access(access);
 
         file_mapping_handle_ = OpenFileMapping(
             desired_access,
@@ -181,7 +237,172 @@ public:
         }
 
         // map_impl() will set the size for us
-        return map_impl();
+        std::error_code ec = map_impl();
+        if (!ec) {
+            detect_large_pages();
+        }
+        return ec;
+    }
+
+    std::error_code prefault(std::size_t offset, std::size_t length) noexcept {
+        if (!is_valid()) {
+            return make_error_code(errc::mapping_failed);
+        }
+        if (offset > size_ || length > size_ - offset) {
+            return make_error_code(errc::invalid_argument);
+        }
+        if (length == 0) {
+            return {};
+        }
+
+        char* begin = static_cast<char*>(mapped_view_) + offset;
+
+#if defined(_WIN32_WINNT) && _WIN32_WINNT >= 0x0602
+        // Issue one batched I/O-style prefetch for the range (Windows 8+), then
+        // touch the pages to map them into the working set
+        WIN32_MEMORY_RANGE_ENTRY range;
+        range.VirtualAddress = begin;
+        range.NumberOfBytes = length;
+        PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+#endif
+        touch_pages(begin, length, page_size_);
+        if (mirrored_) {
+            touch_pages(begin + size_, length, page_size_);
+        }
+        return {};
+    }
+
+    std::error_code make_private(std::size_t offset, std::size_t length) noexcept {
+        if (!is_valid()) {
+            return make_error_code(errc::mapping_failed);
+        }
+        if (!options_.copy_on_write) {
+            return make_error_code(errc::not_supported);
+        }
+        if (mode_ == access_mode::read_only) {
+            return make_error_code(errc::permission_denied);
+        }
+        if (offset > size_ || length > size_ - offset) {
+            return make_error_code(errc::invalid_argument);
+        }
+        if (length == 0) {
+            return {};
+        }
+
+        // Writing to a FILE_MAP_COPY page gives this process its own copy
+        char* begin = static_cast<char*>(mapped_view_) + offset;
+        std::size_t misalignment = reinterpret_cast<std::uintptr_t>(begin) % page_size_;
+        break_cow_pages(begin - misalignment, length + misalignment, page_size_);
+        return {};
+    }
+
+    bool is_copy_on_write() const noexcept {
+        return options_.copy_on_write;
+    }
+
+    std::error_code flush(std::size_t offset, std::size_t length, bool async) noexcept {
+        if (!is_valid()) {
+            return make_error_code(errc::mapping_failed);
+        }
+        if (offset > size_ || length > size_ - offset) {
+            return make_error_code(errc::invalid_argument);
+        }
+        if (length == 0) {
+            return {};
+        }
+
+        // FlushViewOfFile() only starts writing the dirty pages; waiting for
+        // them (and the file metadata) to reach the disk takes FlushFileBuffers()
+        if (!FlushViewOfFile(static_cast<char*>(mapped_view_) + offset, length)) {
+            return get_last_error();
+        }
+        if (!async && file_handle_ != INVALID_HANDLE_VALUE && !FlushFileBuffers(file_handle_)) {
+            return get_last_error();
+        }
+        return {};
+    }
+
+    std::error_code lock(std::size_t offset, std::size_t length, memory_lock policy) noexcept {
+        if (!is_valid()) {
+            return make_error_code(errc::mapping_failed);
+        }
+        if (offset > size_ || length > size_ - offset) {
+            return make_error_code(errc::invalid_argument);
+        }
+        if (policy == memory_lock::none || length == 0) {
+            return {};
+        }
+
+        // VirtualLock() always faults the pages in, so memory_lock::on_fault
+        // behaves like memory_lock::lock
+        char* begin = static_cast<char*>(mapped_view_) + offset;
+        std::error_code ec = lock_range(begin, length);
+        if (!ec && mirrored_) {
+            ec = lock_range(begin + size_, length);
+        }
+        if (ec) {
+            return ec;
+        }
+
+        locked_ = true;
+        return {};
+    }
+
+    std::error_code unlock(std::size_t offset, std::size_t length) noexcept {
+        if (!is_valid()) {
+            return make_error_code(errc::mapping_failed);
+        }
+        if (offset > size_ || length > size_ - offset) {
+            return make_error_code(errc::invalid_argument);
+        }
+        if (length == 0) {
+            return {};
+        }
+        char* begin = static_cast<char*>(mapped_view_) + offset;
+        if (!VirtualUnlock(begin, length) ||
+            (mirrored_ && !VirtualUnlock(begin + size_, length))) {
+            return get_last_error();
+        }
+        if (offset == 0 && length == size_) {
+            locked_ = false;
+        }
+        return {};
+    }
+
+    bool is_locked() const noexcept {
+        return locked_;
+    }
+
+    std::error_code numa_placement(std::vector<std::size_t>& pages_per_node) const {
+        pages_per_node.clear();
+        if (!is_valid()) {
+            return make_error_code(errc::mapping_failed);
+        }
+
+        constexpr std::size_t batch = 1024;
+        std::vector<PSAPI_WORKING_SET_EX_INFORMATION> info(batch);
+        std::size_t page_count = (size_ + page_size_ - 1) / page_size_;
+        for (std::size_t first = 0; first < page_count; first += batch) {
+            std::size_t count = (std::min)(batch, page_count - first);
+            for (std::size_t i = 0; i < count; ++i) {
+                info[i].VirtualAddress = static_cast<char*>(mapped_view_) + (first + i) * page_size_;
+            }
+            if (!QueryWorkingSetEx(GetCurrentProcess(), info.data(),
+                                   static_cast<DWORD>(count * sizeof(info[0])))) {
+                return get_last_error();
+            }
+            for (std::size_t i = 0; i < count; ++i) {
+                if (!info[i].VirtualAttributes.Valid) {
+                    continue;  // Not in the working set
+                }
+                std::size_t node = info[i].VirtualAttributes.Node;
+                if (pages_per_node.size() <= node) {
+                    pages_per_node.resize(node + 1, 0);
+                }
+                ++pages_per_node[node];
+            }
+        }
+        return {};
     }
 
     void unmap() noexcept {
@@ -205,7 +426,10 @@ public:
     }
 
     const char* name() const noexcept {
-        return name_utf8_.c_str();
+        if (interned_name_ != nullptr) {
+            return interned_name_;
+        }
+        return options_.file_backed ? path_.c_str() : name_utf8_.c_str();
     }
 
     bool is_valid() const noexcept {
@@ -220,6 +444,27 @@ public:
         return is_creator_;
     }
 
+    bool is_mirrored() const noexcept {
+        return mirrored_;
+    }
+
+    native_handle_type native_handle() const noexcept {
+        return file_mapping_handle_;
+    }
+
+    // Pagefile-backed sections can't be resized once created
+    bool is_sealed() const noexcept {
+        return is_valid();
+    }
+
+    bool uses_huge_pages() const noexcept {
+        return huge_pages_;
+    }
+
+    std::size_t page_size() const noexcept {
+        return page_size_;
+    }
+
     static bool remove(const char* name) noexcept {
         // On Windows, shared memory is automatically cleaned up when
         // the last handle is closed. There's no explicit remove operation.
@@ -228,13 +473,23 @@ public:
         return true;
     }
 
+    // Sections go away with their last handle, also when processes crash,
+    // so there is never anything to sweep
+    static std::size_t sweep(const char* prefix) noexcept {
+        (void)prefix;
+        return 0;
+    }
+
     static bool exists(const char* name) noexcept {
         if (!is_valid_name(name)) {
             return false;
         }
 
-        platform_string platform_name = to_platform_string(name);
-        HANDLE h = OpenFileMapping(FILE_MAP_READ, FALSE, platform_name.c_str());
+        platform_name section_name;
+        if (!to_platform_name(name, section_name)) {
+            return false;
+        }
+        HANDLE h = OpenFileMapping(FILE_MAP_READ, FALSE, section_name.c_str());
         if (h != nullptr) {
             CloseHandle(h);
             return true;
@@ -244,29 +499,332 @@ public:
 
 private:
     HANDLE file_mapping_handle_ = INVALID_HANDLE_VALUE;
+    HANDLE file_handle_ = INVALID_HANDLE_VALUE;  // File behind a file_backed segment
     void* mapped_view_ = nullptr;
-    platform_string name_;          // std::wstring in UNICODE, std::string otherwise
-    std::string name_utf8_;         // Always UTF-8 for name() accessor
+    platform_name name_;            // wchar_t in UNICODE, char otherwise; empty if unnamed
+    fixed_name<char, MAX_NAME_LENGTH> name_utf8_;  // Always UTF-8 for name() accessor
+    const char* interned_name_ = nullptr;  // What name() returns, see intern_name()
+    std::string path_;              // File behind a file_backed segment
     std::size_t size_ = 0;
+    std::size_t file_size_ = 0;     // Size of the file behind a file_backed segment
+    std::size_t page_size_ = 0;
     access_mode mode_ = access_mode::read_write;
     bool is_creator_ = false;       // True if this object created the shared memory
+    bool huge_pages_ = false;       // True if backed by large pages (SEC_LARGE_PAGES)
+    bool locked_ = false;           // VirtualLock() succeeded on (part of) the view
+    bool mirrored_ = false;         // Two back-to-back views of the section (2 * size_ bytes)
+    segment_options options_;       // Options used to create/open the segment
+
+    std::error_code create_section(std::size_t size, create_mode mode, access_mode access,
+                                   const segment_options& options) {
+        if (size == 0) {
+            return make_error_code(errc::invalid_size);
+        }
+        if (options.copy_on_write) {
+            // A creator's writes would never reach the segment
+            return make_error_code(errc::invalid_argument);
+        }
+
+        size_ = size;
+        mode_ = access;
+        options_ = options;
+        huge_pages_ = false;
+        page_size_ = system_page_size();
+
+        DWORD protect = get_protection_flags(access);
+
+        if (options.mirror) {
+            // Both views of a mirrored mapping must start on an allocation
+            // granularity boundary; placeholders can't hold large page views
+            if (options.huge_page_policy == huge_pages::required) {
+                return make_error_code(errc::not_supported);
+            }
+            std::size_t granularity = allocation_granularity();
+            size_ = (size + granularity - 1) / granularity * granularity;
+        } else if (options.huge_page_policy != huge_pages::none) {
+            std::size_t large_page_size = GetLargePageMinimum();
+            bool supported = large_page_size != 0 && enable_lock_memory_privilege() &&
+                             (options.huge_page_size == 0 ||
+                              options.huge_page_size == large_page_size);
+            if (supported) {
+                // Large page sections must be committed up front, be read-write and
+                // have a size that is a multiple of the large page size
+                size_ = (size + large_page_size - 1) / large_page_size * large_page_size;
+                protect = PAGE_READWRITE | SEC_COMMIT | SEC_LARGE_PAGES;
+                page_size_ = large_page_size;
+                huge_pages_ = true;
+            } else if (options.huge_page_policy == huge_pages::required) {
+                return make_error_code(errc::huge_pages_unavailable);
+            }
+        }
+
+        std::error_code ec = create_mapping(mode, protect);
+        if (ec && huge_pages_ && ec != errc::already_exists) {
+            huge_pages_ = false;
+            page_size_ = system_page_size();
+            if (options.huge_page_policy == huge_pages::required) {
+                return make_error_code(errc::huge_pages_unavailable);
+            }
+            // huge_pages::preferred - fall back to standard pages
+            size_ = size;
+            ec = create_mapping(mode, get_protection_flags(access));
+        }
+        if (ec) {
+            return ec;
+        }
+
+        ec = map_impl();
+        if (!ec && !is_creator_) {
+            // Opened an existing section - its page size was chosen by the creator
+            detect_large_pages();
+        }
+        return ec;
+    }
+
+    // Regular file at the path given as name, mapped through an unnamed section
+    std::error_code create_file(const char* path, std::size_t size, create_mode mode,
+                                access_mode access, const segment_options& options) {
+        if (!is_valid_path(path)) {
+            return make_error_code(errc::invalid_name);
+        }
+        if (size == 0) {
+            return make_error_code(errc::invalid_size);
+        }
+        if (options.huge_page_policy == huge_pages::required || options.sync_mapping) {
+            return make_error_code(errc::not_supported);
+        }
+
+        name_.clear();
+        name_utf8_.clear();
+        path_ = path;
+        interned_name_ = intern_name(path);
+        mode_ = access;
+        options_ = options;
+        huge_pages_ = false;
+        page_size_ = system_page_size();
+        if (options.mirror) {
+            std::size_t granularity = allocation_granularity();
+            size = (size + granularity - 1) / granularity * granularity;
+        }
+
+        platform_string file_name = to_platform_string(path);
+        DWORD disposition = mode == create_mode::create_only ? CREATE_NEW : OPEN_ALWAYS;
+        file_handle_ = CreateFile(file_name.c_str(), GENERIC_READ | GENERIC_WRITE,
+                                  FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                                  nullptr, disposition, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file_handle_ == INVALID_HANDLE_VALUE) {
+            return GetLastError() == ERROR_FILE_EXISTS ? make_error_code(errc::already_exists)
+                                                       : get_last_error();
+        }
+        is_creator_ = mode == create_mode::create_only || GetLastError() != ERROR_ALREADY_EXISTS;
+
+        LARGE_INTEGER file_size;
+        if (!GetFileSizeEx(file_handle_, &file_size)) {
+            std::error_code ec = get_last_error();
+            close_impl();
+            return ec;
+        }
+        if (is_creator_ || mode == create_mode::open_always || file_size.QuadPart == 0) {
+            file_size.QuadPart = static_cast<LONGLONG>(size);
+            if (!SetFilePointerEx(file_handle_, file_size, nullptr, FILE_BEGIN) ||
+                !SetEndOfFile(file_handle_)) {
+                std::error_code ec = get_last_error();
+                close_impl();
+                if (is_creator_) {
+                    DeleteFile(file_name.c_str());
+                }
+                return ec;
+            }
+        }
+        file_size_ = static_cast<std::size_t>(file_size.QuadPart);
+        return map_file();
+    }
+
+    std::error_code open_file(const char* path, access_mode access,
+                              const segment_options& options) {
+        if (!is_valid_path(path)) {
+            return make_error_code(errc::invalid_name);
+        }
+        if (options.sync_mapping) {
+            return make_error_code(errc::not_supported);
+        }
+
+        name_.clear();
+        name_utf8_.clear();
+        path_ = path;
+        interned_name_ = intern_name(path);
+        mode_ = access;
+        options_ = options;
+        is_creator_ = false;
+        huge_pages_ = false;
+        page_size_ = system_page_size();
+
+        platform_string file_name = to_platform_string(path);
+        DWORD desired_access = access == access_mode::read_only || options.copy_on_write
+                                   ? GENERIC_READ
+                                   : GENERIC_READ | GENERIC_WRITE;
+        file_handle_ = CreateFile(file_name.c_str(), desired_access,
+                                  FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                                  nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file_handle_ == INVALID_HANDLE_VALUE) {
+            DWORD err = GetLastError();
+            if (err == ERROR_FILE_NOT_FOUND || err == ERROR_PATH_NOT_FOUND) {
+                return make_error_code(errc::not_found);
+            }
+            return std::error_code(static_cast<int>(err), std::system_category());
+        }
+
+        LARGE_INTEGER file_size;
+        if (!GetFileSizeEx(file_handle_, &file_size)) {
+            std::error_code ec = get_last_error();
+            close_impl();
+            return ec;
+        }
+        if (file_size.QuadPart == 0) {
+            // A section can't be created over an empty file
+            close_impl();
+            return make_error_code(errc::invalid_size);
+        }
+        file_size_ = static_cast<std::size_t>(file_size.QuadPart);
+        return map_file();
+    }
+
+    // Unnamed section over file_handle_, sized by the file
+    std::error_code map_file() {
+        if (options_.mirror && file_size_ % allocation_granularity() != 0) {
+            close_impl();
+            return make_error_code(errc::invalid_size);
+        }
+
+        DWORD protect = options_.copy_on_write ? PAGE_WRITECOPY : get_protection_flags(mode_);
+        file_mapping_handle_ = CreateFileMappingNuma(file_handle_, nullptr, protect, 0, 0, nullptr,
+                                                     preferred_numa_node());
+        if (file_mapping_handle_ == nullptr) {
+            file_mapping_handle_ = INVALID_HANDLE_VALUE;
+            std::error_code ec = get_last_error();
+            close_impl();
+            return ec;
+        }
+
+        std::error_code ec = map_impl();
+        if (ec) {
+            close_impl();
+        }
+        return ec;
+    }
+
+    std::error_code create_mapping(create_mode mode, DWORD protect) {
+        // Split 64-bit size into high and low 32-bit parts
+        DWORD size_high = static_cast<DWORD>((size_ >> 32) & 0xFFFFFFFF);
+        DWORD size_low = static_cast<DWORD>(size_ & 0xFFFFFFFF);
+
+        DWORD node = preferred_numa_node();
+
+        if (mode == create_mode::create_only) {
+            // Try to create, fail if exists
+            file_mapping_handle_ = CreateFileMappingNuma(
+                INVALID_HANDLE_VALUE,  // Use paging file
+                nullptr,               // Default security
+                protect,
+                size_high,
+                size_low,
+                name_.empty() ? nullptr : name_.c_str(),  // Unnamed for create_anonymous()
+                node                   // Preferred NUMA node for physical pages
+            );
+
+            if (file_mapping_handle_ == nullptr || file_mapping_handle_ == INVALID_HANDLE_VALUE) {
+                file_mapping_handle_ = INVALID_HANDLE_VALUE;
+                return get_last_error();
+            }
+
+            // Check if it already existed
+            if (GetLastError() == ERROR_ALREADY_EXISTS) {
+                CloseHandle(file_mapping_handle_);
+                file_mapping_handle_ = INVALID_HANDLE_VALUE;
+                return make_error_code(errc::already_exists);
+            }
+
+            is_creator_ = true;
+        } else {
+            // open_or_create or open_always
+            file_mapping_handle_ = CreateFileMappingNuma(
+                INVALID_HANDLE_VALUE,
+                nullptr,
+                protect,
+                size_high,
+                size_low,
+                name_.empty() ? nullptr : name_.c_str(),
+                node
+            );
+
+            if (file_mapping_handle_ == nullptr || file_mapping_handle_ == INVALID_HANDLE_VALUE) {
+                file_mapping_handle_ = INVALID_HANDLE_VALUE;
+                return get_last_error();
+            }
+
+            // Check if we created it or opened existing
+            is_creator_ = (GetLastError() != ERROR_ALREADY_EXISTS);
+        }
+
+        return {};
+    }
 
     std::error_code map_impl() {
         if (file_mapping_handle_ == INVALID_HANDLE_VALUE || file_mapping_handle_ == nullptr) {
             return make_error_code(errc::mapping_failed);
         }
 
-        DWORD access = get_map_access(mode_);
+        if (options_.numa != numa_policy::none && options_.numa_nodes == 0) {
+            return make_error_code(errc::invalid_argument);
+        }
+        if (options_.numa == numa_policy::interleave) {
+            // Windows only supports a preferred node per section/view
+            return make_error_code(errc::not_supported);
+        }
+
+        if (options_.copy_on_write && options_.mirror) {
+            // The two views of a private mirror would diverge on their first write
+            return make_error_code(errc::not_supported);
+        }
+
+        DWORD access = view_access();
+        if (huge_pages_) {
+            access |= FILE_MAP_LARGE_PAGES;
+        }
+        DWORD node = preferred_numa_node();
+
+        void* base = options_.base_address;
+        if (base) {
+            if (options_.mirror) {
+                return make_error_code(errc::not_supported);
+            }
+            if (reinterpret_cast<std::uintptr_t>(base) % allocation_granularity() != 0) {
+                return make_error_code(errc::invalid_argument);
+            }
+        }
 
-        mapped_view_ = MapViewOfFile(
+        mapped_view_ = MapViewOfFileExNuma(
             file_mapping_handle_,
             access,
-            0,  // Offset high
-            0,  // Offset low
-            0   // Map entire file
+            0,        // Offset high
+            0,        // Offset low
+            0,        // Map entire file
+            base,     // nullptr lets the system choose the address
+            node      // Preferred NUMA node for pages faulted through this view
         );
 
+        if (mapped_view_ == nullptr && huge_pages_) {
+            // FILE_MAP_LARGE_PAGES requires Windows 10 1703+; older systems map
+            // SEC_LARGE_PAGES sections with large pages implicitly
+            mapped_view_ = MapViewOfFileExNuma(file_mapping_handle_, view_access(), 0, 0, 0,
+                                               base, node);
+        }
+
         if (mapped_view_ == nullptr) {
+            if (base && GetLastError() == ERROR_INVALID_ADDRESS) {
+                // Something else is mapped or reserved in the requested range
+                return make_error_code(errc::address_in_use);
+            }
             return get_last_error();
         }
 
@@ -279,16 +837,48 @@ private:
             return get_last_error();
         }
 
-        // Update size to reflect actual allocated size
-        size_ = info.RegionSize;
+        // Update size to reflect actual allocated size. File views are rounded
+        // up to whole pages, so file-backed segments keep the file size
+        size_ = file_handle_ != INVALID_HANDLE_VALUE ? file_size_ : info.RegionSize;
+
+        if (options_.mirror) {
+            // The plain view was only needed to learn the size
+            UnmapViewOfFile(mapped_view_);
+            mapped_view_ = nullptr;
+            std::error_code ec = map_mirrored();
+            if (ec) {
+                return ec;
+            }
+        }
+
+        if (options_.prefault) {
+            std::error_code ec = prefault(0, size_);
+            if (ec) {
+                unmap_impl();
+                return ec;
+            }
+        }
+
+        if (options_.lock != memory_lock::none) {
+            std::error_code ec = lock(0, size_, options_.lock);
+            if (ec) {
+                unmap_impl();
+                return ec;
+            }
+        }
 
         return {};
     }
 
     void unmap_impl() noexcept {
         if (mapped_view_ != nullptr) {
-            UnmapViewOfFile(mapped_view_);
+            UnmapViewOfFile(mapped_view_);  // Also releases any VirtualLock()
+            if (mirrored_) {
+                UnmapViewOfFile(static_cast<char*>(mapped_view_) + size_);
+            }
             mapped_view_ = nullptr;
+            locked_ = false;
+            mirrored_ = false;
         }
     }
 
@@ -299,8 +889,150 @@ private:
             CloseHandle(file_mapping_handle_);
             file_mapping_handle_ = INVALID_HANDLE_VALUE;
         }
+        if (file_handle_ != INVALID_HANDLE_VALUE) {
+            CloseHandle(file_handle_);
+            file_handle_ = INVALID_HANDLE_VALUE;
+        }
 
         size_ = 0;
+        file_size_ = 0;
+        huge_pages_ = false;
+    }
+
+    // Windows has no strict binding: bind and preferred both use the lowest node
+    DWORD preferred_numa_node() const noexcept {
+        if (options_.numa == numa_policy::none || options_.numa_nodes == 0) {
+            return NUMA_NO_PREFERRED_NODE;
+        }
+        DWORD node = 0;
+        while (!(options_.numa_nodes & (std::uint64_t(1) << node))) {
+            ++node;
+        }
+        return node;
+    }
+
+    // Large page sections are non-pageable, so the first page of an existing
+    // view is always resident and reports whether it is a large page
+    void detect_large_pages() noexcept {
+        PSAPI_WORKING_SET_EX_INFORMATION info;
+        info.VirtualAddress = mapped_view_;
+        if (QueryWorkingSetEx(GetCurrentProcess(), &info, sizeof(info)) &&
+            info.VirtualAttributes.Valid && info.VirtualAttributes.LargePage) {
+            huge_pages_ = true;
+            page_size_ = GetLargePageMinimum();
+        }
+    }
+
+    // SEC_LARGE_PAGES requires SeLockMemoryPrivilege to be held and enabled
+    static bool enable_lock_memory_privilege() noexcept {
+        HANDLE token = nullptr;
+        if (!OpenProcessToken(GetCurrentProcess(), TOKEN_ADJUST_PRIVILEGES | TOKEN_QUERY, &token)) {
+            return false;
+        }
+
+        TOKEN_PRIVILEGES privileges;
+        privileges.PrivilegeCount = 1;
+        privileges.Privileges[0].Attributes = SE_PRIVILEGE_ENABLED;
+        bool enabled = LookupPrivilegeValue(nullptr, SE_LOCK_MEMORY_NAME,
+                                            &privileges.Privileges[0].Luid) &&
+                       AdjustTokenPrivileges(token, FALSE, &privileges, 0, nullptr, nullptr) &&
+                       GetLastError() == ERROR_SUCCESS;
+        CloseHandle(token);
+        return enabled;
+    }
+
+    // VirtualLock() always faults the pages in, so memory_lock::on_fault
+    // behaves like memory_lock::lock
+    static std::error_code lock_range(void* begin, std::size_t length) noexcept {
+        if (!VirtualLock(begin, length)) {
+            if (GetLastError() != ERROR_WORKING_SET_QUOTA) {
+                return get_last_error();
+            }
+            // Locked pages count against the minimum working set - grow it and retry
+            SIZE_T min_size = 0;
+            SIZE_T max_size = 0;
+            HANDLE process = GetCurrentProcess();
+            if (!GetProcessWorkingSetSize(process, &min_size, &max_size) ||
+                !SetProcessWorkingSetSize(process, min_size + length, max_size + length) ||
+                !VirtualLock(begin, length)) {
+                return make_error_code(errc::working_set_quota_exceeded);
+            }
+        }
+        return {};
+    }
+
+    // Placeholder APIs (Windows 10 1803+), looked up at run time so that neither
+    // the SDK version nor onecore.lib is required
+    using virtual_alloc2_fn = PVOID(WINAPI*)(HANDLE, PVOID, SIZE_T, ULONG, ULONG, void*, ULONG);
+    using map_view_of_file3_fn = PVOID(WINAPI*)(HANDLE, HANDLE, PVOID, ULONG64, SIZE_T, ULONG,
+                                                ULONG, void*, ULONG);
+
+    // Values from winnt.h, not defined by older SDKs
+    static constexpr ULONG MEM_PRESERVE_PLACEHOLDER_FLAG = 0x00000002;
+    static constexpr ULONG MEM_REPLACE_PLACEHOLDER_FLAG = 0x00004000;
+    static constexpr ULONG MEM_RESERVE_PLACEHOLDER_FLAG = 0x00040000;
+
+    // Reserve a placeholder for twice the size, split it in two and map a view
+    // of the section into each half
+    std::error_code map_mirrored() {
+        static const HMODULE kernelbase = GetModuleHandleA("kernelbase.dll");
+        static const auto virtual_alloc2 = kernelbase
+            ? reinterpret_cast<virtual_alloc2_fn>(GetProcAddress(kernelbase, "VirtualAlloc2"))
+            : nullptr;
+        static const auto map_view_of_file3 = kernelbase
+            ? reinterpret_cast<map_view_of_file3_fn>(GetProcAddress(kernelbase, "MapViewOfFile3"))
+            : nullptr;
+        if (virtual_alloc2 == nullptr || map_view_of_file3 == nullptr || huge_pages_) {
+            return make_error_code(errc::not_supported);
+        }
+        if (size_ % allocation_granularity() != 0) {
+            return make_error_code(errc::invalid_size);
+        }
+
+        HANDLE process = GetCurrentProcess();
+        char* base = static_cast<char*>(virtual_alloc2(process, nullptr, 2 * size_,
+                                                       MEM_RESERVE | MEM_RESERVE_PLACEHOLDER_FLAG,
+                                                       PAGE_NOACCESS, nullptr, 0));
+        if (base == nullptr) {
+            return get_last_error();
+        }
+        if (!VirtualFree(base, size_, MEM_RELEASE | MEM_PRESERVE_PLACEHOLDER_FLAG)) {
+            std::error_code ec = get_last_error();
+            VirtualFree(base, 0, MEM_RELEASE);
+            return ec;
+        }
+
+        ULONG protect = get_protection_flags(mode_);
+        if (map_view_of_file3(file_mapping_handle_, process, base, 0, size_,
+                              MEM_REPLACE_PLACEHOLDER_FLAG, protect, nullptr, 0) == nullptr) {
+            std::error_code ec = get_last_error();
+            VirtualFree(base, 0, MEM_RELEASE);
+            VirtualFree(base + size_, 0, MEM_RELEASE);
+            return ec;
+        }
+        if (map_view_of_file3(file_mapping_handle_, process, base + size_, 0, size_,
+                              MEM_REPLACE_PLACEHOLDER_FLAG, protect, nullptr, 0) == nullptr) {
+            std::error_code ec = get_last_error();
+            UnmapViewOfFile(base);
+            VirtualFree(base + size_, 0, MEM_RELEASE);
+            return ec;
+        }
+
+        mapped_view_ = base;
+        mirrored_ = true;
+        return {};
+    }
+
+    static std::size_t allocation_granularity() noexcept {
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+        return info.dwAllocationGranularity;
+    }
+
+    static std::size_t system_page_size() noexcept {
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+        return info.dwPageSize;
     }
 
     static DWORD get_protection_flags(access_mode mode) {
@@ -314,6 +1046,14 @@ private:
         }
     }
 
+    // Access of the views of this segment: private copies for copy_on_write
+    DWORD view_access() const noexcept {
+        if (options_.copy_on_write && mode_ == access_mode::read_write) {
+            return FILE_MAP_COPY;
+        }
+        return get_map_access(mode_);
+    }
+
     static DWORD get_map_access(access_mode mode) {
         switch (mode) {
             case access_mode::read_only:
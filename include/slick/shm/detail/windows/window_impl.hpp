@@ -0,0 +1,263 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 Slick Quant
+
+#pragma once
+
+#ifdef SLICK_SHM_WINDOWS
+
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#include <psapi.h>
+
+#include <cstdint>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#include "shared_memory_impl.hpp"
+
+namespace slick {
+namespace shm {
+namespace detail {
+
+// Open section with one mapped view of [offset, offset + length) of it.
+//
+// Offsets passed to map() must be multiples of granularity(): the allocation
+// granularity (64 KiB), or the large page size for SEC_LARGE_PAGES sections.
+class platform_shared_window {
+public:
+    platform_shared_window() = default;
+
+    ~platform_shared_window() {
+        close_impl();
+    }
+
+    platform_shared_window(const platform_shared_window&) = delete;
+    platform_shared_window& operator=(const platform_shared_window&) = delete;
+
+    platform_shared_window(platform_shared_window&& other) noexcept {
+        *this = std::move(other);
+    }
+
+    platform_shared_window& operator=(platform_shared_window&& other) noexcept {
+        if (this != &other) {
+            close_impl();
+
+            mapping_handle_ = other.mapping_handle_;
+            view_ = other.view_;
+            view_offset_ = other.view_offset_;
+            segment_size_ = other.segment_size_;
+            granularity_ = other.granularity_;
+            page_size_ = other.page_size_;
+            name_utf8_ = std::move(other.name_utf8_);
+            mode_ = other.mode_;
+            options_ = other.options_;
+
+            other.mapping_handle_ = nullptr;
+            other.view_ = nullptr;
+            other.view_offset_ = 0;
+            other.segment_size_ = 0;
+        }
+        return *this;
+    }
+
+    // Open the section without keeping any of it mapped
+    std::error_code open(const char* name, access_mode access, const segment_options& options) {
+        if (options.file_backed ? !is_valid_path(name) : !is_valid_name(name)) {
+            return make_error_code(errc::invalid_name);
+        }
+
+        name_utf8_ = name;
+        mode_ = access;
+        options_ = options;
+
+        platform_string platform_name = to_platform_string(name);
+        if (options.file_backed) {
+            return open_file(platform_name);
+        }
+        mapping_handle_ = OpenFileMapping(map_access(), FALSE, platform_name.c_str());
+        if (mapping_handle_ == nullptr) {
+            DWORD err = GetLastError();
+            if (err == ERROR_FILE_NOT_FOUND) {
+                return make_error_code(errc::not_found);
+            }
+            return std::error_code(static_cast<int>(err), std::system_category());
+        }
+
+        // There is no documented way to ask a section for its size, so map a
+        // view of all of it (address space only) and query the region
+        void* probe = MapViewOfFile(mapping_handle_, map_access(), 0, 0, 0);
+        if (probe == nullptr) {
+            std::error_code ec = get_last_error();
+            close_impl();
+            return ec;
+        }
+        MEMORY_BASIC_INFORMATION info;
+        if (VirtualQuery(probe, &info, sizeof(info)) == 0) {
+            std::error_code ec = get_last_error();
+            UnmapViewOfFile(probe);
+            close_impl();
+            return ec;
+        }
+        segment_size_ = info.RegionSize;
+
+        SYSTEM_INFO system;
+        GetSystemInfo(&system);
+        granularity_ = system.dwAllocationGranularity;
+        page_size_ = system.dwPageSize;
+
+        // Large page sections are non-pageable, so their first page is resident
+        PSAPI_WORKING_SET_EX_INFORMATION ws;
+        ws.VirtualAddress = probe;
+        if (QueryWorkingSetEx(GetCurrentProcess(), &ws, sizeof(ws)) &&
+            ws.VirtualAttributes.Valid && ws.VirtualAttributes.LargePage) {
+            page_size_ = GetLargePageMinimum();
+            if (page_size_ > granularity_) {
+                granularity_ = page_size_;
+            }
+        }
+        UnmapViewOfFile(probe);
+        return {};
+    }
+
+    // Replace the current view by [offset, offset + length) of the section
+    std::error_code map(std::size_t offset, std::size_t length) {
+        unmap_impl();
+
+        std::uint64_t offset64 = offset;
+        void* view = MapViewOfFile(mapping_handle_, map_access(),
+                                   static_cast<DWORD>(offset64 >> 32),
+                                   static_cast<DWORD>(offset64 & 0xFFFFFFFF), length);
+        if (view == nullptr) {
+            return get_last_error();
+        }
+        view_ = view;
+        view_offset_ = offset;
+
+        if (options_.prefault) {
+            touch_pages(view_, length, page_size_);
+        }
+        if (options_.lock != memory_lock::none && !VirtualLock(view_, length)) {
+            std::error_code ec = GetLastError() == ERROR_WORKING_SET_QUOTA
+                                     ? make_error_code(errc::working_set_quota_exceeded)
+                                     : get_last_error();
+            unmap_impl();
+            return ec;
+        }
+        return {};
+    }
+
+    void* view() const noexcept {
+        return view_;
+    }
+
+    std::size_t view_offset() const noexcept {
+        return view_offset_;
+    }
+
+    std::size_t segment_size() const noexcept {
+        return segment_size_;
+    }
+
+    std::size_t granularity() const noexcept {
+        return granularity_;
+    }
+
+    const char* name() const noexcept {
+        return name_utf8_.c_str();
+    }
+
+    access_mode mode() const noexcept {
+        return mode_;
+    }
+
+    bool is_open() const noexcept {
+        return mapping_handle_ != nullptr;
+    }
+
+private:
+    HANDLE mapping_handle_ = nullptr;
+    void* view_ = nullptr;
+    std::size_t view_offset_ = 0;  // Section offset of view_
+    std::size_t segment_size_ = 0;
+    std::size_t granularity_ = 0;
+    std::size_t page_size_ = 0;
+    std::string name_utf8_;
+    access_mode mode_ = access_mode::read_write;
+    segment_options options_;
+
+    // Unnamed section over a file; the section keeps the file open
+    std::error_code open_file(const platform_string& path) {
+        DWORD desired_access = mode_ == access_mode::read_only ? GENERIC_READ
+                                                               : GENERIC_READ | GENERIC_WRITE;
+        HANDLE file = CreateFile(path.c_str(), desired_access,
+                                 FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+                                 OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            DWORD err = GetLastError();
+            if (err == ERROR_FILE_NOT_FOUND || err == ERROR_PATH_NOT_FOUND) {
+                return make_error_code(errc::not_found);
+            }
+            return std::error_code(static_cast<int>(err), std::system_category());
+        }
+
+        LARGE_INTEGER file_size;
+        std::error_code ec;
+        if (!GetFileSizeEx(file, &file_size)) {
+            ec = get_last_error();
+        } else if (file_size.QuadPart == 0) {
+            ec = make_error_code(errc::invalid_size);
+        } else {
+            mapping_handle_ = CreateFileMapping(
+                file, nullptr, mode_ == access_mode::read_only ? PAGE_READONLY : PAGE_READWRITE,
+                0, 0, nullptr);
+            if (mapping_handle_ == nullptr) {
+                ec = get_last_error();
+            }
+        }
+        CloseHandle(file);
+        if (ec) {
+            return ec;
+        }
+
+        segment_size_ = static_cast<std::size_t>(file_size.QuadPart);
+        SYSTEM_INFO system;
+        GetSystemInfo(&system);
+        granularity_ = system.dwAllocationGranularity;
+        page_size_ = system.dwPageSize;
+        return {};
+    }
+
+    DWORD map_access() const noexcept {
+        return mode_ == access_mode::read_only ? FILE_MAP_READ : FILE_MAP_ALL_ACCESS;
+    }
+
+    void unmap_impl() noexcept {
+        if (view_ != nullptr) {
+            UnmapViewOfFile(view_);  // Also releases any VirtualLock()
+            view_ = nullptr;
+        }
+        view_offset_ = 0;
+    }
+
+    void close_impl() noexcept {
+        unmap_impl();
+        if (mapping_handle_ != nullptr) {
+            CloseHandle(mapping_handle_);
+            mapping_handle_ = nullptr;
+        }
+        segment_size_ = 0;
+    }
+
+    static std::error_code get_last_error() {
+        return std::error_code(static_cast<int>(GetLastError()), std::system_category());
+    }
+};
+
+}  // namespace detail
+}  // namespace shm
+}  // namespace slick
+
+#endif  // SLICK_SHM_WINDOWS
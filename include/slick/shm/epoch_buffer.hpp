@@ -0,0 +1,647 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 Slick Quant
+
+#pragma once
+
+#include "shared_memory.hpp"
+#include "stats.hpp"
+
+#ifdef SLICK_SHM_WINDOWS
+#include "detail/windows/process_impl.hpp"
+#elif defined(SLICK_SHM_POSIX)
+#include "detail/posix/process_impl.hpp"
+#endif
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <thread>
+#include <type_traits>
+
+namespace slick {
+namespace shm {
+
+namespace detail {
+
+// In-segment control block of an epoch_buffer. The plain fields are written
+// before magic is published and are read-only afterwards.
+struct epoch_buffer_header {
+    std::atomic<std::uint64_t> magic;  // Published last by the creator
+    std::uint32_t version;
+    std::uint32_t buffers;
+    std::uint64_t element_size;
+    std::uint64_t buffer_stride;
+    std::uint64_t max_readers;
+
+    alignas(cache_line_size) std::atomic<std::uint64_t> epoch;  // Last published epoch
+
+    stats_block stats;  // See stats.hpp
+};
+
+// One per reader, on its own cache line so readers never share a line with
+// each other or with the epoch
+struct alignas(cache_line_size) epoch_reader_slot {
+    std::atomic<std::uint64_t> held;   // Epoch the reader uses + 1; 0 = idle
+    std::atomic<std::uint32_t> owner;  // PID of the reader; 0 = free
+};
+
+constexpr std::uint64_t EPOCH_BUFFER_MAGIC = 0x66756268636f7065ULL;  // "epochbuf"
+constexpr std::uint32_t EPOCH_BUFFER_VERSION = 1;
+
+// How long an open_or_create opener waits for the creator to write the header
+constexpr std::chrono::seconds EPOCH_BUFFER_INIT_TIMEOUT{1};
+
+}  // namespace detail
+
+/**
+ * @brief Double- (or triple-) buffered publication of a large value in a named segment
+ *
+ * The segment holds Buffers copies of T and an epoch number. The writer fills
+ * the buffer after the current one and flips the epoch; readers always see a
+ * completely written T and never copy it. Each reader records the epoch it
+ * is using in its own slot, so the writer knows when the buffer it is about to
+ * reuse has been released by every reader.
+ *
+ * A reader keeps the buffer returned by read() until its next read() or
+ * release(). read() costs one acquire load of the epoch while nothing new was
+ * published, and one more store to the reader's own slot when it moves to a
+ * newer epoch. With Buffers copies the writer can publish Buffers - 1 epochs
+ * past the oldest epoch a reader still holds; begin_write() waits beyond that.
+ * Readers that stop reading for a while should call release().
+ *
+ * @code
+ * struct instrument_table { std::uint32_t count; instrument rows[100000]; };
+ *
+ * // Reference data publisher
+ * epoch_buffer<instrument_table> table("ref_data", create_only);
+ * instrument_table* next = table.begin_write();
+ * load_instruments(*next);
+ * table.publish();
+ *
+ * // Any reader process
+ * epoch_buffer<instrument_table> table("ref_data", open_existing);
+ * const instrument_table* t = table.read();  // Valid until the next read()
+ * @endcode
+ *
+ * Zero-filled memory is epoch 0 holding a zero-initialized T, so readers never
+ * see an uninitialized buffer. Readers write to their slot, so every side
+ * maps the segment read_write. A reader process that died without release()
+ * is detected by its PID when it holds up the writer, and its slot is freed.
+ *
+ * Thread safety: one writer at a time. Each reader object must be used by one
+ * thread at a time; create one object per reading thread.
+ */
+template <typename T, std::size_t Buffers = 2>
+class epoch_buffer {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "epoch_buffer values must be trivially copyable");
+    static_assert(Buffers >= 2, "epoch_buffer needs at least two buffers");
+
+public:
+    using value_type = T;
+    static constexpr std::size_t buffer_count = Buffers;
+    static constexpr std::size_t default_max_readers = 64;
+
+    /**
+     * @brief Default constructor - creates an invalid buffer
+     */
+    epoch_buffer() = default;
+
+    /**
+     * @brief Create a new segment (usually the writer)
+     * @param name Name of the shared memory segment
+     * @param tag create_only tag
+     * @param max_readers Number of reader slots
+     * @param options Segment options (huge pages, prefault, lock, ...)
+     * @throws shared_memory_error if creation fails
+     */
+    epoch_buffer(const char* name, create_only_t tag,
+                 std::size_t max_readers = default_max_readers,
+                 const segment_options& options = segment_options()) {
+        (void)tag;
+        last_error_ = create_impl(name, max_readers, options);
+        if (last_error_) {
+            throw shared_memory_error(last_error_);
+        }
+    }
+
+    /**
+     * @brief Attach to an existing segment (usually a reader)
+     * @param name Name of the shared memory segment
+     * @param tag open_existing tag
+     * @param options Segment options (mapping related options only)
+     * @throws shared_memory_error if the segment doesn't exist or doesn't hold
+     *         Buffers buffers of T (errc::incompatible_layout)
+     */
+    epoch_buffer(const char* name, open_existing_t tag,
+                 const segment_options& options = segment_options()) {
+        (void)tag;
+        last_error_ = open_impl(name, options);
+        if (last_error_) {
+            throw shared_memory_error(last_error_);
+        }
+    }
+
+    /**
+     * @brief Open the segment, or create it if it doesn't exist yet
+     *
+     * Whichever process creates the segment (is_creator()) writes the header;
+     * the others wait briefly for it (errc::timed_out if it never appears).
+     *
+     * @param max_readers Number of reader slots if the segment is created
+     * @throws shared_memory_error on failure
+     */
+    epoch_buffer(const char* name, open_or_create_t tag,
+                 std::size_t max_readers = default_max_readers,
+                 const segment_options& options = segment_options()) {
+        (void)tag;
+        last_error_ = open_or_create_impl(name, max_readers, options);
+        if (last_error_) {
+            throw shared_memory_error(last_error_);
+        }
+    }
+
+    /**
+     * @brief Create a new segment - no-throw version
+     * @note Check is_valid() and last_error() after construction
+     */
+    epoch_buffer(const char* name, create_only_t tag, std::size_t max_readers,
+                 const segment_options& options, const std::nothrow_t& nt) noexcept {
+        (void)tag;
+        (void)nt;
+        last_error_ = create_impl(name, max_readers, options);
+    }
+
+    /**
+     * @brief Attach to an existing segment - no-throw version
+     * @note Check is_valid() and last_error() after construction
+     */
+    epoch_buffer(const char* name, open_existing_t tag, const segment_options& options,
+                 const std::nothrow_t& nt) noexcept {
+        (void)tag;
+        (void)nt;
+        last_error_ = open_impl(name, options);
+    }
+
+    /**
+     * @brief Open or create - no-throw version
+     * @note Check is_valid() and last_error() after construction
+     */
+    epoch_buffer(const char* name, open_or_create_t tag, std::size_t max_readers,
+                 const segment_options& options, const std::nothrow_t& nt) noexcept {
+        (void)tag;
+        (void)nt;
+        last_error_ = open_or_create_impl(name, max_readers, options);
+    }
+
+    epoch_buffer(const epoch_buffer&) = delete;
+    epoch_buffer& operator=(const epoch_buffer&) = delete;
+
+    epoch_buffer(epoch_buffer&& other) noexcept {
+        *this = std::move(other);
+    }
+
+    ~epoch_buffer() {
+        detach();
+    }
+
+    epoch_buffer& operator=(epoch_buffer&& other) noexcept {
+        if (this != &other) {
+            detach();
+            shm_ = std::move(other.shm_);
+            header_ = other.header_;
+            slots_ = other.slots_;
+            buffers_ = other.buffers_;
+            slot_ = other.slot_;
+            held_ = other.held_;
+            writing_ = other.writing_;
+            last_error_ = other.last_error_;
+
+            other.header_ = nullptr;
+            other.slots_ = nullptr;
+            other.buffers_ = nullptr;
+            other.slot_ = nullptr;
+            other.held_ = not_held;
+            other.writing_ = false;
+        }
+        return *this;
+    }
+
+    // ========================================================================
+    // Writer side
+    // ========================================================================
+
+    /**
+     * @brief Buffer of the next epoch, if no reader still holds it
+     * @return nullptr if a reader holds the epoch the buffer last published
+     * @note Fill the buffer and call publish(). It still holds the value of
+     *       epoch() + 1 - Buffers; copy latest() into it first for incremental updates.
+     */
+    T* try_begin_write() noexcept {
+        if (header_ == nullptr) {
+            return nullptr;
+        }
+        std::uint64_t next = header_->epoch.load(std::memory_order_relaxed) + 1;
+        if (!buffer_free(next)) {
+            detail::stat_add(header_->stats.full_events);
+            return nullptr;
+        }
+        writing_ = true;
+        return buffer(next);
+    }
+
+    /**
+     * @brief Buffer of the next epoch, waiting until every reader has released it
+     * @return nullptr only if the object is invalid
+     */
+    T* begin_write() noexcept {
+        return begin_write_impl(nullptr);
+    }
+
+    /**
+     * @brief Buffer of the next epoch, waiting at most timeout for readers
+     * @return nullptr if a reader still held the buffer when the timeout expired
+     */
+    template <typename Rep, typename Period>
+    T* begin_write(const std::chrono::duration<Rep, Period>& timeout) noexcept {
+        auto deadline = std::chrono::steady_clock::now() + timeout;
+        return begin_write_impl(&deadline);
+    }
+
+    /**
+     * @brief Make the buffer from begin_write() the current one
+     * @return The published epoch; epoch() unchanged if no write was begun
+     */
+    std::uint64_t publish() noexcept {
+        if (header_ == nullptr || !writing_) {
+            return epoch();
+        }
+        std::uint64_t next = header_->epoch.load(std::memory_order_relaxed) + 1;
+        // seq_cst pairs with the slot scan of readers moving off the idle state
+        header_->epoch.store(next, std::memory_order_seq_cst);
+        writing_ = false;
+        detail::stat_add(header_->stats.enqueues);
+        return next;
+    }
+
+    /**
+     * @brief Copy value into the next buffer and publish it (waits like begin_write())
+     * @return The published epoch
+     */
+    std::uint64_t publish(const T& value) noexcept {
+        T* next = begin_write();
+        if (next == nullptr) {
+            return 0;
+        }
+        std::memcpy(next, &value, sizeof(T));
+        return publish();
+    }
+
+    /**
+     * @brief Current value, for the writer (readers use read())
+     */
+    const T* latest() const noexcept {
+        return header_ ? buffer(header_->epoch.load(std::memory_order_relaxed)) : nullptr;
+    }
+
+    // ========================================================================
+    // Reader side
+    // ========================================================================
+
+    /**
+     * @brief Latest published value
+     * @return Valid until the next read() or release() of this object, or
+     *         nullptr if all reader slots are taken (errc::too_many_readers)
+     */
+    const T* read() noexcept {
+        if (header_ == nullptr) {
+            return nullptr;
+        }
+        std::uint64_t e = header_->epoch.load(std::memory_order_acquire);
+        if (e != held_ && !hold(e)) {
+            return nullptr;
+        }
+        return buffer(held_);
+    }
+
+    /**
+     * @brief Stop holding a buffer, so the writer can reuse it
+     * @note The reader slot stays claimed; the next read() takes it up again
+     */
+    void release() noexcept {
+        if (slot_ != nullptr) {
+            slot_->held.store(0, std::memory_order_release);
+        }
+        held_ = not_held;
+    }
+
+    /**
+     * @brief Epoch returned by the last read(), or 0 if this reader holds none
+     */
+    std::uint64_t read_epoch() const noexcept {
+        return held_ == not_held ? 0 : held_;
+    }
+
+    // ========================================================================
+    // Accessors
+    // ========================================================================
+
+    /**
+     * @brief Number of publish() calls on the segment so far
+     */
+    std::uint64_t epoch() const noexcept {
+        return header_ ? header_->epoch.load(std::memory_order_acquire) : 0;
+    }
+
+    /**
+     * @brief Reader slots currently claimed
+     */
+    std::size_t reader_count() const noexcept {
+        std::size_t count = 0;
+        for (std::size_t i = 0; i < max_readers(); ++i) {
+            if (slots_[i].owner.load(std::memory_order_relaxed) != 0) {
+                ++count;
+            }
+        }
+        return count;
+    }
+
+    std::size_t max_readers() const noexcept {
+        return header_ ? static_cast<std::size_t>(header_->max_readers) : 0;
+    }
+
+    /**
+     * @brief Counters of the buffer (see stats.hpp)
+     * @note enqueues counts publishes, dequeues counts readers moving to a
+     *       newer epoch and full_events counts writes delayed by a reader.
+     */
+    segment_stats stats_snapshot() const noexcept {
+        return header_ ? detail::load_stats(header_->stats) : segment_stats();
+    }
+
+    bool is_valid() const noexcept {
+        return header_ != nullptr;
+    }
+
+    bool is_creator() const noexcept {
+        return shm_.is_creator();
+    }
+
+    std::error_code last_error() const noexcept {
+        return last_error_;
+    }
+
+    const shared_memory& segment() const noexcept {
+        return shm_;
+    }
+
+    /**
+     * @brief Segment size needed for the given number of reader slots
+     */
+    static std::size_t required_size(std::size_t max_readers) noexcept {
+        return buffers_offset(max_readers) + Buffers * buffer_stride();
+    }
+
+private:
+    static constexpr std::uint64_t not_held = ~std::uint64_t(0);
+
+    shared_memory shm_;
+    detail::epoch_buffer_header* header_ = nullptr;
+    detail::epoch_reader_slot* slots_ = nullptr;
+    unsigned char* buffers_ = nullptr;
+    detail::epoch_reader_slot* slot_ = nullptr;  // Claimed by the first read()
+    std::uint64_t held_ = not_held;              // Process-local copy of slot_->held - 1
+    bool writing_ = false;
+    std::error_code last_error_;
+
+    static constexpr std::size_t buffer_alignment() noexcept {
+        return alignof(T) > detail::cache_line_size ? alignof(T) : detail::cache_line_size;
+    }
+
+    static constexpr std::size_t buffer_stride() noexcept {
+        return detail::align_up(sizeof(T), buffer_alignment());
+    }
+
+    static constexpr std::size_t slots_offset() noexcept {
+        return detail::align_up(sizeof(detail::epoch_buffer_header), detail::cache_line_size);
+    }
+
+    static constexpr std::size_t buffers_offset(std::size_t max_readers) noexcept {
+        return detail::align_up(slots_offset() + max_readers * sizeof(detail::epoch_reader_slot),
+                                buffer_alignment());
+    }
+
+    T* buffer(std::uint64_t epoch) const noexcept {
+        return std::launder(
+            reinterpret_cast<T*>(buffers_ + (epoch % Buffers) * buffer_stride()));
+    }
+
+    // The buffer of next last held epoch next - Buffers. It is free once every
+    // reader holds a later epoch: a reader's slot lags the epoch it reads by at
+    // most the one it held before, so 'held' (epoch + 1) must be past next - Buffers + 1
+    bool buffer_free(std::uint64_t next) noexcept {
+        if (next < Buffers) {
+            return true;  // Not used yet
+        }
+        const std::uint64_t min_held = next - Buffers + 2;
+        for (std::size_t i = 0; i < max_readers(); ++i) {
+            detail::epoch_reader_slot& slot = slots_[i];
+            std::uint64_t held = slot.held.load(std::memory_order_seq_cst);
+            if (held == 0 || held >= min_held) {
+                continue;
+            }
+            std::uint32_t owner = slot.owner.load(std::memory_order_relaxed);
+            if (owner != 0 && detail::is_process_alive(owner)) {
+                return false;
+            }
+            // The reader died holding the buffer. If the slot changed hands in
+            // the meantime, its new owner starts from a current epoch
+            if (slot.held.compare_exchange_strong(held, 0, std::memory_order_relaxed) &&
+                owner != 0) {
+                slot.owner.compare_exchange_strong(owner, 0, std::memory_order_release);
+            }
+        }
+        return true;
+    }
+
+    T* begin_write_impl(const std::chrono::steady_clock::time_point* deadline) noexcept {
+        if (header_ == nullptr) {
+            return nullptr;
+        }
+        std::uint64_t next = header_->epoch.load(std::memory_order_relaxed) + 1;
+        if (!buffer_free(next)) {
+            detail::stat_add(header_->stats.full_events);
+            for (unsigned spins = 0; !buffer_free(next); ++spins) {
+                if (deadline && std::chrono::steady_clock::now() >= *deadline) {
+                    return nullptr;
+                }
+                if (spins < 64) {
+                    detail::cpu_relax();
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        }
+        writing_ = true;
+        return buffer(next);
+    }
+
+    // Move this reader to epoch e, the value it just loaded
+    bool hold(std::uint64_t e) noexcept {
+        if (slot_ == nullptr && !claim_slot()) {
+            return false;
+        }
+        if (held_ != not_held) {
+            // The slot still blocks the buffer this reader held, which is
+            // never newer than e, so the writer can't be reusing e's buffer.
+            // Release orders our reads of the old buffer before the writer's reuse
+            slot_->held.store(e + 1, std::memory_order_release);
+        } else {
+            // From idle the writer may already be refilling e's buffer: announce
+            // e, then check that it is still current (pairs with publish())
+            for (;;) {
+                slot_->held.store(e + 1, std::memory_order_seq_cst);
+                std::uint64_t now = header_->epoch.load(std::memory_order_seq_cst);
+                if (now == e) {
+                    break;
+                }
+                e = now;
+            }
+        }
+        held_ = e;
+        detail::stat_add_shared(header_->stats.dequeues);
+        return true;
+    }
+
+    bool claim_slot() noexcept {
+        const std::uint32_t pid = detail::current_process_id();
+        for (std::size_t i = 0; i < max_readers(); ++i) {
+            std::uint32_t expected = 0;
+            if (slots_[i].owner.compare_exchange_strong(expected, pid,
+                                                        std::memory_order_acquire,
+                                                        std::memory_order_relaxed)) {
+                slot_ = &slots_[i];
+                return true;
+            }
+        }
+        last_error_ = make_error_code(errc::too_many_readers);
+        return false;
+    }
+
+    void detach() noexcept {
+        if (header_ == nullptr) {
+            return;
+        }
+        if (slot_ != nullptr) {
+            slot_->held.store(0, std::memory_order_release);
+            slot_->owner.store(0, std::memory_order_release);
+            slot_ = nullptr;
+        }
+        held_ = not_held;
+        detail::stat_add_shared(header_->stats.detaches);
+    }
+
+    std::error_code create_impl(const char* name, std::size_t max_readers,
+                                const segment_options& options) {
+        if (max_readers == 0) {
+            return make_error_code(errc::invalid_argument);
+        }
+        shared_memory shm(name, required_size(max_readers), create_only, access_mode::read_write,
+                          options, std::nothrow);
+        if (!shm.is_valid()) {
+            return shm.last_error();
+        }
+        init_header(shm, max_readers);
+        attach(std::move(shm));
+        return {};
+    }
+
+    std::error_code open_impl(const char* name, const segment_options& options) {
+        shared_memory shm(name, open_existing, access_mode::read_write, options, std::nothrow);
+        if (!shm.is_valid()) {
+            return shm.last_error();
+        }
+        std::error_code ec = check_header(shm);
+        if (ec) {
+            return ec;
+        }
+        attach(std::move(shm));
+        return {};
+    }
+
+    std::error_code open_or_create_impl(const char* name, std::size_t max_readers,
+                                        const segment_options& options) {
+        if (max_readers == 0) {
+            return make_error_code(errc::invalid_argument);
+        }
+        shared_memory shm(name, required_size(max_readers), open_or_create,
+                          access_mode::read_write, options, std::nothrow);
+        if (!shm.is_valid()) {
+            return shm.last_error();
+        }
+        if (shm.is_creator()) {
+            init_header(shm, max_readers);
+        } else {
+            // The creator may still be writing the header
+            auto* header = static_cast<const detail::epoch_buffer_header*>(shm.data());
+            auto deadline = std::chrono::steady_clock::now() + detail::EPOCH_BUFFER_INIT_TIMEOUT;
+            while (header->magic.load(std::memory_order_acquire) == 0) {
+                if (std::chrono::steady_clock::now() >= deadline) {
+                    return make_error_code(errc::timed_out);
+                }
+                std::this_thread::yield();
+            }
+            std::error_code ec = check_header(shm);
+            if (ec) {
+                return ec;
+            }
+        }
+        attach(std::move(shm));
+        return {};
+    }
+
+    // The segment is zero-filled: epoch 0, every slot free, every buffer a zero T
+    static void init_header(shared_memory& shm, std::size_t max_readers) noexcept {
+        auto* header = static_cast<detail::epoch_buffer_header*>(shm.data());
+        header->version = detail::EPOCH_BUFFER_VERSION;
+        header->buffers = static_cast<std::uint32_t>(Buffers);
+        header->element_size = sizeof(T);
+        header->buffer_stride = buffer_stride();
+        header->max_readers = max_readers;
+        header->magic.store(detail::EPOCH_BUFFER_MAGIC, std::memory_order_release);
+    }
+
+    static std::error_code check_header(const shared_memory& shm) noexcept {
+        if (shm.size() < slots_offset()) {
+            return make_error_code(errc::incompatible_layout);
+        }
+        auto* header = static_cast<const detail::epoch_buffer_header*>(shm.data());
+        const std::size_t max_slots =
+            (shm.size() - slots_offset()) / sizeof(detail::epoch_reader_slot);
+        if (header->magic.load(std::memory_order_acquire) != detail::EPOCH_BUFFER_MAGIC ||
+            header->version != detail::EPOCH_BUFFER_VERSION || header->buffers != Buffers ||
+            header->element_size != sizeof(T) || header->buffer_stride != buffer_stride() ||
+            header->max_readers == 0 || header->max_readers > max_slots ||
+            shm.size() < required_size(static_cast<std::size_t>(header->max_readers))) {
+            return make_error_code(errc::incompatible_layout);
+        }
+        return {};
+    }
+
+    void attach(shared_memory&& shm) noexcept {
+        shm_ = std::move(shm);
+        auto* base = static_cast<unsigned char*>(shm_.data());
+        header_ = reinterpret_cast<detail::epoch_buffer_header*>(base);
+        slots_ = reinterpret_cast<detail::epoch_reader_slot*>(base + slots_offset());
+        buffers_ = base + buffers_offset(static_cast<std::size_t>(header_->max_readers));
+        slot_ = nullptr;
+        held_ = not_held;
+        writing_ = false;
+        detail::stat_add_shared(header_->stats.attaches);
+    }
+};
+
+}  // namespace shm
+}  // namespace slick
@@ -21,6 +21,14 @@ enum class errc {
     mapping_failed,
     invalid_size,
     invalid_name,
+    huge_pages_unavailable,
+    lock_limit_exceeded,
+    working_set_quota_exceeded,
+    not_supported,
+    incompatible_layout,
+    timed_out,
+    address_in_use,
+    too_many_readers,
     unknown_error
 };
 
@@ -51,6 +59,22 @@ public:
                 return "invalid size (must be greater than zero)";
             case errc::invalid_name:
                 return "invalid shared memory name";
+            case errc::huge_pages_unavailable:
+                return "huge pages unavailable";
+            case errc::lock_limit_exceeded:
+                return "memory lock limit exceeded (RLIMIT_MEMLOCK)";
+            case errc::working_set_quota_exceeded:
+                return "working set quota exceeded";
+            case errc::not_supported:
+                return "operation not supported on this platform";
+            case errc::incompatible_layout:
+                return "incompatible shared memory layout";
+            case errc::timed_out:
+                return "operation timed out";
+            case errc::address_in_use:
+                return "requested address range already in use";
+            case errc::too_many_readers:
+                return "all reader slots are in use";
             case errc::unknown_error:
             default:
                 return "unknown error";
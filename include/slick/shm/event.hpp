@@ -0,0 +1,224 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 Slick Quant
+
+#pragma once
+
+#include "detail/platform.hpp"
+#include "stats.hpp"
+
+#ifdef SLICK_SHM_WINDOWS
+#include "detail/windows/event_impl.hpp"
+#elif defined(SLICK_SHM_POSIX)
+#include "detail/posix/event_impl.hpp"
+#endif
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <type_traits>
+
+namespace slick {
+namespace shm {
+
+/**
+ * @brief How long a waiter spins before blocking in the kernel
+ */
+struct wait_policy {
+    // Polls of the event (each followed by a CPU pause hint) before blocking.
+    // 0 blocks right away: an idle waiter costs nothing. A few thousand keeps
+    // hot waiters off the kernel path and wakes them in well under a microsecond.
+    std::uint32_t spin_count = 2000;
+};
+
+/**
+ * @brief Cross-process event (eventcount) that lives inside a shared memory segment
+ *
+ * Place a shared_event in a struct that lives in a segment. Zero-filled memory
+ * is a valid event, so a freshly created segment needs no initialization and no
+ * constructor has to run in shared memory.
+ *
+ * Waiters spin for wait_policy::spin_count polls and then block in the kernel:
+ * - Linux: futex(FUTEX_WAIT/FUTEX_WAKE) without FUTEX_PRIVATE_FLAG
+ * - macOS: os_sync_wait_on_address (14.4+ deployment target) or __ulock_wait,
+ *   both in their shared (cross-process) flavor
+ * - Windows: a named semaphore (WaitOnAddress() only works within a process)
+ *
+ * notify_one()/notify_all() only enter the kernel when a waiter is blocked.
+ *
+ * Lost wake-ups are avoided with the eventcount protocol: read epoch() *before*
+ * checking the condition, then wait on that epoch:
+ * @code
+ * for (;;) {
+ *     std::uint32_t epoch = data->ready.epoch();
+ *     if (queue_has_data()) break;
+ *     data->ready.wait(epoch);
+ * }
+ * @endcode
+ * or simply data->ready.wait([&] { return queue_has_data(); });
+ *
+ * Thread safety: all member functions may be called concurrently from any thread
+ * of any process mapping the segment.
+ */
+class shared_event {
+public:
+    /**
+     * @brief Construct an unsignaled event (for events outside shared memory)
+     */
+    shared_event() noexcept : seq_(0), waiters_(0), key_(0), kernel_waits_(0), kernel_wakes_(0) {}
+
+    shared_event(const shared_event&) = delete;
+    shared_event& operator=(const shared_event&) = delete;
+
+    /**
+     * @brief Current notification count, to be passed to wait()/wait_for()
+     */
+    std::uint32_t epoch() const noexcept {
+        return seq_.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Wake at most one waiting thread
+     */
+    void notify_one() noexcept {
+        seq_.fetch_add(1, std::memory_order_seq_cst);
+        if (waiters_.load(std::memory_order_seq_cst) != 0) {
+            count(kernel_wakes_);
+            detail::event_wake(seq_, key_, 1);
+        }
+    }
+
+    /**
+     * @brief Wake all waiting threads
+     */
+    void notify_all() noexcept {
+        seq_.fetch_add(1, std::memory_order_seq_cst);
+        std::uint32_t waiters = waiters_.load(std::memory_order_seq_cst);
+        if (waiters != 0) {
+            count(kernel_wakes_);
+            detail::event_wake(seq_, key_, waiters);
+        }
+    }
+
+    /**
+     * @brief Block until the event is notified after epoch was read
+     * @param epoch Value returned by epoch()
+     * @param policy Spin budget before blocking
+     */
+    void wait(std::uint32_t epoch, const wait_policy& policy = wait_policy()) noexcept {
+        wait_impl(epoch, policy, nullptr);
+    }
+
+    /**
+     * @brief Block until the event is notified after epoch was read, or the timeout expires
+     * @return false if the timeout expired without a notification
+     */
+    template <typename Rep, typename Period>
+    bool wait_for(std::uint32_t epoch, const std::chrono::duration<Rep, Period>& timeout,
+                  const wait_policy& policy = wait_policy()) noexcept {
+        auto deadline = std::chrono::steady_clock::now() +
+                        std::chrono::duration_cast<std::chrono::steady_clock::duration>(timeout);
+        return wait_impl(epoch, policy, &deadline);
+    }
+
+    /**
+     * @brief Block until pred() returns true, re-checking it after every notification
+     */
+    template <typename Predicate,
+              typename = typename std::enable_if<std::is_invocable_r<bool, Predicate&>::value>::type>
+    void wait(Predicate pred, const wait_policy& policy = wait_policy()) {
+        for (;;) {
+            std::uint32_t current = epoch();
+            if (pred()) {
+                return;
+            }
+            wait_impl(current, policy, nullptr);
+        }
+    }
+
+    /**
+     * @brief Block until pred() returns true or the timeout expires
+     * @return The final value of pred()
+     */
+    template <typename Predicate, typename Rep, typename Period,
+              typename = typename std::enable_if<std::is_invocable_r<bool, Predicate&>::value>::type>
+    bool wait_for(Predicate pred, const std::chrono::duration<Rep, Period>& timeout,
+                  const wait_policy& policy = wait_policy()) {
+        auto deadline = std::chrono::steady_clock::now() +
+                        std::chrono::duration_cast<std::chrono::steady_clock::duration>(timeout);
+        for (;;) {
+            std::uint32_t current = epoch();
+            if (pred()) {
+                return true;
+            }
+            if (!wait_impl(current, policy, &deadline)) {
+                return pred();
+            }
+        }
+    }
+
+    /**
+     * @brief Number of times a waiter blocked in the kernel (0 without SLICK_SHM_ENABLE_STATS)
+     */
+    std::uint32_t kernel_waits() const noexcept {
+        return kernel_waits_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Number of wake-ups issued to the kernel (0 without SLICK_SHM_ENABLE_STATS)
+     */
+    std::uint32_t kernel_wakes() const noexcept {
+        return kernel_wakes_.load(std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<std::uint32_t> seq_;      // Bumped by every notification
+    std::atomic<std::uint32_t> waiters_;  // Threads blocked (or about to block) in the kernel
+    std::atomic<std::uint64_t> key_;      // Windows: semaphore name key, 0 until first use
+    std::atomic<std::uint32_t> kernel_waits_;  // See stats.hpp
+    std::atomic<std::uint32_t> kernel_wakes_;
+
+    static void count(std::atomic<std::uint32_t>& counter) noexcept {
+        if (stats_enabled) {
+            counter.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    bool wait_impl(std::uint32_t epoch, const wait_policy& policy,
+                   const std::chrono::steady_clock::time_point* deadline) noexcept {
+        for (std::uint32_t i = 0; i < policy.spin_count; ++i) {
+            if (seq_.load(std::memory_order_acquire) != epoch) {
+                return true;
+            }
+            detail::cpu_relax();
+        }
+
+        // Announce the waiter before the final check so a concurrent notify
+        // either sees it or has already changed seq_
+        waiters_.fetch_add(1, std::memory_order_seq_cst);
+        bool notified = true;
+        while (seq_.load(std::memory_order_seq_cst) == epoch) {
+            if (deadline) {
+                auto remaining = *deadline - std::chrono::steady_clock::now();
+                if (remaining <= std::chrono::steady_clock::duration::zero()) {
+                    notified = false;
+                    break;
+                }
+                std::chrono::nanoseconds timeout =
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(remaining);
+                count(kernel_waits_);
+                detail::event_wait(seq_, epoch, key_, &timeout);
+            } else {
+                count(kernel_waits_);
+                detail::event_wait(seq_, epoch, key_, nullptr);
+            }
+        }
+        waiters_.fetch_sub(1, std::memory_order_relaxed);
+        return notified;
+    }
+};
+
+static_assert(std::is_standard_layout<shared_event>::value,
+              "shared_event must have a fixed in-segment layout");
+
+}  // namespace shm
+}  // namespace slick
@@ -0,0 +1,408 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 Slick Quant
+
+#pragma once
+
+#include "types.hpp"
+#include "error.hpp"
+#include "interprocess_mutex.hpp"
+#include "detail/platform.hpp"
+
+#ifdef SLICK_SHM_WINDOWS
+#include "detail/windows/growable_impl.hpp"
+#elif defined(SLICK_SHM_POSIX)
+#include "detail/posix/growable_impl.hpp"
+#endif
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <utility>
+
+namespace slick {
+namespace shm {
+
+namespace detail {
+
+// In-segment header of a growable_segment, followed by the user data
+struct growable_header {
+    std::atomic<std::uint64_t> magic;  // Published last by the creator
+    std::uint32_t version;
+    std::uint32_t data_offset;         // Start of the user data
+    std::uint64_t max_size;            // Reserved bytes, including the header
+
+    alignas(cache_line_size) std::atomic<std::uint64_t> size;  // Committed bytes, including the header
+    std::atomic<std::uint64_t> generation;                     // Incremented by every grow()
+    interprocess_mutex grow_lock;                              // Serializes growers
+};
+
+constexpr std::uint64_t GROWABLE_MAGIC = 0x776f7267736d6873ULL;  // "shmsgrow"
+constexpr std::uint32_t GROWABLE_VERSION = 1;
+
+// How long an opener waits for a creator that is still writing the header
+constexpr std::chrono::seconds GROWABLE_INIT_TIMEOUT{1};
+
+}  // namespace detail
+
+/**
+ * @brief Named shared memory segment that can grow up to a maximum size in place
+ *
+ * Reserves virtual address space for max_size bytes once, and only backs and maps
+ * the first size() bytes. grow() extends the backing object and the mapping in
+ * page-sized steps without moving data(), so pointers into the segment stay valid
+ * in this process. Memory is only used for the committed part, so a segment can
+ * be sized for its worst day without paying for it every day.
+ *
+ * Other processes notice growth through a generation counter in the segment
+ * header: stale() tells that the segment grew, and refresh() extends their own
+ * view. Until then, they keep accessing the part they already mapped.
+ *
+ * @code
+ * // Writer
+ * growable_segment feed("feed_a", 64 * 1024 * 1024, 64ULL << 30, create_only);
+ * if (needed > feed.size()) {
+ *     feed.grow(needed);
+ * }
+ *
+ * // Reader
+ * growable_segment feed("feed_a", open_existing, access_mode::read_only);
+ * if (feed.stale()) {
+ *     feed.refresh();
+ * }
+ * @endcode
+ *
+ * Implementation:
+ * - POSIX: a PROT_NONE reservation with the shm object mapped over its start
+ *   (MAP_FIXED); grow() extends the object with ftruncate(). macOS can only size a
+ *   shm object once, so the object is sized for max_size up front; untouched pages
+ *   still use no memory
+ * - Windows: a SEC_RESERVE pagefile section of max_size bytes; grow() and refresh()
+ *   commit pages with VirtualAlloc(MEM_COMMIT)
+ *
+ * Thread safety: grow() may be called by several processes at once; each
+ * growable_segment object is used by one thread at a time.
+ *
+ * @note Huge pages (huge_pages::required) and NUMA placement are not supported and
+ *       fail with errc::not_supported; huge_pages::preferred uses standard pages.
+ * @note The segment never shrinks.
+ */
+class growable_segment {
+public:
+    /**
+     * @brief Default constructor - creates an invalid segment
+     */
+    growable_segment() = default;
+
+    /**
+     * @brief Create a new growable segment
+     * @param name Name of the shared memory segment
+     * @param size Initial usable size in bytes
+     * @param max_size Largest usable size the segment can grow to
+     * @param tag create_only tag
+     * @param options Segment options (prefault and lock apply to every committed range)
+     * @throws shared_memory_error if creation fails
+     */
+    growable_segment(const char* name, std::size_t size, std::size_t max_size, create_only_t tag,
+                     const segment_options& options = segment_options()) {
+        (void)tag;
+        last_error_ = create_impl(name, size, max_size, options);
+        if (last_error_) {
+            throw shared_memory_error(last_error_);
+        }
+    }
+
+    /**
+     * @brief Open an existing growable segment
+     * @param name Name of the shared memory segment
+     * @param tag open_existing tag
+     * @param mode Access mode (grow() requires read_write)
+     * @param options Segment options (prefault and lock apply to every committed range)
+     * @throws shared_memory_error if the segment doesn't exist or is not growable
+     * @note An open racing with the creator fails with errc::not_found, or with
+     *       errc::invalid_size while the object is still unsized (POSIX); retry
+     *       in that case. An unpublished header is waited for, up to a second
+     *       (errc::timed_out).
+     */
+    growable_segment(const char* name, open_existing_t tag,
+                     access_mode mode = access_mode::read_write,
+                     const segment_options& options = segment_options()) {
+        (void)tag;
+        last_error_ = open_impl(name, mode, options);
+        if (last_error_) {
+            throw shared_memory_error(last_error_);
+        }
+    }
+
+    /**
+     * @brief Create a new growable segment - no-throw version
+     * @note Check is_valid() and last_error() after construction
+     */
+    growable_segment(const char* name, std::size_t size, std::size_t max_size, create_only_t tag,
+                     const segment_options& options, const std::nothrow_t& nt) noexcept {
+        (void)tag;
+        (void)nt;
+        last_error_ = create_impl(name, size, max_size, options);
+    }
+
+    /**
+     * @brief Open an existing growable segment - no-throw version
+     * @note Check is_valid() and last_error() after construction
+     */
+    growable_segment(const char* name, open_existing_t tag, access_mode mode,
+                     const segment_options& options, const std::nothrow_t& nt) noexcept {
+        (void)tag;
+        (void)nt;
+        last_error_ = open_impl(name, mode, options);
+    }
+
+    growable_segment(const growable_segment&) = delete;
+    growable_segment& operator=(const growable_segment&) = delete;
+
+    growable_segment(growable_segment&& other) noexcept {
+        *this = std::move(other);
+    }
+
+    growable_segment& operator=(growable_segment&& other) noexcept {
+        if (this != &other) {
+            impl_ = std::move(other.impl_);
+            header_ = other.header_;
+            generation_ = other.generation_;
+            last_error_ = other.last_error_;
+
+            other.header_ = nullptr;
+            other.generation_ = 0;
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Grow the segment so that at least new_size bytes are usable
+     *
+     * Does nothing to the segment if it is already large enough (another
+     * process may have grown it), but still extends this process's view.
+     *
+     * @return errc::invalid_size if new_size exceeds max_size(),
+     *         errc::permission_denied on a read_only segment
+     */
+    std::error_code grow(std::size_t new_size) noexcept {
+        if (!is_valid()) {
+            return make_error_code(errc::mapping_failed);
+        }
+        if (impl_.mode() != access_mode::read_write) {
+            return make_error_code(errc::permission_denied);
+        }
+        if (new_size > max_size()) {
+            return make_error_code(errc::invalid_size);
+        }
+
+        std::uint64_t total = round_to_page(header_->data_offset + new_size);
+        try {
+            std::lock_guard<interprocess_mutex> guard(header_->grow_lock);
+            if (header_->size.load(std::memory_order_relaxed) < total) {
+                std::error_code ec = impl_.grow_object(static_cast<std::size_t>(total));
+                if (ec) {
+                    return ec;
+                }
+                header_->size.store(total, std::memory_order_release);
+                header_->generation.fetch_add(1, std::memory_order_release);
+            }
+        } catch (const shared_memory_error& e) {
+            return e.code();
+        }
+        return refresh();
+    }
+
+    /**
+     * @brief Extend this process's view to the current size of the segment
+     *
+     * If locking the new pages fails and they can't be returned to the
+     * reservation, the whole view is unmapped and the segment becomes invalid.
+     */
+    std::error_code refresh() noexcept {
+        if (!is_valid()) {
+            return make_error_code(errc::mapping_failed);
+        }
+        std::uint64_t generation = header_->generation.load(std::memory_order_acquire);
+        if (generation == generation_) {
+            return {};
+        }
+        std::error_code ec =
+            impl_.map_to(static_cast<std::size_t>(header_->size.load(std::memory_order_acquire)));
+        if (!ec) {
+            generation_ = generation;
+        } else if (impl_.data() == nullptr) {
+            // The view couldn't be rolled back and was unmapped
+            header_ = nullptr;
+        }
+        return ec;
+    }
+
+    /**
+     * @brief true if the segment grew since this view was last extended
+     */
+    bool stale() const noexcept {
+        return is_valid() &&
+               header_->generation.load(std::memory_order_acquire) != generation_;
+    }
+
+    /**
+     * @brief Number of grow() calls that this view has caught up with
+     */
+    std::uint64_t generation() const noexcept {
+        return generation_;
+    }
+
+    // ========================================================================
+    // Accessors
+    // ========================================================================
+
+    /**
+     * @brief Start of the usable memory (stable for the lifetime of this object)
+     */
+    void* data() noexcept {
+        return header_ ? reinterpret_cast<char*>(header_) + header_->data_offset : nullptr;
+    }
+
+    const void* data() const noexcept {
+        return header_ ? reinterpret_cast<const char*>(header_) + header_->data_offset : nullptr;
+    }
+
+    /**
+     * @brief Usable bytes in this process's view
+     */
+    std::size_t size() const noexcept {
+        return header_ ? impl_.mapped_size() - header_->data_offset : 0;
+    }
+
+    /**
+     * @brief Largest usable size the segment can grow to
+     */
+    std::size_t max_size() const noexcept {
+        return header_ ? impl_.reserved_size() - header_->data_offset : 0;
+    }
+
+    const char* name() const noexcept {
+        return impl_.name();
+    }
+
+    access_mode mode() const noexcept {
+        return impl_.mode();
+    }
+
+    bool is_creator() const noexcept {
+        return impl_.is_creator();
+    }
+
+    std::size_t page_size() const noexcept {
+        return impl_.page_size();
+    }
+
+    bool is_valid() const noexcept {
+        return header_ != nullptr;
+    }
+
+    std::error_code last_error() const noexcept {
+        return last_error_;
+    }
+
+    /**
+     * @brief Remove a growable segment by name
+     * @note Windows: no-op, the segment goes away with its last handle.
+     */
+    static bool remove(const char* name) noexcept {
+        return detail::platform_growable_segment::remove(name);
+    }
+
+private:
+    detail::platform_growable_segment impl_;
+    detail::growable_header* header_ = nullptr;
+    std::uint64_t generation_ = 0;
+    std::error_code last_error_;
+
+    static constexpr std::size_t data_offset() noexcept {
+        return (sizeof(detail::growable_header) + detail::cache_line_size - 1) /
+               detail::cache_line_size * detail::cache_line_size;
+    }
+
+    std::uint64_t round_to_page(std::uint64_t bytes) const noexcept {
+        std::uint64_t page = impl_.page_size();
+        return (bytes + page - 1) / page * page;
+    }
+
+    std::error_code create_impl(const char* name, std::size_t size, std::size_t max_size,
+                                const segment_options& options) {
+        if (size == 0 || max_size < size) {
+            return make_error_code(errc::invalid_size);
+        }
+        std::error_code ec = impl_.create(name, data_offset() + size, data_offset() + max_size,
+                                          options);
+        if (ec) {
+            return ec;
+        }
+
+        // The object is zero-filled, which is also an unlocked grow_lock
+        auto* header = static_cast<detail::growable_header*>(impl_.data());
+        header->version = detail::GROWABLE_VERSION;
+        header->data_offset = static_cast<std::uint32_t>(data_offset());
+        header->max_size = impl_.reserved_size();
+        header->size.store(impl_.mapped_size(), std::memory_order_relaxed);
+        header->generation.store(0, std::memory_order_relaxed);
+        header->magic.store(detail::GROWABLE_MAGIC, std::memory_order_release);
+
+        header_ = header;
+        generation_ = 0;
+        return {};
+    }
+
+    std::error_code open_impl(const char* name, access_mode mode, const segment_options& options) {
+        std::error_code ec = impl_.open(name, mode, options, sizeof(detail::growable_header));
+        if (ec) {
+            return ec;
+        }
+
+        auto* probe = static_cast<const detail::growable_header*>(impl_.data());
+        // The creator may still be writing the header
+        auto deadline = std::chrono::steady_clock::now() + detail::GROWABLE_INIT_TIMEOUT;
+        while (probe->magic.load(std::memory_order_acquire) == 0) {
+            if (std::chrono::steady_clock::now() >= deadline) {
+                impl_ = detail::platform_growable_segment();
+                return make_error_code(errc::timed_out);
+            }
+            std::this_thread::yield();
+        }
+        if (probe->magic.load(std::memory_order_acquire) != detail::GROWABLE_MAGIC ||
+            probe->version != detail::GROWABLE_VERSION ||
+            probe->data_offset != data_offset() || probe->max_size < data_offset()) {
+            impl_ = detail::platform_growable_segment();
+            return make_error_code(errc::incompatible_layout);
+        }
+        // Read everything needed from the probe mapping, which reserve() may replace.
+        // A grow() racing with this is picked up by the next refresh().
+        std::size_t max_size = static_cast<std::size_t>(probe->max_size);
+        std::uint64_t generation = probe->generation.load(std::memory_order_acquire);
+        std::size_t size = static_cast<std::size_t>(probe->size.load(std::memory_order_acquire));
+        if (size > max_size) {
+            impl_ = detail::platform_growable_segment();
+            return make_error_code(errc::incompatible_layout);
+        }
+
+        ec = impl_.reserve(max_size);
+        if (!ec) {
+            ec = impl_.map_to(size);
+        }
+        if (ec) {
+            impl_ = detail::platform_growable_segment();
+            return ec;
+        }
+
+        header_ = static_cast<detail::growable_header*>(impl_.data());
+        generation_ = generation;
+        return {};
+    }
+};
+
+}  // namespace shm
+}  // namespace slick
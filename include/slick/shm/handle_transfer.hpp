@@ -0,0 +1,101 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 Slick Quant
+
+#pragma once
+
+#include "shared_memory.hpp"
+
+#ifdef SLICK_SHM_WINDOWS
+#include "detail/windows/handle_transfer_impl.hpp"
+#elif defined(SLICK_SHM_POSIX)
+#include "detail/posix/handle_transfer_impl.hpp"
+#endif
+
+#include <cstdint>
+#include <system_error>
+
+namespace slick {
+namespace shm {
+
+/**
+ * Handing segment handles to other processes.
+ *
+ * Anonymous segments (shared_memory(size, anonymous)) have no name, so other
+ * processes get them through their handle instead. The receiver maps the
+ * handle with shared_memory(handle, adopt_handle), which also takes ownership:
+ *
+ * @code
+ * // Producer
+ * shared_memory shm(64 * 1024 * 1024, anonymous);
+ * send_handle(socket, shm.native_handle());
+ *
+ * // Consumer
+ * shared_memory::native_handle_type handle;
+ * if (!receive_handle(socket, handle)) {
+ *     shared_memory shm(handle, adopt_handle, access_mode::read_only);
+ * }
+ * @endcode
+ */
+
+/**
+ * @brief Copy a handle out of another process into this one
+ * @param pid Process that owns the handle
+ * @param remote Value of the handle in that process
+ * @param[out] handle Handle in this process (owned by the caller)
+ * @return errc::not_found if the process or the handle doesn't exist,
+ *         errc::permission_denied if the process may not be accessed,
+ *         errc::not_supported where the platform can't do it
+ * @note Linux: pidfd_getfd() (5.6+), which needs ptrace access to pid.
+ *       Windows: DuplicateHandle(), which needs PROCESS_DUP_HANDLE access.
+ *       macOS: not supported, use send_handle().
+ */
+inline std::error_code import_handle(std::uint32_t pid, shared_memory::native_handle_type remote,
+                                     shared_memory::native_handle_type& handle) noexcept {
+    return detail::import_handle(pid, remote, handle);
+}
+
+#ifdef SLICK_SHM_POSIX
+
+/**
+ * @brief Send a descriptor over a connected Unix domain socket (SCM_RIGHTS)
+ * @note The descriptor stays open and owned by the sender.
+ * @note A peer that has gone away fails the send with EPIPE rather than raising
+ *       SIGPIPE (MSG_NOSIGNAL). macOS has no such flag: set SO_NOSIGPIPE on the
+ *       socket or ignore SIGPIPE there.
+ */
+inline std::error_code send_handle(int socket, shared_memory::native_handle_type handle) noexcept {
+    return detail::send_handle(socket, handle);
+}
+
+/**
+ * @brief Receive a descriptor sent with send_handle()
+ * @param socket Connected Unix domain socket
+ * @param[out] handle Received descriptor (owned by the caller, close-on-exec)
+ * @return errc::not_found if the peer closed the socket, errc::invalid_argument
+ *         if the message carried no descriptor or more than one (any
+ *         descriptors it did carry are closed)
+ */
+inline std::error_code receive_handle(int socket, shared_memory::native_handle_type& handle) noexcept {
+    return detail::receive_handle(socket, handle);
+}
+
+#endif  // SLICK_SHM_POSIX
+
+#ifdef SLICK_SHM_WINDOWS
+
+/**
+ * @brief Duplicate a handle into another process
+ * @param pid Target process
+ * @param handle Handle in this process (stays owned by this process)
+ * @param[out] remote Value of the new handle in the target process; send it
+ *             there by any channel and adopt it with adopt_handle
+ */
+inline std::error_code share_handle(std::uint32_t pid, shared_memory::native_handle_type handle,
+                                    shared_memory::native_handle_type& remote) noexcept {
+    return detail::share_handle(pid, handle, remote);
+}
+
+#endif  // SLICK_SHM_WINDOWS
+
+}  // namespace shm
+}  // namespace slick
@@ -0,0 +1,275 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 Slick Quant
+
+#pragma once
+
+#include "error.hpp"
+#include "detail/platform.hpp"
+
+#ifdef SLICK_SHM_WINDOWS
+#include "detail/windows/event_impl.hpp"
+#include "detail/windows/process_impl.hpp"
+#elif defined(SLICK_SHM_POSIX)
+#include "detail/posix/event_impl.hpp"
+#include "detail/posix/process_impl.hpp"
+#endif
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <system_error>
+#include <thread>
+
+// Robust process-shared pthread mutexes are available everywhere except macOS
+#if defined(SLICK_SHM_POSIX) && !defined(SLICK_SHM_MACOS)
+#define SLICK_SHM_ROBUST_PTHREAD_MUTEX
+#include <cerrno>
+#include <pthread.h>
+#endif
+
+namespace slick {
+namespace shm {
+
+/**
+ * @brief Mutex that lives inside a shared memory segment and survives owner death
+ *
+ * Zero-filled memory is a valid, unlocked mutex, so it can be embedded in a
+ * struct in a freshly created segment without any initialization. If the memory
+ * may hold stale data, construct it once in the creator before anyone else uses it:
+ * @code
+ * shared_memory shm("config", sizeof(config_block), open_or_create);
+ * auto* block = static_cast<config_block*>(shm.data());
+ * if (shm.is_creator()) {
+ *     new (&block->lock) interprocess_mutex();
+ * }
+ * @endcode
+ *
+ * If the owner dies while holding the lock, the next lock() succeeds and
+ * recovered() returns true, signalling that the protected data may be
+ * half-updated and should be validated or repaired before unlock().
+ *
+ * Implementation:
+ * - Linux and other POSIX systems: pthread mutex with PTHREAD_PROCESS_SHARED and
+ *   PTHREAD_MUTEX_ROBUST (EOWNERDEAD is recovered with pthread_mutex_consistent()),
+ *   initialized on first use
+ * - macOS and Windows: a lock word holding the owner PID. Waiters spin, then block
+ *   (shared address wait / named semaphore) and periodically check whether the
+ *   owner process is still alive. Only the death of the whole owner process is
+ *   detected, not of a single thread.
+ *
+ * Meets the Lockable requirements, so std::lock_guard and std::unique_lock work.
+ * Not recursive.
+ *
+ * @note A mutex placed in a segment is never destroyed explicitly; it goes away
+ *       with the segment.
+ */
+class interprocess_mutex {
+public:
+    /**
+     * @brief Construct an unlocked mutex
+     * @throws shared_memory_error if the platform mutex can't be initialized
+     */
+    interprocess_mutex() {
+#ifdef SLICK_SHM_ROBUST_PTHREAD_MUTEX
+        state_.store(UNINITIALIZED, std::memory_order_relaxed);
+        recovered_ = false;
+        ensure_initialized();
+#else
+        owner_.store(0, std::memory_order_relaxed);
+        waiters_.store(0, std::memory_order_relaxed);
+        key_.store(0, std::memory_order_relaxed);
+        recovered_ = false;
+#endif
+    }
+
+    ~interprocess_mutex() {
+#ifdef SLICK_SHM_ROBUST_PTHREAD_MUTEX
+        if (state_.load(std::memory_order_acquire) == READY) {
+            pthread_mutex_destroy(&mutex_);
+        }
+#endif
+    }
+
+    interprocess_mutex(const interprocess_mutex&) = delete;
+    interprocess_mutex& operator=(const interprocess_mutex&) = delete;
+
+    /**
+     * @brief Acquire the lock, blocking if necessary
+     * @throws shared_memory_error if the platform mutex fails
+     */
+    void lock() {
+#ifdef SLICK_SHM_ROBUST_PTHREAD_MUTEX
+        ensure_initialized();
+        int rc = pthread_mutex_lock(&mutex_);
+        if (!acquired(rc)) {
+            throw shared_memory_error(std::error_code(rc, std::system_category()),
+                                      "interprocess_mutex lock failed");
+        }
+#else
+        const std::uint32_t self = detail::current_process_id();
+        for (std::uint32_t attempt = 0;; ++attempt) {
+            std::uint32_t owner = 0;
+            if (try_acquire(owner, self)) {
+                return;
+            }
+            if (attempt < SPIN_COUNT) {
+                detail::cpu_relax();
+                continue;
+            }
+            if (take_over_if_dead(owner, self)) {
+                return;
+            }
+
+            // Block until the owner unlocks; wake up periodically to check
+            // that the owner is still alive
+            waiters_.fetch_add(1, std::memory_order_seq_cst);
+            if (owner_.load(std::memory_order_seq_cst) == owner) {
+                std::chrono::nanoseconds timeout = OWNER_CHECK_INTERVAL;
+                detail::event_wait(owner_, owner, key_, &timeout);
+            }
+            waiters_.fetch_sub(1, std::memory_order_relaxed);
+        }
+#endif
+    }
+
+    /**
+     * @brief Try to acquire the lock without blocking
+     * @return true if the lock was acquired
+     */
+    bool try_lock() {
+#ifdef SLICK_SHM_ROBUST_PTHREAD_MUTEX
+        ensure_initialized();
+        int rc = pthread_mutex_trylock(&mutex_);
+        if (rc == EBUSY) {
+            return false;
+        }
+        if (!acquired(rc)) {
+            throw shared_memory_error(std::error_code(rc, std::system_category()),
+                                      "interprocess_mutex try_lock failed");
+        }
+        return true;
+#else
+        const std::uint32_t self = detail::current_process_id();
+        std::uint32_t owner = 0;
+        return try_acquire(owner, self) || take_over_if_dead(owner, self);
+#endif
+    }
+
+    /**
+     * @brief Release the lock
+     */
+    void unlock() noexcept {
+        recovered_ = false;
+#ifdef SLICK_SHM_ROBUST_PTHREAD_MUTEX
+        pthread_mutex_unlock(&mutex_);
+#else
+        owner_.store(0, std::memory_order_seq_cst);
+        if (waiters_.load(std::memory_order_seq_cst) != 0) {
+            detail::event_wake(owner_, key_, 1);
+        }
+#endif
+    }
+
+    /**
+     * @brief true if the lock was taken over from an owner that died holding it
+     * @note Only meaningful while the caller holds the lock; cleared by unlock().
+     */
+    bool recovered() const noexcept {
+        return recovered_;
+    }
+
+private:
+#ifdef SLICK_SHM_ROBUST_PTHREAD_MUTEX
+    static constexpr std::uint32_t UNINITIALIZED = 0;  // Zero-filled memory
+    static constexpr std::uint32_t INITIALIZING = 1;
+    static constexpr std::uint32_t READY = 2;
+
+    std::atomic<std::uint32_t> state_;
+    bool recovered_;
+    pthread_mutex_t mutex_;
+
+    // The first user initializes the pthread mutex; everyone else waits for it
+    void ensure_initialized() {
+        if (state_.load(std::memory_order_acquire) == READY) {
+            return;
+        }
+
+        std::uint32_t expected = UNINITIALIZED;
+        if (state_.compare_exchange_strong(expected, INITIALIZING, std::memory_order_acquire)) {
+            pthread_mutexattr_t attr;
+            int rc = pthread_mutexattr_init(&attr);
+            if (rc == 0) {
+                rc = pthread_mutexattr_setpshared(&attr, PTHREAD_PROCESS_SHARED);
+                if (rc == 0) {
+                    rc = pthread_mutexattr_setrobust(&attr, PTHREAD_MUTEX_ROBUST);
+                }
+                if (rc == 0) {
+                    rc = pthread_mutex_init(&mutex_, &attr);
+                }
+                pthread_mutexattr_destroy(&attr);
+            }
+            if (rc != 0) {
+                state_.store(UNINITIALIZED, std::memory_order_release);
+                throw shared_memory_error(std::error_code(rc, std::system_category()),
+                                          "interprocess_mutex initialization failed");
+            }
+            state_.store(READY, std::memory_order_release);
+            return;
+        }
+
+        while (state_.load(std::memory_order_acquire) != READY) {
+            std::this_thread::yield();
+        }
+    }
+
+    // Handle the result of pthread_mutex_(try)lock
+    bool acquired(int rc) noexcept {
+        if (rc == 0) {
+            recovered_ = false;
+            return true;
+        }
+        if (rc == EOWNERDEAD) {
+            // Mark the mutex usable again; the caller decides about the data
+            pthread_mutex_consistent(&mutex_);
+            recovered_ = true;
+            return true;
+        }
+        return false;
+    }
+#else
+    static constexpr std::uint32_t SPIN_COUNT = 1000;
+    static constexpr std::chrono::milliseconds OWNER_CHECK_INTERVAL{10};
+
+    std::atomic<std::uint32_t> owner_;    // PID of the holder, 0 when unlocked
+    std::atomic<std::uint32_t> waiters_;  // Threads blocked in lock()
+    std::atomic<std::uint64_t> key_;      // Windows: wake-up semaphore key
+    bool recovered_;
+
+    // On failure owner receives the current holder
+    bool try_acquire(std::uint32_t& owner, std::uint32_t self) noexcept {
+        owner = 0;
+        if (owner_.compare_exchange_strong(owner, self, std::memory_order_acquire,
+                                           std::memory_order_relaxed)) {
+            recovered_ = false;
+            return true;
+        }
+        return false;
+    }
+
+    // Steal the lock if its holder's process is gone
+    bool take_over_if_dead(std::uint32_t owner, std::uint32_t self) noexcept {
+        if (owner == 0 || detail::is_process_alive(owner)) {
+            return false;
+        }
+        if (owner_.compare_exchange_strong(owner, self, std::memory_order_acquire,
+                                           std::memory_order_relaxed)) {
+            recovered_ = true;
+            return true;
+        }
+        return false;
+    }
+#endif
+};
+
+}  // namespace shm
+}  // namespace slick
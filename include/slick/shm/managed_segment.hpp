@@ -0,0 +1,490 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 Slick Quant
+
+#pragma once
+
+#include "shared_memory.hpp"
+#include "event.hpp"
+#include "stats.hpp"
+
+#ifdef SLICK_SHM_WINDOWS
+#include "detail/windows/process_impl.hpp"
+#elif defined(SLICK_SHM_POSIX)
+#include "detail/posix/process_impl.hpp"
+#endif
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <new>
+#include <system_error>
+#include <thread>
+
+namespace slick {
+namespace shm {
+
+/**
+ * @brief Initialization state published in a managed_segment header
+ */
+enum class segment_state : std::uint32_t {
+    uninitialized = 0,  // Zero-filled: the creator hasn't written the header yet
+    initializing = 1,   // Header written, the creator is initializing the data
+    ready = 2           // mark_ready() was called; the data is complete
+};
+
+namespace detail {
+
+// Header at the start of a managed segment. The plain fields are written before
+// state leaves uninitialized and are read-only afterwards.
+struct managed_header {
+    std::atomic<std::uint64_t> magic;
+    std::uint32_t version;
+    std::uint32_t creator_pid;
+    std::uint64_t layout_version;   // Chosen by the user, e.g. segment_layout::fingerprint
+    std::int64_t created_ns;        // system_clock time since the epoch
+    std::uint64_t data_size;
+    std::uint64_t base_address;     // Creator's mapping, see map_at_creator_address()
+
+    alignas(cache_line_size) std::atomic<std::uint32_t> state;  // segment_state
+    shared_event ready;                                         // Notified by mark_ready()
+
+    stats_block stats;  // See stats.hpp
+};
+
+constexpr std::uint64_t MANAGED_SEGMENT_MAGIC = 0x746e6d6765736d73ULL;  // "smsegmnt"
+constexpr std::uint32_t MANAGED_SEGMENT_VERSION = 1;
+
+}  // namespace detail
+
+/**
+ * @brief Named segment with a header that makes attaching race-free
+ *
+ * The creator writes a header holding a magic number, a layout version, the
+ * creation time and its PID, initializes data(), and then calls mark_ready().
+ * Openers call wait_ready(), which blocks on a shared_event in the header (a
+ * futex on Linux) until the creator is done, instead of polling ad-hoc flags.
+ *
+ * @code
+ * // Creator
+ * managed_segment seg("book", sizeof(book), create_only, BOOK_LAYOUT_VERSION);
+ * new (seg.data()) book();
+ * seg.mark_ready();
+ *
+ * // Any other process
+ * managed_segment seg("book", open_existing, BOOK_LAYOUT_VERSION);
+ * if (!seg.wait_ready(std::chrono::seconds(1))) {
+ *     auto* b = static_cast<book*>(seg.data());
+ * }
+ * @endcode
+ *
+ * A segment that exists but has not been sized yet opens with
+ * errc::invalid_size; retry the open in that case. Once the open succeeds, all
+ * further waiting happens through the header.
+ *
+ * Thread safety: wait_ready() may be called concurrently from any thread of any
+ * process; mark_ready() is called once by the creator.
+ */
+class managed_segment {
+public:
+    /**
+     * @brief Default constructor - creates an invalid segment
+     */
+    managed_segment() = default;
+
+    /**
+     * @brief Create a new segment and write its header
+     * @param name Name of the shared memory segment
+     * @param size Bytes available at data()
+     * @param tag create_only tag
+     * @param layout_version Version or hash of the data layout, checked by openers
+     * @param options Segment options (huge pages, prefault, lock, ...)
+     * @throws shared_memory_error if creation fails
+     * @note The segment is in segment_state::initializing until mark_ready()
+     */
+    managed_segment(const char* name, std::size_t size, create_only_t tag,
+                    std::uint64_t layout_version = 0,
+                    const segment_options& options = segment_options()) {
+        (void)tag;
+        last_error_ = create_impl(name, size, layout_version, options);
+        if (last_error_) {
+            throw shared_memory_error(last_error_);
+        }
+    }
+
+    /**
+     * @brief Open an existing segment without waiting for it to be ready
+     * @param name Name of the shared memory segment
+     * @param tag open_existing tag
+     * @param layout_version Expected layout version; 0 accepts any
+     * @param mode Access mode; read_only openers poll in wait_ready() because
+     *        blocking on the event needs to write to the segment
+     * @param options Segment options (mapping related options only)
+     * @throws shared_memory_error if the segment can't be opened, or is ready
+     *         and has another magic or layout version (errc::incompatible_layout)
+     */
+    managed_segment(const char* name, open_existing_t tag, std::uint64_t layout_version = 0,
+                    access_mode mode = access_mode::read_write,
+                    const segment_options& options = segment_options()) {
+        (void)tag;
+        last_error_ = open_impl(name, layout_version, mode, options);
+        if (last_error_) {
+            throw shared_memory_error(last_error_);
+        }
+    }
+
+    /**
+     * @brief Create a new segment - no-throw version
+     * @note Check is_valid() and last_error() after construction
+     */
+    managed_segment(const char* name, std::size_t size, create_only_t tag,
+                    std::uint64_t layout_version, const segment_options& options,
+                    const std::nothrow_t& nt) noexcept {
+        (void)tag;
+        (void)nt;
+        last_error_ = create_impl(name, size, layout_version, options);
+    }
+
+    /**
+     * @brief Open an existing segment - no-throw version
+     * @note Check is_valid() and last_error() after construction
+     */
+    managed_segment(const char* name, open_existing_t tag, std::uint64_t layout_version,
+                    access_mode mode, const segment_options& options,
+                    const std::nothrow_t& nt) noexcept {
+        (void)tag;
+        (void)nt;
+        last_error_ = open_impl(name, layout_version, mode, options);
+    }
+
+    managed_segment(const managed_segment&) = delete;
+    managed_segment& operator=(const managed_segment&) = delete;
+
+    managed_segment(managed_segment&& other) noexcept {
+        *this = std::move(other);
+    }
+
+    ~managed_segment() {
+        count_detach();
+    }
+
+    managed_segment& operator=(managed_segment&& other) noexcept {
+        if (this != &other) {
+            count_detach();
+            shm_ = std::move(other.shm_);
+            header_ = other.header_;
+            layout_version_ = other.layout_version_;
+            options_ = other.options_;
+            last_error_ = other.last_error_;
+
+            other.header_ = nullptr;
+        }
+        return *this;
+    }
+
+    // ========================================================================
+    // Initialization barrier
+    // ========================================================================
+
+    /**
+     * @brief Publish the data and wake every waiting opener (creator only)
+     */
+    void mark_ready() noexcept {
+        header_->state.store(static_cast<std::uint32_t>(segment_state::ready),
+                             std::memory_order_release);
+        header_->ready.notify_all();
+    }
+
+    /**
+     * @brief Block until the creator called mark_ready()
+     * @return Error code, empty once ready. errc::incompatible_layout if the
+     *         header doesn't match the expected magic or layout version.
+     */
+    std::error_code wait_ready(const wait_policy& policy = wait_policy()) noexcept {
+        return wait_impl(policy, nullptr);
+    }
+
+    /**
+     * @brief Block until the creator called mark_ready() or the timeout expires
+     * @return Error code, empty once ready. errc::timed_out if the timeout
+     *         expired (check creator_alive() to tell a slow creator from a dead one).
+     */
+    template <typename Rep, typename Period>
+    std::error_code wait_ready(const std::chrono::duration<Rep, Period>& timeout,
+                               const wait_policy& policy = wait_policy()) noexcept {
+        auto deadline = std::chrono::steady_clock::now() +
+                        std::chrono::duration_cast<std::chrono::steady_clock::duration>(timeout);
+        return wait_impl(policy, &deadline);
+    }
+
+    /**
+     * @brief Current initialization state
+     */
+    segment_state state() const noexcept {
+        return static_cast<segment_state>(header_->state.load(std::memory_order_acquire));
+    }
+
+    bool is_ready() const noexcept {
+        return header_ != nullptr && state() == segment_state::ready;
+    }
+
+    // ========================================================================
+    // Header
+    // ========================================================================
+
+    /**
+     * @brief Layout version written by the creator
+     * @note Header fields other than state() are only meaningful once the state
+     *       is no longer segment_state::uninitialized
+     */
+    std::uint64_t layout_version() const noexcept {
+        return header_->layout_version;
+    }
+
+    std::chrono::system_clock::time_point creation_time() const noexcept {
+        return std::chrono::system_clock::time_point(
+            std::chrono::duration_cast<std::chrono::system_clock::duration>(
+                std::chrono::nanoseconds(header_->created_ns)));
+    }
+
+    std::uint32_t creator_pid() const noexcept {
+        return header_->creator_pid;
+    }
+
+    /**
+     * @brief Check if the creating process still runs (false only if it's known to be gone)
+     */
+    bool creator_alive() const noexcept {
+        return detail::is_process_alive(header_->creator_pid);
+    }
+
+    /**
+     * @brief Address the creator has the segment mapped at
+     */
+    void* creator_address() const noexcept {
+        return reinterpret_cast<void*>(static_cast<std::uintptr_t>(header_->base_address));
+    }
+
+    /**
+     * @brief Map the segment again at the creator's address and drop the current mapping
+     *
+     * Raw pointers into the segment stored by the creator are then valid in this
+     * process too. The creator picks an address with segment_options::base_address
+     * that is free in every participating process.
+     *
+     * @return errc::address_in_use if anything (including the current mapping)
+     *         occupies the range, errc::invalid_argument before the header is written
+     * @note Pointers previously obtained from data() or segment() are invalidated
+     */
+    std::error_code map_at_creator_address() noexcept {
+        if (header_ == nullptr) {
+            return make_error_code(errc::mapping_failed);
+        }
+        if (state() == segment_state::uninitialized) {
+            return make_error_code(errc::invalid_argument);
+        }
+        void* base = creator_address();
+        if (shm_.data() == base) {
+            return {};
+        }
+
+        segment_options options = options_;
+        options.base_address = base;
+        shared_memory shm(shm_.name(), open_existing, shm_.mode(), options, std::nothrow);
+        if (!shm.is_valid()) {
+            return shm.last_error();
+        }
+
+        shm_ = std::move(shm);
+        header_ = static_cast<detail::managed_header*>(shm_.data());
+        return {};
+    }
+
+    /**
+     * @brief Counters of the segment (see stats.hpp)
+     * @note waits and wakes are those of the ready barrier. Read-only openers
+     *       don't count as attaches.
+     */
+    segment_stats stats_snapshot() const noexcept {
+        if (header_ == nullptr) {
+            return segment_stats();
+        }
+        segment_stats stats = detail::load_stats(header_->stats);
+        stats.waits += header_->ready.kernel_waits();
+        stats.wakes += header_->ready.kernel_wakes();
+        return stats;
+    }
+
+    // ========================================================================
+    // Data
+    // ========================================================================
+
+    void* data() noexcept {
+        return header_ ? static_cast<char*>(shm_.data()) + data_offset() : nullptr;
+    }
+
+    const void* data() const noexcept {
+        return header_ ? static_cast<const char*>(shm_.data()) + data_offset() : nullptr;
+    }
+
+    /**
+     * @brief Bytes available at data(), as requested by the creator
+     * @note Openers read it from the header, so call it after wait_ready()
+     */
+    std::size_t size() const noexcept {
+        return header_ ? static_cast<std::size_t>(header_->data_size) : 0;
+    }
+
+    /**
+     * @brief Underlying segment (includes the header)
+     */
+    shared_memory& segment() noexcept {
+        return shm_;
+    }
+
+    const char* name() const noexcept {
+        return shm_.name();
+    }
+
+    bool is_creator() const noexcept {
+        return shm_.is_creator();
+    }
+
+    bool is_valid() const noexcept {
+        return header_ != nullptr;
+    }
+
+    std::error_code last_error() const noexcept {
+        return last_error_;
+    }
+
+    /**
+     * @brief Offset of data() from the start of the segment
+     */
+    static constexpr std::size_t data_offset() noexcept {
+        return detail::align_up(sizeof(detail::managed_header), detail::cache_line_size);
+    }
+
+private:
+    shared_memory shm_;
+    detail::managed_header* header_ = nullptr;
+    std::uint64_t layout_version_ = 0;  // Expected by this opener, 0 = any
+    segment_options options_;           // Reused by map_at_creator_address()
+    std::error_code last_error_;
+
+    std::error_code create_impl(const char* name, std::size_t size, std::uint64_t layout_version,
+                                const segment_options& options) {
+        if (size == 0) {
+            return make_error_code(errc::invalid_size);
+        }
+
+        shared_memory shm(name, data_offset() + size, create_only, access_mode::read_write,
+                          options, std::nothrow);
+        if (!shm.is_valid()) {
+            return shm.last_error();
+        }
+
+        // The segment is zero-filled, so the state is uninitialized and the
+        // event is valid. Fill in the header, then leave uninitialized
+        auto* header = static_cast<detail::managed_header*>(shm.data());
+        header->version = detail::MANAGED_SEGMENT_VERSION;
+        header->creator_pid = detail::current_process_id();
+        header->layout_version = layout_version;
+        header->created_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                 std::chrono::system_clock::now().time_since_epoch())
+                                 .count();
+        header->data_size = size;
+        header->base_address = reinterpret_cast<std::uintptr_t>(shm.data());
+        header->magic.store(detail::MANAGED_SEGMENT_MAGIC, std::memory_order_relaxed);
+        detail::stat_add_shared(header->stats.attaches);
+        header->state.store(static_cast<std::uint32_t>(segment_state::initializing),
+                            std::memory_order_release);
+
+        shm_ = std::move(shm);
+        header_ = header;
+        layout_version_ = layout_version;
+        return {};
+    }
+
+    std::error_code open_impl(const char* name, std::uint64_t layout_version, access_mode mode,
+                              const segment_options& options) {
+        shared_memory shm(name, open_existing, mode, options, std::nothrow);
+        if (!shm.is_valid()) {
+            return shm.last_error();
+        }
+        if (shm.size() < data_offset()) {
+            return make_error_code(errc::incompatible_layout);
+        }
+
+        auto* header = static_cast<detail::managed_header*>(shm.data());
+        layout_version_ = layout_version;
+        if (header->state.load(std::memory_order_acquire) ==
+                static_cast<std::uint32_t>(segment_state::ready) &&
+            !header_matches(header, shm.size())) {
+            return make_error_code(errc::incompatible_layout);
+        }
+
+        shm_ = std::move(shm);
+        header_ = header;
+        options_ = options;
+        if (mode == access_mode::read_write) {
+            detail::stat_add_shared(header_->stats.attaches);
+        }
+        return {};
+    }
+
+    void count_detach() noexcept {
+        if (header_ != nullptr && shm_.mode() == access_mode::read_write) {
+            detail::stat_add_shared(header_->stats.detaches);
+        }
+    }
+
+    bool header_matches(const detail::managed_header* header, std::size_t mapped) const noexcept {
+        return header->magic.load(std::memory_order_relaxed) == detail::MANAGED_SEGMENT_MAGIC &&
+               header->version == detail::MANAGED_SEGMENT_VERSION &&
+               (layout_version_ == 0 || header->layout_version == layout_version_) &&
+               header->data_size <= mapped - data_offset();
+    }
+
+    std::error_code wait_impl(const wait_policy& policy,
+                              const std::chrono::steady_clock::time_point* deadline) noexcept {
+        if (header_ == nullptr) {
+            return make_error_code(errc::mapping_failed);
+        }
+
+        auto ready = [this] { return is_ready(); };
+        bool done;
+        if (shm_.mode() == access_mode::read_write) {
+            if (deadline) {
+                auto remaining = *deadline - std::chrono::steady_clock::now();
+                done = header_->ready.wait_for(ready, remaining, policy);
+            } else {
+                header_->ready.wait(ready, policy);
+                done = true;
+            }
+        } else {
+            // shared_event waiters register themselves in the segment
+            done = poll_ready(deadline);
+        }
+
+        if (!done) {
+            return make_error_code(errc::timed_out);
+        }
+        if (!header_matches(header_, shm_.size())) {
+            return make_error_code(errc::incompatible_layout);
+        }
+        return {};
+    }
+
+    bool poll_ready(const std::chrono::steady_clock::time_point* deadline) const noexcept {
+        while (!is_ready()) {
+            if (deadline && std::chrono::steady_clock::now() >= *deadline) {
+                return false;
+            }
+            std::this_thread::yield();
+        }
+        return true;
+    }
+};
+
+}  // namespace shm
+}  // namespace slick
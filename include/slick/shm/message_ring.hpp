@@ -0,0 +1,568 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 Slick Quant
+
+#pragma once
+
+#include "shared_memory.hpp"
+#include "stats.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <new>
+
+namespace slick {
+namespace shm {
+
+namespace detail {
+
+// In-segment control block of a message_ring. Positions are byte offsets that
+// only ever grow; the slot offset is position & (capacity - 1).
+struct message_ring_header {
+    std::atomic<std::uint64_t> magic;  // Published last by the creator
+    std::uint32_t version;
+    std::uint32_t alignment;           // Record alignment in bytes
+    std::uint64_t capacity;            // Data area size in bytes, power of two
+
+    alignas(cache_line_size) std::atomic<std::uint64_t> head;  // Next write position (producer)
+    alignas(cache_line_size) std::atomic<std::uint64_t> tail;  // Next read position (consumer)
+
+    stats_block stats;  // See stats.hpp
+};
+
+// Every record starts with this header at an alignment boundary; the payload
+// follows immediately. A padding record fills the gap up to the end of the data
+// area when a message doesn't fit before the wrap point.
+struct message_record_header {
+    std::uint32_t length;  // Payload bytes (message) or whole record bytes (padding)
+    std::uint32_t type;
+};
+
+// Largest record (framing included), so that message and padding lengths fit
+// message_record_header::length
+constexpr std::uint64_t MAX_MESSAGE_RECORD = std::uint64_t(1) << 32;
+
+constexpr std::uint32_t MESSAGE_RECORD = 1;
+constexpr std::uint32_t PADDING_RECORD = 2;
+
+constexpr std::uint64_t MESSAGE_RING_MAGIC = 0x676e69726773656dULL;  // "mesgring"
+constexpr std::uint32_t MESSAGE_RING_VERSION = 1;
+
+// Record alignment limits; records are always at least as aligned as their header
+constexpr std::size_t MIN_MESSAGE_ALIGNMENT = sizeof(message_record_header);
+constexpr std::size_t MAX_MESSAGE_ALIGNMENT = 4096;
+
+}  // namespace detail
+
+/**
+ * @brief Writable view of a claimed message, pointing into the segment
+ */
+class message_span {
+public:
+    message_span() = default;
+    message_span(unsigned char* data, std::size_t size) noexcept : data_(data), size_(size) {}
+
+    unsigned char* data() const noexcept { return data_; }
+    std::size_t size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+    unsigned char* begin() const noexcept { return data_; }
+    unsigned char* end() const noexcept { return data_ + size_; }
+    explicit operator bool() const noexcept { return data_ != nullptr; }
+
+private:
+    unsigned char* data_ = nullptr;
+    std::size_t size_ = 0;
+};
+
+/**
+ * @brief Read-only view of a received message, pointing into the segment
+ */
+class message_view {
+public:
+    message_view() = default;
+    message_view(const unsigned char* data, std::size_t size) noexcept : data_(data), size_(size) {}
+
+    const unsigned char* data() const noexcept { return data_; }
+    std::size_t size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+    const unsigned char* begin() const noexcept { return data_; }
+    const unsigned char* end() const noexcept { return data_ + size_; }
+    explicit operator bool() const noexcept { return data_ != nullptr; }
+
+private:
+    const unsigned char* data_ = nullptr;
+    std::size_t size_ = 0;
+};
+
+/**
+ * @brief Single-producer/single-consumer ring of variable-length messages
+ *
+ * Zero-copy in both directions: the producer claims space for a message, writes
+ * (serializes) it directly into the segment and commits it; the consumer gets a
+ * read-only view of the bytes in place and releases it when done.
+ *
+ * @code
+ * message_span span = ring.claim(len);
+ * if (span) {
+ *     encode(span.data(), len);
+ *     ring.commit(span);
+ * }
+ * @endcode
+ *
+ * Each message is framed by an 8-byte record header and the record is padded to
+ * the ring's alignment (8 by default; 64 keeps every record on its own cache
+ * line). A message never straddles the end of the data area: if it doesn't fit
+ * before the wrap point, a padding record fills the rest and the message starts
+ * at offset 0.
+ *
+ * Thread safety: exactly one thread may claim/commit and exactly one thread may
+ * read/release at a time, across all processes attached to the ring.
+ *
+ * @note The consumer needs a read_write mapping because it publishes its read position.
+ */
+class message_ring {
+public:
+    /**
+     * @brief Default constructor - creates an invalid ring
+     */
+    message_ring() = default;
+
+    /**
+     * @brief Create a new ring in a new segment
+     * @param name Name of the shared memory segment
+     * @param capacity Data area size in bytes (rounded up to a power of two)
+     * @param tag create_only tag
+     * @param alignment Record alignment, a power of two from 8 to 4096 (default: 8)
+     * @param options Segment options (huge pages, prefault, lock, ...)
+     * @throws shared_memory_error if creation fails
+     */
+    message_ring(const char* name, std::size_t capacity, create_only_t tag,
+                 std::size_t alignment = detail::MIN_MESSAGE_ALIGNMENT,
+                 const segment_options& options = segment_options()) {
+        (void)tag;
+        last_error_ = create_impl(name, capacity, alignment, options);
+        if (last_error_) {
+            throw shared_memory_error(last_error_);
+        }
+    }
+
+    /**
+     * @brief Attach to an existing ring
+     * @param name Name of the shared memory segment
+     * @param tag open_existing tag
+     * @param options Segment options (mapping related options only)
+     * @throws shared_memory_error if the segment doesn't exist or is not a message ring
+     */
+    message_ring(const char* name, open_existing_t tag,
+                 const segment_options& options = segment_options()) {
+        (void)tag;
+        last_error_ = open_impl(name, options);
+        if (last_error_) {
+            throw shared_memory_error(last_error_);
+        }
+    }
+
+    /**
+     * @brief Create a new ring - no-throw version
+     * @note Check is_valid() and last_error() after construction
+     */
+    message_ring(const char* name, std::size_t capacity, create_only_t tag, std::size_t alignment,
+                 const segment_options& options, const std::nothrow_t& nt) noexcept {
+        (void)tag;
+        (void)nt;
+        last_error_ = create_impl(name, capacity, alignment, options);
+    }
+
+    /**
+     * @brief Attach to an existing ring - no-throw version
+     * @note Check is_valid() and last_error() after construction
+     */
+    message_ring(const char* name, open_existing_t tag, const segment_options& options,
+                 const std::nothrow_t& nt) noexcept {
+        (void)tag;
+        (void)nt;
+        last_error_ = open_impl(name, options);
+    }
+
+    message_ring(const message_ring&) = delete;
+    message_ring& operator=(const message_ring&) = delete;
+
+    message_ring(message_ring&& other) noexcept {
+        *this = std::move(other);
+    }
+
+    ~message_ring() {
+        count_detach();
+    }
+
+    message_ring& operator=(message_ring&& other) noexcept {
+        if (this != &other) {
+            count_detach();
+            shm_ = std::move(other.shm_);
+            header_ = other.header_;
+            data_ = other.data_;
+            capacity_ = other.capacity_;
+            mask_ = other.mask_;
+            alignment_ = other.alignment_;
+            last_error_ = other.last_error_;
+            producer_ = other.producer_;
+            consumer_ = other.consumer_;
+
+            other.header_ = nullptr;
+            other.data_ = nullptr;
+            other.capacity_ = 0;
+            other.mask_ = 0;
+        }
+        return *this;
+    }
+
+    // ========================================================================
+    // Producer side
+    // ========================================================================
+
+    /**
+     * @brief Claim space for a message of the given length
+     * @return Writable span inside the segment, or an empty span if there is
+     *         not enough free space (or length > max_message_size())
+     * @note Only one claim can be outstanding; claiming again abandons the
+     *       previous uncommitted claim.
+     */
+    message_span claim(std::size_t length) noexcept {
+        if (length > max_message_size()) {
+            return {};
+        }
+
+        std::uint64_t head = header_->head.load(std::memory_order_relaxed);
+        std::size_t record = record_size(length);
+        std::size_t offset = static_cast<std::size_t>(head & mask_);
+        std::size_t to_end = capacity_ - offset;
+        std::size_t padding = record > to_end ? to_end : 0;
+        std::uint64_t needed = padding + record;
+
+        if (head + needed - producer_.cached_tail > capacity_) {
+            producer_.cached_tail = header_->tail.load(std::memory_order_acquire);
+            if (head + needed - producer_.cached_tail > capacity_) {
+                detail::stat_add(header_->stats.full_events);
+                return {};
+            }
+        }
+
+        if (padding != 0) {
+            write_record_header(offset, static_cast<std::uint32_t>(padding),
+                                detail::PADDING_RECORD);
+            offset = 0;
+        }
+        write_record_header(offset, static_cast<std::uint32_t>(length), detail::MESSAGE_RECORD);
+        producer_.claimed = head + padding;
+        return message_span(data_ + offset + sizeof(detail::message_record_header), length);
+    }
+
+    /**
+     * @brief Publish the claimed message to the consumer
+     */
+    void commit(const message_span& span) noexcept {
+        commit(span, span.size());
+    }
+
+    /**
+     * @brief Publish the claimed message, trimmed to the bytes actually written
+     * @param span Span returned by the last claim(); an empty span from a
+     *        failed claim() is ignored
+     * @param length Bytes written, at most span.size()
+     */
+    void commit(const message_span& span, std::size_t length) noexcept {
+        if (!span) {
+            return;
+        }
+        if (length > span.size()) {
+            length = span.size();
+        }
+        std::size_t offset = static_cast<std::size_t>(producer_.claimed & mask_);
+        if (length != span.size()) {
+            write_record_header(offset, static_cast<std::uint32_t>(length),
+                                detail::MESSAGE_RECORD);
+        }
+        header_->head.store(producer_.claimed + record_size(length), std::memory_order_release);
+        detail::stat_add(header_->stats.enqueues);
+    }
+
+    /**
+     * @brief Copy a message in (claim + memcpy + commit)
+     * @return false if there is not enough free space
+     */
+    bool try_write(const void* data, std::size_t length) noexcept {
+        message_span span = claim(length);
+        if (!span) {
+            return false;
+        }
+        std::memcpy(span.data(), data, length);
+        commit(span);
+        return true;
+    }
+
+    // ========================================================================
+    // Consumer side
+    // ========================================================================
+
+    /**
+     * @brief View the next message in place
+     * @return Read-only view inside the segment, or an empty view if there is no message
+     * @note The view stays valid until release(); calling read() again before
+     *       release() returns the same message.
+     */
+    message_view read() noexcept {
+        std::uint64_t position = consumer_.position;
+        if (position == consumer_.cached_head) {
+            consumer_.cached_head = header_->head.load(std::memory_order_acquire);
+            if (position == consumer_.cached_head) {
+                detail::stat_add(header_->stats.empty_events);
+                return {};
+            }
+        }
+
+        // A padding record is always published together with the message after it
+        const detail::message_record_header* record = record_header(position);
+        if (record->type == detail::PADDING_RECORD) {
+            position += record->length;
+            consumer_.position = position;
+            record = record_header(position);
+        }
+
+        consumer_.next = position + record_size(record->length);
+        return message_view(
+            reinterpret_cast<const unsigned char*>(record) + sizeof(detail::message_record_header),
+            record->length);
+    }
+
+    /**
+     * @brief Give the space of the message returned by read() back to the producer
+     */
+    void release() noexcept {
+        if (consumer_.next != consumer_.position) {
+            // Bytes the consumer saw queued, including the released message
+            std::uint64_t lag = consumer_.cached_head - consumer_.position;
+            consumer_.position = consumer_.next;
+            header_->tail.store(consumer_.position, std::memory_order_release);
+            detail::stat_add(header_->stats.dequeues);
+            detail::stat_max(header_->stats.max_consumer_lag, lag);
+        }
+    }
+
+    // ========================================================================
+    // Accessors
+    // ========================================================================
+
+    /**
+     * @brief Approximate number of bytes in use, including framing and padding
+     */
+    std::size_t bytes_used() const noexcept {
+        std::uint64_t tail = header_->tail.load(std::memory_order_acquire);
+        std::uint64_t head = header_->head.load(std::memory_order_acquire);
+        return head > tail ? static_cast<std::size_t>(head - tail) : 0;
+    }
+
+    bool empty() const noexcept {
+        return bytes_used() == 0;
+    }
+
+    /**
+     * @brief Data area size in bytes (a power of two)
+     */
+    std::size_t capacity() const noexcept {
+        return capacity_;
+    }
+
+    /**
+     * @brief Record alignment in bytes
+     */
+    std::size_t alignment() const noexcept {
+        return alignment_;
+    }
+
+    /**
+     * @brief Largest payload claim() can ever satisfy
+     *
+     * Limited to half of the data area minus framing, so that a message always fits
+     * into an empty ring no matter where the wrap point is. Record lengths are
+     * 32-bit, so rings of 16 GiB and more are further limited to records of at
+     * most 4 GiB; padding is always shorter than a record, so it fits as well.
+     */
+    std::size_t max_message_size() const noexcept {
+        std::size_t half = capacity_ / 2;
+        if (half > detail::MAX_MESSAGE_RECORD) {
+            half = detail::MAX_MESSAGE_RECORD;
+        }
+        return half - sizeof(detail::message_record_header);
+    }
+
+    /**
+     * @brief Counters of the ring (see stats.hpp); max_consumer_lag is in bytes
+     */
+    segment_stats stats_snapshot() const noexcept {
+        return header_ ? detail::load_stats(header_->stats) : segment_stats();
+    }
+
+    bool is_valid() const noexcept {
+        return header_ != nullptr;
+    }
+
+    std::error_code last_error() const noexcept {
+        return last_error_;
+    }
+
+    /**
+     * @brief The underlying shared memory segment
+     */
+    const shared_memory& segment() const noexcept {
+        return shm_;
+    }
+
+    /**
+     * @brief Segment size needed for a ring with the given data area size
+     */
+    static std::size_t required_size(std::size_t capacity,
+                                     std::size_t alignment = detail::MIN_MESSAGE_ALIGNMENT) noexcept {
+        return data_offset(alignment) + data_capacity(capacity, alignment);
+    }
+
+private:
+    // Process-local state of each side, on separate cache lines in case a
+    // producer thread and a consumer thread share one message_ring object
+    struct alignas(detail::cache_line_size) producer_state {
+        std::uint64_t cached_tail = 0;
+        std::uint64_t claimed = 0;   // Position of the claimed record header
+    };
+    struct alignas(detail::cache_line_size) consumer_state {
+        std::uint64_t cached_head = 0;
+        std::uint64_t position = 0;  // Position of the next record to read
+        std::uint64_t next = 0;      // Position after the message returned by read()
+    };
+
+    shared_memory shm_;
+    detail::message_ring_header* header_ = nullptr;
+    unsigned char* data_ = nullptr;
+    std::size_t capacity_ = 0;
+    std::size_t mask_ = 0;
+    std::size_t alignment_ = 0;
+    std::error_code last_error_;
+    producer_state producer_;
+    consumer_state consumer_;
+
+    std::size_t record_size(std::size_t length) const noexcept {
+        return detail::align_up(sizeof(detail::message_record_header) + length, alignment_);
+    }
+
+    void write_record_header(std::size_t offset, std::uint32_t length,
+                             std::uint32_t type) noexcept {
+        detail::message_record_header record{length, type};
+        std::memcpy(data_ + offset, &record, sizeof(record));
+    }
+
+    const detail::message_record_header* record_header(std::uint64_t position) const noexcept {
+        return reinterpret_cast<const detail::message_record_header*>(
+            data_ + static_cast<std::size_t>(position & mask_));
+    }
+
+    static bool valid_alignment(std::size_t alignment) noexcept {
+        return alignment >= detail::MIN_MESSAGE_ALIGNMENT &&
+               alignment <= detail::MAX_MESSAGE_ALIGNMENT && (alignment & (alignment - 1)) == 0;
+    }
+
+    // At least four records of the minimum size fit into the data area
+    static std::size_t data_capacity(std::size_t capacity, std::size_t alignment) noexcept {
+        std::size_t minimum = 4 * alignment;
+        return detail::round_up_pow2(capacity > minimum ? capacity : minimum);
+    }
+
+    // The data area starts on its own cache line (or alignment boundary), after
+    // the consumer's tail
+    static constexpr std::size_t data_offset(std::size_t alignment) noexcept {
+        return detail::align_up(sizeof(detail::message_ring_header),
+                                alignment > detail::cache_line_size ? alignment
+                                                                    : detail::cache_line_size);
+    }
+
+    void count_detach() noexcept {
+        if (header_ != nullptr) {
+            detail::stat_add_shared(header_->stats.detaches);
+        }
+    }
+
+    std::error_code create_impl(const char* name, std::size_t capacity, std::size_t alignment,
+                                const segment_options& options) {
+        if (capacity == 0) {
+            return make_error_code(errc::invalid_size);
+        }
+        if (!valid_alignment(alignment)) {
+            return make_error_code(errc::invalid_argument);
+        }
+        capacity = data_capacity(capacity, alignment);
+        if (capacity == 0 ||
+            capacity > std::numeric_limits<std::size_t>::max() - data_offset(alignment)) {
+            return make_error_code(errc::invalid_size);
+        }
+
+        shared_memory shm(name, required_size(capacity, alignment), create_only,
+                          access_mode::read_write, options, std::nothrow);
+        if (!shm.is_valid()) {
+            return shm.last_error();
+        }
+
+        // The segment is zero-filled: initialize the plain fields, then publish
+        // the magic so openers only ever see a complete header
+        auto* header = static_cast<detail::message_ring_header*>(shm.data());
+        header->version = detail::MESSAGE_RING_VERSION;
+        header->alignment = static_cast<std::uint32_t>(alignment);
+        header->capacity = capacity;
+        header->head.store(0, std::memory_order_relaxed);
+        header->tail.store(0, std::memory_order_relaxed);
+        header->magic.store(detail::MESSAGE_RING_MAGIC, std::memory_order_release);
+
+        attach(std::move(shm), capacity, alignment);
+        return {};
+    }
+
+    std::error_code open_impl(const char* name, const segment_options& options) {
+        shared_memory shm(name, open_existing, access_mode::read_write, options, std::nothrow);
+        if (!shm.is_valid()) {
+            return shm.last_error();
+        }
+
+        if (shm.size() < sizeof(detail::message_ring_header)) {
+            return make_error_code(errc::incompatible_layout);
+        }
+        auto* header = static_cast<detail::message_ring_header*>(shm.data());
+        if (header->magic.load(std::memory_order_acquire) != detail::MESSAGE_RING_MAGIC ||
+            header->version != detail::MESSAGE_RING_VERSION ||
+            !valid_alignment(header->alignment)) {
+            return make_error_code(errc::incompatible_layout);
+        }
+        std::size_t alignment = header->alignment;
+        std::size_t capacity = static_cast<std::size_t>(header->capacity);
+        if (capacity < 4 * alignment || (capacity & (capacity - 1)) != 0 ||
+            shm.size() < required_size(capacity, alignment)) {
+            return make_error_code(errc::incompatible_layout);
+        }
+
+        attach(std::move(shm), capacity, alignment);
+        return {};
+    }
+
+    void attach(shared_memory&& shm, std::size_t capacity, std::size_t alignment) {
+        shm_ = std::move(shm);
+        header_ = static_cast<detail::message_ring_header*>(shm_.data());
+        data_ = static_cast<unsigned char*>(shm_.data()) + data_offset(alignment);
+        capacity_ = capacity;
+        mask_ = capacity - 1;
+        alignment_ = alignment;
+        producer_.cached_tail = header_->tail.load(std::memory_order_acquire);
+        consumer_.cached_head = header_->head.load(std::memory_order_acquire);
+        consumer_.position = header_->tail.load(std::memory_order_relaxed);
+        consumer_.next = consumer_.position;
+        detail::stat_add_shared(header_->stats.attaches);
+    }
+};
+
+}  // namespace shm
+}  // namespace slick
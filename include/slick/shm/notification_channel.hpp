@@ -0,0 +1,552 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 Slick Quant
+
+#pragma once
+
+#include "shared_memory.hpp"
+
+#ifdef SLICK_SHM_WINDOWS
+#include "detail/windows/notify_impl.hpp"
+#include "detail/windows/process_impl.hpp"
+#elif defined(SLICK_SHM_POSIX)
+#include "detail/posix/notify_impl.hpp"
+#include "detail/posix/process_impl.hpp"
+#endif
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <new>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#ifdef __has_include
+#if __has_include(<version>)
+#include <version>
+#endif
+#endif
+
+#if defined(__cpp_impl_coroutine) && defined(__cpp_lib_coroutine)
+#include <coroutine>
+#endif
+
+namespace slick {
+namespace shm {
+
+namespace detail {
+
+struct notify_slot {
+    std::atomic<std::uint32_t> owner;       // PID of the listener; 0 = free
+    std::atomic<std::uint32_t> generation;  // Bumped by every listen(), part of the address
+};
+
+// Small segment of its own: the rings and other primitives keep their layouts,
+// and any number of them can share one channel
+struct notify_header {
+    std::atomic<std::uint64_t> magic;  // Published last by the creator
+    std::uint32_t version;
+    std::uint32_t max_listeners;
+    std::uint64_t key;                 // Names the listeners' sockets / events
+
+    alignas(cache_line_size) std::atomic<std::uint64_t> armed;  // Bit per armed listener
+
+    alignas(cache_line_size) notify_slot slots[64];
+};
+
+constexpr std::uint64_t NOTIFY_MAGIC = 0x6c6e6e6168637966ULL;  // "fychannl"
+constexpr std::uint32_t NOTIFY_VERSION = 1;
+
+// How long an open_or_create opener waits for the creator to write the header
+constexpr std::chrono::seconds NOTIFY_INIT_TIMEOUT{1};
+
+// Non-consuming "is there something to read" of the rings, for readable()
+template <typename Ring>
+auto ring_has_data(const Ring& ring, int) noexcept -> decltype(ring.empty(), bool()) {
+    return !ring.empty();
+}
+
+template <typename Ring>
+auto ring_has_data(const Ring& ring, long) noexcept
+    -> decltype(ring.read_sequence() != ring.write_sequence(), bool()) {
+    return ring.read_sequence() != ring.write_sequence();
+}
+
+}  // namespace detail
+
+#if defined(__cpp_impl_coroutine) && defined(__cpp_lib_coroutine)
+template <typename Loop, typename Predicate>
+class notification_awaitable;
+#endif
+
+/**
+ * @brief Pollable cross-process wake-ups for event loops
+ *
+ * shared_event blocks a thread in the kernel, which an epoll, io_uring, kqueue
+ * or IOCP loop can't afford. A notification_channel gives each listening
+ * process a native handle that the loop watches next to its sockets:
+ * - POSIX: a non-blocking Unix datagram socket (Linux: abstract address), readable
+ *   after a notification. Works with epoll, io_uring poll and kqueue.
+ * - Windows: a named manual-reset event, signaled after a notification. Works with
+ *   WaitForMultipleObjects() and thread pool waits (CreateThreadpoolWait()).
+ *
+ * The channel lives in a small segment of its own, so one channel can serve
+ * any number of rings or segments. Producers call notify() after publishing;
+ * it only makes a system call for listeners that armed themselves, so a busy
+ * consumer that never waits costs the producer one load.
+ *
+ * Listener protocol (lost wake-ups are impossible as long as arm() comes before
+ * the final check):
+ * @code
+ * notification_channel ch("md_feed_notify", open_or_create);
+ * ch.listen();
+ * loop.add(ch.native_handle(), [&] {
+ *     ch.reset();                              // Consume the wake-up
+ *     while (ring.try_pop(msg)) handle(msg);
+ *     while (!ch.prepare_wait([&] { return !ring.empty(); })) {
+ *         while (ring.try_pop(msg)) handle(msg); // Data arrived after the last pop
+ *     }
+ * });
+ *
+ * // Producer
+ * ring.try_push(msg);
+ * ch.notify();
+ * @endcode
+ *
+ * With C++20 coroutines, until() and readable() return awaitables (see
+ * notification_awaitable).
+ *
+ * Thread safety: notify() may be called concurrently from any thread of any
+ * process. Listener functions must be called by one thread at a time.
+ */
+class notification_channel {
+public:
+    using native_handle_type = detail::notify_handle;
+    static constexpr std::size_t max_listeners = 64;
+
+    /**
+     * @brief Default constructor - creates an invalid channel
+     */
+    notification_channel() = default;
+
+    /**
+     * @brief Create a new channel
+     * @param name Name of the channel's shared memory segment
+     * @param tag create_only tag
+     * @param options Segment options
+     * @throws shared_memory_error if creation fails
+     */
+    notification_channel(const char* name, create_only_t tag,
+                         const segment_options& options = segment_options()) {
+        (void)tag;
+        last_error_ = create_impl(name, options);
+        if (last_error_) {
+            throw shared_memory_error(last_error_);
+        }
+    }
+
+    /**
+     * @brief Attach to an existing channel
+     * @throws shared_memory_error if the segment doesn't exist or isn't a channel
+     */
+    notification_channel(const char* name, open_existing_t tag,
+                         const segment_options& options = segment_options()) {
+        (void)tag;
+        last_error_ = open_impl(name, options);
+        if (last_error_) {
+            throw shared_memory_error(last_error_);
+        }
+    }
+
+    /**
+     * @brief Attach to a channel, creating it if it doesn't exist yet
+     *
+     * Whichever process creates the segment (is_creator()) writes the header;
+     * the others wait briefly for it (errc::timed_out if it never appears).
+     *
+     * @throws shared_memory_error on failure
+     */
+    notification_channel(const char* name, open_or_create_t tag,
+                         const segment_options& options = segment_options()) {
+        (void)tag;
+        last_error_ = open_or_create_impl(name, options);
+        if (last_error_) {
+            throw shared_memory_error(last_error_);
+        }
+    }
+
+    /**
+     * @brief Create a new channel - no-throw version
+     * @note Check is_valid() and last_error() after construction
+     */
+    notification_channel(const char* name, create_only_t tag, const segment_options& options,
+                         const std::nothrow_t& nt) noexcept {
+        (void)tag;
+        (void)nt;
+        last_error_ = create_impl(name, options);
+    }
+
+    /**
+     * @brief Attach to an existing channel - no-throw version
+     * @note Check is_valid() and last_error() after construction
+     */
+    notification_channel(const char* name, open_existing_t tag, const segment_options& options,
+                         const std::nothrow_t& nt) noexcept {
+        (void)tag;
+        (void)nt;
+        last_error_ = open_impl(name, options);
+    }
+
+    /**
+     * @brief Attach or create - no-throw version
+     * @note Check is_valid() and last_error() after construction
+     */
+    notification_channel(const char* name, open_or_create_t tag, const segment_options& options,
+                         const std::nothrow_t& nt) noexcept {
+        (void)tag;
+        (void)nt;
+        last_error_ = open_or_create_impl(name, options);
+    }
+
+    notification_channel(const notification_channel&) = delete;
+    notification_channel& operator=(const notification_channel&) = delete;
+
+    notification_channel(notification_channel&& other) noexcept {
+        *this = std::move(other);
+    }
+
+    ~notification_channel() {
+        stop_listening();
+    }
+
+    notification_channel& operator=(notification_channel&& other) noexcept {
+        if (this != &other) {
+            stop_listening();
+            shm_ = std::move(other.shm_);
+            header_ = other.header_;
+            sender_.reset();
+            sender_.swap(other.sender_);
+            handle_ = other.handle_;
+            slot_ = other.slot_;
+            generation_ = other.generation_;
+            last_error_ = other.last_error_;
+
+            other.header_ = nullptr;
+            other.handle_ = detail::invalid_notify_handle;
+            other.slot_ = no_slot;
+        }
+        return *this;
+    }
+
+    // ========================================================================
+    // Notifier side
+    // ========================================================================
+
+    /**
+     * @brief Wake every armed listener once
+     * @return Number of listeners signaled
+     * @note Call after publishing the data. With no armed listener this is a
+     *       fence and one load; otherwise one sendto() / SetEvent() per listener.
+     */
+    std::size_t notify() noexcept {
+        if (header_ == nullptr) {
+            return 0;
+        }
+        // Orders the caller's data stores before the check, pairing with arm()
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (header_->armed.load(std::memory_order_relaxed) == 0) {
+            return 0;
+        }
+        std::uint64_t armed = header_->armed.exchange(0, std::memory_order_acq_rel);
+        std::size_t signaled = 0;
+        for (std::uint32_t slot = 0; armed != 0; ++slot, armed >>= 1) {
+            if (armed & 1) {
+                std::uint32_t generation =
+                    header_->slots[slot].generation.load(std::memory_order_acquire);
+                sender_.signal(header_->key, slot, generation);
+                ++signaled;
+            }
+        }
+        return signaled;
+    }
+
+    /**
+     * @brief True if a listener is armed, i.e. notify() would make a system call
+     */
+    bool has_waiters() const noexcept {
+        return header_ != nullptr && header_->armed.load(std::memory_order_acquire) != 0;
+    }
+
+    // ========================================================================
+    // Listener side
+    // ========================================================================
+
+    /**
+     * @brief Claim a listener slot and create the native handle
+     * @return errc::too_many_readers if all max_listeners slots are taken; slots
+     *         of listener processes that died are reclaimed
+     */
+    std::error_code listen() noexcept {
+        if (header_ == nullptr) {
+            return make_error_code(errc::mapping_failed);
+        }
+        if (slot_ != no_slot) {
+            return {};
+        }
+        const std::uint32_t pid = detail::current_process_id();
+        for (std::uint32_t i = 0; i < header_->max_listeners; ++i) {
+            detail::notify_slot& slot = header_->slots[i];
+            std::uint32_t owner = slot.owner.load(std::memory_order_relaxed);
+            if (owner != 0 && detail::is_process_alive(owner)) {
+                continue;
+            }
+            if (!slot.owner.compare_exchange_strong(owner, pid, std::memory_order_acquire,
+                                                    std::memory_order_relaxed)) {
+                continue;
+            }
+            header_->armed.fetch_and(~(std::uint64_t(1) << i), std::memory_order_relaxed);
+            std::uint32_t generation = slot.generation.fetch_add(1, std::memory_order_release) + 1;
+            std::error_code ec = detail::open_listener(header_->key, i, generation, handle_);
+            if (ec) {
+                slot.owner.store(0, std::memory_order_release);
+                return ec;
+            }
+            slot_ = i;
+            generation_ = generation;
+            return {};
+        }
+        return make_error_code(errc::too_many_readers);
+    }
+
+    /**
+     * @brief Release the listener slot and close the native handle
+     */
+    void stop_listening() noexcept {
+        if (slot_ == no_slot) {
+            return;
+        }
+        header_->armed.fetch_and(~bit(), std::memory_order_relaxed);
+        detail::close_listener(handle_, header_->key, slot_, generation_);
+        header_->slots[slot_].owner.store(0, std::memory_order_release);
+        handle_ = detail::invalid_notify_handle;
+        slot_ = no_slot;
+    }
+
+    bool is_listening() const noexcept {
+        return slot_ != no_slot;
+    }
+
+    /**
+     * @brief Handle for the event loop: readable (POSIX) or signaled (Windows)
+     *        after a notification; invalid before listen()
+     */
+    native_handle_type native_handle() const noexcept {
+        return handle_;
+    }
+
+    /**
+     * @brief Ask for a wake-up from the next notify()
+     * @note Re-check the data after arming (prepare_wait() does both). An arm
+     *       is used up by one notify().
+     */
+    void arm() noexcept {
+        if (slot_ != no_slot) {
+            header_->armed.fetch_or(bit(), std::memory_order_seq_cst);
+        }
+    }
+
+    /**
+     * @brief Arm, then check the condition once more
+     * @return true if pred() is still false and the caller should wait for
+     *         native_handle(); false if there is data to handle first
+     */
+    template <typename Predicate>
+    bool prepare_wait(Predicate pred) {
+        arm();
+        return !pred();
+    }
+
+    /**
+     * @brief Consume pending notifications, so the handle stops being ready
+     */
+    void reset() noexcept {
+        if (slot_ != no_slot) {
+            detail::drain_listener(handle_);
+        }
+    }
+
+#if defined(__cpp_impl_coroutine) && defined(__cpp_lib_coroutine)
+    /**
+     * @brief Awaitable that completes when pred() is true (checked around arming)
+     *        or after a notification
+     * @param loop Event loop adapter with watch(native_handle_type, std::coroutine_handle<>)
+     */
+    template <typename Loop, typename Predicate>
+    notification_awaitable<Loop, Predicate> until(Loop& loop, Predicate pred) noexcept {
+        return notification_awaitable<Loop, Predicate>(*this, loop, std::move(pred));
+    }
+
+    /**
+     * @brief until() for a ring: completes once ring has something to read
+     *
+     * Works with spsc_ring, message_ring (empty()) and broadcast_ring
+     * (read_sequence() / write_sequence()).
+     */
+    template <typename Loop, typename Ring>
+    auto readable(Loop& loop, const Ring& ring) noexcept {
+        const Ring* r = &ring;
+        return until(loop, [r] { return detail::ring_has_data(*r, 0); });
+    }
+#endif
+
+    // ========================================================================
+    // Accessors
+    // ========================================================================
+
+    bool is_valid() const noexcept {
+        return header_ != nullptr;
+    }
+
+    bool is_creator() const noexcept {
+        return shm_.is_creator();
+    }
+
+    std::error_code last_error() const noexcept {
+        return last_error_;
+    }
+
+    const shared_memory& segment() const noexcept {
+        return shm_;
+    }
+
+private:
+    static constexpr std::uint32_t no_slot = ~std::uint32_t(0);
+
+    shared_memory shm_;
+    detail::notify_header* header_ = nullptr;
+    detail::notify_sender sender_;
+    native_handle_type handle_ = detail::invalid_notify_handle;
+    std::uint32_t slot_ = no_slot;
+    std::uint32_t generation_ = 0;
+    std::error_code last_error_;
+
+    std::uint64_t bit() const noexcept {
+        return std::uint64_t(1) << slot_;
+    }
+
+    std::error_code create_impl(const char* name, const segment_options& options) {
+        return attach(shared_memory(name, sizeof(detail::notify_header), create_only,
+                                    access_mode::read_write, options, std::nothrow),
+                      false);
+    }
+
+    std::error_code open_impl(const char* name, const segment_options& options) {
+        return attach(shared_memory(name, open_existing, access_mode::read_write, options,
+                                    std::nothrow),
+                      false);
+    }
+
+    std::error_code open_or_create_impl(const char* name, const segment_options& options) {
+        return attach(shared_memory(name, sizeof(detail::notify_header), open_or_create,
+                                    access_mode::read_write, options, std::nothrow),
+                      true);
+    }
+
+    // wait_for_header: an open_or_create creator may still be writing the header
+    std::error_code attach(shared_memory&& shm, bool wait_for_header) noexcept {
+        if (!shm.is_valid()) {
+            return shm.last_error();
+        }
+        if (shm.size() < sizeof(detail::notify_header)) {
+            return make_error_code(errc::incompatible_layout);
+        }
+
+        auto* header = static_cast<detail::notify_header*>(shm.data());
+        if (shm.is_creator()) {
+            // Zero-filled: no listener, nothing armed
+            header->version = detail::NOTIFY_VERSION;
+            header->max_listeners = static_cast<std::uint32_t>(max_listeners);
+            header->key = detail::new_notify_key();
+            header->magic.store(detail::NOTIFY_MAGIC, std::memory_order_release);
+        } else {
+            auto deadline = std::chrono::steady_clock::now() + detail::NOTIFY_INIT_TIMEOUT;
+            while (wait_for_header && header->magic.load(std::memory_order_acquire) == 0) {
+                if (std::chrono::steady_clock::now() >= deadline) {
+                    return make_error_code(errc::timed_out);
+                }
+                std::this_thread::yield();
+            }
+            if (header->magic.load(std::memory_order_acquire) != detail::NOTIFY_MAGIC ||
+                header->version != detail::NOTIFY_VERSION ||
+                header->max_listeners == 0 || header->max_listeners > max_listeners) {
+                return make_error_code(errc::incompatible_layout);
+            }
+        }
+
+        std::error_code ec = sender_.open();
+        if (ec) {
+            return ec;
+        }
+        shm_ = std::move(shm);
+        header_ = header;
+        return {};
+    }
+};
+
+#if defined(__cpp_impl_coroutine) && defined(__cpp_lib_coroutine)
+
+/**
+ * @brief co_await support for notification_channel (C++20)
+ *
+ * The awaiting coroutine is handed to the event loop through
+ * loop.watch(handle, coroutine), which must resume it once handle is readable
+ * (POSIX) or signaled (Windows), e.g. with epoll, an io_uring poll or a thread
+ * pool wait. The awaitable doesn't listen() by itself; call it first.
+ *
+ * @code
+ * task consume(notification_channel& ch, spsc_ring<tick>& ring, reactor& loop) {
+ *     tick t;
+ *     for (;;) {
+ *         co_await ch.readable(loop, ring);
+ *         while (ring.try_pop(t)) handle(t);
+ *     }
+ * }
+ * @endcode
+ *
+ * A wake-up can be spurious (an earlier notification, or another consumer took
+ * the data), so consumers loop as above.
+ */
+template <typename Loop, typename Predicate>
+class notification_awaitable {
+public:
+    notification_awaitable(notification_channel& channel, Loop& loop, Predicate pred) noexcept
+        : channel_(&channel), loop_(&loop), pred_(std::move(pred)) {}
+
+    bool await_ready() {
+        return pred_() || !channel_->is_listening();
+    }
+
+    template <typename Promise>
+    bool await_suspend(std::coroutine_handle<Promise> coroutine) {
+        // Old wake-ups would resume the coroutine right away
+        channel_->reset();
+        if (!channel_->prepare_wait(pred_)) {
+            return false;  // Data arrived in the meantime: don't suspend
+        }
+        loop_->watch(channel_->native_handle(), std::coroutine_handle<>(coroutine));
+        return true;
+    }
+
+    void await_resume() noexcept {}
+
+private:
+    notification_channel* channel_;
+    Loop* loop_;
+    Predicate pred_;
+};
+
+#endif
+
+}  // namespace shm
+}  // namespace slick
@@ -0,0 +1,173 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 Slick Quant
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+
+namespace slick {
+namespace shm {
+
+/**
+ * @brief Pointer that stays valid when the segment is mapped at a different address
+ *
+ * Stores the distance from its own address to the target instead of the target
+ * address, so a structure in a segment may point into the same segment no
+ * matter where each process maps it. Works as a fancy pointer for allocators
+ * (see arena_allocator) and as a random access iterator.
+ *
+ * Zero-filled memory is a null offset_ptr. The distance is measured from the byte
+ * after the offset_ptr's own address, so 0 never names a real target (nothing
+ * lives inside the offset_ptr itself). It is computed on std::uintptr_t values:
+ * subtracting pointers to unrelated objects is undefined, and optimizers do
+ * exploit it.
+ *
+ * @note Only point to objects in the same mapping as the offset_ptr itself (or
+ *       both in process-local memory); a pointer between two different
+ *       segments is only valid in the process that stored it.
+ * @note Copying recomputes the distance for the new location, so offset_ptr is
+ *       not trivially copyable; don't memcpy it around.
+ */
+template <typename T>
+class offset_ptr {
+public:
+    using element_type = T;
+    using value_type = typename std::remove_cv<T>::type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T*;
+    using reference = typename std::add_lvalue_reference<T>::type;
+    using iterator_category = std::random_access_iterator_tag;
+
+    template <typename U>
+    using rebind = offset_ptr<U>;
+
+    offset_ptr() noexcept = default;
+    offset_ptr(std::nullptr_t) noexcept {}
+    offset_ptr(T* ptr) noexcept { set(ptr); }
+
+    offset_ptr(const offset_ptr& other) noexcept { set(other.get()); }
+
+    template <typename U, typename = typename std::enable_if<std::is_convertible<U*, T*>::value>::type>
+    offset_ptr(const offset_ptr<U>& other) noexcept {
+        set(static_cast<T*>(other.get()));
+    }
+
+    offset_ptr& operator=(const offset_ptr& other) noexcept {
+        set(other.get());
+        return *this;
+    }
+
+    offset_ptr& operator=(T* ptr) noexcept {
+        set(ptr);
+        return *this;
+    }
+
+    offset_ptr& operator=(std::nullptr_t) noexcept {
+        offset_ = 0;
+        return *this;
+    }
+
+    /**
+     * @brief Required by std::pointer_traits for fancy pointers
+     */
+    template <typename U = T, typename = typename std::enable_if<!std::is_void<U>::value>::type>
+    static offset_ptr pointer_to(U& ref) noexcept {
+        return offset_ptr(&ref);
+    }
+
+    T* get() const noexcept {
+        if (offset_ == 0) {
+            return nullptr;
+        }
+        return reinterpret_cast<T*>(self() + offset_);
+    }
+
+    explicit operator bool() const noexcept { return offset_ != 0; }
+
+    template <typename U = T, typename = typename std::enable_if<!std::is_void<U>::value>::type>
+    U& operator*() const noexcept { return *get(); }
+
+    T* operator->() const noexcept { return get(); }
+
+    template <typename U = T, typename = typename std::enable_if<!std::is_void<U>::value>::type>
+    U& operator[](difference_type index) const noexcept { return get()[index]; }
+
+    // Pointer arithmetic (not available for offset_ptr<void>)
+    offset_ptr& operator+=(difference_type n) noexcept {
+        set(get() + n);
+        return *this;
+    }
+    offset_ptr& operator-=(difference_type n) noexcept {
+        set(get() - n);
+        return *this;
+    }
+    offset_ptr& operator++() noexcept { return *this += 1; }
+    offset_ptr& operator--() noexcept { return *this -= 1; }
+    offset_ptr operator++(int) noexcept {
+        offset_ptr old(*this);
+        ++*this;
+        return old;
+    }
+    offset_ptr operator--(int) noexcept {
+        offset_ptr old(*this);
+        --*this;
+        return old;
+    }
+
+    friend offset_ptr operator+(const offset_ptr& p, difference_type n) noexcept {
+        return offset_ptr(p.get() + n);
+    }
+    friend offset_ptr operator+(difference_type n, const offset_ptr& p) noexcept {
+        return offset_ptr(p.get() + n);
+    }
+    friend offset_ptr operator-(const offset_ptr& p, difference_type n) noexcept {
+        return offset_ptr(p.get() - n);
+    }
+    friend difference_type operator-(const offset_ptr& a, const offset_ptr& b) noexcept {
+        return a.get() - b.get();
+    }
+
+    friend bool operator==(const offset_ptr& a, const offset_ptr& b) noexcept { return a.get() == b.get(); }
+    friend bool operator!=(const offset_ptr& a, const offset_ptr& b) noexcept { return a.get() != b.get(); }
+    friend bool operator<(const offset_ptr& a, const offset_ptr& b) noexcept { return a.get() < b.get(); }
+    friend bool operator>(const offset_ptr& a, const offset_ptr& b) noexcept { return a.get() > b.get(); }
+    friend bool operator<=(const offset_ptr& a, const offset_ptr& b) noexcept { return a.get() <= b.get(); }
+    friend bool operator>=(const offset_ptr& a, const offset_ptr& b) noexcept { return a.get() >= b.get(); }
+
+    friend bool operator==(const offset_ptr& a, std::nullptr_t) noexcept { return !a; }
+    friend bool operator==(std::nullptr_t, const offset_ptr& a) noexcept { return !a; }
+    friend bool operator!=(const offset_ptr& a, std::nullptr_t) noexcept { return static_cast<bool>(a); }
+    friend bool operator!=(std::nullptr_t, const offset_ptr& a) noexcept { return static_cast<bool>(a); }
+
+private:
+    std::uintptr_t offset_ = 0;  // target - (this + 1), modulo 2^N; 0 for null
+
+    std::uintptr_t self() const noexcept {
+        return reinterpret_cast<std::uintptr_t>(this) + 1;
+    }
+
+    void set(const volatile T* ptr) noexcept {
+        offset_ = ptr ? reinterpret_cast<std::uintptr_t>(ptr) - self() : 0;
+    }
+};
+
+template <typename T, typename U>
+offset_ptr<T> static_pointer_cast(const offset_ptr<U>& p) noexcept {
+    return offset_ptr<T>(static_cast<T*>(p.get()));
+}
+
+template <typename T, typename U>
+offset_ptr<T> const_pointer_cast(const offset_ptr<U>& p) noexcept {
+    return offset_ptr<T>(const_cast<T*>(p.get()));
+}
+
+template <typename T, typename U>
+offset_ptr<T> reinterpret_pointer_cast(const offset_ptr<U>& p) noexcept {
+    return offset_ptr<T>(reinterpret_cast<T*>(p.get()));
+}
+
+}  // namespace shm
+}  // namespace slick
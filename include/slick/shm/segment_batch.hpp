@@ -0,0 +1,196 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 Slick Quant
+
+#pragma once
+
+#include "shared_memory.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace slick {
+namespace shm {
+
+/**
+ * @brief One segment of a create_many() / open_many() batch
+ */
+struct segment_spec {
+    const char* name = nullptr;
+    std::size_t size = 0;                          // Ignored by open_many()
+    create_mode mode = create_mode::create_only;   // Ignored by open_many()
+    access_mode access = access_mode::read_write;
+    const segment_options* options = nullptr;      // nullptr = batch_options::options
+};
+
+/**
+ * @brief Settings shared by all entries of a batch
+ */
+struct batch_options {
+    // Worker threads, including the calling thread. 0 = one per hardware thread
+    unsigned threads = 1;
+
+    // Options of every entry that doesn't point to its own
+    segment_options options;
+};
+
+namespace detail {
+
+// Entries handed to a worker at a time; large enough to keep the shared
+// counter off the hot path, small enough to balance uneven entries
+constexpr std::size_t BATCH_CHUNK = 32;
+
+// Calls fn(i) for every i in [0, count), on up to threads threads
+template <typename Fn>
+void run_batch(std::size_t count, unsigned threads, Fn fn) noexcept {
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    std::size_t chunks = (count + BATCH_CHUNK - 1) / BATCH_CHUNK;
+    if (threads > chunks) {
+        threads = static_cast<unsigned>(chunks);
+    }
+
+    std::atomic<std::size_t> next(0);
+    auto work = [&] {
+        for (;;) {
+            std::size_t begin = next.fetch_add(BATCH_CHUNK, std::memory_order_relaxed);
+            if (begin >= count) {
+                return;
+            }
+            std::size_t end = std::min(begin + BATCH_CHUNK, count);
+            for (std::size_t i = begin; i < end; ++i) {
+                fn(i);
+            }
+        }
+    };
+
+    std::vector<std::thread> workers;
+    try {
+        workers.reserve(threads > 1 ? threads - 1 : 0);
+        for (unsigned t = 1; t < threads; ++t) {
+            workers.emplace_back(work);
+        }
+    } catch (...) {
+        // Out of threads or memory: the threads that did start (and this one) do the rest
+    }
+    work();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+}
+
+inline shared_memory create_one(const segment_spec& spec,
+                                const segment_options& options) noexcept {
+    switch (spec.mode) {
+        case create_mode::open_or_create:
+            return shared_memory(spec.name, spec.size, open_or_create, spec.access, options,
+                                 std::nothrow);
+        case create_mode::open_always:
+            return shared_memory(spec.name, spec.size, open_always, spec.access, options,
+                                 std::nothrow);
+        case create_mode::create_only:
+        default:
+            return shared_memory(spec.name, spec.size, create_only, spec.access, options,
+                                 std::nothrow);
+    }
+}
+
+}  // namespace detail
+
+/**
+ * @brief Create (or open, per create_mode) many segments in one call
+ *
+ * Entries are independent: each gets its own error code, and a failed entry
+ * leaves an invalid shared_memory behind without affecting the others. With
+ * batch_options::threads > 1 the entries are spread over worker threads, which
+ * overlaps the shm_open() / ftruncate() / mmap() system calls of different
+ * segments.
+ *
+ * @param specs count segment descriptions
+ * @param[out] segments count segments, assigned in the order of specs
+ * @param[out] errors count error codes, empty for the entries that succeeded
+ * @return Number of entries that failed
+ *
+ * @code
+ * std::vector<segment_spec> specs(instruments.size());
+ * for (std::size_t i = 0; i < specs.size(); ++i) {
+ *     specs[i].name = instruments[i].shm_name;
+ *     specs[i].size = sizeof(book);
+ * }
+ * std::vector<shared_memory> books;
+ * std::vector<std::error_code> errors;
+ * batch_options batch;
+ * batch.threads = 8;
+ * if (create_many(specs, books, errors, batch) != 0) { ... }
+ * @endcode
+ */
+inline std::size_t create_many(const segment_spec* specs, std::size_t count,
+                               shared_memory* segments, std::error_code* errors,
+                               const batch_options& batch = batch_options()) noexcept {
+    std::atomic<std::size_t> failed(0);
+    detail::run_batch(count, batch.threads, [&](std::size_t i) {
+        const segment_spec& spec = specs[i];
+        segments[i] = detail::create_one(spec, spec.options ? *spec.options : batch.options);
+        errors[i] = segments[i].last_error();
+        if (errors[i]) {
+            failed.fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+    return failed.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Open many existing segments in one call (see create_many())
+ * @return Number of entries that failed
+ */
+inline std::size_t open_many(const segment_spec* specs, std::size_t count,
+                             shared_memory* segments, std::error_code* errors,
+                             const batch_options& batch = batch_options()) noexcept {
+    std::atomic<std::size_t> failed(0);
+    detail::run_batch(count, batch.threads, [&](std::size_t i) {
+        const segment_spec& spec = specs[i];
+        segments[i] = shared_memory(spec.name, open_existing, spec.access,
+                                    spec.options ? *spec.options : batch.options, std::nothrow);
+        errors[i] = segments[i].last_error();
+        if (errors[i]) {
+            failed.fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+    return failed.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief create_many() into vectors sized to match specs
+ * @throws std::bad_alloc if the vectors can't be resized
+ */
+inline std::size_t create_many(const std::vector<segment_spec>& specs,
+                               std::vector<shared_memory>& segments,
+                               std::vector<std::error_code>& errors,
+                               const batch_options& batch = batch_options()) {
+    segments.clear();
+    segments.resize(specs.size());
+    errors.assign(specs.size(), std::error_code());
+    return create_many(specs.data(), specs.size(), segments.data(), errors.data(), batch);
+}
+
+/**
+ * @brief open_many() into vectors sized to match specs
+ * @throws std::bad_alloc if the vectors can't be resized
+ */
+inline std::size_t open_many(const std::vector<segment_spec>& specs,
+                             std::vector<shared_memory>& segments,
+                             std::vector<std::error_code>& errors,
+                             const batch_options& batch = batch_options()) {
+    segments.clear();
+    segments.resize(specs.size());
+    errors.assign(specs.size(), std::error_code());
+    return open_many(specs.data(), specs.size(), segments.data(), errors.data(), batch);
+}
+
+}  // namespace shm
+}  // namespace slick
@@ -0,0 +1,504 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 Slick Quant
+
+#pragma once
+
+#include "shared_memory.hpp"
+#include "shared_memory_view.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <unordered_map>
+
+namespace slick {
+namespace shm {
+
+namespace detail {
+
+// FNV-1a, usable in constant expressions so keys can be hashed at compile time
+constexpr std::uint64_t name_hash(const char* name) noexcept {
+    std::uint64_t hash = 0xcbf29ce484222325ULL;
+    for (; name != nullptr && *name != '\0'; ++name) {
+        hash ^= static_cast<unsigned char>(*name);
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+constexpr std::size_t name_length(const char* name) noexcept {
+    std::size_t length = 0;
+    for (; name != nullptr && name[length] != '\0'; ++length) {
+    }
+    return length;
+}
+
+}  // namespace detail
+
+/**
+ * @brief Segment name with its precomputed hash
+ *
+ * Build keys once (e.g. per symbol at startup) and pass them to
+ * segment_cache::acquire() so lookups neither hash, measure the name nor
+ * allocate. The key only points to the name, which must outlive it.
+ */
+class segment_key {
+public:
+    constexpr segment_key(const char* name) noexcept
+        : name_(name), size_(detail::name_length(name)), hash_(detail::name_hash(name)) {}
+
+    constexpr const char* name() const noexcept {
+        return name_;
+    }
+
+    constexpr std::size_t size() const noexcept {
+        return size_;
+    }
+
+    constexpr std::uint64_t hash() const noexcept {
+        return hash_;
+    }
+
+private:
+    const char* name_;
+    std::size_t size_;
+    std::uint64_t hash_;
+};
+
+class segment_cache;
+
+/**
+ * @brief Reference to a mapping owned by a segment_cache
+ *
+ * The mapping stays open while any handle refers to it. Handles are move-only;
+ * acquire the name again for another reference. A handle must not outlive its
+ * cache.
+ */
+class cached_segment {
+public:
+    cached_segment() noexcept = default;
+
+    ~cached_segment() {
+        release();
+    }
+
+    cached_segment(const cached_segment&) = delete;
+    cached_segment& operator=(const cached_segment&) = delete;
+
+    cached_segment(cached_segment&& other) noexcept
+        : cache_(other.cache_), entry_(other.entry_) {
+        other.cache_ = nullptr;
+        other.entry_ = nullptr;
+    }
+
+    cached_segment& operator=(cached_segment&& other) noexcept {
+        if (this != &other) {
+            release();
+            cache_ = other.cache_;
+            entry_ = other.entry_;
+            other.cache_ = nullptr;
+            other.entry_ = nullptr;
+        }
+        return *this;
+    }
+
+    void* data() noexcept;
+    const void* data() const noexcept;
+    std::size_t size() const noexcept;
+    const char* name() const noexcept;
+    access_mode mode() const noexcept;
+
+    /**
+     * @brief Mapping behind the handle (shared with every other handle to it)
+     */
+    const shared_memory& segment() const noexcept;
+
+    /**
+     * @brief Non-owning view of the mapping, valid while this handle is
+     */
+    shared_memory_view view() const {
+        return is_valid() ? shared_memory_view(segment()) : shared_memory_view();
+    }
+
+    bool is_valid() const noexcept {
+        return entry_ != nullptr;
+    }
+
+    /**
+     * @brief Drop the reference; the mapping becomes evictable when none are left
+     */
+    void release() noexcept;
+
+private:
+    friend class segment_cache;
+    struct entry;
+
+    cached_segment(segment_cache* cache, entry* e) noexcept : cache_(cache), entry_(e) {}
+
+    segment_cache* cache_ = nullptr;
+    entry* entry_ = nullptr;
+};
+
+// Cached mapping; the idle and detached lists link entries through lru_prev/lru_next
+struct cached_segment::entry {
+    std::string name;
+    std::uint64_t hash = 0;
+    access_mode mode = access_mode::read_write;
+    shared_memory shm;
+    std::size_t refs = 0;       // Live cached_segment handles, guarded by the cache mutex
+    bool detached = false;      // Invalidated while held
+    entry* lru_prev = nullptr;
+    entry* lru_next = nullptr;
+};
+
+/**
+ * @brief Process-wide cache of open segments, so reopening a name is a hash lookup
+ *
+ * acquire() returns a cached_segment for a mapped segment, opening it with
+ * open_existing on the first request only. Segments nobody holds stay mapped
+ * in least-recently-used order until the mapped bytes exceed the cap; then the
+ * oldest idle ones are closed. Segments in use are never closed, so the cap can
+ * be exceeded while they are held.
+ *
+ * @code
+ * static const segment_key key("book_AAPL");
+ * cached_segment book;
+ * if (!segment_cache::instance().acquire(key, book, access_mode::read_only)) {
+ *     use(book.data());
+ * }
+ * @endcode
+ *
+ * @note The cache can't tell when a segment is removed and recreated under the
+ *       same name; call invalidate() (or clear()) after that happens.
+ * @note A miss opens the segment without holding the cache lock, so hits in
+ *       other threads don't wait for it.
+ *
+ * Thread safety: all member functions may be called concurrently.
+ */
+class segment_cache {
+public:
+    /**
+     * @brief Create a cache
+     * @param max_mapped_bytes Cap on the bytes mapped by the cache; 0 for no cap
+     */
+    explicit segment_cache(std::size_t max_mapped_bytes = 0) noexcept
+        : max_mapped_bytes_(max_mapped_bytes) {}
+
+    /**
+     * @brief Close every mapping
+     * @note All cached_segment handles must be released first
+     */
+    ~segment_cache() {
+        for (auto& item : entries_) {
+            delete item.second;
+        }
+        for (entry* e = detached_; e != nullptr;) {
+            entry* next = e->lru_next;
+            delete e;
+            e = next;
+        }
+    }
+
+    segment_cache(const segment_cache&) = delete;
+    segment_cache& operator=(const segment_cache&) = delete;
+
+    /**
+     * @brief The process-wide cache (no cap on mapped bytes unless set_capacity() is called)
+     */
+    static segment_cache& instance() {
+        static segment_cache cache;
+        return cache;
+    }
+
+    /**
+     * @brief Get a handle to a mapping of an existing segment
+     * @param key Segment name (a const char* converts to a key implicitly)
+     * @param[out] out Handle to the mapping
+     * @param mode Access mode; mappings are cached separately per mode
+     * @param options Segment options, used only when the segment is not cached yet
+     * @return Error code, empty on success (errors of shared_memory's open_existing)
+     */
+    std::error_code acquire(const segment_key& key, cached_segment& out,
+                            access_mode mode = access_mode::read_write,
+                            const segment_options& options = segment_options()) {
+        out.release();
+        for (;;) {
+            std::uint64_t generation = 0;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (entry* e = find(key, mode)) {
+                    ++hits_;
+                    out = take(e);
+                    return {};
+                }
+                ++misses_;
+                generation = generation_;
+            }
+
+            shared_memory shm(key.name(), open_existing, mode, options, std::nothrow);
+            if (!shm.is_valid()) {
+                return shm.last_error();
+            }
+            std::unique_ptr<entry> created(new entry());
+            created->name.assign(key.name(), key.size());
+            created->hash = key.hash();
+            created->mode = mode;
+            created->shm = std::move(shm);
+
+            // Declared after created, so a mapping that isn't kept is closed
+            // after the lock is released
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (generation != generation_) {
+                continue;  // Invalidated while opening; this may be the old segment
+            }
+            if (entry* e = find(key, mode)) {
+                out = take(e);  // Another thread opened it meanwhile
+                return {};
+            }
+            entry* e = created.release();
+            e->refs = 1;
+            entries_.emplace(e->hash, e);
+            mapped_bytes_ += e->shm.size();
+            evict_idle();
+
+            out = cached_segment(this, e);
+            return {};
+        }
+    }
+
+    /**
+     * @brief Stop serving the cached mappings of a name
+     *
+     * Idle mappings are closed now; mappings still held stay valid for their
+     * handles and are closed with the last one. The next acquire() reopens
+     * the segment.
+     */
+    void invalidate(const segment_key& key) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++generation_;
+        auto range = entries_.equal_range(key.hash());
+        for (auto it = range.first; it != range.second;) {
+            entry* e = it->second;
+            if (matches(e, key)) {
+                it = entries_.erase(it);
+                detach(e);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    /**
+     * @brief invalidate() every cached name
+     */
+    void clear() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++generation_;
+        for (auto& item : entries_) {
+            detach(item.second);
+        }
+        entries_.clear();
+    }
+
+    /**
+     * @brief Close idle mappings until at most max_mapped_bytes are mapped (0 closes all idle)
+     */
+    void trim(std::size_t max_mapped_bytes = 0) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        evict_idle_to(max_mapped_bytes);
+    }
+
+    /**
+     * @brief Change the cap on mapped bytes (0 for no cap), evicting idle mappings as needed
+     */
+    void set_capacity(std::size_t max_mapped_bytes) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        max_mapped_bytes_ = max_mapped_bytes;
+        evict_idle();
+    }
+
+    std::size_t capacity() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return max_mapped_bytes_;
+    }
+
+    /**
+     * @brief Bytes mapped by the cache, held or idle
+     */
+    std::size_t mapped_bytes() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return mapped_bytes_;
+    }
+
+    /**
+     * @brief Number of cached mappings, held or idle
+     */
+    std::size_t cached_count() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return entries_.size();
+    }
+
+    /**
+     * @brief acquire() calls served from the cache, and calls that had to open the segment
+     */
+    std::uint64_t hits() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return hits_;
+    }
+
+    std::uint64_t misses() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return misses_;
+    }
+
+private:
+    friend class cached_segment;
+    using entry = cached_segment::entry;
+
+    mutable std::mutex mutex_;
+    std::unordered_multimap<std::uint64_t, entry*> entries_;
+    entry* lru_head_ = nullptr;   // Least recently released idle entry
+    entry* lru_tail_ = nullptr;   // Most recently released idle entry
+    entry* detached_ = nullptr;   // Invalidated entries still held by handles
+    std::size_t mapped_bytes_ = 0;
+    std::size_t max_mapped_bytes_ = 0;
+    std::uint64_t hits_ = 0;
+    std::uint64_t misses_ = 0;
+    std::uint64_t generation_ = 0;  // Bumped by invalidate() and clear()
+
+    static bool matches(const entry* e, const segment_key& key) noexcept {
+        return e->name.size() == key.size() &&
+               std::memcmp(e->name.data(), key.name(), key.size()) == 0;
+    }
+
+    entry* find(const segment_key& key, access_mode mode) const noexcept {
+        auto range = entries_.equal_range(key.hash());
+        for (auto it = range.first; it != range.second; ++it) {
+            entry* e = it->second;
+            if (e->mode == mode && matches(e, key)) {
+                return e;
+            }
+        }
+        return nullptr;
+    }
+
+    cached_segment take(entry* e) noexcept {
+        if (e->refs++ == 0) {
+            unlink_idle(e);
+        }
+        return cached_segment(this, e);
+    }
+
+    void release(entry* e) noexcept {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (--e->refs != 0) {
+            return;
+        }
+        if (e->detached) {
+            unlink_detached(e);
+            destroy(e);
+            return;
+        }
+        // Append as the most recently used idle entry
+        e->lru_prev = lru_tail_;
+        e->lru_next = nullptr;
+        (lru_tail_ ? lru_tail_->lru_next : lru_head_) = e;
+        lru_tail_ = e;
+        evict_idle();
+    }
+
+    void evict_idle() noexcept {
+        if (max_mapped_bytes_ != 0) {
+            evict_idle_to(max_mapped_bytes_);
+        }
+    }
+
+    void evict_idle_to(std::size_t max_mapped_bytes) noexcept {
+        while (lru_head_ != nullptr && mapped_bytes_ > max_mapped_bytes) {
+            entry* e = lru_head_;
+            unlink_idle(e);
+            auto range = entries_.equal_range(e->hash);
+            for (auto it = range.first; it != range.second; ++it) {
+                if (it->second == e) {
+                    entries_.erase(it);
+                    break;
+                }
+            }
+            destroy(e);
+        }
+    }
+
+    // Remove from the map's ownership: close now if idle, else when released
+    void detach(entry* e) noexcept {
+        if (e->refs == 0) {
+            unlink_idle(e);
+            destroy(e);
+            return;
+        }
+        e->detached = true;
+        e->lru_prev = nullptr;
+        e->lru_next = detached_;
+        if (detached_) {
+            detached_->lru_prev = e;
+        }
+        detached_ = e;
+    }
+
+    void unlink_idle(entry* e) noexcept {
+        (e->lru_prev ? e->lru_prev->lru_next : lru_head_) = e->lru_next;
+        (e->lru_next ? e->lru_next->lru_prev : lru_tail_) = e->lru_prev;
+        e->lru_prev = nullptr;
+        e->lru_next = nullptr;
+    }
+
+    void unlink_detached(entry* e) noexcept {
+        (e->lru_prev ? e->lru_prev->lru_next : detached_) = e->lru_next;
+        if (e->lru_next) {
+            e->lru_next->lru_prev = e->lru_prev;
+        }
+    }
+
+    void destroy(entry* e) noexcept {
+        mapped_bytes_ -= e->shm.size();
+        delete e;
+    }
+};
+
+inline void* cached_segment::data() noexcept {
+    return entry_ ? entry_->shm.data() : nullptr;
+}
+
+inline const void* cached_segment::data() const noexcept {
+    return entry_ ? entry_->shm.data() : nullptr;
+}
+
+inline std::size_t cached_segment::size() const noexcept {
+    return entry_ ? entry_->shm.size() : 0;
+}
+
+inline const char* cached_segment::name() const noexcept {
+    return entry_ ? entry_->name.c_str() : "";
+}
+
+inline access_mode cached_segment::mode() const noexcept {
+    return entry_ ? entry_->mode : access_mode::read_write;
+}
+
+inline const shared_memory& cached_segment::segment() const noexcept {
+    return entry_->shm;
+}
+
+inline void cached_segment::release() noexcept {
+    if (entry_ != nullptr) {
+        cache_->release(entry_);
+        cache_ = nullptr;
+        entry_ = nullptr;
+    }
+}
+
+}  // namespace shm
+}  // namespace slick
@@ -0,0 +1,327 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 Slick Quant
+
+#pragma once
+
+#include "shared_memory.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+
+namespace slick {
+namespace shm {
+
+/**
+ * @brief One object of type T in a segment_layout
+ * @tparam Align Alignment of the region; 0 means the larger of alignof(T) and
+ *         the cache line size, so the region doesn't share a line with its neighbours
+ */
+template <typename T, std::size_t Align = 0>
+struct region {
+    using value_type = T;
+    using pointer = T*;
+    static constexpr std::size_t count = 1;
+    static constexpr std::size_t size = sizeof(T);
+    static constexpr std::size_t alignment =
+        Align != 0 ? Align
+                   : (alignof(T) > detail::cache_line_size ? alignof(T) : detail::cache_line_size);
+};
+
+/**
+ * @brief N contiguous objects of type T in a segment_layout
+ * @tparam Align Alignment of the first element (see region)
+ */
+template <typename T, std::size_t N, std::size_t Align = 0>
+struct array_region {
+    using value_type = T;
+    using pointer = T*;  // First element
+    static constexpr std::size_t count = N;
+    static constexpr std::size_t size = sizeof(T) * N;
+    static constexpr std::size_t alignment =
+        Align != 0 ? Align
+                   : (alignof(T) > detail::cache_line_size ? alignof(T) : detail::cache_line_size);
+};
+
+namespace detail {
+
+// Types that can live in a region: trivially copyable ones, or trivially
+// destructible standard-layout ones such as structs of std::atomic (MSVC
+// implements CWG 1734, under which atomics aren't trivially copyable)
+template <typename T>
+struct is_region_type
+    : std::integral_constant<bool, std::is_trivially_copyable<T>::value ||
+                                       (std::is_trivially_destructible<T>::value &&
+                                        std::is_standard_layout<T>::value)> {};
+
+template <typename Region>
+struct region_traits {
+    static_assert(is_region_type<typename Region::value_type>::value,
+                  "segment_layout regions must be trivially copyable, or trivially "
+                  "destructible with standard layout");
+    static_assert(Region::count > 0, "segment_layout regions can't be empty");
+    static_assert(Region::alignment >= alignof(typename Region::value_type),
+                  "region alignment is below the alignment of its type");
+    static_assert((Region::alignment & (Region::alignment - 1)) == 0,
+                  "region alignment must be a power of two");
+    static_assert(Region::alignment <= 4096,
+                  "region alignment can't exceed the page alignment of a mapping");
+};
+
+// Offsets of the regions, laid out in order, each at its own alignment.
+// Padding a region up to its alignment keeps the next one off its last line
+template <std::size_t Offset, typename... Regions>
+struct layout_offsets;
+
+template <std::size_t Offset>
+struct layout_offsets<Offset> {
+    static constexpr std::size_t end = Offset;
+
+    static constexpr std::size_t offset(std::size_t) noexcept {
+        return 0;
+    }
+};
+
+template <std::size_t Offset, typename First, typename... Rest>
+struct layout_offsets<Offset, First, Rest...> {
+    static_assert(sizeof(region_traits<First>) > 0, "");  // Checks the region
+
+    static constexpr std::size_t begin = align_up(Offset, First::alignment);
+    using rest = layout_offsets<align_up(begin + First::size, First::alignment), Rest...>;
+    static constexpr std::size_t end = rest::end;
+
+    static constexpr std::size_t offset(std::size_t index) noexcept {
+        return index == 0 ? begin : rest::offset(index - 1);
+    }
+};
+
+template <std::size_t I, typename... Regions>
+struct region_at;
+
+template <typename First, typename... Rest>
+struct region_at<0, First, Rest...> {
+    using type = First;
+};
+
+template <std::size_t I, typename First, typename... Rest>
+struct region_at<I, First, Rest...> : region_at<I - 1, Rest...> {};
+
+// Index of the region holding T, or sizeof...(Regions) if there is none
+template <typename T, typename... Regions>
+struct region_index;
+
+template <typename T>
+struct region_index<T> {
+    static constexpr std::size_t value = 0;
+    static constexpr std::size_t matches = 0;
+};
+
+template <typename T, typename First, typename... Rest>
+struct region_index<T, First, Rest...> {
+    static constexpr bool match = std::is_same<T, typename First::value_type>::value;
+    static constexpr std::size_t value = match ? 0 : 1 + region_index<T, Rest...>::value;
+    static constexpr std::size_t matches = (match ? 1 : 0) + region_index<T, Rest...>::matches;
+};
+
+template <std::size_t... Values>
+struct max_of;
+
+template <>
+struct max_of<> {
+    static constexpr std::size_t value = 1;
+};
+
+template <std::size_t First, std::size_t... Rest>
+struct max_of<First, Rest...> {
+    static constexpr std::size_t value =
+        First > max_of<Rest...>::value ? First : max_of<Rest...>::value;
+};
+
+// FNV-1a over the offset, size and alignment of every region
+template <typename... Regions>
+constexpr std::uint64_t layout_fingerprint() noexcept {
+    const std::size_t sizes[] = {Regions::size...};
+    const std::size_t alignments[] = {Regions::alignment...};
+    std::uint64_t hash = 0xcbf29ce484222325ULL;
+    for (std::size_t i = 0; i < sizeof...(Regions); ++i) {
+        std::size_t fields[3] = {layout_offsets<0, Regions...>::offset(i), sizes[i],
+                                 alignments[i]};
+        for (std::size_t field : fields) {
+            for (int byte = 0; byte < 8; ++byte) {
+                hash ^= (static_cast<std::uint64_t>(field) >> (8 * byte)) & 0xff;
+                hash *= 0x100000001b3ULL;
+            }
+        }
+    }
+    return hash;
+}
+
+}  // namespace detail
+
+/**
+ * @brief Compile-time description of the regions of a segment
+ *
+ * Each region gets a constant offset, aligned to the cache line size by default,
+ * so fields written by different processes never share a line. Accessors add
+ * that constant to the base address; there is no cast or offset arithmetic in
+ * user code.
+ *
+ * @code
+ * struct header { std::uint64_t magic; std::uint32_t version; };
+ * struct producer_block { std::atomic<std::uint64_t> head; };
+ * struct consumer_block { std::atomic<std::uint64_t> tail; };
+ *
+ * using feed_layout = segment_layout<region<header>, region<producer_block>,
+ *                                    region<consumer_block>, array_region<quote, 4096>>;
+ *
+ * shared_memory shm("feed", feed_layout::size, create_only);
+ * auto feed = feed_layout::bind(shm);
+ * feed.get<producer_block>()->head.store(1, std::memory_order_release);
+ * quote* quotes = feed.get<3>();
+ * @endcode
+ *
+ * Regions must hold trivially copyable types, or trivially destructible types
+ * with standard layout such as structs of std::atomic. Zero-filled memory is
+ * their initial state unless construct() value-initializes them. A type that
+ * appears in a single region can be looked up by type, otherwise by index.
+ */
+template <typename... Regions>
+class segment_layout {
+    static_assert(sizeof...(Regions) > 0, "segment_layout needs at least one region");
+
+    using offsets = detail::layout_offsets<0, Regions...>;
+
+public:
+    class view;
+
+    /// Region type of region I
+    template <std::size_t I>
+    using region_type = typename detail::region_at<I, Regions...>::type;
+
+    /// Number of regions
+    static constexpr std::size_t region_count = sizeof...(Regions);
+
+    /// Largest region alignment, the alignment the base address needs
+    static constexpr std::size_t alignment = detail::max_of<Regions::alignment...>::value;
+
+    /// Bytes spanned by all regions, padded to the layout alignment
+    static constexpr std::size_t size = detail::align_up(offsets::end, alignment);
+
+    /// Hash of the offset, size and alignment of every region. Store it as the
+    /// managed_segment layout version to reject peers built with another layout
+    static constexpr std::uint64_t fingerprint = detail::layout_fingerprint<Regions...>();
+
+    /// Byte offset of region I from the start of the segment
+    template <std::size_t I>
+    static constexpr std::size_t offset_of() noexcept {
+        static_assert(I < region_count, "region index out of range");
+        return offsets::offset(I);
+    }
+
+    /// Index of the region holding T
+    template <typename T>
+    static constexpr std::size_t index_of() noexcept {
+        static_assert(detail::region_index<T, Regions...>::matches == 1,
+                      "type must be held by exactly one region; use the region index");
+        return detail::region_index<T, Regions...>::value;
+    }
+
+    /// Pointer to region I (the first element for array_region) in a segment at base
+    template <std::size_t I>
+    static typename region_type<I>::pointer get(void* base) noexcept {
+        return std::launder(reinterpret_cast<typename region_type<I>::pointer>(
+            static_cast<unsigned char*>(base) + offset_of<I>()));
+    }
+
+    template <std::size_t I>
+    static const typename region_type<I>::value_type* get(const void* base) noexcept {
+        return std::launder(reinterpret_cast<const typename region_type<I>::value_type*>(
+            static_cast<const unsigned char*>(base) + offset_of<I>()));
+    }
+
+    /// Pointer to the region holding T in a segment at base
+    template <typename T>
+    static T* get(void* base) noexcept {
+        return get<index_of<T>()>(base);
+    }
+
+    template <typename T>
+    static const T* get(const void* base) noexcept {
+        return get<index_of<T>()>(base);
+    }
+
+    /**
+     * @brief Value-initialize every region (the creator, before publishing the segment)
+     * @note Freshly created segments are zero-filled, which is enough for types
+     *       whose zero bit pattern is their initial state.
+     */
+    static void construct(void* base) noexcept {
+        construct_regions(base, std::make_index_sequence<region_count>());
+    }
+
+    /**
+     * @brief Check that a mapping is large enough and suitably aligned for the layout
+     */
+    static bool fits(const void* base, std::size_t bytes) noexcept {
+        return base != nullptr && bytes >= size &&
+               reinterpret_cast<std::uintptr_t>(base) % alignment == 0;
+    }
+
+    /**
+     * @brief View of the layout over a mapped segment
+     * @return Invalid view if the segment is not mapped or too small (see fits())
+     */
+    static view bind(shared_memory& shm) noexcept {
+        return fits(shm.data(), shm.size()) ? view(shm.data()) : view();
+    }
+
+    /**
+     * @brief Typed accessors bound to a base address
+     */
+    class view {
+    public:
+        view() noexcept = default;
+        explicit view(void* base) noexcept : base_(base) {}
+
+        template <std::size_t I>
+        typename region_type<I>::pointer get() const noexcept {
+            return segment_layout::template get<I>(base_);
+        }
+
+        template <typename T>
+        T* get() const noexcept {
+            return segment_layout::template get<T>(base_);
+        }
+
+        void* data() const noexcept {
+            return base_;
+        }
+
+        bool is_valid() const noexcept {
+            return base_ != nullptr;
+        }
+
+    private:
+        void* base_ = nullptr;
+    };
+
+private:
+    template <std::size_t... I>
+    static void construct_regions(void* base, std::index_sequence<I...>) noexcept {
+        int expand[] = {(construct_region<I>(base), 0)...};
+        (void)expand;
+    }
+
+    template <std::size_t I>
+    static void construct_region(void* base) noexcept {
+        using value_type = typename region_type<I>::value_type;
+        unsigned char* p = static_cast<unsigned char*>(base) + offset_of<I>();
+        for (std::size_t i = 0; i < region_type<I>::count; ++i) {
+            new (p + i * sizeof(value_type)) value_type();
+        }
+    }
+};
+
+}  // namespace shm
+}  // namespace slick
@@ -0,0 +1,105 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 Slick Quant
+
+#pragma once
+
+#include "detail/platform.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace slick {
+namespace shm {
+
+/**
+ * @brief Single-writer, many-reader snapshot of a small value in shared memory
+ *
+ * The writer never waits. Readers never take a lock and never write to the
+ * segment, so they work through read_only mappings. A reader retries only when the
+ * writer updated the value while it was being copied (a torn read).
+ *
+ * Zero-filled memory is a valid seqlock holding a zero-initialized T, so it can be
+ * embedded in a struct in a freshly created segment without any initialization.
+ *
+ * @code
+ * struct top_of_book { double bid, ask; std::uint64_t bid_size, ask_size; };
+ * struct market_block { seqlock<top_of_book> book; };
+ *
+ * block->book.store(tob);            // Writer process
+ * top_of_book tob = block->book.load();  // Any reader process
+ * @endcode
+ *
+ * Thread safety: one writer at a time (use an interprocess_mutex for several
+ * writers); any number of concurrent readers.
+ */
+template <typename T>
+class seqlock {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "seqlock values must be trivially copyable");
+
+public:
+    using value_type = T;
+
+    /**
+     * @brief Construct with a zero-initialized value
+     */
+    seqlock() noexcept : seq_(0), value_() {}
+
+    seqlock(const seqlock&) = delete;
+    seqlock& operator=(const seqlock&) = delete;
+
+    /**
+     * @brief Publish a new value (writer only)
+     */
+    void store(const T& value) noexcept {
+        std::uint64_t seq = seq_.load(std::memory_order_relaxed);
+        seq_.store(seq + 1, std::memory_order_relaxed);  // Odd: update in progress
+        std::atomic_thread_fence(std::memory_order_release);
+        std::memcpy(&value_, &value, sizeof(T));
+        seq_.store(seq + 2, std::memory_order_release);
+    }
+
+    /**
+     * @brief Read a consistent snapshot, retrying on torn reads
+     */
+    T load() const noexcept {
+        T value;
+        while (!try_load(value)) {
+            detail::cpu_relax();
+        }
+        return value;
+    }
+
+    /**
+     * @brief Read a snapshot with a single attempt
+     * @return false if the writer was updating the value; out is unspecified then
+     */
+    bool try_load(T& out) const noexcept {
+        std::uint64_t before = seq_.load(std::memory_order_acquire);
+        if (before & 1) {
+            return false;
+        }
+        std::memcpy(&out, &value_, sizeof(T));
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return seq_.load(std::memory_order_relaxed) == before;
+    }
+
+    /**
+     * @brief Number of completed store() calls
+     *
+     * Lets readers cheaply check whether a new value was published since
+     * their last load().
+     */
+    std::uint64_t version() const noexcept {
+        return seq_.load(std::memory_order_acquire) / 2;
+    }
+
+private:
+    std::atomic<std::uint64_t> seq_;  // Odd while a store() is in progress
+    T value_;
+};
+
+}  // namespace shm
+}  // namespace slick
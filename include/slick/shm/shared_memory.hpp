@@ -6,6 +6,7 @@
 #include "types.hpp"
 #include "error.hpp"
 #include "detail/platform.hpp"
+#include "typed_view.hpp"
 
 #ifdef SLICK_SHM_WINDOWS
 #include "detail/windows/shared_memory_impl.hpp"
@@ -15,6 +16,7 @@
 
 #include <utility>
 #include <new>
+#include <vector>
 
 namespace slick {
 namespace shm {
@@ -34,11 +36,16 @@ namespace shm {
  *       systems could theoretically support resizing via ftruncate(), Windows
  *       CreateFileMapping does not support resizing. For cross-platform
  *       compatibility, this library does not expose resize operations.
- *       If you need dynamic sizing, allocate the maximum size upfront or
- *       use a memory allocator within the fixed-size shared memory region.
+ *       If you need dynamic sizing, use growable_segment, allocate the maximum
+ *       size upfront or use an arena (see arena.hpp) within the fixed-size region.
  */
 class shared_memory {
 public:
+    /**
+     * @brief OS handle of a segment: a file descriptor on POSIX, a section HANDLE on Windows
+     */
+    using native_handle_type = detail::native_handle_type;
+
     /**
      * @brief Default constructor - creates an invalid shared memory object
      */
@@ -54,13 +61,15 @@ public:
      * @param size Size in bytes
      * @param tag create_only tag
      * @param mode Access mode (default: read_write)
+     * @param options Segment options (huge pages, prefault, lock, NUMA policy, ...)
      * @throws shared_memory_error if creation fails
      */
     shared_memory(const char* name, std::size_t size, create_only_t tag,
-                  access_mode mode = access_mode::read_write)
+                  access_mode mode = access_mode::read_write,
+                  const segment_options& options = segment_options())
         : impl_(), last_error_() {
         (void)tag;
-        last_error_ = impl_.create(name, size, create_mode::create_only, mode);
+        last_error_ = impl_.create(name, size, create_mode::create_only, mode, options);
         if (last_error_) {
             throw shared_memory_error(last_error_);
         }
@@ -72,13 +81,15 @@ public:
      * @param size Size in bytes (used only if creating)
      * @param tag open_or_create tag
      * @param mode Access mode (default: read_write)
+     * @param options Segment options (huge pages, prefault, lock, NUMA policy, ...)
      * @throws shared_memory_error if operation fails
      */
     shared_memory(const char* name, std::size_t size, open_or_create_t tag,
-                  access_mode mode = access_mode::read_write)
+                  access_mode mode = access_mode::read_write,
+                  const segment_options& options = segment_options())
         : impl_(), last_error_() {
         (void)tag;
-        last_error_ = impl_.create(name, size, create_mode::open_or_create, mode);
+        last_error_ = impl_.create(name, size, create_mode::open_or_create, mode, options);
         if (last_error_) {
             throw shared_memory_error(last_error_);
         }
@@ -90,13 +101,15 @@ public:
      * @param size Size in bytes
      * @param tag open_always tag
      * @param mode Access mode (default: read_write)
+     * @param options Segment options (huge pages, prefault, lock, NUMA policy, ...)
      * @throws shared_memory_error if operation fails
      */
     shared_memory(const char* name, std::size_t size, open_always_t tag,
-                  access_mode mode = access_mode::read_write)
+                  access_mode mode = access_mode::read_write,
+                  const segment_options& options = segment_options())
         : impl_(), last_error_() {
         (void)tag;
-        last_error_ = impl_.create(name, size, create_mode::open_always, mode);
+        last_error_ = impl_.create(name, size, create_mode::open_always, mode, options);
         if (last_error_) {
             throw shared_memory_error(last_error_);
         }
@@ -107,13 +120,61 @@ public:
      * @param name Name of the shared memory
      * @param tag open_existing tag
      * @param mode Access mode (default: read_write)
+     * @param options Segment options (mapping related options only)
      * @throws shared_memory_error if shared memory doesn't exist or open fails
      */
     shared_memory(const char* name, open_existing_t tag,
-                  access_mode mode = access_mode::read_write)
+                  access_mode mode = access_mode::read_write,
+                  const segment_options& options = segment_options())
         : impl_(), last_error_() {
         (void)tag;
-        last_error_ = impl_.open(name, mode);
+        last_error_ = impl_.open(name, mode, options);
+        if (last_error_) {
+            throw shared_memory_error(last_error_);
+        }
+    }
+
+    /**
+     * @brief Create an unnamed segment that is shared by passing its handle
+     *
+     * Nothing is added to the shared memory namespace: there is no name to
+     * collide with, and the segment goes away when the last handle and mapping
+     * are closed, also if the processes using it crash. Hand native_handle() to
+     * other processes with send_handle() or import_handle() (see
+     * handle_transfer.hpp) or by inheritance, and map it there with adopt_handle.
+     *
+     * @param size Size in bytes
+     * @param tag anonymous tag
+     * @param options Segment options (huge pages, prefault, lock, NUMA policy, ...)
+     * @throws shared_memory_error if creation fails
+     * @note Linux: a memfd with its size sealed (is_sealed()). Windows: an unnamed
+     *       section. macOS: an shm object unlinked right after creation.
+     */
+    shared_memory(std::size_t size, anonymous_t tag,
+                  const segment_options& options = segment_options())
+        : impl_(), last_error_() {
+        (void)tag;
+        last_error_ = impl_.create_anonymous(size, options);
+        if (last_error_) {
+            throw shared_memory_error(last_error_);
+        }
+    }
+
+    /**
+     * @brief Map a segment from its handle and take ownership of the handle
+     * @param handle Handle received from send_handle()/import_handle(), or inherited
+     * @param tag adopt_handle tag
+     * @param mode Access mode (default: read_write)
+     * @param options Segment options (mapping related options only)
+     * @throws shared_memory_error if mapping fails
+     * @note The handle is closed by this object, also when construction fails.
+     */
+    shared_memory(native_handle_type handle, adopt_handle_t tag,
+                  access_mode mode = access_mode::read_write,
+                  const segment_options& options = segment_options())
+        : impl_(), last_error_() {
+        (void)tag;
+        last_error_ = impl_.adopt(handle, mode, options);
         if (last_error_) {
             throw shared_memory_error(last_error_);
         }
@@ -140,6 +201,19 @@ public:
         last_error_ = impl_.create(name, size, create_mode::create_only, mode);
     }
 
+    /**
+     * @brief Same as above with explicit segment options - no-throw version
+     * @note Check is_valid() and last_error() after construction
+     */
+    shared_memory(const char* name, std::size_t size, create_only_t tag,
+                  access_mode mode, const segment_options& options,
+                  const std::nothrow_t& nt) noexcept
+        : impl_(), last_error_() {
+        (void)tag;
+        (void)nt;
+        last_error_ = impl_.create(name, size, create_mode::create_only, mode, options);
+    }
+
     /**
      * @brief Create or open shared memory (open_or_create mode) - no-throw version
      * @param name Name of the shared memory
@@ -157,6 +231,19 @@ public:
         last_error_ = impl_.create(name, size, create_mode::open_or_create, mode);
     }
 
+    /**
+     * @brief Same as above with explicit segment options - no-throw version
+     * @note Check is_valid() and last_error() after construction
+     */
+    shared_memory(const char* name, std::size_t size, open_or_create_t tag,
+                  access_mode mode, const segment_options& options,
+                  const std::nothrow_t& nt) noexcept
+        : impl_(), last_error_() {
+        (void)tag;
+        (void)nt;
+        last_error_ = impl_.create(name, size, create_mode::open_or_create, mode, options);
+    }
+
     /**
      * @brief Create shared memory, truncate if exists (open_always mode) - no-throw version
      * @param name Name of the shared memory
@@ -174,6 +261,19 @@ public:
         last_error_ = impl_.create(name, size, create_mode::open_always, mode);
     }
 
+    /**
+     * @brief Same as above with explicit segment options - no-throw version
+     * @note Check is_valid() and last_error() after construction
+     */
+    shared_memory(const char* name, std::size_t size, open_always_t tag,
+                  access_mode mode, const segment_options& options,
+                  const std::nothrow_t& nt) noexcept
+        : impl_(), last_error_() {
+        (void)tag;
+        (void)nt;
+        last_error_ = impl_.create(name, size, create_mode::open_always, mode, options);
+    }
+
     /**
      * @brief Open existing shared memory - no-throw version
      * @param name Name of the shared memory
@@ -190,6 +290,43 @@ public:
         last_error_ = impl_.open(name, mode);
     }
 
+    /**
+     * @brief Open existing shared memory with explicit segment options - no-throw version
+     * @note Check is_valid() and last_error() after construction
+     */
+    shared_memory(const char* name, open_existing_t tag, access_mode mode,
+                  const segment_options& options, const std::nothrow_t& nt) noexcept
+        : impl_(), last_error_() {
+        (void)tag;
+        (void)nt;
+        last_error_ = impl_.open(name, mode, options);
+    }
+
+    /**
+     * @brief Create an unnamed segment - no-throw version
+     * @note Check is_valid() and last_error() after construction
+     */
+    shared_memory(std::size_t size, anonymous_t tag, const segment_options& options,
+                  const std::nothrow_t& nt) noexcept
+        : impl_(), last_error_() {
+        (void)tag;
+        (void)nt;
+        last_error_ = impl_.create_anonymous(size, options);
+    }
+
+    /**
+     * @brief Map a segment from its handle - no-throw version
+     * @note Check is_valid() and last_error() after construction. The handle is
+     *       closed on failure.
+     */
+    shared_memory(native_handle_type handle, adopt_handle_t tag, access_mode mode,
+                  const segment_options& options, const std::nothrow_t& nt) noexcept
+        : impl_(), last_error_() {
+        (void)tag;
+        (void)nt;
+        last_error_ = impl_.adopt(handle, mode, options);
+    }
+
     /**
      * @brief Destructor - automatically unmaps and closes shared memory
      */
@@ -240,12 +377,90 @@ public:
         return impl_.data();
     }
 
+    /**
+     * @brief Typed pointer to one T at offset
+     * @tparam Align Required alignment of the object (at least alignof(T))
+     * @return nullptr if the segment is not mapped, too small or misaligned
+     */
+    template <typename T, std::size_t Align = alignof(T)>
+    T* as(std::size_t offset = 0) noexcept {
+        return detail::typed_pointer<T, Align>(static_cast<unsigned char*>(data()), size(), offset,
+                                               1);
+    }
+
+    template <typename T, std::size_t Align = alignof(T)>
+    const T* as(std::size_t offset = 0) const noexcept {
+        return detail::typed_pointer<const T, Align>(static_cast<const unsigned char*>(data()),
+                                                     size(), offset, 1);
+    }
+
+    /**
+     * @brief Typed view of the elements of T from offset to the end of the segment
+     * @tparam Align Required alignment of the first element, promised to the
+     *         compiler by the view's data() / begin()
+     * @return Empty view if the segment is not mapped, offset is misaligned or
+     *         no element fits
+     *
+     * @code
+     * auto prices = shm.as_array<double, 64>();
+     * double sum = 0;
+     * for (double p : prices) sum += p;  // Vectorized with aligned loads
+     * @endcode
+     */
+    template <typename T, std::size_t Align = alignof(T)>
+    array_view<T, Align> as_array(std::size_t offset = 0) noexcept {
+        return detail::make_array_view<T, Align>(static_cast<unsigned char*>(data()), size(),
+                                                 offset, detail::typed_count<T>(size(), offset));
+    }
+
+    template <typename T, std::size_t Align = alignof(T)>
+    array_view<const T, Align> as_array(std::size_t offset = 0) const noexcept {
+        return detail::make_array_view<const T, Align>(static_cast<const unsigned char*>(data()),
+                                                       size(), offset,
+                                                       detail::typed_count<T>(size(), offset));
+    }
+
+    /**
+     * @brief Typed view of count elements of T at offset
+     * @return Empty view if the elements don't fit or offset is misaligned
+     */
+    template <typename T, std::size_t Align = alignof(T)>
+    array_view<T, Align> as_array(std::size_t offset, std::size_t count) noexcept {
+        return detail::make_array_view<T, Align>(static_cast<unsigned char*>(data()), size(),
+                                                 offset, count);
+    }
+
+    template <typename T, std::size_t Align = alignof(T)>
+    array_view<const T, Align> as_array(std::size_t offset, std::size_t count) const noexcept {
+        return detail::make_array_view<const T, Align>(static_cast<const unsigned char*>(data()),
+                                                       size(), offset, count);
+    }
+
+    /**
+     * @brief Row-major rows x cols view of T at offset (e.g. instruments x fields)
+     * @return Invalid view if the matrix doesn't fit or offset is misaligned
+     */
+    template <typename T, std::size_t Align = alignof(T)>
+    matrix_view<T, Align> as_matrix(std::size_t rows, std::size_t cols,
+                                    std::size_t offset = 0) noexcept {
+        return detail::make_matrix_view<T, Align>(static_cast<unsigned char*>(data()), size(),
+                                                  offset, rows, cols);
+    }
+
+    template <typename T, std::size_t Align = alignof(T)>
+    matrix_view<const T, Align> as_matrix(std::size_t rows, std::size_t cols,
+                                          std::size_t offset = 0) const noexcept {
+        return detail::make_matrix_view<const T, Align>(static_cast<const unsigned char*>(data()),
+                                                        size(), offset, rows, cols);
+    }
+
     /**
      * @brief Get the size of the shared memory in bytes
      * @return Actual allocated size in bytes, or 0 if invalid
      * @note The actual size may be larger than requested due to page rounding.
      *       On Windows, sizes are rounded to the system's allocation granularity (typically 64KB).
      *       On POSIX systems, sizes may be rounded to page size (typically 4KB).
+     *       The lifetime table of a ref_counted segment (POSIX) is not included.
      *       Use this method to get the actual usable size.
      */
     std::size_t size() const noexcept {
@@ -297,13 +512,215 @@ public:
         return impl_.is_creator();
     }
 
+    /**
+     * @brief Check if the segment is backed by huge pages
+     * @return true if huge pages back the mapping, false for standard pages
+     * @note With huge_pages::preferred, this reports whether huge pages were actually obtained.
+     *       Openers detect huge page backing from the existing segment.
+     */
+    bool uses_huge_pages() const noexcept {
+        return impl_.uses_huge_pages();
+    }
+
+    /**
+     * @brief Get the page size backing the mapping
+     * @return Huge page size when uses_huge_pages() is true, otherwise the system page size
+     * @note size() is a multiple of this value for huge page segments.
+     */
+    std::size_t page_size() const noexcept {
+        return impl_.page_size();
+    }
+
+    /**
+     * @brief Check if the segment is mapped twice back-to-back (segment_options::mirror)
+     * @return true if data() is followed by a second view of the segment, so that
+     *         the 2 * size() bytes at data() are accessible and data()[size() + i]
+     *         is data()[i]
+     * @note prefault() and lock() apply to both views.
+     */
+    bool is_mirrored() const noexcept {
+        return impl_.is_mirrored();
+    }
+
+    /**
+     * @brief Check if the segment was opened as a private copy-on-write mapping
+     *        (segment_options::copy_on_write)
+     */
+    bool is_copy_on_write() const noexcept {
+        return impl_.is_copy_on_write();
+    }
+
+    /**
+     * @brief Get the OS handle of the segment (still owned by this object)
+     * @return File descriptor on POSIX, section handle on Windows; -1 / INVALID_HANDLE_VALUE
+     *         when closed
+     */
+    native_handle_type native_handle() const noexcept {
+        return impl_.native_handle();
+    }
+
+    /**
+     * @brief Check if the size of the segment can't change
+     * @return true for anonymous segments on Linux (F_SEAL_SHRINK and F_SEAL_GROW)
+     *         and for every segment on Windows, whose sections can't be resized
+     * @note Readers of a sealed segment can trust size() without re-validating it.
+     */
+    bool is_sealed() const noexcept {
+        return impl_.is_sealed();
+    }
+
     // ========================================================================
     // Manual control
     // ========================================================================
 
+    /**
+     * @brief Pre-fault the whole mapping
+     * @return Error code, empty on success
+     * @see prefault(std::size_t, std::size_t)
+     */
+    std::error_code prefault() noexcept {
+        return impl_.prefault(0, impl_.size());
+    }
+
+    /**
+     * @brief Pre-fault a byte range of the mapping so later accesses don't page fault
+     * @param offset Byte offset into the mapping
+     * @param length Number of bytes
+     * @return Error code, empty on success (errc::invalid_argument if the range is out of bounds)
+     * @note Linux uses madvise(MADV_POPULATE_READ/WRITE) and touches pages on older kernels.
+     *       macOS uses madvise(MADV_WILLNEED) followed by touching every page.
+     *       Windows uses PrefetchVirtualMemory() followed by touching every page.
+     *       Data is never modified. Use segment_options::prefault to do this at construction.
+     */
+    std::error_code prefault(std::size_t offset, std::size_t length) noexcept {
+        return impl_.prefault(offset, length);
+    }
+
+    /**
+     * @brief Lock the whole mapping into RAM so it can't be swapped out
+     * @param policy memory_lock::lock (fault in now) or memory_lock::on_fault
+     * @return Error code, empty on success
+     * @see lock(std::size_t, std::size_t, memory_lock)
+     */
+    std::error_code lock(memory_lock policy = memory_lock::lock) noexcept {
+        return impl_.lock(0, impl_.size(), policy);
+    }
+
+    /**
+     * @brief Lock a byte range of the mapping into RAM
+     * @param offset Byte offset into the mapping
+     * @param length Number of bytes
+     * @param policy memory_lock::lock (fault in now) or memory_lock::on_fault
+     * @return Error code, empty on success. errc::lock_limit_exceeded if RLIMIT_MEMLOCK
+     *         is exhausted (POSIX), errc::working_set_quota_exceeded if the working set
+     *         can't be grown to hold the pages (Windows).
+     * @note POSIX uses mlock() (mlock2(MLOCK_ONFAULT) for on_fault on Linux), Windows uses
+     *       VirtualLock(), growing the process working set if needed. Locks are released
+     *       by unlock() or when the memory is unmapped.
+     */
+    std::error_code lock(std::size_t offset, std::size_t length,
+                         memory_lock policy = memory_lock::lock) noexcept {
+        return impl_.lock(offset, length, policy);
+    }
+
+    /**
+     * @brief Unlock the whole mapping
+     * @return Error code, empty on success
+     */
+    std::error_code unlock() noexcept {
+        return impl_.unlock(0, impl_.size());
+    }
+
+    /**
+     * @brief Unlock a byte range of the mapping
+     * @param offset Byte offset into the mapping
+     * @param length Number of bytes
+     * @return Error code, empty on success
+     */
+    std::error_code unlock(std::size_t offset, std::size_t length) noexcept {
+        return impl_.unlock(offset, length);
+    }
+
+    /**
+     * @brief Check if lock() (or segment_options::lock) succeeded on this mapping
+     * @return true if (part of) the mapping is locked into RAM
+     */
+    bool is_locked() const noexcept {
+        return impl_.is_locked();
+    }
+
+    /**
+     * @brief Take private copies of every page of a copy_on_write mapping
+     * @return Error code, empty on success
+     * @see make_private(std::size_t, std::size_t)
+     */
+    std::error_code make_private() noexcept {
+        return impl_.make_private(0, impl_.size());
+    }
+
+    /**
+     * @brief Take private copies of the pages of a byte range of a copy_on_write mapping
+     *
+     * Pages of a copy_on_write mapping that this process hasn't written still
+     * show the writer's later changes. Copying them freezes the range: what it
+     * holds afterwards is what the segment held at the time of the copy, page by
+     * page. Pair it with a generation counter or seqlock sequence that the writer
+     * bumps around updates: read it, make_private() the range, read it again,
+     * and retry if it changed.
+     *
+     * @param offset Byte offset into the mapping
+     * @param length Number of bytes (whole pages are copied)
+     * @return Error code, empty on success. errc::not_supported if the mapping is
+     *         not copy_on_write, errc::permission_denied if it is read_only,
+     *         errc::invalid_argument if the range is out of bounds.
+     * @note Linux uses madvise(MADV_POPULATE_WRITE) and write-faults every page on
+     *       older kernels (and elsewhere) with an atomic OR of zero, which leaves the
+     *       data unchanged. The copies take as much memory as the range.
+     */
+    std::error_code make_private(std::size_t offset, std::size_t length) noexcept {
+        return impl_.make_private(offset, length);
+    }
+
+    /**
+     * @brief Write the whole mapping back to its file
+     * @param async Only schedule the write-back instead of waiting for it
+     * @return Error code, empty on success
+     * @see flush(std::size_t, std::size_t, bool)
+     */
+    std::error_code flush(bool async = false) noexcept {
+        return impl_.flush(0, impl_.size(), async);
+    }
+
+    /**
+     * @brief Write a byte range of the mapping back to its file (segment_options::file_backed)
+     * @param offset Byte offset into the mapping
+     * @param length Number of bytes
+     * @param async Only schedule the write-back instead of waiting for it
+     * @return Error code, empty on success (errc::invalid_argument if the range is out of bounds)
+     * @note POSIX uses msync(MS_SYNC or MS_ASYNC). Windows uses FlushViewOfFile(), plus
+     *       FlushFileBuffers() unless async. Segments that aren't file-backed have no
+     *       backing store to write to, so this only costs a system call for them.
+     */
+    std::error_code flush(std::size_t offset, std::size_t length, bool async = false) noexcept {
+        return impl_.flush(offset, length, async);
+    }
+
+    /**
+     * @brief Report on which NUMA nodes the mapping's pages actually live
+     * @param[out] pages_per_node Number of resident pages per node (index = node),
+     *             pages not faulted in yet are not counted
+     * @return Error code, empty on success (errc::not_supported on macOS)
+     * @note Linux uses move_pages() in query mode, Windows uses QueryWorkingSetEx()
+     *       (which only sees pages in this process's working set).
+     */
+    std::error_code numa_placement(std::vector<std::size_t>& pages_per_node) const {
+        return impl_.numa_placement(pages_per_node);
+    }
+
     /**
      * @brief Manually unmap the shared memory
-     * @note The shared memory handle remains open
+     * @note The shared memory handle remains open. A ref_counted segment is
+     *       detached here: the last process to unmap it removes its name.
      */
     void unmap() noexcept {
         impl_.unmap();
@@ -332,6 +749,25 @@ public:
         return detail::platform_shared_memory::remove(name);
     }
 
+    /**
+     * @brief Remove leaked segment_lifetime::ref_counted segments
+     *
+     * A ref_counted segment is unlinked by the last process that detaches from
+     * it. One whose processes crashed is left behind; this reclaims the table
+     * slots of processes that are gone (kill(pid, 0) fails with ESRCH) and
+     * removes the segment once none is left. Segments created with
+     * segment_lifetime::manual are never touched.
+     *
+     * @param prefix Only segments whose name starts with it ("" for all)
+     * @return Number of segments removed
+     * @note Linux scans /dev/shm and the hugetlbfs mounts, mapping only the last
+     *       page of each candidate. macOS can't list shm objects and returns 0.
+     *       On Windows sections go away with their last handle, so this returns 0.
+     */
+    static std::size_t sweep(const char* prefix) noexcept {
+        return detail::platform_shared_memory::sweep(prefix);
+    }
+
     /**
      * @brief Check if a shared memory segment with the given name exists
      * @param name Name of the shared memory
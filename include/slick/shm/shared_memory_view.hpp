@@ -4,7 +4,7 @@
 #pragma once
 
 #include "shared_memory.hpp"
-#include <string>
+#include <type_traits>
 
 namespace slick {
 namespace shm {
@@ -19,6 +19,12 @@ class shared_memory;
  * managing its lifetime. Useful for passing shared memory references around
  * without transferring ownership.
  *
+ * A view is a trivially copyable handful of words, so creating and copying
+ * views never allocates. A view of a shared_memory refers to the process-wide
+ * copy of the segment's name (interned once per name at create or open), which
+ * stays valid after the shared_memory is moved, closed or destroyed. data()
+ * stays valid as long as the segment stays mapped.
+ *
  * Thread safety: Individual shared_memory_view objects are not thread-safe.
  */
 class shared_memory_view {
@@ -27,7 +33,7 @@ public:
      * @brief Default constructor - creates an invalid view
      */
     shared_memory_view() noexcept
-        : data_(nullptr), size_(0), name_(), mode_(access_mode::read_write) {}
+        : data_(nullptr), size_(0), name_(""), mode_(access_mode::read_write) {}
 
     /**
      * @brief Construct view from a shared_memory object
@@ -39,7 +45,7 @@ public:
      * @brief Construct view from raw parameters
      * @param data Pointer to shared memory data
      * @param size Size in bytes
-     * @param name Name of the shared memory
+     * @param name Name of the shared memory, referenced rather than copied
      * @param mode Access mode
      */
     shared_memory_view(void* data, std::size_t size, const char* name,
@@ -70,6 +76,83 @@ public:
         return data_;
     }
 
+    /**
+     * @brief Typed pointer to one T at offset
+     * @tparam Align Required alignment of the object (at least alignof(T))
+     * @return nullptr if the view is invalid, too small or misaligned
+     */
+    template <typename T, std::size_t Align = alignof(T)>
+    T* as(std::size_t offset = 0) noexcept {
+        return detail::typed_pointer<T, Align>(static_cast<unsigned char*>(data()), size(), offset,
+                                               1);
+    }
+
+    template <typename T, std::size_t Align = alignof(T)>
+    const T* as(std::size_t offset = 0) const noexcept {
+        return detail::typed_pointer<const T, Align>(static_cast<const unsigned char*>(data()),
+                                                     size(), offset, 1);
+    }
+
+    /**
+     * @brief Typed view of the elements of T from offset to the end of the segment
+     * @tparam Align Required alignment of the first element, promised to the
+     *         compiler by the view's data() / begin()
+     * @return Empty view if the view is invalid, offset is misaligned or
+     *         no element fits
+     *
+     * @code
+     * auto prices = shm.as_array<double, 64>();
+     * double sum = 0;
+     * for (double p : prices) sum += p;  // Vectorized with aligned loads
+     * @endcode
+     */
+    template <typename T, std::size_t Align = alignof(T)>
+    array_view<T, Align> as_array(std::size_t offset = 0) noexcept {
+        return detail::make_array_view<T, Align>(static_cast<unsigned char*>(data()), size(),
+                                                 offset, detail::typed_count<T>(size(), offset));
+    }
+
+    template <typename T, std::size_t Align = alignof(T)>
+    array_view<const T, Align> as_array(std::size_t offset = 0) const noexcept {
+        return detail::make_array_view<const T, Align>(static_cast<const unsigned char*>(data()),
+                                                       size(), offset,
+                                                       detail::typed_count<T>(size(), offset));
+    }
+
+    /**
+     * @brief Typed view of count elements of T at offset
+     * @return Empty view if the elements don't fit or offset is misaligned
+     */
+    template <typename T, std::size_t Align = alignof(T)>
+    array_view<T, Align> as_array(std::size_t offset, std::size_t count) noexcept {
+        return detail::make_array_view<T, Align>(static_cast<unsigned char*>(data()), size(),
+                                                 offset, count);
+    }
+
+    template <typename T, std::size_t Align = alignof(T)>
+    array_view<const T, Align> as_array(std::size_t offset, std::size_t count) const noexcept {
+        return detail::make_array_view<const T, Align>(static_cast<const unsigned char*>(data()),
+                                                       size(), offset, count);
+    }
+
+    /**
+     * @brief Row-major rows x cols view of T at offset (e.g. instruments x fields)
+     * @return Invalid view if the matrix doesn't fit or offset is misaligned
+     */
+    template <typename T, std::size_t Align = alignof(T)>
+    matrix_view<T, Align> as_matrix(std::size_t rows, std::size_t cols,
+                                    std::size_t offset = 0) noexcept {
+        return detail::make_matrix_view<T, Align>(static_cast<unsigned char*>(data()), size(),
+                                                  offset, rows, cols);
+    }
+
+    template <typename T, std::size_t Align = alignof(T)>
+    matrix_view<const T, Align> as_matrix(std::size_t rows, std::size_t cols,
+                                          std::size_t offset = 0) const noexcept {
+        return detail::make_matrix_view<const T, Align>(static_cast<const unsigned char*>(data()),
+                                                        size(), offset, rows, cols);
+    }
+
     /**
      * @brief Get the size of the shared memory in bytes
      * @return Size in bytes, or 0 if invalid
@@ -83,7 +166,7 @@ public:
      * @return Name string, or empty if invalid
      */
     const char* name() const noexcept {
-        return name_.c_str();
+        return name_;
     }
 
     /**
@@ -105,10 +188,13 @@ public:
 private:
     void* data_;
     std::size_t size_;
-    std::string name_;
+    const char* name_;  // Interned, or the caller's string for the raw constructor
     access_mode mode_;
 };
 
+static_assert(std::is_trivially_copyable<shared_memory_view>::value,
+              "shared_memory_view must stay cheap to pass by value");
+
 // Implementation of constructor from shared_memory
 // This is defined here after shared_memory_view is fully defined
 inline shared_memory_view::shared_memory_view(const shared_memory& shm) noexcept
@@ -0,0 +1,422 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 Slick Quant
+
+#pragma once
+
+#include "types.hpp"
+#include "error.hpp"
+#include "detail/platform.hpp"
+
+#ifdef SLICK_SHM_WINDOWS
+#include "detail/windows/window_impl.hpp"
+#elif defined(SLICK_SHM_POSIX)
+#include "detail/posix/window_impl.hpp"
+#endif
+
+#include <algorithm>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+namespace slick {
+namespace shm {
+
+/**
+ * @brief Mapping of a slice [offset, offset + length) of an existing segment
+ *
+ * Only the pages of the slice are mapped, so a process that needs a small part
+ * of a large segment doesn't pay the address space and page table cost of the
+ * rest. remap() moves the window to another slice of the same segment.
+ *
+ * The offset can be any byte offset: the mapping starts at the closest
+ * granularity() boundary below it and data() points at the requested byte.
+ * granularity() is the page size on POSIX (the huge page size for hugetlbfs
+ * segments) and the allocation granularity (64 KiB) on Windows.
+ *
+ * @code
+ * // Map 4 KiB at byte 10 GiB of a 16 GiB segment
+ * shared_memory_window index("feed_a", open_existing, 10ULL << 30, 4096,
+ *                            access_mode::read_only);
+ * const auto* entries = static_cast<const index_entry*>(index.data());
+ * @endcode
+ *
+ * Thread safety: Individual shared_memory_window objects are not thread-safe.
+ *
+ * @note segment_options::prefault and lock apply to every mapped slice; the
+ *       huge page and NUMA options are properties of the segment and are ignored.
+ */
+class shared_memory_window {
+public:
+    /**
+     * @brief Default constructor - creates an invalid window
+     */
+    shared_memory_window() = default;
+
+    /**
+     * @brief Open an existing segment and map a slice of it
+     * @param name Name of the shared memory segment
+     * @param tag open_existing tag
+     * @param offset Byte offset of the slice in the segment
+     * @param length Length of the slice in bytes
+     * @param mode Access mode
+     * @param options Segment options (prefault and lock)
+     * @throws shared_memory_error if the segment doesn't exist or the slice is
+     *         not inside it
+     */
+    shared_memory_window(const char* name, open_existing_t tag, std::size_t offset,
+                         std::size_t length, access_mode mode = access_mode::read_write,
+                         const segment_options& options = segment_options()) {
+        (void)tag;
+        last_error_ = open_impl(name, offset, length, mode, options);
+        if (last_error_) {
+            throw shared_memory_error(last_error_);
+        }
+    }
+
+    /**
+     * @brief Open an existing segment and map a slice of it - no-throw version
+     * @note Check is_valid() and last_error() after construction
+     */
+    shared_memory_window(const char* name, open_existing_t tag, std::size_t offset,
+                         std::size_t length, access_mode mode, const segment_options& options,
+                         const std::nothrow_t& nt) noexcept {
+        (void)tag;
+        (void)nt;
+        last_error_ = open_impl(name, offset, length, mode, options);
+    }
+
+    shared_memory_window(const shared_memory_window&) = delete;
+    shared_memory_window& operator=(const shared_memory_window&) = delete;
+
+    shared_memory_window(shared_memory_window&& other) noexcept {
+        *this = std::move(other);
+    }
+
+    shared_memory_window& operator=(shared_memory_window&& other) noexcept {
+        if (this != &other) {
+            impl_ = std::move(other.impl_);
+            offset_ = other.offset_;
+            size_ = other.size_;
+            last_error_ = other.last_error_;
+
+            other.offset_ = 0;
+            other.size_ = 0;
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Map [offset, offset + length) instead of the current slice
+     *
+     * Pointers into the previous slice are invalid afterwards. On failure the
+     * window is left unmapped (is_valid() is false) until the next successful
+     * remap().
+     *
+     * @return errc::invalid_argument if the slice is not inside the segment,
+     *         errc::invalid_size if length is 0
+     */
+    std::error_code remap(std::size_t offset, std::size_t length) noexcept {
+        if (!impl_.is_open()) {
+            return last_error_ = make_error_code(errc::mapping_failed);
+        }
+        if (length == 0) {
+            return last_error_ = make_error_code(errc::invalid_size);
+        }
+        std::size_t segment = impl_.segment_size();
+        if (offset > segment || length > segment - offset) {
+            return last_error_ = make_error_code(errc::invalid_argument);
+        }
+
+        std::size_t start = offset / impl_.granularity() * impl_.granularity();
+        last_error_ = impl_.map(start, offset - start + length);
+        if (last_error_) {
+            offset_ = 0;
+            size_ = 0;
+            return last_error_;
+        }
+        offset_ = offset;
+        size_ = length;
+        return {};
+    }
+
+    /**
+     * @brief true if [offset, offset + length) is inside the mapped slice
+     */
+    bool contains(std::size_t offset, std::size_t length) const noexcept {
+        return is_valid() && offset >= offset_ && offset - offset_ <= size_ &&
+               length <= size_ - (offset - offset_);
+    }
+
+    // ========================================================================
+    // Accessors
+    // ========================================================================
+
+    /**
+     * @brief Pointer to the byte at offset() in the segment, or nullptr if invalid
+     */
+    void* data() noexcept {
+        return is_valid()
+                   ? static_cast<char*>(impl_.view()) + (offset_ - impl_.view_offset())
+                   : nullptr;
+    }
+
+    const void* data() const noexcept {
+        return is_valid()
+                   ? static_cast<const char*>(impl_.view()) + (offset_ - impl_.view_offset())
+                   : nullptr;
+    }
+
+    /**
+     * @brief Length of the mapped slice in bytes
+     */
+    std::size_t size() const noexcept {
+        return is_valid() ? size_ : 0;
+    }
+
+    /**
+     * @brief Offset of the mapped slice in the segment
+     */
+    std::size_t offset() const noexcept {
+        return offset_;
+    }
+
+    /**
+     * @brief Size of the whole segment in bytes
+     */
+    std::size_t segment_size() const noexcept {
+        return impl_.segment_size();
+    }
+
+    /**
+     * @brief Alignment of the mappings made for the window
+     */
+    std::size_t granularity() const noexcept {
+        return impl_.granularity();
+    }
+
+    const char* name() const noexcept {
+        return impl_.name();
+    }
+
+    access_mode mode() const noexcept {
+        return impl_.mode();
+    }
+
+    bool is_valid() const noexcept {
+        return impl_.view() != nullptr;
+    }
+
+    std::error_code last_error() const noexcept {
+        return last_error_;
+    }
+
+private:
+    detail::platform_shared_window impl_;
+    std::size_t offset_ = 0;
+    std::size_t size_ = 0;
+    std::error_code last_error_;
+
+    std::error_code open_impl(const char* name, std::size_t offset, std::size_t length,
+                              access_mode mode, const segment_options& options) {
+        std::error_code ec = impl_.open(name, mode, options);
+        if (ec) {
+            return ec;
+        }
+        ec = remap(offset, length);
+        if (ec) {
+            impl_ = detail::platform_shared_window();
+        }
+        return ec;
+    }
+};
+
+/**
+ * @brief Fixed-size window that follows reads through a large segment
+ *
+ * at() returns a pointer to any range of the segment and only remaps when the
+ * range is not in the current window; the new window starts at the range and
+ * spans window_size bytes (or more, for a range longer than that). Streaming
+ * through a segment front to back therefore costs one remap per window_size
+ * bytes and never maps more than one window.
+ *
+ * @code
+ * sliding_window replay("feed_a", open_existing, 64 * 1024 * 1024);
+ * for (std::size_t pos = 0; pos + sizeof(record) <= replay.segment_size();
+ *      pos += sizeof(record)) {
+ *     const auto* r = static_cast<const record*>(replay.at(pos, sizeof(record)));
+ *     process(*r);
+ * }
+ * @endcode
+ *
+ * Pointers returned by at() stay valid until at() needs to remap.
+ *
+ * Thread safety: Individual sliding_window objects are not thread-safe.
+ */
+class sliding_window {
+public:
+    /**
+     * @brief Default constructor - creates an invalid window
+     */
+    sliding_window() = default;
+
+    /**
+     * @brief Open an existing segment and map its first window_size bytes
+     * @param name Name of the shared memory segment
+     * @param tag open_existing tag
+     * @param window_size Bytes to map at a time (rounded up to the granularity)
+     * @param mode Access mode
+     * @param options Segment options (prefault and lock apply to every window)
+     * @throws shared_memory_error if the segment doesn't exist
+     */
+    sliding_window(const char* name, open_existing_t tag, std::size_t window_size,
+                   access_mode mode = access_mode::read_only,
+                   const segment_options& options = segment_options()) {
+        (void)tag;
+        last_error_ = open_impl(name, window_size, mode, options);
+        if (last_error_) {
+            throw shared_memory_error(last_error_);
+        }
+    }
+
+    /**
+     * @brief Open an existing segment - no-throw version
+     * @note Check is_valid() and last_error() after construction
+     */
+    sliding_window(const char* name, open_existing_t tag, std::size_t window_size,
+                   access_mode mode, const segment_options& options,
+                   const std::nothrow_t& nt) noexcept {
+        (void)tag;
+        (void)nt;
+        last_error_ = open_impl(name, window_size, mode, options);
+    }
+
+    sliding_window(const sliding_window&) = delete;
+    sliding_window& operator=(const sliding_window&) = delete;
+
+    sliding_window(sliding_window&& other) noexcept {
+        *this = std::move(other);
+    }
+
+    sliding_window& operator=(sliding_window&& other) noexcept {
+        if (this != &other) {
+            window_ = std::move(other.window_);
+            window_size_ = other.window_size_;
+            remaps_ = other.remaps_;
+            last_error_ = other.last_error_;
+
+            other.window_size_ = 0;
+            other.remaps_ = 0;
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Pointer to [offset, offset + length) of the segment
+     * @return nullptr if the range is not inside the segment or remapping failed
+     *         (see last_error())
+     */
+    void* at(std::size_t offset, std::size_t length) noexcept {
+        return const_cast<void*>(static_cast<const sliding_window*>(this)->at(offset, length));
+    }
+
+    const void* at(std::size_t offset, std::size_t length) const noexcept {
+        if (!window_.contains(offset, length)) {
+            if (!slide(offset, length)) {
+                return nullptr;
+            }
+        }
+        return static_cast<const char*>(window_.data()) + (offset - window_.offset());
+    }
+
+    /**
+     * @brief The current window
+     */
+    const shared_memory_window& window() const noexcept {
+        return window_;
+    }
+
+    /**
+     * @brief Bytes mapped by each remap (unless a longer range needs more)
+     */
+    std::size_t window_size() const noexcept {
+        return window_size_;
+    }
+
+    /**
+     * @brief Number of times at() moved the window
+     */
+    std::uint64_t remap_count() const noexcept {
+        return remaps_;
+    }
+
+    std::size_t segment_size() const noexcept {
+        return window_.segment_size();
+    }
+
+    const char* name() const noexcept {
+        return window_.name();
+    }
+
+    access_mode mode() const noexcept {
+        return window_.mode();
+    }
+
+    bool is_valid() const noexcept {
+        return window_size_ != 0;
+    }
+
+    std::error_code last_error() const noexcept {
+        return last_error_;
+    }
+
+private:
+    // Moving the window doesn't change what the sliding_window exposes, so at()
+    // stays const for readers
+    mutable shared_memory_window window_;
+    std::size_t window_size_ = 0;
+    mutable std::uint64_t remaps_ = 0;
+    mutable std::error_code last_error_;
+
+    bool slide(std::size_t offset, std::size_t length) const noexcept {
+        std::size_t segment = window_.segment_size();
+        if (!is_valid() || offset > segment || length > segment - offset) {
+            last_error_ = make_error_code(errc::invalid_argument);
+            return false;
+        }
+        std::size_t start = offset / window_.granularity() * window_.granularity();
+        std::size_t span = (std::max)(window_size_, offset - start + length);
+        span = (std::min)(span, segment - start);
+        last_error_ = window_.remap(start, span);
+        if (last_error_) {
+            return false;
+        }
+        ++remaps_;
+        return true;
+    }
+
+    std::error_code open_impl(const char* name, std::size_t window_size, access_mode mode,
+                              const segment_options& options) {
+        if (window_size == 0) {
+            return make_error_code(errc::invalid_size);
+        }
+        // Map a single byte first to learn the segment size and granularity
+        shared_memory_window window(name, open_existing, 0, 1, mode, options, std::nothrow);
+        if (!window.is_valid()) {
+            return window.last_error();
+        }
+        std::size_t granularity = window.granularity();
+        window_size = (window_size + granularity - 1) / granularity * granularity;
+
+        std::error_code ec =
+            window.remap(0, (std::min)(window_size, window.segment_size()));
+        if (ec) {
+            return ec;
+        }
+        window_ = std::move(window);
+        window_size_ = window_size;
+        return {};
+    }
+};
+
+}  // namespace shm
+}  // namespace slick
@@ -0,0 +1,551 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 Slick Quant
+
+#pragma once
+
+#include "shared_memory.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <new>
+#include <type_traits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SLICK_SHM_HASH_MAP_SSE2
+#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define SLICK_SHM_HASH_MAP_NEON
+#include <arm_neon.h>
+#endif
+
+namespace slick {
+namespace shm {
+
+namespace detail {
+
+// A bucket is one cache line of tag bytes, one per slot:
+// 0 = empty, 1 = being written, 0x80 | 7 hash bits = occupied.
+// Slots in a bucket fill in order, so empty slots always form a suffix.
+constexpr std::size_t HASH_MAP_BUCKET_SLOTS = 64;
+constexpr std::uint8_t HASH_MAP_EMPTY = 0;
+constexpr std::uint8_t HASH_MAP_BUSY = 1;
+
+struct alignas(cache_line_size) hash_map_bucket {
+    std::atomic<std::uint64_t> tags[HASH_MAP_BUCKET_SLOTS / 8];  // Slot i is byte i % 8 of word i / 8
+};
+
+struct hash_map_header {
+    std::atomic<std::uint64_t> magic;  // Published last by the creator
+    std::uint32_t version;
+    std::uint32_t key_size;
+    std::uint32_t value_size;
+    std::uint32_t entry_size;
+    std::uint64_t bucket_count;        // Power of two
+
+    alignas(cache_line_size) std::atomic<std::uint64_t> size;  // Number of entries
+};
+
+constexpr std::uint64_t HASH_MAP_MAGIC = 0x70616d6873616873ULL;  // "shashmap"
+constexpr std::uint32_t HASH_MAP_VERSION = 1;
+
+// Bit i set when slot i of the bucket holds tag
+inline std::uint64_t match_tags(const std::uint64_t (&words)[HASH_MAP_BUCKET_SLOTS / 8],
+                                std::uint8_t tag) noexcept {
+    std::uint64_t mask = 0;
+#if defined(SLICK_SHM_HASH_MAP_SSE2)
+    const __m128i needle = _mm_set1_epi8(static_cast<char>(tag));
+    for (std::size_t i = 0; i < HASH_MAP_BUCKET_SLOTS / 16; ++i) {
+        __m128i group = _mm_set_epi64x(static_cast<long long>(words[2 * i + 1]),
+                                       static_cast<long long>(words[2 * i]));
+        auto bits = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(group, needle)));
+        mask |= static_cast<std::uint64_t>(bits) << (16 * i);
+    }
+#elif defined(SLICK_SHM_HASH_MAP_NEON)
+    static const std::uint8_t lane_bits[16] = {1, 2, 4, 8, 16, 32, 64, 128,
+                                               1, 2, 4, 8, 16, 32, 64, 128};
+    const uint8x16_t bit_values = vld1q_u8(lane_bits);
+    const uint8x16_t needle = vdupq_n_u8(tag);
+    for (std::size_t i = 0; i < HASH_MAP_BUCKET_SLOTS / 16; ++i) {
+        uint8x16_t group = vcombine_u8(vcreate_u8(words[2 * i]), vcreate_u8(words[2 * i + 1]));
+        uint8x16_t hits = vandq_u8(vceqq_u8(group, needle), bit_values);
+        std::uint64_t bits = static_cast<std::uint64_t>(vaddv_u8(vget_low_u8(hits))) |
+                             (static_cast<std::uint64_t>(vaddv_u8(vget_high_u8(hits))) << 8);
+        mask |= bits << (16 * i);
+    }
+#else
+    for (std::size_t slot = 0; slot < HASH_MAP_BUCKET_SLOTS; ++slot) {
+        if (static_cast<std::uint8_t>(words[slot / 8] >> (8 * (slot % 8))) == tag) {
+            mask |= std::uint64_t(1) << slot;
+        }
+    }
+#endif
+    return mask;
+}
+
+inline unsigned count_trailing_zeros(std::uint64_t value) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<unsigned>(__builtin_ctzll(value));
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+    unsigned long index;
+    _BitScanForward64(&index, value);
+    return static_cast<unsigned>(index);
+#else
+    unsigned index = 0;
+    while ((value & 1) == 0) {
+        value >>= 1;
+        ++index;
+    }
+    return index;
+#endif
+}
+
+// Finalizer of MurmurHash3: spreads weak hashes (std::hash of integers is the
+// identity on common implementations) over all bits
+constexpr std::uint64_t mix_hash(std::uint64_t h) noexcept {
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+}  // namespace detail
+
+// Result of shm_hash_map::insert()
+enum class insert_status {
+    inserted,  // The key was added
+    exists,    // The key was already present; its value was left unchanged
+    full       // No free slot left
+};
+
+/**
+ * @brief Fixed-capacity, insert-only hash table living in a named segment
+ *
+ * One process creates and fills the table; other processes attach with
+ * open_existing, which costs only a header check no matter how large the table
+ * is. Lookups are lock-free and only use acquire loads, so readers can attach
+ * with access_mode::read_only (the default).
+ *
+ * Open addressing over cache-line buckets of 64 one-byte tags holding 7 bits of
+ * the key's hash. A lookup compares a whole bucket of tags with SIMD (SSE2 or
+ * NEON, scalar elsewhere) and only touches the entries whose tag matches. Keys
+ * are never removed, so a bucket with a free slot ends the probe sequence.
+ *
+ * Writers claim a slot with a compare-and-swap on the bucket's tags, so several
+ * writers (in any processes attached read_write) may insert concurrently, and
+ * concurrent inserts of the same key store it exactly once.
+ *
+ * @code
+ * // Builder process
+ * shm_hash_map<std::uint64_t, std::uint32_t> ids("instrument_ids", 100000, create_only);
+ * ids.insert(instrument_id, book_slot);
+ *
+ * // Gateway processes
+ * shm_hash_map<std::uint64_t, std::uint32_t> ids("instrument_ids", open_existing);
+ * if (const std::uint32_t* slot = ids.find(instrument_id)) { ... }
+ * @endcode
+ *
+ * @tparam K Key type (trivially copyable)
+ * @tparam V Value type (trivially copyable)
+ * @tparam Hash Hash function. Must give the same result in every attached
+ *         process: std::hash qualifies for processes built with the same
+ *         standard library.
+ * @tparam KeyEqual Key comparison
+ *
+ * @note Values are written once, before the key becomes visible. Changing a value
+ *       in place afterwards is not synchronized by the table.
+ * @note A writer that dies between claiming a slot and publishing it leaves the
+ *       slot busy, and other writers probing past it wait forever.
+ */
+template <typename K, typename V, typename Hash = std::hash<K>,
+          typename KeyEqual = std::equal_to<K>>
+class shm_hash_map {
+    static_assert(std::is_trivially_copyable<K>::value,
+                  "shm_hash_map keys must be trivially copyable");
+    static_assert(std::is_trivially_copyable<V>::value,
+                  "shm_hash_map values must be trivially copyable");
+
+public:
+    using key_type = K;
+    using mapped_type = V;
+
+    /**
+     * @brief Default constructor - creates an invalid table
+     */
+    shm_hash_map() = default;
+
+    /**
+     * @brief Create a new table in a new segment
+     * @param name Name of the shared memory segment
+     * @param capacity Number of keys the table must hold (some headroom is added
+     *        to keep probe sequences short)
+     * @param tag create_only tag
+     * @param options Segment options (huge pages, prefault, lock, ...)
+     * @throws shared_memory_error if creation fails
+     */
+    shm_hash_map(const char* name, std::size_t capacity, create_only_t tag,
+                 const segment_options& options = segment_options()) {
+        (void)tag;
+        last_error_ = create_impl(name, capacity, options);
+        if (last_error_) {
+            throw shared_memory_error(last_error_);
+        }
+    }
+
+    /**
+     * @brief Attach to an existing table
+     * @param name Name of the shared memory segment
+     * @param tag open_existing tag
+     * @param mode Access mode (default: read_only; insert() needs read_write)
+     * @param options Segment options (mapping related options only)
+     * @throws shared_memory_error if the segment doesn't exist or is not a table of K, V
+     */
+    shm_hash_map(const char* name, open_existing_t tag,
+                 access_mode mode = access_mode::read_only,
+                 const segment_options& options = segment_options()) {
+        (void)tag;
+        last_error_ = open_impl(name, mode, options);
+        if (last_error_) {
+            throw shared_memory_error(last_error_);
+        }
+    }
+
+    /**
+     * @brief Create a new table - no-throw version
+     * @note Check is_valid() and last_error() after construction
+     */
+    shm_hash_map(const char* name, std::size_t capacity, create_only_t tag,
+                 const segment_options& options, const std::nothrow_t& nt) noexcept {
+        (void)tag;
+        (void)nt;
+        last_error_ = create_impl(name, capacity, options);
+    }
+
+    /**
+     * @brief Attach to an existing table - no-throw version
+     * @note Check is_valid() and last_error() after construction
+     */
+    shm_hash_map(const char* name, open_existing_t tag, access_mode mode,
+                 const segment_options& options, const std::nothrow_t& nt) noexcept {
+        (void)tag;
+        (void)nt;
+        last_error_ = open_impl(name, mode, options);
+    }
+
+    shm_hash_map(const shm_hash_map&) = delete;
+    shm_hash_map& operator=(const shm_hash_map&) = delete;
+
+    shm_hash_map(shm_hash_map&& other) noexcept {
+        *this = std::move(other);
+    }
+
+    shm_hash_map& operator=(shm_hash_map&& other) noexcept {
+        if (this != &other) {
+            shm_ = std::move(other.shm_);
+            header_ = other.header_;
+            buckets_ = other.buckets_;
+            entries_ = other.entries_;
+            bucket_mask_ = other.bucket_mask_;
+            last_error_ = other.last_error_;
+
+            other.header_ = nullptr;
+            other.buckets_ = nullptr;
+            other.entries_ = nullptr;
+            other.bucket_mask_ = 0;
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Add a key unless it is already present
+     * @note Requires a read_write mapping.
+     */
+    insert_status insert(const K& key, const V& value) {
+        const std::uint64_t h = hash_of(key);
+        const std::uint8_t tag = tag_of(h);
+        std::size_t index = static_cast<std::size_t>(h) & bucket_mask_;
+
+        for (std::size_t probe = 0; probe <= bucket_mask_; ++probe) {
+            detail::hash_map_bucket& bucket = buckets_[index];
+            for (;;) {
+                std::uint64_t words[detail::HASH_MAP_BUCKET_SLOTS / 8];
+                load_tags(bucket, words);
+                std::uint64_t empty = detail::match_tags(words, detail::HASH_MAP_EMPTY);
+
+                // An insert in flight may be for the same key: let it finish first
+                if (detail::match_tags(words, detail::HASH_MAP_BUSY) != 0) {
+                    detail::cpu_relax();
+                    continue;
+                }
+                if (find_in(index, words, tag, key) != nullptr) {
+                    return insert_status::exists;
+                }
+                if (empty == 0) {
+                    break;  // Bucket full, probe the next one
+                }
+
+                std::size_t slot = detail::count_trailing_zeros(empty);
+                if (!exchange_tag(bucket, slot, detail::HASH_MAP_EMPTY, detail::HASH_MAP_BUSY)) {
+                    continue;  // Another writer took the slot
+                }
+                entry& e = entries_[index * detail::HASH_MAP_BUCKET_SLOTS + slot];
+                std::memcpy(&e.key, &key, sizeof(K));
+                std::memcpy(&e.value, &value, sizeof(V));
+                while (!exchange_tag(bucket, slot, detail::HASH_MAP_BUSY, tag)) {
+                }
+                header_->size.fetch_add(1, std::memory_order_relaxed);
+                return insert_status::inserted;
+            }
+            index = (index + 1) & bucket_mask_;
+        }
+        return insert_status::full;
+    }
+
+    /**
+     * @brief Look up a key
+     * @return Pointer to the value in the segment, or nullptr if the key is absent
+     */
+    const V* find(const K& key) const noexcept {
+        const std::uint64_t h = hash_of(key);
+        const std::uint8_t tag = tag_of(h);
+        std::size_t index = static_cast<std::size_t>(h) & bucket_mask_;
+
+        for (std::size_t probe = 0; probe <= bucket_mask_; ++probe) {
+            std::uint64_t words[detail::HASH_MAP_BUCKET_SLOTS / 8];
+            load_tags(buckets_[index], words);
+            if (const V* value = find_in(index, words, tag, key)) {
+                return value;
+            }
+            if (detail::match_tags(words, detail::HASH_MAP_EMPTY) != 0) {
+                return nullptr;  // Keys never land past a bucket with a free slot
+            }
+            index = (index + 1) & bucket_mask_;
+        }
+        return nullptr;
+    }
+
+    bool contains(const K& key) const noexcept {
+        return find(key) != nullptr;
+    }
+
+    /**
+     * @brief Call fn(key, value) for every entry
+     */
+    template <typename Fn>
+    void for_each(Fn&& fn) const {
+        for (std::size_t index = 0; index <= bucket_mask_; ++index) {
+            std::uint64_t words[detail::HASH_MAP_BUCKET_SLOTS / 8];
+            load_tags(buckets_[index], words);
+            for (std::size_t slot = 0; slot < detail::HASH_MAP_BUCKET_SLOTS; ++slot) {
+                auto tag = static_cast<std::uint8_t>(words[slot / 8] >> (8 * (slot % 8)));
+                if (tag & 0x80) {
+                    const entry& e = entries_[index * detail::HASH_MAP_BUCKET_SLOTS + slot];
+                    fn(e.key, e.value);
+                }
+            }
+        }
+    }
+
+    // ========================================================================
+    // Accessors
+    // ========================================================================
+
+    std::size_t size() const noexcept {
+        return static_cast<std::size_t>(header_->size.load(std::memory_order_relaxed));
+    }
+
+    bool empty() const noexcept {
+        return size() == 0;
+    }
+
+    /**
+     * @brief Number of slots (more than the capacity asked for at creation)
+     */
+    std::size_t capacity() const noexcept {
+        return (bucket_mask_ + 1) * detail::HASH_MAP_BUCKET_SLOTS;
+    }
+
+    bool is_valid() const noexcept {
+        return header_ != nullptr;
+    }
+
+    std::error_code last_error() const noexcept {
+        return last_error_;
+    }
+
+    /**
+     * @brief The underlying shared memory segment
+     */
+    const shared_memory& segment() const noexcept {
+        return shm_;
+    }
+
+    /**
+     * @brief Segment size needed for a table holding capacity keys
+     */
+    static std::size_t required_size(std::size_t capacity) noexcept {
+        return entries_offset(bucket_count_for(capacity)) +
+               bucket_count_for(capacity) * detail::HASH_MAP_BUCKET_SLOTS * sizeof(entry);
+    }
+
+private:
+    struct entry {
+        K key;
+        V value;
+    };
+
+    shared_memory shm_;
+    detail::hash_map_header* header_ = nullptr;
+    detail::hash_map_bucket* buckets_ = nullptr;
+    entry* entries_ = nullptr;
+    std::size_t bucket_mask_ = 0;
+    std::error_code last_error_;
+
+    static std::uint64_t hash_of(const K& key) noexcept {
+        return detail::mix_hash(static_cast<std::uint64_t>(Hash{}(key)));
+    }
+
+    // Top 7 bits; the bucket index comes from the low bits
+    static std::uint8_t tag_of(std::uint64_t h) noexcept {
+        return static_cast<std::uint8_t>(0x80 | (h >> 57));
+    }
+
+    // Keep at least 1/8 of the slots free, in whole power-of-two buckets
+    // (0 if capacity is too large for that)
+    static std::size_t bucket_count_for(std::size_t capacity) noexcept {
+        if (capacity > std::numeric_limits<std::size_t>::max() / 2) {
+            return 0;
+        }
+        std::size_t slots = capacity + capacity / 7 + 1;
+        return detail::round_up_pow2((slots + detail::HASH_MAP_BUCKET_SLOTS - 1) /
+                                     detail::HASH_MAP_BUCKET_SLOTS);
+    }
+
+    static constexpr std::size_t buckets_offset() noexcept {
+        return detail::align_up(sizeof(detail::hash_map_header), alignof(detail::hash_map_bucket));
+    }
+
+    static std::size_t entries_offset(std::size_t bucket_count) noexcept {
+        return detail::align_up(buckets_offset() + bucket_count * sizeof(detail::hash_map_bucket),
+                                alignof(entry) > detail::cache_line_size ? alignof(entry)
+                                                                         : detail::cache_line_size);
+    }
+
+    static void load_tags(const detail::hash_map_bucket& bucket,
+                          std::uint64_t (&words)[detail::HASH_MAP_BUCKET_SLOTS / 8]) noexcept {
+        for (std::size_t i = 0; i < detail::HASH_MAP_BUCKET_SLOTS / 8; ++i) {
+            words[i] = bucket.tags[i].load(std::memory_order_acquire);
+        }
+    }
+
+    const V* find_in(std::size_t index, const std::uint64_t (&words)[detail::HASH_MAP_BUCKET_SLOTS / 8],
+                     std::uint8_t tag, const K& key) const noexcept {
+        std::uint64_t hits = detail::match_tags(words, tag);
+        while (hits != 0) {
+            std::size_t slot = detail::count_trailing_zeros(hits);
+            const entry& e = entries_[index * detail::HASH_MAP_BUCKET_SLOTS + slot];
+            if (KeyEqual{}(e.key, key)) {
+                return &e.value;
+            }
+            hits &= hits - 1;
+        }
+        return nullptr;
+    }
+
+    // Replace one tag byte if it still holds from
+    static bool exchange_tag(detail::hash_map_bucket& bucket, std::size_t slot, std::uint8_t from,
+                             std::uint8_t to) noexcept {
+        std::atomic<std::uint64_t>& word = bucket.tags[slot / 8];
+        const unsigned shift = static_cast<unsigned>(8 * (slot % 8));
+        std::uint64_t current = word.load(std::memory_order_relaxed);
+        for (;;) {
+            if (static_cast<std::uint8_t>(current >> shift) != from) {
+                return false;
+            }
+            std::uint64_t desired = (current & ~(std::uint64_t(0xff) << shift)) |
+                                    (static_cast<std::uint64_t>(to) << shift);
+            if (word.compare_exchange_weak(current, desired, std::memory_order_acq_rel,
+                                           std::memory_order_relaxed)) {
+                return true;
+            }
+        }
+    }
+
+    std::error_code create_impl(const char* name, std::size_t capacity,
+                                const segment_options& options) {
+        if (capacity == 0) {
+            return make_error_code(errc::invalid_size);
+        }
+        std::size_t bucket_count = bucket_count_for(capacity);
+        constexpr std::size_t bucket_bytes =
+            sizeof(detail::hash_map_bucket) + detail::HASH_MAP_BUCKET_SLOTS * sizeof(entry);
+        if (bucket_count == 0 ||
+            bucket_count > std::numeric_limits<std::size_t>::max() / 2 / bucket_bytes) {
+            return make_error_code(errc::invalid_size);
+        }
+
+        shared_memory shm(name, required_size(capacity), create_only, access_mode::read_write,
+                          options, std::nothrow);
+        if (!shm.is_valid()) {
+            return shm.last_error();
+        }
+
+        // The segment is zero-filled, so every tag starts out empty
+        auto* header = static_cast<detail::hash_map_header*>(shm.data());
+        header->version = detail::HASH_MAP_VERSION;
+        header->key_size = static_cast<std::uint32_t>(sizeof(K));
+        header->value_size = static_cast<std::uint32_t>(sizeof(V));
+        header->entry_size = static_cast<std::uint32_t>(sizeof(entry));
+        header->bucket_count = bucket_count;
+        header->size.store(0, std::memory_order_relaxed);
+        header->magic.store(detail::HASH_MAP_MAGIC, std::memory_order_release);
+
+        attach(std::move(shm), bucket_count);
+        return {};
+    }
+
+    std::error_code open_impl(const char* name, access_mode mode,
+                              const segment_options& options) {
+        shared_memory shm(name, open_existing, mode, options, std::nothrow);
+        if (!shm.is_valid()) {
+            return shm.last_error();
+        }
+
+        if (shm.size() < sizeof(detail::hash_map_header)) {
+            return make_error_code(errc::incompatible_layout);
+        }
+        auto* header = static_cast<const detail::hash_map_header*>(shm.data());
+        if (header->magic.load(std::memory_order_acquire) != detail::HASH_MAP_MAGIC ||
+            header->version != detail::HASH_MAP_VERSION || header->key_size != sizeof(K) ||
+            header->value_size != sizeof(V) || header->entry_size != sizeof(entry)) {
+            return make_error_code(errc::incompatible_layout);
+        }
+        std::size_t bucket_count = static_cast<std::size_t>(header->bucket_count);
+        if (bucket_count == 0 || (bucket_count & (bucket_count - 1)) != 0 ||
+            shm.size() < entries_offset(bucket_count) +
+                             bucket_count * detail::HASH_MAP_BUCKET_SLOTS * sizeof(entry)) {
+            return make_error_code(errc::incompatible_layout);
+        }
+
+        attach(std::move(shm), bucket_count);
+        return {};
+    }
+
+    void attach(shared_memory&& shm, std::size_t bucket_count) {
+        shm_ = std::move(shm);
+        // Lookups only ever load through these pointers, which is fine on a
+        // read-only mapping
+        auto* base = static_cast<char*>(const_cast<void*>(static_cast<const shared_memory&>(shm_).data()));
+        header_ = reinterpret_cast<detail::hash_map_header*>(base);
+        buckets_ = reinterpret_cast<detail::hash_map_bucket*>(base + buckets_offset());
+        entries_ = reinterpret_cast<entry*>(base + entries_offset(bucket_count));
+        bucket_mask_ = bucket_count - 1;
+    }
+};
+
+}  // namespace shm
+}  // namespace slick
@@ -0,0 +1,422 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 Slick Quant
+
+#pragma once
+
+#include "shared_memory.hpp"
+#include "stats.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <type_traits>
+
+namespace slick {
+namespace shm {
+
+namespace detail {
+
+// In-segment control block of an spsc_ring. head and tail live on their own
+// cache lines so the producer and the consumer never write to the same line.
+struct spsc_ring_header {
+    std::atomic<std::uint64_t> magic;  // Published last by the creator
+    std::uint32_t version;
+    std::uint32_t element_size;
+    std::uint64_t capacity;            // Power of two
+
+    alignas(cache_line_size) std::atomic<std::uint64_t> head;  // Next write index (producer)
+    alignas(cache_line_size) std::atomic<std::uint64_t> tail;  // Next read index (consumer)
+
+    stats_block stats;  // See stats.hpp
+};
+
+constexpr std::uint64_t SPSC_RING_MAGIC = 0x676e697263737073ULL;  // "spscring"
+constexpr std::uint32_t SPSC_RING_VERSION = 1;
+
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free,
+              "spsc_ring requires lock-free 64-bit atomics for cross-process use");
+
+}  // namespace detail
+
+/**
+ * @brief Lock-free single-producer/single-consumer queue living in a named segment
+ *
+ * The producer and the consumer attach to the same segment by name, usually from
+ * different processes: one side creates the ring with create_only, the other opens
+ * it with open_existing. Elements are copied in and out with memcpy, so T must be
+ * trivially copyable.
+ *
+ * Each side keeps a local copy of the other side's index and only re-reads the
+ * shared index when the cached one says the ring is full (producer) or empty
+ * (consumer), which keeps cross-core traffic to a minimum.
+ *
+ * Thread safety: exactly one thread may push and exactly one thread may pop at a
+ * time, across all processes attached to the ring.
+ *
+ * @note The consumer needs a read_write mapping because it publishes its read index.
+ * @note Open the ring only after the creator's constructor has returned; opening a
+ *       segment that is not (yet) a ring fails with errc::incompatible_layout.
+ */
+template <typename T>
+class spsc_ring {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "spsc_ring elements must be trivially copyable");
+
+public:
+    using value_type = T;
+
+    /**
+     * @brief Default constructor - creates an invalid ring
+     */
+    spsc_ring() = default;
+
+    /**
+     * @brief Create a new ring in a new segment
+     * @param name Name of the shared memory segment
+     * @param capacity Minimum number of elements (rounded up to a power of two)
+     * @param tag create_only tag
+     * @param options Segment options (huge pages, prefault, lock, ...)
+     * @throws shared_memory_error if creation fails
+     */
+    spsc_ring(const char* name, std::size_t capacity, create_only_t tag,
+              const segment_options& options = segment_options()) {
+        (void)tag;
+        last_error_ = create_impl(name, capacity, options);
+        if (last_error_) {
+            throw shared_memory_error(last_error_);
+        }
+    }
+
+    /**
+     * @brief Attach to an existing ring
+     * @param name Name of the shared memory segment
+     * @param tag open_existing tag
+     * @param options Segment options (mapping related options only)
+     * @throws shared_memory_error if the segment doesn't exist or is not a ring of T
+     */
+    spsc_ring(const char* name, open_existing_t tag,
+              const segment_options& options = segment_options()) {
+        (void)tag;
+        last_error_ = open_impl(name, options);
+        if (last_error_) {
+            throw shared_memory_error(last_error_);
+        }
+    }
+
+    /**
+     * @brief Create a new ring - no-throw version
+     * @note Check is_valid() and last_error() after construction
+     */
+    spsc_ring(const char* name, std::size_t capacity, create_only_t tag,
+              const segment_options& options, const std::nothrow_t& nt) noexcept {
+        (void)tag;
+        (void)nt;
+        last_error_ = create_impl(name, capacity, options);
+    }
+
+    /**
+     * @brief Attach to an existing ring - no-throw version
+     * @note Check is_valid() and last_error() after construction
+     */
+    spsc_ring(const char* name, open_existing_t tag, const segment_options& options,
+              const std::nothrow_t& nt) noexcept {
+        (void)tag;
+        (void)nt;
+        last_error_ = open_impl(name, options);
+    }
+
+    spsc_ring(const spsc_ring&) = delete;
+    spsc_ring& operator=(const spsc_ring&) = delete;
+
+    spsc_ring(spsc_ring&& other) noexcept {
+        *this = std::move(other);
+    }
+
+    ~spsc_ring() {
+        count_detach();
+    }
+
+    spsc_ring& operator=(spsc_ring&& other) noexcept {
+        if (this != &other) {
+            count_detach();
+            shm_ = std::move(other.shm_);
+            header_ = other.header_;
+            slots_ = other.slots_;
+            capacity_ = other.capacity_;
+            mask_ = other.mask_;
+            last_error_ = other.last_error_;
+            producer_ = other.producer_;
+            consumer_ = other.consumer_;
+
+            other.header_ = nullptr;
+            other.slots_ = nullptr;
+            other.capacity_ = 0;
+            other.mask_ = 0;
+        }
+        return *this;
+    }
+
+    // ========================================================================
+    // Producer side
+    // ========================================================================
+
+    /**
+     * @brief Push one element
+     * @return false if the ring is full
+     */
+    bool try_push(const T& item) noexcept {
+        std::uint64_t head = header_->head.load(std::memory_order_relaxed);
+        if (head - producer_.cached_tail >= capacity_) {
+            producer_.cached_tail = header_->tail.load(std::memory_order_acquire);
+            if (head - producer_.cached_tail >= capacity_) {
+                detail::stat_add(header_->stats.full_events);
+                return false;
+            }
+        }
+        std::memcpy(&slots_[head & mask_], &item, sizeof(T));
+        header_->head.store(head + 1, std::memory_order_release);
+        detail::stat_add(header_->stats.enqueues);
+        return true;
+    }
+
+    /**
+     * @brief Push up to count elements with a single index update
+     * @return Number of elements pushed (0 if the ring is full)
+     */
+    std::size_t try_push_n(const T* items, std::size_t count) noexcept {
+        std::uint64_t head = header_->head.load(std::memory_order_relaxed);
+        std::uint64_t free_slots = capacity_ - (head - producer_.cached_tail);
+        if (free_slots < count) {
+            producer_.cached_tail = header_->tail.load(std::memory_order_acquire);
+            free_slots = capacity_ - (head - producer_.cached_tail);
+        }
+        std::size_t n = count < free_slots ? count : static_cast<std::size_t>(free_slots);
+        if (n == 0) {
+            detail::stat_add(header_->stats.full_events);
+            return 0;
+        }
+
+        std::size_t index = static_cast<std::size_t>(head & mask_);
+        std::size_t first = n < capacity_ - index ? n : capacity_ - index;
+        std::memcpy(&slots_[index], items, first * sizeof(T));
+        std::memcpy(&slots_[0], items + first, (n - first) * sizeof(T));
+
+        header_->head.store(head + n, std::memory_order_release);
+        detail::stat_add(header_->stats.enqueues, n);
+        return n;
+    }
+
+    // ========================================================================
+    // Consumer side
+    // ========================================================================
+
+    /**
+     * @brief Pop one element
+     * @return false if the ring is empty
+     */
+    bool try_pop(T& item) noexcept {
+        std::uint64_t tail = header_->tail.load(std::memory_order_relaxed);
+        if (tail == consumer_.cached_head) {
+            consumer_.cached_head = header_->head.load(std::memory_order_acquire);
+            if (tail == consumer_.cached_head) {
+                detail::stat_add(header_->stats.empty_events);
+                return false;
+            }
+        }
+        std::memcpy(&item, &slots_[tail & mask_], sizeof(T));
+        header_->tail.store(tail + 1, std::memory_order_release);
+        count_dequeue(1, consumer_.cached_head - tail);
+        return true;
+    }
+
+    /**
+     * @brief Pop up to max_count elements with a single index update
+     * @return Number of elements popped (0 if the ring is empty)
+     */
+    std::size_t try_pop_n(T* out, std::size_t max_count) noexcept {
+        std::uint64_t tail = header_->tail.load(std::memory_order_relaxed);
+        std::uint64_t available = consumer_.cached_head - tail;
+        if (available < max_count) {
+            consumer_.cached_head = header_->head.load(std::memory_order_acquire);
+            available = consumer_.cached_head - tail;
+        }
+        std::size_t n = max_count < available ? max_count : static_cast<std::size_t>(available);
+        if (n == 0) {
+            detail::stat_add(header_->stats.empty_events);
+            return 0;
+        }
+
+        std::size_t index = static_cast<std::size_t>(tail & mask_);
+        std::size_t first = n < capacity_ - index ? n : capacity_ - index;
+        std::memcpy(out, &slots_[index], first * sizeof(T));
+        std::memcpy(out + first, &slots_[0], (n - first) * sizeof(T));
+
+        header_->tail.store(tail + n, std::memory_order_release);
+        count_dequeue(n, available);
+        return n;
+    }
+
+    // ========================================================================
+    // Accessors
+    // ========================================================================
+
+    /**
+     * @brief Approximate number of queued elements (exact if called by producer or consumer
+     *        while the other side is idle)
+     */
+    std::size_t size_approx() const noexcept {
+        std::uint64_t tail = header_->tail.load(std::memory_order_acquire);
+        std::uint64_t head = header_->head.load(std::memory_order_acquire);
+        return head > tail ? static_cast<std::size_t>(head - tail) : 0;
+    }
+
+    bool empty() const noexcept {
+        return size_approx() == 0;
+    }
+
+    /**
+     * @brief Counters of the ring (see stats.hpp); max_consumer_lag is in elements
+     */
+    segment_stats stats_snapshot() const noexcept {
+        return header_ ? detail::load_stats(header_->stats) : segment_stats();
+    }
+
+    /**
+     * @brief Number of slots (a power of two)
+     */
+    std::size_t capacity() const noexcept {
+        return capacity_;
+    }
+
+    bool is_valid() const noexcept {
+        return header_ != nullptr;
+    }
+
+    std::error_code last_error() const noexcept {
+        return last_error_;
+    }
+
+    /**
+     * @brief The underlying shared memory segment
+     */
+    const shared_memory& segment() const noexcept {
+        return shm_;
+    }
+
+    /**
+     * @brief Segment size needed for a ring of the given capacity
+     */
+    static std::size_t required_size(std::size_t capacity) noexcept {
+        return slots_offset() + detail::round_up_pow2(capacity) * sizeof(T);
+    }
+
+private:
+    // Process-local state of each side, on separate cache lines in case a
+    // producer thread and a consumer thread share one spsc_ring object
+    struct alignas(detail::cache_line_size) producer_state {
+        std::uint64_t cached_tail = 0;
+    };
+    struct alignas(detail::cache_line_size) consumer_state {
+        std::uint64_t cached_head = 0;
+    };
+
+    shared_memory shm_;
+    detail::spsc_ring_header* header_ = nullptr;
+    T* slots_ = nullptr;
+    std::size_t capacity_ = 0;
+    std::size_t mask_ = 0;
+    std::error_code last_error_;
+    producer_state producer_;
+    consumer_state consumer_;
+
+    // Slots start on their own cache line, after the consumer's tail
+    static constexpr std::size_t slots_offset() noexcept {
+        return detail::align_up(sizeof(detail::spsc_ring_header),
+                                alignof(T) > detail::cache_line_size ? alignof(T)
+                                                                     : detail::cache_line_size);
+    }
+
+    // Elements the consumer saw queued (including the ones it took)
+    void count_dequeue(std::uint64_t n, std::uint64_t lag) noexcept {
+        detail::stat_add(header_->stats.dequeues, n);
+        detail::stat_max(header_->stats.max_consumer_lag, lag);
+    }
+
+    void count_detach() noexcept {
+        if (header_ != nullptr) {
+            detail::stat_add_shared(header_->stats.detaches);
+        }
+    }
+
+    std::error_code create_impl(const char* name, std::size_t capacity,
+                                const segment_options& options) {
+        if (capacity == 0) {
+            return make_error_code(errc::invalid_size);
+        }
+        capacity = detail::round_up_pow2(capacity);
+        if (capacity == 0 ||
+            capacity > (std::numeric_limits<std::size_t>::max() - slots_offset()) / sizeof(T)) {
+            return make_error_code(errc::invalid_size);
+        }
+
+        shared_memory shm(name, required_size(capacity), create_only, access_mode::read_write,
+                          options, std::nothrow);
+        if (!shm.is_valid()) {
+            return shm.last_error();
+        }
+
+        // The segment is zero-filled: initialize the plain fields, then publish
+        // the magic so openers only ever see a complete header
+        auto* header = static_cast<detail::spsc_ring_header*>(shm.data());
+        header->version = detail::SPSC_RING_VERSION;
+        header->element_size = static_cast<std::uint32_t>(sizeof(T));
+        header->capacity = capacity;
+        header->head.store(0, std::memory_order_relaxed);
+        header->tail.store(0, std::memory_order_relaxed);
+        header->magic.store(detail::SPSC_RING_MAGIC, std::memory_order_release);
+
+        attach(std::move(shm), capacity);
+        return {};
+    }
+
+    std::error_code open_impl(const char* name, const segment_options& options) {
+        shared_memory shm(name, open_existing, access_mode::read_write, options, std::nothrow);
+        if (!shm.is_valid()) {
+            return shm.last_error();
+        }
+
+        if (shm.size() < sizeof(detail::spsc_ring_header)) {
+            return make_error_code(errc::incompatible_layout);
+        }
+        auto* header = static_cast<detail::spsc_ring_header*>(shm.data());
+        if (header->magic.load(std::memory_order_acquire) != detail::SPSC_RING_MAGIC ||
+            header->version != detail::SPSC_RING_VERSION ||
+            header->element_size != sizeof(T)) {
+            return make_error_code(errc::incompatible_layout);
+        }
+        std::size_t capacity = static_cast<std::size_t>(header->capacity);
+        if (capacity == 0 || (capacity & (capacity - 1)) != 0 ||
+            shm.size() < required_size(capacity)) {
+            return make_error_code(errc::incompatible_layout);
+        }
+
+        attach(std::move(shm), capacity);
+        return {};
+    }
+
+    void attach(shared_memory&& shm, std::size_t capacity) {
+        shm_ = std::move(shm);
+        header_ = static_cast<detail::spsc_ring_header*>(shm_.data());
+        slots_ = reinterpret_cast<T*>(static_cast<char*>(shm_.data()) + slots_offset());
+        capacity_ = capacity;
+        mask_ = capacity - 1;
+        producer_.cached_tail = header_->tail.load(std::memory_order_acquire);
+        consumer_.cached_head = header_->head.load(std::memory_order_acquire);
+        detail::stat_add_shared(header_->stats.attaches);
+    }
+};
+
+}  // namespace shm
+}  // namespace slick
@@ -0,0 +1,118 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 Slick Quant
+
+#pragma once
+
+#include "detail/platform.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace slick {
+namespace shm {
+
+/**
+ * Hot-path statistics.
+ *
+ * managed_segment, the rings and epoch_buffer reserve a block of counters in
+ * their segment header. The counters are only updated when SLICK_SHM_ENABLE_STATS
+ * is defined (CMake option of the same name), so a default build pays nothing on
+ * the hot path. The block is part of the header in every build, so processes built with
+ * and without stats can share a segment, and a read_only mapping can read the
+ * counters (stats_snapshot(), slick-shm-stat) without writing to the segment.
+ *
+ * Counters written by a single side (the producer or the consumer of an SPSC
+ * ring) are updated with a plain load and store; counters shared by several
+ * processes use atomic read-modify-write operations.
+ */
+
+#ifdef SLICK_SHM_ENABLE_STATS
+constexpr bool stats_enabled = true;
+#else
+constexpr bool stats_enabled = false;
+#endif
+
+/**
+ * @brief Copy of the counters of a segment, returned by stats_snapshot()
+ * @note Counters are read one at a time, so a snapshot taken while the segment is
+ *       in use is not a consistent cut across counters.
+ */
+struct segment_stats {
+    std::uint64_t attaches = 0;          // Read-write attaches, including the creator
+    std::uint64_t detaches = 0;          // Read-write attachments that were closed
+    std::uint64_t enqueues = 0;          // Elements or messages published
+    std::uint64_t dequeues = 0;          // Elements or messages consumed
+    std::uint64_t full_events = 0;       // Pushes refused because the ring was full
+    std::uint64_t empty_events = 0;      // Pops that found the ring empty
+    std::uint64_t waits = 0;             // Waits that blocked in the kernel (futex)
+    std::uint64_t wakes = 0;             // Wake-ups issued to the kernel
+    std::uint64_t max_consumer_lag = 0;  // Most elements (bytes for message_ring) seen queued by a consumer
+};
+
+namespace detail {
+
+// In-segment counters. The producer and consumer counters have their own cache
+// lines, so enabling stats adds no sharing between the two sides.
+struct stats_block {
+    alignas(cache_line_size) std::atomic<std::uint64_t> attaches;
+    std::atomic<std::uint64_t> detaches;
+    std::atomic<std::uint64_t> waits;
+    std::atomic<std::uint64_t> wakes;
+
+    alignas(cache_line_size) std::atomic<std::uint64_t> enqueues;  // Producer
+    std::atomic<std::uint64_t> full_events;
+
+    alignas(cache_line_size) std::atomic<std::uint64_t> dequeues;  // Consumer
+    std::atomic<std::uint64_t> empty_events;
+    std::atomic<std::uint64_t> max_consumer_lag;
+};
+
+// Counter with a single writer
+inline void stat_add(std::atomic<std::uint64_t>& counter, std::uint64_t n = 1) noexcept {
+    if (stats_enabled) {
+        counter.store(counter.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+    }
+}
+
+// Counter written by several threads or processes
+inline void stat_add_shared(std::atomic<std::uint64_t>& counter, std::uint64_t n = 1) noexcept {
+    if (stats_enabled) {
+        counter.fetch_add(n, std::memory_order_relaxed);
+    }
+}
+
+// Maximum with a single writer
+inline void stat_max(std::atomic<std::uint64_t>& counter, std::uint64_t value) noexcept {
+    if (stats_enabled && value > counter.load(std::memory_order_relaxed)) {
+        counter.store(value, std::memory_order_relaxed);
+    }
+}
+
+// Maximum written by several threads or processes
+inline void stat_max_shared(std::atomic<std::uint64_t>& counter, std::uint64_t value) noexcept {
+    if (stats_enabled) {
+        std::uint64_t current = counter.load(std::memory_order_relaxed);
+        while (value > current &&
+               !counter.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+        }
+    }
+}
+
+inline segment_stats load_stats(const stats_block& block) noexcept {
+    segment_stats stats;
+    stats.attaches = block.attaches.load(std::memory_order_relaxed);
+    stats.detaches = block.detaches.load(std::memory_order_relaxed);
+    stats.enqueues = block.enqueues.load(std::memory_order_relaxed);
+    stats.dequeues = block.dequeues.load(std::memory_order_relaxed);
+    stats.full_events = block.full_events.load(std::memory_order_relaxed);
+    stats.empty_events = block.empty_events.load(std::memory_order_relaxed);
+    stats.waits = block.waits.load(std::memory_order_relaxed);
+    stats.wakes = block.wakes.load(std::memory_order_relaxed);
+    stats.max_consumer_lag = block.max_consumer_lag.load(std::memory_order_relaxed);
+    return stats;
+}
+
+}  // namespace detail
+
+}  // namespace shm
+}  // namespace slick
@@ -0,0 +1,236 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 Slick Quant
+
+#pragma once
+
+#include "detail/platform.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+#ifdef __has_include
+#if __has_include(<version>)
+#include <version>
+#endif
+#endif
+
+#if defined(__cpp_lib_span)
+#include <span>
+#endif
+#if defined(__cpp_lib_mdspan)
+#include <mdspan>
+#endif
+
+namespace slick {
+namespace shm {
+
+/**
+ * Typed views of a mapped segment, returned by as_array() and as_matrix() of
+ * shared_memory and shared_memory_view.
+ *
+ * Size and alignment are checked once, when the view is made; element access
+ * is unchecked. The Align parameter promises the alignment of the first
+ * element to the compiler (std::assume_aligned or __builtin_assume_aligned),
+ * so loops over data() / begin() can use aligned vector loads.
+ */
+
+namespace detail {
+
+// Tell the compiler p is aligned to Align bytes
+template <std::size_t Align, typename T>
+inline T* assume_aligned(T* p) noexcept {
+#if defined(__cpp_lib_assume_aligned)
+    return std::assume_aligned<Align>(p);
+#elif defined(__GNUC__) || defined(__clang__)
+    return static_cast<T*>(__builtin_assume_aligned(p, Align));
+#elif defined(_MSC_VER)
+    __assume(reinterpret_cast<std::uintptr_t>(p) % Align == 0);
+    return p;
+#else
+    return p;
+#endif
+}
+
+template <typename T, std::size_t Align>
+struct typed_view_traits {
+    static_assert(std::is_trivially_copyable<typename std::remove_const<T>::type>::value,
+                  "typed views of shared memory need trivially copyable types");
+    static_assert(Align >= alignof(T), "alignment is below the alignment of the type");
+    static_assert((Align & (Align - 1)) == 0, "alignment must be a power of two");
+};
+
+// First of count elements of T at offset from base, or nullptr if the range
+// doesn't fit in bytes or isn't aligned to Align
+template <typename T, std::size_t Align, typename Byte>
+inline T* typed_pointer(Byte* base, std::size_t bytes, std::size_t offset,
+                        std::size_t count) noexcept {
+    (void)typed_view_traits<T, Align>();
+    if (base == nullptr || count == 0 || offset > bytes ||
+        count > (bytes - offset) / sizeof(T)) {
+        return nullptr;
+    }
+    Byte* p = base + offset;
+    if (reinterpret_cast<std::uintptr_t>(p) % Align != 0) {
+        return nullptr;
+    }
+    return std::launder(reinterpret_cast<T*>(p));
+}
+
+// Elements of T that fit between offset and the end of the region
+template <typename T>
+inline std::size_t typed_count(std::size_t bytes, std::size_t offset) noexcept {
+    return offset < bytes ? (bytes - offset) / sizeof(T) : 0;
+}
+
+}  // namespace detail
+
+/**
+ * @brief Contiguous elements in a segment (a std::span before C++20)
+ * @tparam Align Alignment of the first element, checked by as_array()
+ */
+template <typename T, std::size_t Align = alignof(T)>
+class array_view {
+public:
+    using element_type = T;
+    using value_type = typename std::remove_const<T>::type;
+    using size_type = std::size_t;
+    using pointer = T*;
+    using reference = T&;
+    using iterator = T*;
+    static constexpr std::size_t alignment = Align;
+
+    array_view() noexcept = default;
+    array_view(T* data, std::size_t size) noexcept : data_(data), size_(size) {}
+
+    // A mutable view converts to a read-only one
+    template <typename U, std::size_t A,
+              typename = typename std::enable_if<std::is_same<const U, T>::value &&
+                                                 A >= Align>::type>
+    array_view(const array_view<U, A>& other) noexcept : data_(other.data()), size_(other.size()) {}
+
+    T* data() const noexcept {
+        return data_ ? detail::assume_aligned<Align>(data_) : nullptr;
+    }
+
+    std::size_t size() const noexcept {
+        return size_;
+    }
+
+    std::size_t size_bytes() const noexcept {
+        return size_ * sizeof(T);
+    }
+
+    bool empty() const noexcept {
+        return size_ == 0;
+    }
+
+    T& operator[](std::size_t i) const noexcept {
+        return data()[i];
+    }
+
+    T* begin() const noexcept {
+        return data();
+    }
+
+    T* end() const noexcept {
+        return data() + size_;
+    }
+
+#if defined(__cpp_lib_span)
+    operator std::span<T>() const noexcept {
+        return std::span<T>(data_, size_);
+    }
+#endif
+
+private:
+    T* data_ = nullptr;
+    std::size_t size_ = 0;
+};
+
+/**
+ * @brief Row-major rows x cols elements in a segment (a 2-D std::mdspan before C++23)
+ * @tparam Align Alignment of the first element, checked by as_matrix()
+ */
+template <typename T, std::size_t Align = alignof(T)>
+class matrix_view {
+public:
+    using element_type = T;
+    using value_type = typename std::remove_const<T>::type;
+    static constexpr std::size_t alignment = Align;
+
+    matrix_view() noexcept = default;
+    matrix_view(T* data, std::size_t rows, std::size_t cols) noexcept
+        : data_(data), rows_(rows), cols_(cols) {}
+
+    T* data() const noexcept {
+        return data_ ? detail::assume_aligned<Align>(data_) : nullptr;
+    }
+
+    std::size_t rows() const noexcept {
+        return rows_;
+    }
+
+    std::size_t cols() const noexcept {
+        return cols_;
+    }
+
+    std::size_t size() const noexcept {
+        return rows_ * cols_;
+    }
+
+    bool is_valid() const noexcept {
+        return data_ != nullptr;
+    }
+
+    T& operator()(std::size_t row, std::size_t col) const noexcept {
+        return data()[row * cols_ + col];
+    }
+
+    // Row r; rows only share the matrix alignment if each row's size in bytes is a multiple of it
+    array_view<T> row(std::size_t r) const noexcept {
+        return array_view<T>(data_ + r * cols_, cols_);
+    }
+
+    // All elements, row after row
+    array_view<T, Align> elements() const noexcept {
+        return array_view<T, Align>(data_, rows_ * cols_);
+    }
+
+#if defined(__cpp_lib_mdspan)
+    std::mdspan<T, std::dextents<std::size_t, 2>> to_mdspan() const noexcept {
+        return std::mdspan<T, std::dextents<std::size_t, 2>>(data_, rows_, cols_);
+    }
+#endif
+
+private:
+    T* data_ = nullptr;
+    std::size_t rows_ = 0;
+    std::size_t cols_ = 0;
+};
+
+namespace detail {
+
+template <typename T, std::size_t Align, typename Byte>
+inline array_view<T, Align> make_array_view(Byte* base, std::size_t bytes, std::size_t offset,
+                                            std::size_t count) noexcept {
+    T* p = typed_pointer<T, Align>(base, bytes, offset, count);
+    return p ? array_view<T, Align>(p, count) : array_view<T, Align>();
+}
+
+template <typename T, std::size_t Align, typename Byte>
+inline matrix_view<T, Align> make_matrix_view(Byte* base, std::size_t bytes, std::size_t offset,
+                                              std::size_t rows, std::size_t cols) noexcept {
+    if (cols != 0 && rows > SIZE_MAX / cols) {
+        return matrix_view<T, Align>();
+    }
+    T* p = typed_pointer<T, Align>(base, bytes, offset, rows * cols);
+    return p ? matrix_view<T, Align>(p, rows, cols) : matrix_view<T, Align>();
+}
+
+}  // namespace detail
+
+}  // namespace shm
+}  // namespace slick
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 
 namespace slick {
 namespace shm {
@@ -21,6 +22,89 @@ enum class create_mode {
     open_always       // Always create (truncate if exists)
 };
 
+// Huge page backing policy for newly created segments
+enum class huge_pages {
+    none,        // Standard pages (default)
+    preferred,   // Use huge pages if available, fall back to standard pages otherwise
+    required     // Fail with errc::huge_pages_unavailable if huge pages cannot be used
+};
+
+// Memory locking policy for a mapping
+enum class memory_lock {
+    none,       // Pages may be swapped out (default)
+    lock,       // Lock all pages into RAM (faults them in immediately)
+    on_fault    // Lock pages as they are first touched (Linux mlock2(MLOCK_ONFAULT))
+};
+
+// NUMA placement policy for the pages of a mapping
+enum class numa_policy {
+    none,        // First-touch placement (default)
+    bind,        // Allocate only on the nodes in numa_nodes
+    interleave,  // Interleave pages across the nodes in numa_nodes
+    preferred    // Prefer the lowest node in numa_nodes, fall back to others
+};
+
+// Who removes a named segment
+enum class segment_lifetime {
+    manual,      // Stays until remove() is called, also after every process exited (default)
+    ref_counted  // Removed when the last process using it detaches, or by sweep() after a crash
+};
+
+// Options controlling how a segment is created and mapped
+struct segment_options {
+    // Huge page policy (only honored when this call creates the segment)
+    huge_pages huge_page_policy = huge_pages::none;
+
+    // Requested huge page size in bytes, e.g. 2 MiB or 1 GiB (0 = system default)
+    std::size_t huge_page_size = 0;
+
+    // Pre-fault the whole mapping during construction so that first accesses
+    // don't take page faults; construction fails if that fails
+    bool prefault = false;
+
+    // Lock the mapping into RAM during construction so it can't be swapped out
+    memory_lock lock = memory_lock::none;
+
+    // NUMA placement policy applied to the mapping before any page is faulted
+    numa_policy numa = numa_policy::none;
+
+    // Bit mask of NUMA nodes for the policy (bit N = node N)
+    std::uint64_t numa_nodes = 0;
+
+    // Map the segment twice, back-to-back, so that data()[size() + i] aliases
+    // data()[i] and ring buffers never have to split an access at the end.
+    // The size is rounded up to the page size (allocation granularity on Windows)
+    bool mirror = false;
+
+    // Map a regular file instead of a shared memory object. The name is a file
+    // system path, and the contents persist across restarts (see flush())
+    bool file_backed = false;
+
+    // Map a file on a DAX (persistent memory) file system with MAP_SYNC, so that
+    // data flushed from the CPU caches is durable without msync(). Linux only;
+    // other file systems fail with errc::not_supported
+    bool sync_mapping = false;
+
+    // Map the segment at this address (nullptr lets the system choose), so that
+    // raw pointers into it are valid in every process mapping it there. Must be
+    // page aligned (allocation granularity aligned on Windows). Fails with
+    // errc::address_in_use if anything is already mapped in the range
+    void* base_address = nullptr;
+
+    // Open a private copy-on-write mapping (MAP_PRIVATE / FILE_MAP_COPY). Writes
+    // through it stay in this process, and the segment is only opened for
+    // reading. Pages this process hasn't written may still show later writes
+    // by others; make_private() copies a range so it stops changing. Openers only
+    bool copy_on_write = false;
+
+    // Lifetime of a new named segment. ref_counted keeps a count and a table of
+    // attached processes in the last bytes of the segment; openers of such a
+    // segment are counted whatever they pass, and should pass ref_counted too so
+    // they wait for a creator that is still setting it up. Not for file_backed,
+    // mirror or open_always. Windows sections are always reference counted
+    segment_lifetime lifetime = segment_lifetime::manual;
+};
+
 // Tag types for constructor overload resolution
 struct create_only_t {
     explicit create_only_t() = default;
@@ -38,11 +122,21 @@ struct open_existing_t {
     explicit open_existing_t() = default;
 };
 
+struct anonymous_t {
+    explicit anonymous_t() = default;
+};
+
+struct adopt_handle_t {
+    explicit adopt_handle_t() = default;
+};
+
 // Tag instances
 inline constexpr create_only_t create_only{};
 inline constexpr open_or_create_t open_or_create{};
 inline constexpr open_always_t open_always{};
 inline constexpr open_existing_t open_existing{};
+inline constexpr anonymous_t anonymous{};
+inline constexpr adopt_handle_t adopt_handle{};
 
 }  // namespace shm
 }  // namespace slick
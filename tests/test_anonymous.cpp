@@ -0,0 +1,251 @@
+#include <catch2/catch_test_macros.hpp>
+#include <slick/shm/shared_memory.hpp>
+#include <slick/shm/handle_transfer.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <new>
+
+#ifdef SLICK_SHM_POSIX
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+using namespace slick::shm;
+
+TEST_CASE("Create an anonymous segment", "[anonymous]") {
+    shared_memory shm(64 * 1024, anonymous);
+    REQUIRE(shm.is_valid());
+    REQUIRE(shm.size() == 64 * 1024);
+    REQUIRE(shm.is_creator());
+    REQUIRE(shm.mode() == access_mode::read_write);
+    REQUIRE(std::string(shm.name()).empty());
+
+    std::memset(shm.data(), 0x5a, shm.size());
+    REQUIRE(static_cast<unsigned char*>(shm.data())[shm.size() - 1] == 0x5a);
+
+#if defined(SLICK_SHM_LINUX) || defined(SLICK_SHM_WINDOWS)
+    REQUIRE(shm.is_sealed());
+#endif
+}
+
+TEST_CASE("Anonymous segment errors", "[anonymous]") {
+    shared_memory empty(0, anonymous, segment_options(), std::nothrow);
+    REQUIRE_FALSE(empty.is_valid());
+    REQUIRE(empty.last_error() == errc::invalid_size);
+
+    REQUIRE_THROWS_AS(shared_memory(0, anonymous), shared_memory_error);
+
+#ifdef SLICK_SHM_POSIX
+    shared_memory bad(-1, adopt_handle, access_mode::read_write, segment_options(), std::nothrow);
+#else
+    shared_memory bad(nullptr, adopt_handle, access_mode::read_write, segment_options(),
+                      std::nothrow);
+#endif
+    REQUIRE_FALSE(bad.is_valid());
+    REQUIRE(bad.last_error() == errc::invalid_argument);
+}
+
+TEST_CASE("Anonymous segment with mapping options", "[anonymous]") {
+    segment_options options;
+    options.prefault = true;
+    options.mirror = true;
+    shared_memory shm(1000, anonymous, options);
+    REQUIRE(shm.is_mirrored());
+    REQUIRE(shm.size() % shm.page_size() == 0);
+    static_cast<char*>(shm.data())[0] = 'q';
+    REQUIRE(static_cast<char*>(shm.data())[shm.size()] == 'q');
+}
+
+TEST_CASE("Anonymous segment with preferred huge pages", "[anonymous][huge_pages]") {
+    segment_options options;
+    options.huge_page_policy = huge_pages::preferred;
+    shared_memory shm(3 * 1024 * 1024, anonymous, options);
+    REQUIRE(shm.is_valid());
+    if (shm.uses_huge_pages()) {
+        REQUIRE(shm.size() % shm.page_size() == 0);
+    }
+    static_cast<char*>(shm.data())[shm.size() - 1] = 1;
+}
+
+#ifdef SLICK_SHM_POSIX
+TEST_CASE("Adopt a duplicated descriptor", "[anonymous]") {
+    shared_memory shm(4096, anonymous);
+    std::memcpy(shm.data(), "adopted", 8);
+
+    shared_memory view(dup(shm.native_handle()), adopt_handle, access_mode::read_only);
+    REQUIRE(view.is_valid());
+    REQUIRE_FALSE(view.is_creator());
+    REQUIRE(view.size() == shm.size());
+    REQUIRE(view.mode() == access_mode::read_only);
+    REQUIRE(std::strcmp(static_cast<const char*>(view.data()), "adopted") == 0);
+    REQUIRE(view.is_sealed() == shm.is_sealed());
+
+    // Both mappings share the same pages
+    static_cast<char*>(shm.data())[0] = 'A';
+    REQUIRE(static_cast<const char*>(view.data())[0] == 'A');
+}
+
+TEST_CASE("Adopted descriptor is owned by the segment", "[anonymous]") {
+    int fd = -1;
+    {
+        shared_memory shm(4096, anonymous);
+        fd = dup(shm.native_handle());
+        shared_memory view(fd, adopt_handle);
+        REQUIRE(view.native_handle() == fd);
+    }
+    REQUIRE(fcntl(fd, F_GETFD) == -1);
+}
+
+#ifdef SLICK_SHM_LINUX
+TEST_CASE("Sealed anonymous segments can't be resized", "[anonymous]") {
+    shared_memory shm(8192, anonymous);
+    REQUIRE(shm.is_sealed());
+    REQUIRE(ftruncate(shm.native_handle(), 4096) == -1);
+    REQUIRE(ftruncate(shm.native_handle(), 16384) == -1);
+}
+#endif
+
+TEST_CASE("Pass an anonymous segment over a Unix socket", "[anonymous][cross_process]") {
+    int sockets[2];
+    REQUIRE(socketpair(AF_UNIX, SOCK_STREAM, 0, sockets) == 0);
+
+    pid_t child = fork();
+    REQUIRE(child >= 0);
+    if (child == 0) {
+        ::close(sockets[0]);
+        shared_memory shm(64 * 1024, anonymous, segment_options(), std::nothrow);
+        if (!shm.is_valid()) {
+            _exit(1);
+        }
+        std::memcpy(shm.data(), "from the child", 15);
+        if (send_handle(sockets[1], shm.native_handle())) {
+            _exit(2);
+        }
+        // Wait for the parent to map it before going away
+        char ack = 0;
+        if (read(sockets[1], &ack, 1) != 1) {
+            _exit(3);
+        }
+        _exit(0);
+    }
+    ::close(sockets[1]);
+
+    shared_memory::native_handle_type handle = -1;
+    REQUIRE_FALSE(receive_handle(sockets[0], handle));
+    REQUIRE(handle >= 0);
+    shared_memory shm(handle, adopt_handle, access_mode::read_only);
+    char ack = 1;
+    REQUIRE(write(sockets[0], &ack, 1) == 1);
+
+    int status = 0;
+    REQUIRE(waitpid(child, &status, 0) == child);
+    REQUIRE(WIFEXITED(status));
+    REQUIRE(WEXITSTATUS(status) == 0);
+
+    // Still mapped after the creator exited
+    REQUIRE(shm.size() == 64 * 1024);
+    REQUIRE(std::strcmp(static_cast<const char*>(shm.data()), "from the child") == 0);
+
+    // Nothing more to receive
+    REQUIRE(receive_handle(sockets[0], handle) == errc::not_found);
+    ::close(sockets[0]);
+}
+
+#ifdef MSG_NOSIGNAL
+TEST_CASE("send_handle to a closed peer fails without SIGPIPE", "[anonymous]") {
+    int sockets[2];
+    REQUIRE(socketpair(AF_UNIX, SOCK_STREAM, 0, sockets) == 0);
+    ::close(sockets[1]);
+
+    shared_memory shm(4096, anonymous);
+    REQUIRE(send_handle(sockets[0], shm.native_handle()) == std::errc::broken_pipe);
+    ::close(sockets[0]);
+}
+#endif
+
+TEST_CASE("receive_handle closes descriptors it rejects", "[anonymous]") {
+    int sockets[2];
+    REQUIRE(socketpair(AF_UNIX, SOCK_STREAM, 0, sockets) == 0);
+
+    // Two descriptors in one message
+    int fds[2] = {dup(0), dup(0)};
+    REQUIRE(fds[0] >= 0);
+    REQUIRE(fds[1] >= 0);
+    char payload = 0;
+    iovec iov;
+    iov.iov_base = &payload;
+    iov.iov_len = 1;
+    alignas(cmsghdr) char control[CMSG_SPACE(sizeof(fds))] = {};
+    msghdr msg = {};
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+    cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type = SCM_RIGHTS;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(fds));
+    std::memcpy(CMSG_DATA(cmsg), fds, sizeof(fds));
+    REQUIRE(sendmsg(sockets[1], &msg, 0) == 1);
+    ::close(fds[0]);
+    ::close(fds[1]);
+
+    // The lowest free descriptor is still free afterwards
+    int lowest = dup(0);
+    ::close(lowest);
+    shared_memory::native_handle_type handle = -1;
+    REQUIRE(receive_handle(sockets[0], handle) == errc::invalid_argument);
+    int again = dup(0);
+    REQUIRE(again == lowest);
+    ::close(again);
+
+    ::close(sockets[0]);
+    ::close(sockets[1]);
+}
+#endif
+
+#ifdef SLICK_SHM_LINUX
+TEST_CASE("Import a descriptor from another process", "[anonymous][cross_process]") {
+    shared_memory shm(4096, anonymous);
+    std::memcpy(shm.data(), "imported", 9);
+
+    int pipe_fds[2];
+    REQUIRE(pipe(pipe_fds) == 0);
+    pid_t child = fork();
+    REQUIRE(child >= 0);
+    if (child == 0) {
+        // The child holds the segment; the parent imports it from the child
+        char c;
+        ::close(pipe_fds[1]);
+        (void)!read(pipe_fds[0], &c, 1);
+        _exit(0);
+    }
+    ::close(pipe_fds[0]);
+
+    shared_memory::native_handle_type handle = -1;
+    std::error_code ec = import_handle(static_cast<std::uint32_t>(child), shm.native_handle(),
+                                       handle);
+    ::close(pipe_fds[1]);
+    int status = 0;
+    waitpid(child, &status, 0);
+
+    if (ec) {
+        // Old kernel or restricted ptrace access
+        REQUIRE((ec == errc::not_supported || ec == errc::permission_denied));
+        return;
+    }
+    shared_memory imported(handle, adopt_handle, access_mode::read_only);
+    REQUIRE(std::strcmp(static_cast<const char*>(imported.data()), "imported") == 0);
+}
+
+TEST_CASE("Import from a missing process", "[anonymous]") {
+    shared_memory::native_handle_type handle = -1;
+    // PIDs above pid_max (at most 2^22) are never in use
+    std::error_code ec = import_handle(0x7fffffff, 3, handle);
+    REQUIRE((ec == errc::not_found || ec == errc::not_supported));
+    REQUIRE(handle == -1);
+}
+#endif
@@ -0,0 +1,221 @@
+#include <catch2/catch_test_macros.hpp>
+#include <slick/shm/arena.hpp>
+#include <slick/shm/shared_memory.hpp>
+
+#include <string>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace slick::shm;
+
+namespace {
+
+std::string unique_name(const char* prefix) {
+    auto now = std::chrono::system_clock::now().time_since_epoch();
+    auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(now).count();
+    // Use modulo to keep the timestamp shorter while still being unique (macOS has 31-char limit)
+    return std::string(prefix) + std::to_string(millis % 100000000);
+}
+
+struct shm_cleanup {
+    std::string name;
+    ~shm_cleanup() {
+        shared_memory::remove(name.c_str());
+    }
+};
+
+using shm_vector = std::vector<std::uint64_t, arena_allocator<std::uint64_t>>;
+
+struct directory {
+    std::uint64_t count;
+    offset_ptr<shm_vector> values;
+};
+
+}  // namespace
+
+TEST_CASE("arena allocate and reuse", "[arena]") {
+    std::string name = unique_name("test_arena_reuse_");
+    shm_cleanup cleanup{name};
+
+    shared_arena heap(name.c_str(), 1024 * 1024, create_only);
+    REQUIRE(heap.is_valid());
+    REQUIRE(heap->capacity() >= 1024 * 1024);
+
+    void* a = heap->allocate(24);
+    void* b = heap->allocate(24);
+    REQUIRE(a != nullptr);
+    REQUIRE(b != nullptr);
+    REQUIRE(a != b);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(a) % alignof(std::max_align_t) == 0);
+
+    // A freed block is handed out again for the same size class
+    std::size_t available = heap->available();
+    heap->deallocate(a, 24);
+    void* c = heap->allocate(32);
+    REQUIRE(c == a);
+    REQUIRE(heap->available() == available);
+
+    heap->deallocate(b, 24);
+    heap->deallocate(c, 32);
+    heap->deallocate(nullptr, 24);
+}
+
+TEST_CASE("arena alignment", "[arena]") {
+    std::string name = unique_name("test_arena_align_");
+    shm_cleanup cleanup{name};
+
+    shared_arena heap(name.c_str(), 1024 * 1024, create_only);
+    for (std::size_t alignment : {1, 8, 64, 256, 4096, 8192}) {
+        void* p = heap->allocate(3, alignment);
+        REQUIRE(p != nullptr);
+        REQUIRE(reinterpret_cast<std::uintptr_t>(p) % alignment == 0);
+        heap->deallocate(p, 3, alignment);
+    }
+    REQUIRE(heap->allocate(16, 3) == nullptr);
+}
+
+TEST_CASE("arena exhaustion", "[arena]") {
+    std::string name = unique_name("test_arena_full_");
+    shm_cleanup cleanup{name};
+
+    shared_arena heap(name.c_str(), 64 * 1024, create_only);
+    std::vector<void*> blocks;
+    while (void* p = heap->allocate(1024)) {
+        blocks.push_back(p);
+    }
+    REQUIRE(!blocks.empty());
+    REQUIRE(blocks.size() < 64);
+    REQUIRE(heap->allocate(2 * 1024 * 1024) == nullptr);
+
+    // Freeing makes room again
+    heap->deallocate(blocks.back(), 1024);
+    REQUIRE(heap->allocate(1000) == blocks.back());
+}
+
+TEST_CASE("arena construct and root across mappings", "[arena]") {
+    std::string name = unique_name("test_arena_root_");
+    shm_cleanup cleanup{name};
+
+    shared_arena creator(name.c_str(), 1024 * 1024, create_only);
+    auto* dir = creator->construct<directory>();
+    REQUIRE(dir != nullptr);
+    dir->values = creator->construct<shm_vector>(arena_allocator<std::uint64_t>(*creator));
+    for (std::uint64_t i = 0; i < 1000; ++i) {
+        dir->values->push_back(i * i);
+    }
+    dir->count = dir->values->size();
+    creator->set_root(dir);
+
+    // A second mapping lands at a different address but sees the same data
+    shared_arena other(name.c_str(), open_existing);
+    REQUIRE(other.is_valid());
+    REQUIRE(other.segment().data() != creator.segment().data());
+    auto* seen = other->root<directory>();
+    REQUIRE(seen != nullptr);
+    REQUIRE(seen != dir);
+    REQUIRE(seen->count == 1000);
+    REQUIRE(seen->values->size() == 1000);
+    REQUIRE((*seen->values)[999] == 999 * 999);
+
+    // Growing through the second mapping allocates from the shared arena
+    seen->values->push_back(7);
+    REQUIRE(dir->values->back() == 7);
+    REQUIRE(dir->values->get_allocator() == arena_allocator<int>(*creator));
+
+    creator->destroy(dir->values.get());
+    creator->destroy(dir);
+    creator->set_root(nullptr);
+    REQUIRE(other->root() == nullptr);
+}
+
+TEST_CASE("arena concurrent allocation", "[arena]") {
+    std::string name = unique_name("test_arena_mt_");
+    shm_cleanup cleanup{name};
+
+    shared_arena heap(name.c_str(), 4 * 1024 * 1024, create_only);
+    constexpr int threads = 4;
+    constexpr int rounds = 2000;
+    std::atomic<bool> overlap{false};
+
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t] {
+            std::vector<std::uint64_t*> held;
+            for (int i = 0; i < rounds; ++i) {
+                auto* p = static_cast<std::uint64_t*>(heap->allocate(64));
+                if (p == nullptr) {
+                    overlap = true;
+                    return;
+                }
+                // Tag the block; another owner would overwrite it
+                std::uint64_t tag = (static_cast<std::uint64_t>(t) << 32) | static_cast<std::uint64_t>(i);
+                p[1] = tag;
+                held.push_back(p);
+                if (held.size() > 8) {
+                    std::uint64_t* q = held.front();
+                    held.erase(held.begin());
+                    if ((q[1] >> 32) != static_cast<std::uint64_t>(t)) {
+                        overlap = true;
+                    }
+                    heap->deallocate(q, 64);
+                }
+            }
+            for (std::uint64_t* q : held) {
+                heap->deallocate(q, 64);
+            }
+        });
+    }
+    for (auto& w : workers) {
+        w.join();
+    }
+    REQUIRE_FALSE(overlap);
+
+    // Every block went back to the free list: reallocating them all never bumps
+    std::size_t available = heap->available();
+    std::set<void*> distinct;
+    for (int i = 0; i < threads * 9; ++i) {
+        distinct.insert(heap->allocate(64));
+    }
+    REQUIRE(distinct.size() == static_cast<std::size_t>(threads * 9));
+    REQUIRE(heap->available() <= available);
+}
+
+TEST_CASE("arena open and create errors", "[arena]") {
+    std::string name = unique_name("test_arena_err_");
+    shm_cleanup cleanup{name};
+
+    SECTION("Missing segment") {
+        shared_arena heap(name.c_str(), open_existing, segment_options(), std::nothrow);
+        REQUIRE_FALSE(heap.is_valid());
+        REQUIRE(heap.last_error() == errc::not_found);
+    }
+
+    SECTION("Segment without an arena") {
+        shared_memory plain(name.c_str(), 4096, create_only);
+        shared_arena heap(name.c_str(), open_existing, segment_options(), std::nothrow);
+        REQUIRE_FALSE(heap.is_valid());
+        REQUIRE(heap.last_error() == errc::incompatible_layout);
+        REQUIRE_THROWS_AS(shared_arena(name.c_str(), open_existing), shared_memory_error);
+    }
+
+    SECTION("Too small") {
+        shared_arena heap(name.c_str(), 16, create_only, segment_options(), std::nothrow);
+        REQUIRE_FALSE(heap.is_valid());
+        REQUIRE(heap.last_error() == errc::invalid_size);
+    }
+
+    SECTION("In-place arena in caller memory") {
+        alignas(64) static unsigned char buffer[8192];
+        arena* a = arena::create(buffer, sizeof(buffer));
+        REQUIRE(a != nullptr);
+        REQUIRE(arena::attach(buffer, sizeof(buffer)) == a);
+        REQUIRE(arena::create(buffer + 8, sizeof(buffer) - 8) == nullptr);
+        unsigned char zero[256] = {};
+        REQUIRE(arena::attach(zero, sizeof(zero)) == nullptr);
+    }
+}
@@ -0,0 +1,218 @@
+#include <catch2/catch_test_macros.hpp>
+#include <slick/shm/broadcast_ring.hpp>
+
+#include <string>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <thread>
+
+using namespace slick::shm;
+
+namespace {
+
+std::string unique_name(const char* prefix) {
+    auto now = std::chrono::system_clock::now().time_since_epoch();
+    auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(now).count();
+    // Use modulo to keep the timestamp shorter while still being unique (macOS has 31-char limit)
+    return std::string(prefix) + std::to_string(millis % 100000000);
+}
+
+struct shm_cleanup {
+    std::string name;
+    ~shm_cleanup() {
+        shared_memory::remove(name.c_str());
+    }
+};
+
+// All fields carry the same value so torn reads are easy to spot
+struct quote {
+    std::uint64_t seq;
+    std::uint64_t bid;
+    std::uint64_t ask;
+    std::uint64_t size;
+};
+
+quote make_quote(std::uint64_t i) {
+    return quote{i, i, i, i};
+}
+
+}  // namespace
+
+TEST_CASE("broadcast_ring fan-out to independent readers", "[broadcast_ring]") {
+    std::string name = unique_name("test_bcast_basic");
+    shm_cleanup cleanup{name};
+
+    broadcast_ring<quote> writer(name.c_str(), 6, create_only);
+    REQUIRE(writer.is_valid());
+    REQUIRE(writer.capacity() == 8);
+
+    broadcast_ring<quote> fast(name.c_str(), open_existing);
+    broadcast_ring<quote> slow(name.c_str(), open_existing);
+    REQUIRE(fast.is_valid());
+    REQUIRE(slow.is_valid());
+    REQUIRE(fast.segment().mode() == access_mode::read_only);
+
+    quote out{};
+    REQUIRE(fast.try_read(out) == read_status::empty);
+
+    for (std::uint64_t i = 0; i < 4; ++i) {
+        REQUIRE(writer.publish(make_quote(i)) == i);
+    }
+
+    // Each reader sees every message, at its own pace
+    for (std::uint64_t i = 0; i < 4; ++i) {
+        REQUIRE(fast.try_read(out) == read_status::ok);
+        REQUIRE(out.seq == i);
+    }
+    REQUIRE(fast.try_read(out) == read_status::empty);
+
+    REQUIRE(slow.try_read(out) == read_status::ok);
+    REQUIRE(out.seq == 0);
+    REQUIRE(slow.read_sequence() == 1);
+    REQUIRE(slow.write_sequence() == 4);
+    REQUIRE(fast.lost() == 0);
+}
+
+TEST_CASE("broadcast_ring late reader starts at the head", "[broadcast_ring]") {
+    std::string name = unique_name("test_bcast_late");
+    shm_cleanup cleanup{name};
+
+    broadcast_ring<quote> writer(name.c_str(), 8, create_only);
+    writer.publish(make_quote(0));
+    writer.publish(make_quote(1));
+
+    broadcast_ring<quote> reader(name.c_str(), open_existing);
+    quote out{};
+    REQUIRE(reader.try_read(out) == read_status::empty);
+
+    writer.publish(make_quote(2));
+    REQUIRE(reader.try_read(out) == read_status::ok);
+    REQUIRE(out.seq == 2);
+}
+
+TEST_CASE("broadcast_ring lapped reader resyncs", "[broadcast_ring]") {
+    std::string name = unique_name("test_bcast_lap");
+    shm_cleanup cleanup{name};
+
+    broadcast_ring<quote> writer(name.c_str(), 8, create_only);
+    broadcast_ring<quote> reader(name.c_str(), open_existing);
+
+    for (std::uint64_t i = 0; i < 20; ++i) {
+        writer.publish(make_quote(i));
+    }
+
+    quote out{};
+    REQUIRE(reader.try_read(out) == read_status::lapped);
+    REQUIRE(reader.lost() == 13);
+    REQUIRE(reader.read_sequence() == 13);
+
+    // Everything from the resync point onwards is intact
+    for (std::uint64_t i = 13; i < 20; ++i) {
+        REQUIRE(reader.try_read(out) == read_status::ok);
+        REQUIRE(out.seq == i);
+    }
+    REQUIRE(reader.try_read(out) == read_status::empty);
+
+    SECTION("seek_latest skips pending messages") {
+        writer.publish(make_quote(20));
+        writer.publish(make_quote(21));
+        reader.seek_latest();
+        REQUIRE(reader.try_read(out) == read_status::empty);
+        writer.publish(make_quote(22));
+        REQUIRE(reader.try_read(out) == read_status::ok);
+        REQUIRE(out.seq == 22);
+        REQUIRE(reader.lost() == 13);
+    }
+}
+
+TEST_CASE("broadcast_ring layout validation", "[broadcast_ring]") {
+    std::string name = unique_name("test_bcast_layout");
+    shm_cleanup cleanup{name};
+
+    SECTION("Missing segment") {
+        broadcast_ring<quote> reader(name.c_str(), open_existing, access_mode::read_only,
+                                     segment_options(), std::nothrow);
+        REQUIRE_FALSE(reader.is_valid());
+        REQUIRE(reader.last_error() == errc::not_found);
+    }
+
+    SECTION("Element size mismatch") {
+        broadcast_ring<quote> writer(name.c_str(), 8, create_only);
+        broadcast_ring<std::uint32_t> reader(name.c_str(), open_existing, access_mode::read_only,
+                                             segment_options(), std::nothrow);
+        REQUIRE_FALSE(reader.is_valid());
+        REQUIRE(reader.last_error() == errc::incompatible_layout);
+    }
+
+    SECTION("Raw segment") {
+        shared_memory raw(name.c_str(), 4096, create_only);
+        REQUIRE_THROWS_AS(broadcast_ring<quote>(name.c_str(), open_existing), shared_memory_error);
+    }
+
+    SECTION("Zero capacity") {
+        broadcast_ring<quote> writer(name.c_str(), 0, create_only, segment_options(),
+                                     std::nothrow);
+        REQUIRE_FALSE(writer.is_valid());
+        REQUIRE(writer.last_error() == errc::invalid_size);
+    }
+
+    SECTION("Capacity too large to round up") {
+        broadcast_ring<quote> writer(name.c_str(), std::numeric_limits<std::size_t>::max(),
+                                     create_only, segment_options(), std::nothrow);
+        REQUIRE(writer.last_error() == errc::invalid_size);
+    }
+}
+
+TEST_CASE("broadcast_ring concurrent writer and readers", "[broadcast_ring]") {
+    std::string name = unique_name("test_bcast_mt");
+    shm_cleanup cleanup{name};
+
+    constexpr std::uint64_t count = 200000;
+    broadcast_ring<quote> writer(name.c_str(), 1024, create_only);
+
+    auto consume = [&name](std::uint64_t& received, std::uint64_t& lost, bool& consistent) {
+        broadcast_ring<quote> reader(name.c_str(), open_existing);
+        std::uint64_t expected = reader.read_sequence();
+        quote out{};
+        while (expected < count) {
+            read_status status = reader.try_read(out);
+            if (status == read_status::ok) {
+                if (out.seq != expected || out.bid != out.seq || out.ask != out.seq ||
+                    out.size != out.seq) {
+                    consistent = false;
+                }
+                expected = out.seq + 1;
+                ++received;
+            } else if (status == read_status::lapped) {
+                expected = reader.read_sequence();
+            } else {
+                std::this_thread::yield();
+            }
+        }
+        lost = reader.lost();
+    };
+
+    std::uint64_t received[2] = {0, 0};
+    std::uint64_t lost[2] = {0, 0};
+    bool consistent[2] = {true, true};
+    std::thread r0(consume, std::ref(received[0]), std::ref(lost[0]), std::ref(consistent[0]));
+    std::thread r1(consume, std::ref(received[1]), std::ref(lost[1]), std::ref(consistent[1]));
+
+    // Give the readers a moment to attach before the stream starts
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    for (std::uint64_t i = 0; i < count; ++i) {
+        writer.publish(make_quote(i));
+        if ((i & 1023) == 0) {
+            std::this_thread::yield();
+        }
+    }
+
+    r0.join();
+    r1.join();
+    for (int r = 0; r < 2; ++r) {
+        REQUIRE(consistent[r]);
+        REQUIRE(received[r] > 0);
+        REQUIRE(received[r] + lost[r] <= count);
+    }
+}
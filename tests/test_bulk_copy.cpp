@@ -0,0 +1,99 @@
+#include <catch2/catch_test_macros.hpp>
+#include <slick/shm/bulk_copy.hpp>
+#include <slick/shm/shared_memory.hpp>
+#include <slick/shm/shared_memory_view.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace slick::shm;
+
+namespace {
+
+std::string unique_name(const char* prefix) {
+    auto now = std::chrono::system_clock::now().time_since_epoch();
+    auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(now).count();
+    // Use modulo to keep the timestamp shorter while still being unique (macOS has 31-char limit)
+    return std::string(prefix) + std::to_string(millis % 100000000);
+}
+
+struct shm_cleanup {
+    std::string name;
+    ~shm_cleanup() {
+        shared_memory::remove(name.c_str());
+    }
+};
+
+std::vector<unsigned char> pattern(std::size_t n) {
+    std::vector<unsigned char> bytes(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        bytes[i] = static_cast<unsigned char>(i * 131 + 7);
+    }
+    return bytes;
+}
+
+}  // namespace
+
+TEST_CASE("Instruction set is picked", "[bulk_copy]") {
+    std::string isa = stream_copy_isa();
+    REQUIRE_FALSE(isa.empty());
+    REQUIRE(isa == stream_copy_isa());  // Picked once
+}
+
+TEST_CASE("stream_copy() copies every length and alignment", "[bulk_copy]") {
+    std::vector<unsigned char> src = pattern(8192);
+    std::vector<unsigned char> dst(8192 + 128);
+
+    const std::size_t lengths[] = {0, 1, 63, 64, 65, 127, 128, 1000, 4096, 8000};
+    for (std::size_t length : lengths) {
+        for (std::size_t dst_offset : {0, 1, 17, 63}) {
+            for (std::size_t src_offset : {0, 3}) {
+                std::fill(dst.begin(), dst.end(), 0xee);
+                stream_copy(dst.data() + dst_offset, src.data() + src_offset, length);
+                REQUIRE(std::memcmp(dst.data() + dst_offset, src.data() + src_offset, length) == 0);
+                // Neighbouring bytes are untouched
+                if (dst_offset > 0) {
+                    REQUIRE(dst[dst_offset - 1] == 0xee);
+                }
+                REQUIRE(dst[dst_offset + length] == 0xee);
+            }
+        }
+    }
+}
+
+TEST_CASE("stream_read() copies every length", "[bulk_copy]") {
+    std::vector<unsigned char> src = pattern(10000);
+    for (std::size_t length : {0, 1, 64, 500, 513, 4096, 10000}) {
+        std::vector<unsigned char> dst(length + 1, 0xee);
+        stream_read(dst.data(), src.data(), length);
+        REQUIRE(std::memcmp(dst.data(), src.data(), length) == 0);
+        REQUIRE(dst[length] == 0xee);
+    }
+}
+
+TEST_CASE("Streaming into and out of a segment", "[bulk_copy]") {
+    auto name = unique_name("bulkseg");
+    shm_cleanup cleanup{name};
+
+    const std::size_t size = 1024 * 1024;
+    shared_memory shm(name.c_str(), size, create_only);
+    std::vector<unsigned char> snapshot = pattern(size - 100);
+
+    REQUIRE_FALSE(stream_write(shm, 100, snapshot.data(), snapshot.size()));
+    REQUIRE(std::memcmp(static_cast<unsigned char*>(shm.data()) + 100, snapshot.data(),
+                        snapshot.size()) == 0);
+
+    shared_memory reader(name.c_str(), open_existing, access_mode::read_only);
+    std::vector<unsigned char> copy(snapshot.size());
+    REQUIRE_FALSE(stream_read(shared_memory_view(reader), 100, copy.data(), copy.size()));
+    REQUIRE(copy == snapshot);
+
+    REQUIRE(stream_write(shm, 101, snapshot.data(), snapshot.size()) == errc::invalid_argument);
+    REQUIRE(stream_read(reader, size, copy.data(), 1) == errc::invalid_argument);
+    REQUIRE(stream_write(shared_memory_view(reader), 0, snapshot.data(), 1) ==
+            errc::permission_denied);
+    REQUIRE(stream_write(shared_memory_view(), 0, snapshot.data(), 1) == errc::mapping_failed);
+}
@@ -0,0 +1,170 @@
+#include <catch2/catch_test_macros.hpp>
+#include <slick/shm/shared_memory.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <new>
+#include <string>
+
+using namespace slick::shm;
+
+namespace {
+
+std::string unique_name(const char* prefix) {
+    auto now = std::chrono::system_clock::now().time_since_epoch();
+    auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(now).count();
+    // Use modulo to keep the timestamp shorter while still being unique (macOS has 31-char limit)
+    return std::string(prefix) + std::to_string(millis % 100000000);
+}
+
+struct shm_cleanup {
+    std::string name;
+    ~shm_cleanup() {
+        shared_memory::remove(name.c_str());
+    }
+};
+
+segment_options cow_options() {
+    segment_options options;
+    options.copy_on_write = true;
+    return options;
+}
+
+std::uint64_t load(const shared_memory& shm, std::size_t offset) {
+    std::uint64_t value = 0;
+    std::memcpy(&value, static_cast<const char*>(shm.data()) + offset, sizeof(value));
+    return value;
+}
+
+void store(shared_memory& shm, std::size_t offset, std::uint64_t value) {
+    std::memcpy(static_cast<char*>(shm.data()) + offset, &value, sizeof(value));
+}
+
+}  // namespace
+
+TEST_CASE("Copy-on-write writes stay private", "[copy_on_write]") {
+    auto name = unique_name("cowpriv");
+    shm_cleanup cleanup{name};
+
+    shared_memory writer(name.c_str(), 64 * 1024, create_only);
+    store(writer, 0, 1);
+
+    shared_memory snapshot(name.c_str(), open_existing, access_mode::read_write, cow_options());
+    REQUIRE(snapshot.is_copy_on_write());
+    REQUIRE_FALSE(writer.is_copy_on_write());
+    REQUIRE(snapshot.size() == writer.size());
+    REQUIRE(load(snapshot, 0) == 1);
+
+    store(snapshot, 0, 2);
+    REQUIRE(load(snapshot, 0) == 2);
+    REQUIRE(load(writer, 0) == 1);
+
+    // Another opener sees the segment, not the private copy
+    shared_memory other(name.c_str(), open_existing);
+    REQUIRE(load(other, 0) == 1);
+}
+
+TEST_CASE("make_private() freezes a range", "[copy_on_write]") {
+    auto name = unique_name("cowfreeze");
+    shm_cleanup cleanup{name};
+
+    const std::size_t page = 64 * 1024;
+    shared_memory writer(name.c_str(), 4 * page, create_only);
+    store(writer, 0, 10);
+    store(writer, 2 * page, 20);
+
+    shared_memory snapshot(name.c_str(), open_existing, access_mode::read_write, cow_options());
+    REQUIRE_FALSE(snapshot.make_private(0, page));
+    REQUIRE(load(snapshot, 0) == 10);
+
+    store(writer, 0, 11);
+    REQUIRE(load(snapshot, 0) == 10);     // Frozen
+    REQUIRE(load(writer, 0) == 11);
+
+    // The fallback write-faults pages without changing them
+    slick::shm::detail::break_cow_pages(static_cast<char*>(snapshot.data()) + 2 * page, page,
+                                        4096);
+    REQUIRE(load(snapshot, 2 * page) == 20);
+    store(writer, 2 * page, 21);
+    REQUIRE(load(snapshot, 2 * page) == 20);
+
+#ifdef __linux__
+    // Pages that were neither written nor made private follow the segment
+    store(writer, 3 * page, 30);
+    REQUIRE(load(snapshot, 3 * page) == 30);
+#endif
+
+    REQUIRE_FALSE(snapshot.make_private());
+}
+
+TEST_CASE("Prefaulting a copy-on-write mapping doesn't copy it", "[copy_on_write]") {
+    auto name = unique_name("cowpf");
+    shm_cleanup cleanup{name};
+
+    shared_memory writer(name.c_str(), 64 * 1024, create_only);
+    segment_options options = cow_options();
+    options.prefault = true;
+    shared_memory snapshot(name.c_str(), open_existing, access_mode::read_write, options);
+    REQUIRE(snapshot.is_valid());
+    REQUIRE_FALSE(snapshot.prefault());
+
+#ifdef __linux__
+    store(writer, 4096, 5);
+    REQUIRE(load(snapshot, 4096) == 5);
+#endif
+}
+
+TEST_CASE("Copy-on-write file mapping leaves the file alone", "[copy_on_write][file_backed]") {
+    std::string path = unique_name("slick_cow_file_") + ".dat";
+    struct file_cleanup {
+        std::string path;
+        ~file_cleanup() { std::remove(path.c_str()); }
+    } cleanup{path};
+
+    segment_options file;
+    file.file_backed = true;
+    {
+        shared_memory creator(path.c_str(), 4096, create_only, access_mode::read_write, file);
+        store(creator, 0, 7);
+    }
+
+    segment_options options = cow_options();
+    options.file_backed = true;
+    {
+        shared_memory snapshot(path.c_str(), open_existing, access_mode::read_write, options);
+        store(snapshot, 0, 8);
+        REQUIRE(load(snapshot, 0) == 8);
+    }
+
+    shared_memory reopened(path.c_str(), open_existing, access_mode::read_only, file);
+    REQUIRE(load(reopened, 0) == 7);
+}
+
+TEST_CASE("Copy-on-write errors", "[copy_on_write]") {
+    auto name = unique_name("cowerr");
+    shm_cleanup cleanup{name};
+
+    shared_memory created(name.c_str(), 4096, create_only, access_mode::read_write, cow_options(),
+                          std::nothrow);
+    REQUIRE(created.last_error() == errc::invalid_argument);
+    REQUIRE(shared_memory(4096, anonymous, cow_options(), std::nothrow).last_error() ==
+            errc::invalid_argument);
+
+    shared_memory writer(name.c_str(), 4096, create_only);
+    REQUIRE(writer.make_private() == errc::not_supported);
+
+    shared_memory viewer(name.c_str(), open_existing, access_mode::read_only, cow_options());
+    REQUIRE(viewer.is_copy_on_write());
+    REQUIRE(viewer.make_private() == errc::permission_denied);
+
+    shared_memory snapshot(name.c_str(), open_existing, access_mode::read_write, cow_options());
+    REQUIRE(snapshot.make_private(4000, 100) == errc::invalid_argument);
+
+    segment_options mirrored = cow_options();
+    mirrored.mirror = true;
+    shared_memory mirror(name.c_str(), open_existing, access_mode::read_write, mirrored,
+                         std::nothrow);
+    REQUIRE(mirror.last_error() == errc::not_supported);
+}
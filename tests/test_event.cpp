@@ -0,0 +1,148 @@
+#include <catch2/catch_test_macros.hpp>
+#include <slick/shm/event.hpp>
+#include <slick/shm/shared_memory.hpp>
+
+#include <string>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace slick::shm;
+
+namespace {
+
+std::string unique_name(const char* prefix) {
+    auto now = std::chrono::system_clock::now().time_since_epoch();
+    auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(now).count();
+    // Use modulo to keep the timestamp shorter while still being unique (macOS has 31-char limit)
+    return std::string(prefix) + std::to_string(millis % 100000000);
+}
+
+struct shm_cleanup {
+    std::string name;
+    ~shm_cleanup() {
+        shared_memory::remove(name.c_str());
+    }
+};
+
+struct shared_state {
+    shared_event ready;
+    std::atomic<std::uint32_t> value;
+};
+
+shared_state* state_of(shared_memory& shm) {
+    // A zero-filled segment already holds a valid, unsignaled event
+    return static_cast<shared_state*>(shm.data());
+}
+
+wait_policy block_immediately() {
+    wait_policy policy;
+    policy.spin_count = 0;
+    return policy;
+}
+
+}  // namespace
+
+TEST_CASE("shared_event timeout without notification", "[event]") {
+    std::string name = unique_name("test_event_tmo");
+    shm_cleanup cleanup{name};
+
+    shared_memory shm(name.c_str(), sizeof(shared_state), create_only);
+    shared_state* state = state_of(shm);
+    REQUIRE(state->ready.epoch() == 0);
+
+    auto start = std::chrono::steady_clock::now();
+    REQUIRE_FALSE(state->ready.wait_for(state->ready.epoch(), std::chrono::milliseconds(30)));
+    REQUIRE(std::chrono::steady_clock::now() - start >= std::chrono::milliseconds(30));
+
+    // A stale epoch returns immediately
+    std::uint32_t epoch = state->ready.epoch();
+    state->ready.notify_one();
+    REQUIRE(state->ready.wait_for(epoch, std::chrono::seconds(10)));
+    state->ready.wait(epoch);
+}
+
+TEST_CASE("shared_event wakes a blocked waiter through another mapping", "[event]") {
+    std::string name = unique_name("test_event_wake");
+    shm_cleanup cleanup{name};
+
+    // Two mappings of the same segment at different addresses, as in two processes
+    shared_memory waiter_map(name.c_str(), sizeof(shared_state), create_only);
+    shared_memory notifier_map(name.c_str(), open_existing);
+    REQUIRE(waiter_map.data() != notifier_map.data());
+    shared_state* waiter_side = state_of(waiter_map);
+    shared_state* notifier_side = state_of(notifier_map);
+
+    std::atomic<bool> woken{false};
+    std::thread waiter([&] {
+        std::uint32_t epoch = waiter_side->ready.epoch();
+        bool notified =
+            waiter_side->ready.wait_for(epoch, std::chrono::seconds(10), block_immediately());
+        woken.store(notified);
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    REQUIRE_FALSE(woken.load());
+    notifier_side->ready.notify_one();
+    waiter.join();
+    REQUIRE(woken.load());
+}
+
+TEST_CASE("shared_event predicate wait", "[event]") {
+    std::string name = unique_name("test_event_pred");
+    shm_cleanup cleanup{name};
+
+    shared_memory shm(name.c_str(), sizeof(shared_state), create_only);
+    shared_memory other(name.c_str(), open_existing);
+    shared_state* consumer = state_of(shm);
+    shared_state* producer = state_of(other);
+
+    constexpr std::uint32_t target = 1000;
+    std::thread writer([&] {
+        for (std::uint32_t i = 1; i <= target; ++i) {
+            producer->value.store(i, std::memory_order_release);
+            producer->ready.notify_all();
+            if (i % 100 == 0) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    consumer->ready.wait([&] { return consumer->value.load(std::memory_order_acquire) == target; });
+    writer.join();
+    REQUIRE(consumer->value.load() == target);
+
+    SECTION("Predicate with timeout") {
+        REQUIRE(consumer->ready.wait_for([] { return true; }, std::chrono::milliseconds(1)));
+        REQUIRE_FALSE(consumer->ready.wait_for([] { return false; }, std::chrono::milliseconds(10),
+                                               block_immediately()));
+    }
+}
+
+TEST_CASE("shared_event notify_all wakes every waiter", "[event]") {
+    std::string name = unique_name("test_event_all");
+    shm_cleanup cleanup{name};
+
+    shared_memory shm(name.c_str(), sizeof(shared_state), create_only);
+    shared_state* state = state_of(shm);
+
+    constexpr int waiter_count = 4;
+    std::atomic<int> woken{0};
+    std::uint32_t epoch = state->ready.epoch();
+    std::vector<std::thread> waiters;
+    for (int i = 0; i < waiter_count; ++i) {
+        waiters.emplace_back([&] {
+            if (state->ready.wait_for(epoch, std::chrono::seconds(10), block_immediately())) {
+                woken.fetch_add(1);
+            }
+        });
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    state->ready.notify_all();
+    for (auto& t : waiters) {
+        t.join();
+    }
+    REQUIRE(woken.load() == waiter_count);
+}
@@ -0,0 +1,219 @@
+#include <catch2/catch_test_macros.hpp>
+#include <slick/shm/shared_memory.hpp>
+#include <slick/shm/shared_memory_window.hpp>
+#include <slick/shm/growable_segment.hpp>
+
+#include <string>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <new>
+
+using namespace slick::shm;
+
+namespace {
+
+// Files are created in the working directory of the test run
+std::string unique_path(const char* prefix) {
+    auto now = std::chrono::system_clock::now().time_since_epoch();
+    auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(now).count();
+    return std::string(prefix) + std::to_string(millis % 100000000) + ".dat";
+}
+
+struct file_cleanup {
+    std::string path;
+    ~file_cleanup() {
+        std::remove(path.c_str());
+    }
+};
+
+segment_options file_options() {
+    segment_options options;
+    options.file_backed = true;
+    return options;
+}
+
+}  // namespace
+
+TEST_CASE("File-backed segment persists its contents", "[file_backed]") {
+    std::string path = unique_path("slick_file_persist_");
+    file_cleanup cleanup{path};
+
+    {
+        shared_memory shm(path.c_str(), 64 * 1024, create_only, access_mode::read_write,
+                          file_options());
+        REQUIRE(shm.is_valid());
+        REQUIRE(shm.is_creator());
+        REQUIRE(shm.size() == 64 * 1024);
+        REQUIRE(std::string(shm.name()) == path);
+        std::memcpy(shm.data(), "persisted", 10);
+        std::memcpy(static_cast<char*>(shm.data()) + shm.size() - 4, "end", 4);
+        REQUIRE_FALSE(shm.flush());
+    }
+
+    // The file outlives every mapping of it
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    REQUIRE(file.is_open());
+    REQUIRE(static_cast<std::size_t>(file.tellg()) == 64 * 1024);
+    file.close();
+
+    shared_memory reopened(path.c_str(), open_existing, access_mode::read_only, file_options());
+    REQUIRE_FALSE(reopened.is_creator());
+    REQUIRE(reopened.size() == 64 * 1024);
+    REQUIRE(std::strcmp(static_cast<const char*>(reopened.data()), "persisted") == 0);
+    REQUIRE(std::strcmp(static_cast<const char*>(reopened.data()) + reopened.size() - 4,
+                        "end") == 0);
+}
+
+TEST_CASE("File-backed segment create and open modes", "[file_backed]") {
+    std::string path = unique_path("slick_file_modes_");
+    file_cleanup cleanup{path};
+
+    shared_memory missing(path.c_str(), open_existing, access_mode::read_write, file_options(),
+                          std::nothrow);
+    REQUIRE_FALSE(missing.is_valid());
+    REQUIRE(missing.last_error() == errc::not_found);
+
+    shared_memory first(path.c_str(), 8192, create_only, access_mode::read_write,
+                        file_options());
+    static_cast<char*>(first.data())[100] = 'k';
+
+    shared_memory again(path.c_str(), 8192, create_only, access_mode::read_write,
+                        file_options(), std::nothrow);
+    REQUIRE_FALSE(again.is_valid());
+    REQUIRE(again.last_error() == errc::already_exists);
+
+    // open_or_create keeps the existing file and its size
+    shared_memory second(path.c_str(), 4096, open_or_create, access_mode::read_write,
+                         file_options());
+    REQUIRE_FALSE(second.is_creator());
+    REQUIRE(second.size() == 8192);
+    REQUIRE(static_cast<char*>(second.data())[100] == 'k');
+
+    // Both mappings share the page cache
+    static_cast<char*>(second.data())[200] = 'v';
+    REQUIRE(static_cast<char*>(first.data())[200] == 'v');
+}
+
+TEST_CASE("File-backed segment argument errors", "[file_backed]") {
+    shared_memory empty_path("", 4096, create_only, access_mode::read_write, file_options(),
+                             std::nothrow);
+    REQUIRE_FALSE(empty_path.is_valid());
+    REQUIRE(empty_path.last_error() == errc::invalid_name);
+
+    std::string path = unique_path("slick_file_errors_");
+    file_cleanup cleanup{path};
+
+    shared_memory zero(path.c_str(), 0, create_only, access_mode::read_write, file_options(),
+                       std::nothrow);
+    REQUIRE_FALSE(zero.is_valid());
+    REQUIRE(zero.last_error() == errc::invalid_size);
+
+    // An empty file can't be mapped
+    std::ofstream(path, std::ios::binary).close();
+    shared_memory empty_file(path.c_str(), open_existing, access_mode::read_only,
+                             file_options(), std::nothrow);
+    REQUIRE_FALSE(empty_file.is_valid());
+    REQUIRE(empty_file.last_error() == errc::invalid_size);
+
+    segment_options huge = file_options();
+    huge.huge_page_policy = huge_pages::required;
+    std::remove(path.c_str());
+    shared_memory huge_file(path.c_str(), 4096, create_only, access_mode::read_write, huge,
+                            std::nothrow);
+    REQUIRE_FALSE(huge_file.is_valid());
+    REQUIRE(huge_file.last_error() == errc::not_supported);
+}
+
+TEST_CASE("Flush ranges of a file-backed segment", "[file_backed]") {
+    std::string path = unique_path("slick_file_flush_");
+    file_cleanup cleanup{path};
+
+    shared_memory shm(path.c_str(), 256 * 1024, create_only, access_mode::read_write,
+                      file_options());
+    std::memset(shm.data(), 0x11, shm.size());
+
+    REQUIRE_FALSE(shm.flush(true));
+    // Unaligned ranges are widened to whole pages
+    REQUIRE_FALSE(shm.flush(12345, 100));
+    REQUIRE_FALSE(shm.flush(4096, 8192, true));
+    REQUIRE_FALSE(shm.flush(shm.size(), 0));
+
+    REQUIRE(shm.flush(shm.size() - 10, 11) == errc::invalid_argument);
+    REQUIRE(shm.flush(shm.size() + 1, 0) == errc::invalid_argument);
+
+    shared_memory closed;
+    REQUIRE(closed.flush() == errc::mapping_failed);
+}
+
+TEST_CASE("Flush is harmless on shared memory segments", "[file_backed]") {
+    auto now = std::chrono::system_clock::now().time_since_epoch();
+    std::string name = "test_file_shm_" + std::to_string(
+        std::chrono::duration_cast<std::chrono::milliseconds>(now).count() % 100000000);
+
+    shared_memory shm(name.c_str(), 4096, create_only);
+    REQUIRE_FALSE(shm.flush());
+    shm.close();
+    shared_memory::remove(name.c_str());
+}
+
+TEST_CASE("Synchronous mapping needs a DAX file system", "[file_backed]") {
+    std::string path = unique_path("slick_file_sync_");
+    file_cleanup cleanup{path};
+
+    segment_options options = file_options();
+    options.sync_mapping = true;
+    shared_memory shm(path.c_str(), 4096, create_only, access_mode::read_write, options,
+                      std::nothrow);
+    if (!shm.is_valid()) {
+        // The working directory is not on persistent memory
+        REQUIRE(shm.last_error() == errc::not_supported);
+    } else {
+        static_cast<char*>(shm.data())[0] = 1;
+        REQUIRE_FALSE(shm.flush());
+    }
+}
+
+TEST_CASE("Mirrored file-backed segment", "[file_backed][mirror]") {
+    std::string path = unique_path("slick_file_mirror_");
+    file_cleanup cleanup{path};
+
+    segment_options options = file_options();
+    options.mirror = true;
+    shared_memory shm(path.c_str(), 1000, create_only, access_mode::read_write, options);
+    REQUIRE(shm.is_mirrored());
+    REQUIRE(shm.size() % shm.page_size() == 0);
+
+    char* base = static_cast<char*>(shm.data());
+    base[shm.size() + 7] = 'w';
+    REQUIRE(base[7] == 'w');
+    REQUIRE_FALSE(shm.flush());
+}
+
+TEST_CASE("Window over a file-backed segment", "[file_backed][window]") {
+    std::string path = unique_path("slick_file_window_");
+    file_cleanup cleanup{path};
+
+    shared_memory shm(path.c_str(), 1024 * 1024, create_only, access_mode::read_write,
+                      file_options());
+    std::memcpy(static_cast<char*>(shm.data()) + 700000, "in the file", 12);
+
+    shared_memory_window window(path.c_str(), open_existing, 700000, 12, access_mode::read_only,
+                                file_options());
+    REQUIRE(window.segment_size() == shm.size());
+    REQUIRE(std::strcmp(static_cast<const char*>(window.data()), "in the file") == 0);
+
+    std::string missing = unique_path("slick_file_nowin_");
+    shared_memory_window none(missing.c_str(), open_existing, 0, 1, access_mode::read_only,
+                              file_options(), std::nothrow);
+    REQUIRE(none.last_error() == errc::not_found);
+}
+
+TEST_CASE("Growable segments can't be file-backed", "[file_backed]") {
+    std::string path = unique_path("slick_file_grow_");
+
+    growable_segment seg(path.c_str(), 4096, 1 << 20, create_only, file_options(), std::nothrow);
+    REQUIRE_FALSE(seg.is_valid());
+    REQUIRE(seg.last_error() == errc::not_supported);
+}
@@ -0,0 +1,220 @@
+#include <catch2/catch_test_macros.hpp>
+#include <slick/shm/shared_memory.hpp>
+#include <slick/shm/managed_segment.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <string>
+
+#ifdef SLICK_SHM_POSIX
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+using namespace slick::shm;
+
+namespace {
+
+std::string unique_name(const char* prefix) {
+    auto now = std::chrono::system_clock::now().time_since_epoch();
+    auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(now).count();
+    // Use modulo to keep the timestamp shorter while still being unique (macOS has 31-char limit)
+    return std::string(prefix) + std::to_string(millis % 100000000);
+}
+
+struct shm_cleanup {
+    std::string name;
+    ~shm_cleanup() {
+        shared_memory::remove(name.c_str());
+    }
+};
+
+// An address range that is free once the probe mapping is gone
+void* free_address(std::size_t size) {
+    shared_memory probe(size, anonymous);
+    return probe.data();
+}
+
+// Nodes linked with raw pointers, valid wherever the segment is mapped at the same base
+struct node {
+    node* next;
+    std::uint64_t value;
+};
+
+void build_list(void* base, std::size_t count) {
+    node* nodes = static_cast<node*>(base);
+    for (std::size_t i = 0; i < count; ++i) {
+        nodes[i].value = i * 10;
+        nodes[i].next = i + 1 < count ? &nodes[i + 1] : nullptr;
+    }
+}
+
+std::uint64_t sum_list(const void* base) {
+    std::uint64_t sum = 0;
+    for (const node* n = static_cast<const node*>(base); n != nullptr; n = n->next) {
+        sum += n->value;
+    }
+    return sum;
+}
+
+}  // namespace
+
+TEST_CASE("Map a segment at a chosen address", "[fixed_address]") {
+    auto name = unique_name("fixaddr");
+    shm_cleanup cleanup{name};
+
+    segment_options options;
+    options.base_address = free_address(64 * 1024);
+    shared_memory shm(name.c_str(), 64 * 1024, create_only, access_mode::read_write, options);
+    REQUIRE(shm.data() == options.base_address);
+
+    build_list(shm.data(), 100);
+    REQUIRE(sum_list(shm.data()) == 49500);
+}
+
+TEST_CASE("Fixed address already in use", "[fixed_address]") {
+    auto name = unique_name("fixbusy");
+    shm_cleanup cleanup{name};
+
+    shared_memory shm(name.c_str(), 64 * 1024, create_only);
+
+    // The creator's own mapping occupies the range
+    segment_options options;
+    options.base_address = shm.data();
+    shared_memory second(name.c_str(), open_existing, access_mode::read_write, options,
+                         std::nothrow);
+    REQUIRE_FALSE(second.is_valid());
+    REQUIRE(second.last_error() == errc::address_in_use);
+
+    REQUIRE_THROWS_AS(shared_memory(name.c_str(), open_existing, access_mode::read_write, options),
+                      shared_memory_error);
+
+    // The existing mapping is untouched
+    std::memset(shm.data(), 0x11, shm.size());
+}
+
+TEST_CASE("Fixed address option errors", "[fixed_address]") {
+    auto name = unique_name("fixbad");
+    shm_cleanup cleanup{name};
+    shared_memory shm(name.c_str(), 64 * 1024, create_only);
+
+    segment_options options;
+    options.base_address = static_cast<char*>(free_address(64 * 1024)) + 64;
+    shared_memory misaligned(name.c_str(), open_existing, access_mode::read_write, options,
+                             std::nothrow);
+    REQUIRE(misaligned.last_error() == errc::invalid_argument);
+
+    options.base_address = free_address(2 * 64 * 1024);
+    options.mirror = true;
+    shared_memory mirrored(name.c_str(), open_existing, access_mode::read_write, options,
+                           std::nothrow);
+    REQUIRE(mirrored.last_error() == errc::not_supported);
+}
+
+TEST_CASE("Attach at the creator's address", "[fixed_address][managed_segment]") {
+    auto name = unique_name("fixmgd");
+    shm_cleanup cleanup{name};
+
+    managed_segment creator(name.c_str(), 4096, create_only);
+    REQUIRE(creator.creator_address() == creator.segment().data());
+    creator.mark_ready();
+
+    managed_segment opener(name.c_str(), open_existing);
+    REQUIRE_FALSE(opener.wait_ready());
+    REQUIRE(opener.creator_address() == creator.segment().data());
+
+    // Same process: the creator's mapping is in the way
+    REQUIRE(opener.map_at_creator_address() == errc::address_in_use);
+    REQUIRE(opener.is_valid());
+    REQUIRE(opener.size() == 4096);
+
+    // Already there
+    REQUIRE_FALSE(creator.map_at_creator_address());
+}
+
+#ifdef SLICK_SHM_POSIX
+TEST_CASE("Share raw pointers across processes", "[fixed_address][cross_process]") {
+    auto name = unique_name("fixproc");
+    shm_cleanup cleanup{name};
+    void* base = free_address(64 * 1024);
+
+    // Fork first so the child's address space doesn't hold the mapping
+    int pipe_fds[2];
+    REQUIRE(pipe(pipe_fds) == 0);
+    pid_t child = fork();
+    REQUIRE(child >= 0);
+    if (child == 0) {
+        ::close(pipe_fds[1]);
+        char c;
+        if (read(pipe_fds[0], &c, 1) != 1) {
+            _exit(1);
+        }
+        segment_options options;
+        options.base_address = base;
+        shared_memory shm(name.c_str(), open_existing, access_mode::read_only, options,
+                          std::nothrow);
+        if (!shm.is_valid() || shm.data() != base) {
+            _exit(2);
+        }
+        _exit(sum_list(shm.data()) == 49500 ? 0 : 3);
+    }
+    ::close(pipe_fds[0]);
+
+    segment_options options;
+    options.base_address = base;
+    shared_memory shm(name.c_str(), 64 * 1024, create_only, access_mode::read_write, options);
+    build_list(shm.data(), 100);
+    char go = 1;
+    REQUIRE(write(pipe_fds[1], &go, 1) == 1);
+    ::close(pipe_fds[1]);
+
+    int status = 0;
+    REQUIRE(waitpid(child, &status, 0) == child);
+    REQUIRE(WIFEXITED(status));
+    REQUIRE(WEXITSTATUS(status) == 0);
+}
+
+TEST_CASE("Remap a managed segment at the creator's address", "[fixed_address][cross_process]") {
+    auto name = unique_name("fixremap");
+    shm_cleanup cleanup{name};
+
+    int pipe_fds[2];
+    REQUIRE(pipe(pipe_fds) == 0);
+    pid_t child = fork();
+    REQUIRE(child >= 0);
+    if (child == 0) {
+        ::close(pipe_fds[1]);
+        char c;
+        if (read(pipe_fds[0], &c, 1) != 1) {
+            _exit(1);
+        }
+        managed_segment seg(name.c_str(), open_existing, 0, access_mode::read_only,
+                            segment_options(), std::nothrow);
+        if (!seg.is_valid() || seg.wait_ready(std::chrono::seconds(5))) {
+            _exit(2);
+        }
+        if (seg.map_at_creator_address()) {
+            _exit(3);
+        }
+        if (seg.segment().data() != seg.creator_address() || !seg.is_ready()) {
+            _exit(4);
+        }
+        _exit(sum_list(seg.data()) == 49500 ? 0 : 5);
+    }
+    ::close(pipe_fds[0]);
+
+    managed_segment seg(name.c_str(), 100 * sizeof(node), create_only);
+    build_list(seg.data(), 100);
+    seg.mark_ready();
+    char go = 1;
+    REQUIRE(write(pipe_fds[1], &go, 1) == 1);
+    ::close(pipe_fds[1]);
+
+    int status = 0;
+    REQUIRE(waitpid(child, &status, 0) == child);
+    REQUIRE(WIFEXITED(status));
+    REQUIRE(WEXITSTATUS(status) == 0);
+}
+#endif
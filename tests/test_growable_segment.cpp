@@ -0,0 +1,264 @@
+#include <catch2/catch_test_macros.hpp>
+#include <slick/shm/growable_segment.hpp>
+#include <slick/shm/shared_memory.hpp>
+
+#include <string>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#ifdef SLICK_SHM_POSIX
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+using namespace slick::shm;
+
+namespace {
+
+std::string unique_name(const char* prefix) {
+    auto now = std::chrono::system_clock::now().time_since_epoch();
+    auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(now).count();
+    // Use modulo to keep the timestamp shorter while still being unique (macOS has 31-char limit)
+    return std::string(prefix) + std::to_string(millis % 100000000);
+}
+
+struct shm_cleanup {
+    std::string name;
+    ~shm_cleanup() {
+        growable_segment::remove(name.c_str());
+    }
+};
+
+constexpr std::size_t MiB = 1024 * 1024;
+
+}  // namespace
+
+TEST_CASE("growable_segment grows in place", "[growable]") {
+    std::string name = unique_name("test_grow_basic_");
+    shm_cleanup cleanup{name};
+
+    growable_segment seg(name.c_str(), 4096, 256 * MiB, create_only);
+    REQUIRE(seg.is_valid());
+    REQUIRE(seg.is_creator());
+    REQUIRE(seg.size() >= 4096);
+    REQUIRE(seg.max_size() >= 256 * MiB);
+    REQUIRE(seg.generation() == 0);
+
+    auto* base = static_cast<unsigned char*>(seg.data());
+    std::memset(base, 0xab, seg.size());
+
+    REQUIRE_FALSE(seg.grow(16 * MiB));
+    REQUIRE(seg.data() == base);
+    REQUIRE(seg.size() >= 16 * MiB);
+    REQUIRE(seg.generation() == 1);
+    REQUIRE(base[0] == 0xab);
+    base[16 * MiB - 1] = 0x5a;  // The new range is mapped and writable
+    REQUIRE(base[16 * MiB - 1] == 0x5a);
+
+    // Asking for less than the current size changes nothing
+    REQUIRE_FALSE(seg.grow(MiB));
+    REQUIRE(seg.size() >= 16 * MiB);
+    REQUIRE(seg.generation() == 1);
+}
+
+TEST_CASE("growable_segment growth is visible to other mappings", "[growable]") {
+    std::string name = unique_name("test_grow_views_");
+    shm_cleanup cleanup{name};
+
+    growable_segment writer(name.c_str(), 64 * 1024, 64 * MiB, create_only);
+    growable_segment reader(name.c_str(), open_existing, access_mode::read_only);
+    REQUIRE(reader.is_valid());
+    REQUIRE_FALSE(reader.is_creator());
+    REQUIRE(reader.size() == writer.size());
+    REQUIRE(reader.max_size() == writer.max_size());
+    REQUIRE_FALSE(reader.stale());
+
+    const void* reader_base = reader.data();
+    REQUIRE_FALSE(writer.grow(8 * MiB));
+    auto* wbase = static_cast<unsigned char*>(writer.data());
+    wbase[8 * MiB - 1] = 42;
+
+    REQUIRE(reader.stale());
+    REQUIRE(reader.size() < 8 * MiB);
+    REQUIRE_FALSE(reader.refresh());
+    REQUIRE_FALSE(reader.stale());
+    REQUIRE(reader.data() == reader_base);
+    REQUIRE(reader.size() == writer.size());
+    REQUIRE(static_cast<const unsigned char*>(reader.data())[8 * MiB - 1] == 42);
+    REQUIRE(reader.generation() == writer.generation());
+
+    // A read_write opener can grow too; the creator catches up with refresh()
+    growable_segment other(name.c_str(), open_existing);
+    REQUIRE_FALSE(other.grow(16 * MiB));
+    REQUIRE(writer.stale());
+    REQUIRE_FALSE(writer.refresh());
+    REQUIRE(writer.size() >= 16 * MiB);
+}
+
+TEST_CASE("growable_segment concurrent growers", "[growable]") {
+    std::string name = unique_name("test_grow_mt_");
+    shm_cleanup cleanup{name};
+
+    growable_segment creator(name.c_str(), 4096, 64 * MiB, create_only);
+    std::atomic<bool> failed{false};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&name, &failed, t] {
+            growable_segment seg(name.c_str(), open_existing);
+            for (std::size_t step = 1; step <= 8; ++step) {
+                std::size_t target = step * MiB + static_cast<std::size_t>(t) * 4096;
+                if (seg.grow(target)) {
+                    failed = true;
+                    return;
+                }
+                static_cast<unsigned char*>(seg.data())[target - 1] = 1;
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    REQUIRE_FALSE(failed);
+
+    // The object never shrank below the largest request
+    REQUIRE_FALSE(creator.refresh());
+    REQUIRE(creator.size() >= 8 * MiB + 3 * 4096);
+    REQUIRE(static_cast<unsigned char*>(creator.data())[8 * MiB + 3 * 4096 - 1] == 1);
+}
+
+TEST_CASE("growable_segment errors", "[growable]") {
+    std::string name = unique_name("test_grow_err_");
+    shm_cleanup cleanup{name};
+
+    SECTION("Invalid sizes") {
+        growable_segment zero(name.c_str(), 0, MiB, create_only, segment_options(), std::nothrow);
+        REQUIRE(zero.last_error() == errc::invalid_size);
+        growable_segment inverted(name.c_str(), 2 * MiB, MiB, create_only, segment_options(),
+                                  std::nothrow);
+        REQUIRE(inverted.last_error() == errc::invalid_size);
+    }
+
+    SECTION("Growing past the reservation or through a read-only view") {
+        growable_segment seg(name.c_str(), 4096, MiB, create_only);
+        REQUIRE(seg.grow(seg.max_size() + 1) == errc::invalid_size);
+        REQUIRE_FALSE(seg.grow(seg.max_size()));
+
+        growable_segment reader(name.c_str(), open_existing, access_mode::read_only);
+        REQUIRE(reader.grow(4096) == errc::permission_denied);
+    }
+
+    SECTION("Open errors") {
+        growable_segment missing(name.c_str(), open_existing, access_mode::read_write,
+                                 segment_options(), std::nothrow);
+        REQUIRE_FALSE(missing.is_valid());
+        REQUIRE(missing.last_error() == errc::not_found);
+
+        shared_memory plain(name.c_str(), 4096, create_only);
+        // All zero, it looks like a header that is still being written
+        growable_segment unpublished(name.c_str(), open_existing, access_mode::read_write,
+                                     segment_options(), std::nothrow);
+        REQUIRE(unpublished.last_error() == errc::timed_out);
+
+        std::memset(plain.data(), 0xff, plain.size());
+        growable_segment not_growable(name.c_str(), open_existing, access_mode::read_write,
+                                      segment_options(), std::nothrow);
+        REQUIRE(not_growable.last_error() == errc::incompatible_layout);
+        REQUIRE_THROWS_AS(growable_segment(name.c_str(), open_existing), shared_memory_error);
+        shared_memory::remove(name.c_str());
+    }
+
+    SECTION("Size past the reservation") {
+        growable_segment seg(name.c_str(), 4096, MiB, create_only);
+        shared_memory raw(name.c_str(), open_existing);
+        auto* header = static_cast<detail::growable_header*>(raw.data());
+        header->size.store(header->max_size + 4096);
+        growable_segment corrupt(name.c_str(), open_existing, access_mode::read_write,
+                                 segment_options(), std::nothrow);
+        REQUIRE_FALSE(corrupt.is_valid());
+        REQUIRE(corrupt.last_error() == errc::incompatible_layout);
+    }
+
+    SECTION("Existing name") {
+        growable_segment first(name.c_str(), 4096, MiB, create_only);
+        growable_segment second(name.c_str(), 4096, MiB, create_only, segment_options(),
+                                std::nothrow);
+        REQUIRE(second.last_error() == errc::already_exists);
+    }
+
+    SECTION("Unsupported options") {
+        segment_options options;
+        options.huge_page_policy = huge_pages::required;
+        growable_segment seg(name.c_str(), 4096, MiB, create_only, options, std::nothrow);
+        REQUIRE(seg.last_error() == errc::not_supported);
+    }
+}
+
+TEST_CASE("growable_segment move", "[growable]") {
+    std::string name = unique_name("test_grow_move_");
+    shm_cleanup cleanup{name};
+
+    growable_segment a(name.c_str(), 4096, MiB, create_only);
+    void* base = a.data();
+    growable_segment b(std::move(a));
+    REQUIRE_FALSE(a.is_valid());
+    REQUIRE(b.data() == base);
+    REQUIRE_FALSE(b.grow(MiB / 2));
+    REQUIRE(b.data() == base);
+}
+
+TEST_CASE("growable_segment open racing with the creator", "[growable]") {
+    std::string base = unique_name("test_grow_race_");
+    constexpr int rounds = 20;
+
+    for (int round = 0; round < rounds; ++round) {
+        std::string name = base + "_" + std::to_string(round);
+        shm_cleanup cleanup{name};
+
+        std::atomic<bool> opened(false);
+        std::atomic<int> unexpected(0);
+        std::thread opener([&] {
+            auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+            while (std::chrono::steady_clock::now() < deadline) {
+                growable_segment seg(name.c_str(), open_existing, access_mode::read_write,
+                                     segment_options(), std::nothrow);
+                if (seg.is_valid()) {
+                    opened = seg.size() >= 4096;
+                    return;
+                }
+                // Retryable while the creator sets the segment up
+                if (seg.last_error() != errc::not_found &&
+                    seg.last_error() != errc::invalid_size) {
+                    unexpected = seg.last_error().value();
+                    return;
+                }
+                std::this_thread::yield();
+            }
+        });
+        growable_segment creator(name.c_str(), 4096, 16 * MiB, create_only);
+        opener.join();
+
+        REQUIRE(unexpected == 0);
+        REQUIRE(opened);
+    }
+}
+
+#ifdef SLICK_SHM_POSIX
+TEST_CASE("growable_segment open of an unsized object is retryable", "[growable]") {
+    std::string name = unique_name("test_grow_unsized_");
+    shm_cleanup cleanup{name};
+
+    // What an opener sees between the creator's shm_open() and ftruncate()
+    std::string formatted = "/" + name;
+    int fd = shm_open(formatted.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    REQUIRE(fd != -1);
+    growable_segment seg(name.c_str(), open_existing, access_mode::read_write, segment_options(),
+                         std::nothrow);
+    ::close(fd);
+    REQUIRE(seg.last_error() == errc::invalid_size);
+}
+#endif
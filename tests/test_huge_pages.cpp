@@ -0,0 +1,155 @@
+#include <catch2/catch_test_macros.hpp>
+#include <slick/shm/shared_memory.hpp>
+
+#include <string>
+#include <chrono>
+#include <cstring>
+
+using namespace slick::shm;
+
+namespace {
+
+std::string unique_name(const char* prefix) {
+    auto now = std::chrono::system_clock::now().time_since_epoch();
+    auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(now).count();
+    // Use modulo to keep the timestamp shorter while still being unique (macOS has 31-char limit)
+    return std::string(prefix) + std::to_string(millis % 100000000);
+}
+
+struct shm_cleanup {
+    std::string name;
+    ~shm_cleanup() {
+        shared_memory::remove(name.c_str());
+    }
+};
+
+segment_options huge_options(huge_pages policy) {
+    segment_options options;
+    options.huge_page_policy = policy;
+    return options;
+}
+
+}  // namespace
+
+TEST_CASE("Standard pages by default", "[huge_pages]") {
+    std::string name = unique_name("test_std_pages");
+    shm_cleanup cleanup{name};
+
+    shared_memory shm(name.c_str(), 4096, create_only);
+    REQUIRE(shm.is_valid());
+    REQUIRE_FALSE(shm.uses_huge_pages());
+    REQUIRE(shm.page_size() > 0);
+}
+
+TEST_CASE("Preferred huge pages always succeed", "[huge_pages]") {
+    std::string name = unique_name("test_huge_pref");
+    shm_cleanup cleanup{name};
+
+    shared_memory shm(name.c_str(), 1000, create_only, access_mode::read_write,
+                      huge_options(huge_pages::preferred));
+    REQUIRE(shm.is_valid());
+    REQUIRE(shm.size() >= 1000);
+
+    if (shm.uses_huge_pages()) {
+        // Size is rounded up to the huge page size
+        REQUIRE(shm.page_size() > 4096);
+        REQUIRE(shm.size() % shm.page_size() == 0);
+    }
+
+    std::memset(shm.data(), 0xAB, shm.size());
+
+    SECTION("Opener sees the same backing") {
+        shared_memory opener(name.c_str(), open_existing);
+        REQUIRE(opener.is_valid());
+        REQUIRE(opener.size() == shm.size());
+        REQUIRE(opener.uses_huge_pages() == shm.uses_huge_pages());
+        REQUIRE(opener.page_size() == shm.page_size());
+        REQUIRE(static_cast<const unsigned char*>(opener.data())[0] == 0xAB);
+    }
+
+    SECTION("exists() and remove() find the segment") {
+        REQUIRE(shared_memory::exists(name.c_str()));
+        shm.close();
+        REQUIRE(shared_memory::remove(name.c_str()));
+        REQUIRE_FALSE(shared_memory::exists(name.c_str()));
+    }
+}
+
+TEST_CASE("Required huge pages succeed or report huge_pages_unavailable", "[huge_pages]") {
+    std::string name = unique_name("test_huge_req");
+    shm_cleanup cleanup{name};
+
+    shared_memory shm(name.c_str(), 4096, create_only, access_mode::read_write,
+                      huge_options(huge_pages::required), std::nothrow);
+    if (shm.is_valid()) {
+        REQUIRE(shm.uses_huge_pages());
+        REQUIRE(shm.size() % shm.page_size() == 0);
+    } else {
+        REQUIRE(shm.last_error() == errc::huge_pages_unavailable);
+        REQUIRE_FALSE(shared_memory::exists(name.c_str()));
+    }
+}
+
+TEST_CASE("Unsupported huge page size", "[huge_pages]") {
+    std::string name = unique_name("test_huge_size");
+    shm_cleanup cleanup{name};
+
+    segment_options options = huge_options(huge_pages::required);
+    options.huge_page_size = 12345;  // Not a valid huge page size anywhere
+
+    shared_memory shm(name.c_str(), 4096, create_only, access_mode::read_write, options,
+                      std::nothrow);
+    REQUIRE_FALSE(shm.is_valid());
+    REQUIRE(shm.last_error() == errc::huge_pages_unavailable);
+
+    options.huge_page_policy = huge_pages::preferred;
+    shared_memory fallback(name.c_str(), 4096, create_only, access_mode::read_write, options);
+    REQUIRE(fallback.is_valid());
+    REQUIRE_FALSE(fallback.uses_huge_pages());
+}
+
+TEST_CASE("Huge and standard segments share one namespace", "[huge_pages]") {
+    std::string name = unique_name("test_huge_ns");
+    shm_cleanup cleanup{name};
+
+    SECTION("Huge page segment first") {
+        shared_memory huge(name.c_str(), 4096, create_only, access_mode::read_write,
+                           huge_options(huge_pages::required), std::nothrow);
+        if (!huge.is_valid()) {
+            REQUIRE(huge.last_error() == errc::huge_pages_unavailable);
+            return;
+        }
+        std::memset(huge.data(), 0x5a, 16);
+
+        shared_memory plain(name.c_str(), 4096, create_only, access_mode::read_write,
+                            segment_options(), std::nothrow);
+        REQUIRE(plain.last_error() == errc::already_exists);
+
+        shared_memory either(name.c_str(), 4096, open_or_create);
+        REQUIRE_FALSE(either.is_creator());
+        REQUIRE(either.uses_huge_pages());
+        REQUIRE(static_cast<const unsigned char*>(either.data())[0] == 0x5a);
+
+        shared_memory opener(name.c_str(), open_existing);
+        REQUIRE(static_cast<const unsigned char*>(opener.data())[0] == 0x5a);
+    }
+
+    SECTION("Standard segment first") {
+        shared_memory plain(name.c_str(), 4096, create_only);
+        std::memset(plain.data(), 0xa5, 16);
+
+        shared_memory huge(name.c_str(), 4096, create_only, access_mode::read_write,
+                           huge_options(huge_pages::required), std::nothrow);
+        REQUIRE_FALSE(huge.is_valid());
+        if (huge.last_error() != errc::huge_pages_unavailable) {
+            REQUIRE(huge.last_error() == errc::already_exists);
+        }
+
+        shared_memory either(name.c_str(), 4096, open_or_create, access_mode::read_write,
+                             huge_options(huge_pages::preferred));
+        REQUIRE_FALSE(either.is_creator());
+        REQUIRE_FALSE(either.uses_huge_pages());
+        REQUIRE(either.size() == plain.size());
+        REQUIRE(static_cast<const unsigned char*>(either.data())[0] == 0xa5);
+    }
+}
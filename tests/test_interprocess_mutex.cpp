@@ -0,0 +1,155 @@
+#include <catch2/catch_test_macros.hpp>
+#include <slick/shm/interprocess_mutex.hpp>
+#include <slick/shm/shared_memory.hpp>
+
+#include <string>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <vector>
+
+#ifdef SLICK_SHM_POSIX
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+using namespace slick::shm;
+
+namespace {
+
+std::string unique_name(const char* prefix) {
+    auto now = std::chrono::system_clock::now().time_since_epoch();
+    auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(now).count();
+    // Use modulo to keep the timestamp shorter while still being unique (macOS has 31-char limit)
+    return std::string(prefix) + std::to_string(millis % 100000000);
+}
+
+struct shm_cleanup {
+    std::string name;
+    ~shm_cleanup() {
+        shared_memory::remove(name.c_str());
+    }
+};
+
+struct guarded_block {
+    interprocess_mutex lock;
+    std::uint64_t a;
+    std::uint64_t b;
+};
+
+guarded_block* block_of(shared_memory& shm) {
+    return static_cast<guarded_block*>(shm.data());
+}
+
+}  // namespace
+
+TEST_CASE("interprocess_mutex in a zero-filled segment", "[interprocess_mutex]") {
+    std::string name = unique_name("test_ipmtx_basic");
+    shm_cleanup cleanup{name};
+
+    shared_memory shm(name.c_str(), sizeof(guarded_block), create_only);
+    guarded_block* block = block_of(shm);
+
+    block->lock.lock();
+    REQUIRE_FALSE(block->lock.recovered());
+    REQUIRE_FALSE(block->lock.try_lock());
+    block->lock.unlock();
+
+    REQUIRE(block->lock.try_lock());
+    block->lock.unlock();
+
+    {
+        std::lock_guard<interprocess_mutex> guard(block->lock);
+        block->a = 1;
+    }
+    REQUIRE(block->lock.try_lock());
+    block->lock.unlock();
+}
+
+TEST_CASE("interprocess_mutex initialized once by the creator", "[interprocess_mutex]") {
+    std::string name = unique_name("test_ipmtx_init");
+    shm_cleanup cleanup{name};
+
+    shared_memory creator(name.c_str(), sizeof(guarded_block), open_or_create);
+    REQUIRE(creator.is_creator());
+    std::memset(creator.data(), 0xFF, creator.size());  // Stale contents
+    if (creator.is_creator()) {
+        new (&block_of(creator)->lock) interprocess_mutex();
+    }
+
+    shared_memory opener(name.c_str(), sizeof(guarded_block), open_or_create);
+    REQUIRE_FALSE(opener.is_creator());
+    guarded_block* block = block_of(opener);
+    REQUIRE(block->lock.try_lock());
+    REQUIRE_FALSE(block_of(creator)->lock.try_lock());
+    block->lock.unlock();
+}
+
+TEST_CASE("interprocess_mutex mutual exclusion across mappings", "[interprocess_mutex]") {
+    std::string name = unique_name("test_ipmtx_mt");
+    shm_cleanup cleanup{name};
+
+    shared_memory shm(name.c_str(), sizeof(guarded_block), create_only);
+
+    constexpr int thread_count = 4;
+    constexpr int iterations = 20000;
+    std::vector<std::thread> threads;
+    bool consistent = true;
+    for (int t = 0; t < thread_count; ++t) {
+        threads.emplace_back([&name, &consistent] {
+            // Every thread uses its own mapping, as separate processes would
+            shared_memory mapping(name.c_str(), open_existing);
+            guarded_block* block = block_of(mapping);
+            for (int i = 0; i < iterations; ++i) {
+                std::lock_guard<interprocess_mutex> guard(block->lock);
+                if (block->a != block->b) {
+                    consistent = false;
+                }
+                ++block->a;
+                ++block->b;
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    guarded_block* block = block_of(shm);
+    REQUIRE(consistent);
+    REQUIRE(block->a == static_cast<std::uint64_t>(thread_count) * iterations);
+    REQUIRE(block->b == block->a);
+}
+
+#ifdef SLICK_SHM_POSIX
+TEST_CASE("interprocess_mutex recovers from owner death", "[interprocess_mutex]") {
+    std::string name = unique_name("test_ipmtx_dead");
+    shm_cleanup cleanup{name};
+
+    shared_memory shm(name.c_str(), sizeof(guarded_block), create_only);
+    guarded_block* block = block_of(shm);
+
+    pid_t child = fork();
+    REQUIRE(child >= 0);
+    if (child == 0) {
+        // Die in the middle of an update while holding the lock
+        block->lock.lock();
+        block->a = 42;
+        _exit(0);
+    }
+    int status = 0;
+    REQUIRE(waitpid(child, &status, 0) == child);
+
+    block->lock.lock();
+    REQUIRE(block->lock.recovered());
+    REQUIRE(block->a == 42);
+    block->b = block->a;  // Repair
+    block->lock.unlock();
+
+    block->lock.lock();
+    REQUIRE_FALSE(block->lock.recovered());
+    block->lock.unlock();
+}
+#endif
@@ -0,0 +1,250 @@
+#include <catch2/catch_test_macros.hpp>
+#include <slick/shm/shared_memory.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <string>
+#include <thread>
+
+#ifdef SLICK_SHM_POSIX
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+using namespace slick::shm;
+
+namespace {
+
+std::string unique_name(const char* prefix) {
+    auto now = std::chrono::system_clock::now().time_since_epoch();
+    auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(now).count();
+    // Use modulo to keep the timestamp shorter while still being unique (macOS has 31-char limit)
+    return std::string(prefix) + std::to_string(millis % 100000000);
+}
+
+struct shm_cleanup {
+    std::string name;
+    ~shm_cleanup() {
+        shared_memory::remove(name.c_str());
+    }
+};
+
+segment_options ref_counted() {
+    segment_options options;
+    options.lifetime = segment_lifetime::ref_counted;
+    return options;
+}
+
+}  // namespace
+
+TEST_CASE("ref_counted segment is removed by the last detach", "[lifetime]") {
+    std::string name = unique_name("test_life_last");
+    shm_cleanup cleanup{name};
+
+    auto creator = std::make_unique<shared_memory>(name.c_str(), 1000, create_only,
+                                                   access_mode::read_write, ref_counted());
+    REQUIRE(creator->size() >= 1000);
+    std::memset(creator->data(), 0x5a, creator->size());  // The table is past size()
+
+    auto opener = std::make_unique<shared_memory>(name.c_str(), open_existing,
+                                                  access_mode::read_write, ref_counted());
+    REQUIRE(opener->size() == creator->size());
+    REQUIRE(static_cast<unsigned char*>(opener->data())[opener->size() - 1] == 0x5a);
+
+    // A second handle in the same process
+    shared_memory again(name.c_str(), 1000, open_or_create, access_mode::read_write,
+                        ref_counted());
+    REQUIRE_FALSE(again.is_creator());
+
+    creator.reset();
+    REQUIRE(shared_memory::exists(name.c_str()));
+    opener.reset();
+    REQUIRE(shared_memory::exists(name.c_str()));
+    again.close();
+    REQUIRE_FALSE(shared_memory::exists(name.c_str()));
+
+    // The name can be used again right away
+    shared_memory fresh(name.c_str(), 1000, open_or_create, access_mode::read_write,
+                        ref_counted());
+    REQUIRE(fresh.is_creator());
+}
+
+TEST_CASE("manual segments outlive their processes", "[lifetime]") {
+    std::string name = unique_name("test_life_manual");
+    shm_cleanup cleanup{name};
+
+    { shared_memory shm(name.c_str(), 1000, create_only); }
+    REQUIRE(shared_memory::exists(name.c_str()));
+}
+
+TEST_CASE("read-only openers of a ref_counted segment", "[lifetime]") {
+    std::string name = unique_name("test_life_ro");
+    shm_cleanup cleanup{name};
+
+    auto creator = std::make_unique<shared_memory>(name.c_str(), 4096, create_only,
+                                                   access_mode::read_write, ref_counted());
+    std::memcpy(creator->data(), "tick", 5);
+
+    // Not counted (it can't write the table), and the mapping stays valid
+    shared_memory reader(name.c_str(), open_existing, access_mode::read_only);
+    REQUIRE(reader.size() == creator->size());
+    creator.reset();
+#ifdef SLICK_SHM_POSIX
+    REQUIRE_FALSE(shared_memory::exists(name.c_str()));  // Windows: the reader keeps it
+#endif
+    REQUIRE(std::strcmp(static_cast<const char*>(reader.data()), "tick") == 0);
+}
+
+TEST_CASE("ref_counted rejects unsupported options", "[lifetime]") {
+    std::string name = unique_name("test_life_opts");
+    shm_cleanup cleanup{name};
+
+    segment_options mirror = ref_counted();
+    mirror.mirror = true;
+    shared_memory mirrored(name.c_str(), 4096, create_only, access_mode::read_write, mirror,
+                           std::nothrow);
+    REQUIRE(mirrored.last_error() == errc::invalid_argument);
+
+    shared_memory truncating(name.c_str(), 4096, open_always, access_mode::read_write,
+                             ref_counted(), std::nothrow);
+    REQUIRE(truncating.last_error() == errc::invalid_argument);
+    REQUIRE_FALSE(shared_memory::exists(name.c_str()));
+}
+
+TEST_CASE("open_or_create racing with the last detach", "[lifetime]") {
+    std::string name = unique_name("test_life_race");
+    shm_cleanup cleanup{name};
+
+    // Each handle may be the last one, so the other thread's open_or_create
+    // keeps running into segments that are being unlinked
+    std::atomic<int> failures{0};
+    auto churn = [&] {
+        for (int i = 0; i < 500; ++i) {
+            shared_memory shm(name.c_str(), 4096, open_or_create, access_mode::read_write,
+                              ref_counted(), std::nothrow);
+            if (!shm.is_valid()) {
+                failures.fetch_add(1);
+            }
+        }
+    };
+    std::thread other(churn);
+    churn();
+    other.join();
+
+    REQUIRE(failures.load() == 0);
+    REQUIRE_FALSE(shared_memory::exists(name.c_str()));
+}
+
+#ifdef SLICK_SHM_POSIX
+TEST_CASE("ref_counted opener of a manual segment", "[lifetime]") {
+    std::string name = unique_name("test_life_plain");
+    shm_cleanup cleanup{name};
+
+    shared_memory plain(name.c_str(), 4096, create_only);
+    shared_memory opener(name.c_str(), open_existing, access_mode::read_write, ref_counted(),
+                         std::nothrow);
+    REQUIRE(opener.last_error() == errc::incompatible_layout);
+    REQUIRE_FALSE(opener.is_valid());
+
+    // Without the option it is a plain opener
+    shared_memory other(name.c_str(), open_existing);
+    REQUIRE(other.size() == plain.size());
+}
+
+TEST_CASE("sweep() removes segments whose processes died", "[lifetime]") {
+    std::string name = unique_name("test_life_sweep");
+    shm_cleanup cleanup{name};
+
+    pid_t child = fork();
+    REQUIRE(child >= 0);
+    if (child == 0) {
+        shared_memory creator(name.c_str(), 4096, create_only, access_mode::read_write,
+                              ref_counted(), std::nothrow);
+        _exit(creator.is_valid() ? 0 : 1);  // Crash without detaching
+    }
+    int status = 0;
+    REQUIRE(waitpid(child, &status, 0) == child);
+    REQUIRE(WEXITSTATUS(status) == 0);
+    REQUIRE(shared_memory::exists(name.c_str()));
+
+#ifdef SLICK_SHM_LINUX
+    REQUIRE(shared_memory::sweep("test_life_none_") == 0);
+    REQUIRE(shared_memory::exists(name.c_str()));
+    REQUIRE(shared_memory::sweep(name.c_str()) == 1);
+    REQUIRE_FALSE(shared_memory::exists(name.c_str()));
+#endif
+}
+
+#ifdef SLICK_SHM_LINUX
+TEST_CASE("sweep() keeps segments with live processes", "[lifetime]") {
+    std::string name = unique_name("test_life_live");
+    shm_cleanup cleanup{name};
+
+    auto creator = std::make_unique<shared_memory>(name.c_str(), 4096, create_only,
+                                                   access_mode::read_write, ref_counted());
+    shared_memory manual((name + "_m").c_str(), 4096, create_only);
+    shm_cleanup manual_cleanup{name + "_m"};
+
+    pid_t child = fork();
+    REQUIRE(child >= 0);
+    if (child == 0) {
+        shared_memory opener(name.c_str(), open_existing, access_mode::read_write,
+                             ref_counted(), std::nothrow);
+        _exit(opener.is_valid() ? 0 : 1);  // Crash without detaching
+    }
+    int status = 0;
+    REQUIRE(waitpid(child, &status, 0) == child);
+    REQUIRE(WEXITSTATUS(status) == 0);
+
+    // Only the dead child's slot is reclaimed, and manual segments are left alone
+    REQUIRE(shared_memory::sweep(name.c_str()) == 0);
+    REQUIRE(shared_memory::exists(name.c_str()));
+    REQUIRE(shared_memory::exists((name + "_m").c_str()));
+
+    creator.reset();
+    REQUIRE_FALSE(shared_memory::exists(name.c_str()));
+}
+#endif
+
+TEST_CASE("attach reclaims the slots of dead processes", "[lifetime]") {
+    std::string name = unique_name("test_life_reclaim");
+    shm_cleanup cleanup{name};
+
+    auto creator = std::make_unique<shared_memory>(name.c_str(), 4096, create_only,
+                                                   access_mode::read_write, ref_counted());
+
+    pid_t child = fork();
+    REQUIRE(child >= 0);
+    if (child == 0) {
+        shared_memory opener(name.c_str(), open_existing, access_mode::read_write,
+                             ref_counted(), std::nothrow);
+        _exit(opener.is_valid() ? 0 : 1);
+    }
+    int status = 0;
+    REQUIRE(waitpid(child, &status, 0) == child);
+    REQUIRE(WEXITSTATUS(status) == 0);
+
+    // Opening from a new slot drops the dead child's count
+    {
+        pid_t second = fork();
+        REQUIRE(second >= 0);
+        if (second == 0) {
+            bool valid = false;
+            {
+                shared_memory opener(name.c_str(), open_existing, access_mode::read_write,
+                                     ref_counted(), std::nothrow);
+                valid = opener.is_valid();
+            }  // Detaches properly
+            _exit(valid ? 0 : 1);
+        }
+        REQUIRE(waitpid(second, &status, 0) == second);
+        REQUIRE(WEXITSTATUS(status) == 0);
+    }
+
+    creator.reset();
+    REQUIRE_FALSE(shared_memory::exists(name.c_str()));
+}
+#endif
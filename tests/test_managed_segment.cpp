@@ -0,0 +1,228 @@
+#include <catch2/catch_test_macros.hpp>
+#include <slick/shm/shared_memory.hpp>
+#include <slick/shm/managed_segment.hpp>
+#include <slick/shm/segment_layout.hpp>
+
+#include <atomic>
+#include <string>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <thread>
+
+#ifdef SLICK_SHM_POSIX
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+using namespace slick::shm;
+
+namespace {
+
+std::string unique_name(const char* prefix) {
+    auto now = std::chrono::system_clock::now().time_since_epoch();
+    auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(now).count();
+    // Use modulo to keep the timestamp shorter while still being unique (macOS has 31-char limit)
+    return std::string(prefix) + std::to_string(millis % 100000000);
+}
+
+struct shm_cleanup {
+    std::string name;
+    ~shm_cleanup() {
+        shared_memory::remove(name.c_str());
+    }
+};
+
+struct book {
+    std::uint64_t levels;
+    double prices[16];
+};
+
+using book_layout = segment_layout<region<book>, array_region<std::uint64_t, 32>>;
+
+constexpr std::uint64_t BOOK_VERSION = 3;
+
+}  // namespace
+
+TEST_CASE("managed_segment creator writes the header", "[managed_segment]") {
+    std::string name = unique_name("test_managed_hdr_");
+    shm_cleanup cleanup{name};
+
+    auto before = std::chrono::system_clock::now();
+    managed_segment seg(name.c_str(), sizeof(book), create_only, BOOK_VERSION);
+    REQUIRE(seg.is_valid());
+    REQUIRE(seg.is_creator());
+    REQUIRE(seg.size() == sizeof(book));
+    REQUIRE(seg.state() == segment_state::initializing);
+    REQUIRE_FALSE(seg.is_ready());
+    REQUIRE(seg.layout_version() == BOOK_VERSION);
+    REQUIRE(seg.creation_time() >= before - std::chrono::seconds(1));
+    REQUIRE(seg.creation_time() <= std::chrono::system_clock::now() + std::chrono::seconds(1));
+    REQUIRE(seg.creator_alive());
+    REQUIRE(std::string(seg.name()) == name);
+
+    // The data follows the header on its own cache line
+    REQUIRE(static_cast<char*>(seg.data()) ==
+            static_cast<char*>(seg.segment().data()) + managed_segment::data_offset());
+    REQUIRE(reinterpret_cast<std::uintptr_t>(seg.data()) % slick::shm::detail::cache_line_size ==
+            0);
+
+    seg.mark_ready();
+    REQUIRE(seg.is_ready());
+    REQUIRE_FALSE(seg.wait_ready());
+}
+
+TEST_CASE("managed_segment opener waits for mark_ready", "[managed_segment]") {
+    std::string name = unique_name("test_managed_wait_");
+    shm_cleanup cleanup{name};
+
+    managed_segment creator(name.c_str(), sizeof(book), create_only, BOOK_VERSION);
+    managed_segment opener(name.c_str(), open_existing, BOOK_VERSION);
+    REQUIRE_FALSE(opener.is_creator());
+    REQUIRE(opener.state() == segment_state::initializing);
+
+    REQUIRE(opener.wait_ready(std::chrono::milliseconds(20)) == errc::timed_out);
+
+    std::thread init([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        static_cast<book*>(creator.data())->levels = 12;
+        creator.mark_ready();
+    });
+    std::error_code ec = opener.wait_ready(std::chrono::seconds(10));
+    init.join();
+
+    REQUIRE_FALSE(ec);
+    REQUIRE(opener.is_ready());
+    REQUIRE(opener.size() == sizeof(book));
+    REQUIRE(static_cast<const book*>(opener.data())->levels == 12);
+    REQUIRE(opener.creator_pid() == creator.creator_pid());
+}
+
+TEST_CASE("managed_segment read-only openers poll", "[managed_segment]") {
+    std::string name = unique_name("test_managed_ro_");
+    shm_cleanup cleanup{name};
+
+    managed_segment creator(name.c_str(), 64, create_only);
+    managed_segment reader(name.c_str(), open_existing, 0, access_mode::read_only);
+    REQUIRE(reader.wait_ready(std::chrono::milliseconds(5)) == errc::timed_out);
+
+    std::thread init([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        creator.mark_ready();
+    });
+    REQUIRE_FALSE(reader.wait_ready(std::chrono::seconds(10)));
+    init.join();
+}
+
+TEST_CASE("managed_segment rejects other layouts", "[managed_segment]") {
+    std::string name = unique_name("test_managed_ver_");
+    shm_cleanup cleanup{name};
+
+    managed_segment creator(name.c_str(), book_layout::size, create_only,
+                            book_layout::fingerprint);
+
+    // Not ready yet: the version is checked once the creator is done
+    managed_segment early(name.c_str(), open_existing, book_layout::fingerprint + 1,
+                          access_mode::read_write, segment_options(), std::nothrow);
+    REQUIRE(early.is_valid());
+    creator.mark_ready();
+    REQUIRE(early.wait_ready() == errc::incompatible_layout);
+
+    managed_segment late(name.c_str(), open_existing, BOOK_VERSION, access_mode::read_write,
+                         segment_options(), std::nothrow);
+    REQUIRE_FALSE(late.is_valid());
+    REQUIRE(late.last_error() == errc::incompatible_layout);
+    REQUIRE_THROWS_AS(managed_segment(name.c_str(), open_existing, BOOK_VERSION),
+                      shared_memory_error);
+
+    // 0 accepts any layout
+    managed_segment any(name.c_str(), open_existing);
+    REQUIRE_FALSE(any.wait_ready());
+    REQUIRE(any.layout_version() == book_layout::fingerprint);
+
+    managed_segment matching(name.c_str(), open_existing, book_layout::fingerprint);
+    auto view = book_layout::view(matching.data());
+    view.get<book>()->levels = 5;
+    REQUIRE(static_cast<book*>(creator.data())->levels == 5);
+}
+
+TEST_CASE("managed_segment errors", "[managed_segment]") {
+    std::string name = unique_name("test_managed_err_");
+
+    managed_segment missing(name.c_str(), open_existing, 0, access_mode::read_write,
+                            segment_options(), std::nothrow);
+    REQUIRE_FALSE(missing.is_valid());
+    REQUIRE(missing.last_error() == errc::not_found);
+    REQUIRE(missing.data() == nullptr);
+    REQUIRE(missing.size() == 0);
+    REQUIRE(missing.wait_ready() == errc::mapping_failed);
+
+    managed_segment empty(name.c_str(), 0, create_only, 0, segment_options(), std::nothrow);
+    REQUIRE(empty.last_error() == errc::invalid_size);
+
+    // A plain segment never becomes ready
+    shm_cleanup cleanup{name};
+    shared_memory plain(name.c_str(), 4096, create_only);
+    managed_segment opener(name.c_str(), open_existing);
+    REQUIRE(opener.state() == segment_state::uninitialized);
+    REQUIRE(opener.wait_ready(std::chrono::milliseconds(5)) == errc::timed_out);
+
+    managed_segment moved(std::move(opener));
+    REQUIRE_FALSE(opener.is_valid());
+    REQUIRE(moved.is_valid());
+}
+
+#ifdef SLICK_SHM_POSIX
+TEST_CASE("Opening an object that is not sized yet", "[managed_segment]") {
+    std::string name = unique_name("test_managed_zero_");
+    shm_cleanup cleanup{name};
+
+    // What an opener sees between the creator's shm_open() and ftruncate()
+    std::string posix_name = "/" + name;
+    int fd = shm_open(posix_name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    REQUIRE(fd >= 0);
+    ::close(fd);
+
+    managed_segment seg(name.c_str(), open_existing, 0, access_mode::read_write,
+                        segment_options(), std::nothrow);
+    REQUIRE(seg.last_error() == errc::invalid_size);
+}
+
+TEST_CASE("managed_segment attach across processes", "[managed_segment][cross_process]") {
+    std::string name = unique_name("test_managed_xp_");
+    shm_cleanup cleanup{name};
+
+    managed_segment creator(name.c_str(), sizeof(book), create_only, BOOK_VERSION);
+
+    pid_t child = fork();
+    REQUIRE(child >= 0);
+    if (child == 0) {
+        managed_segment seg(name.c_str(), open_existing, BOOK_VERSION, access_mode::read_write,
+                            segment_options(), std::nothrow);
+        if (!seg.is_valid()) {
+            _exit(1);
+        }
+        wait_policy block_now;
+        block_now.spin_count = 0;
+        if (seg.wait_ready(std::chrono::seconds(10), block_now)) {
+            _exit(2);
+        }
+        const book* b = static_cast<const book*>(seg.data());
+        _exit(b->levels == 7 && b->prices[3] == 99.5 ? 0 : 3);
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    book* b = static_cast<book*>(creator.data());
+    b->levels = 7;
+    b->prices[3] = 99.5;
+    creator.mark_ready();
+
+    int status = 0;
+    REQUIRE(waitpid(child, &status, 0) == child);
+    REQUIRE(WIFEXITED(status));
+    REQUIRE(WEXITSTATUS(status) == 0);
+}
+#endif
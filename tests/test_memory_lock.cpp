@@ -0,0 +1,109 @@
+#include <catch2/catch_test_macros.hpp>
+#include <slick/shm/shared_memory.hpp>
+
+#include <string>
+#include <chrono>
+
+using namespace slick::shm;
+
+namespace {
+
+std::string unique_name(const char* prefix) {
+    auto now = std::chrono::system_clock::now().time_since_epoch();
+    auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(now).count();
+    // Use modulo to keep the timestamp shorter while still being unique (macOS has 31-char limit)
+    return std::string(prefix) + std::to_string(millis % 100000000);
+}
+
+struct shm_cleanup {
+    std::string name;
+    ~shm_cleanup() {
+        shared_memory::remove(name.c_str());
+    }
+};
+
+// Locking may legitimately fail on machines with a small memory lock limit
+bool is_lock_limit(std::error_code ec) {
+    return ec == errc::lock_limit_exceeded || ec == errc::working_set_quota_exceeded;
+}
+
+}  // namespace
+
+TEST_CASE("Lock and unlock a mapping", "[lock]") {
+    std::string name = unique_name("test_lock");
+    shm_cleanup cleanup{name};
+
+    shared_memory shm(name.c_str(), 16 * 1024, create_only);
+    REQUIRE(shm.is_valid());
+    REQUIRE_FALSE(shm.is_locked());
+
+    SECTION("Whole mapping") {
+        std::error_code ec = shm.lock();
+        if (!is_lock_limit(ec)) {
+            REQUIRE_FALSE(ec);
+            REQUIRE(shm.is_locked());
+            REQUIRE_FALSE(shm.unlock());
+            REQUIRE_FALSE(shm.is_locked());
+        }
+    }
+
+    SECTION("Lock on fault") {
+        std::error_code ec = shm.lock(0, 4096, memory_lock::on_fault);
+        if (!is_lock_limit(ec)) {
+            REQUIRE_FALSE(ec);
+            REQUIRE(shm.is_locked());
+            REQUIRE_FALSE(shm.unlock(0, 4096));
+        }
+    }
+
+    SECTION("memory_lock::none is a no-op") {
+        REQUIRE_FALSE(shm.lock(memory_lock::none));
+        REQUIRE_FALSE(shm.is_locked());
+    }
+
+    SECTION("Out of range") {
+        REQUIRE(shm.lock(shm.size(), 1) == errc::invalid_argument);
+        REQUIRE(shm.unlock(1, shm.size()) == errc::invalid_argument);
+    }
+
+    SECTION("Unmap releases the lock") {
+        std::error_code ec = shm.lock();
+        if (!is_lock_limit(ec)) {
+            REQUIRE_FALSE(ec);
+            shm.unmap();
+            REQUIRE_FALSE(shm.is_locked());
+            REQUIRE(shm.lock() == errc::mapping_failed);
+        }
+    }
+}
+
+TEST_CASE("Lock option on construction", "[lock]") {
+    std::string name = unique_name("test_lock_opt");
+    shm_cleanup cleanup{name};
+
+    segment_options options;
+    options.lock = memory_lock::lock;
+
+    shared_memory shm(name.c_str(), 8192, create_only, access_mode::read_write, options,
+                      std::nothrow);
+    if (shm.is_valid()) {
+        REQUIRE(shm.is_locked());
+
+        shared_memory reader(name.c_str(), open_existing, access_mode::read_only, options,
+                             std::nothrow);
+        REQUIRE(reader.is_valid());
+        REQUIRE(reader.is_locked());
+    } else {
+        // A failed lock fails construction and doesn't leak the segment
+        REQUIRE(is_lock_limit(shm.last_error()));
+        REQUIRE_FALSE(shared_memory::exists(name.c_str()));
+    }
+}
+
+TEST_CASE("Lock errors are distinct", "[lock][errc]") {
+    REQUIRE(make_error_code(errc::lock_limit_exceeded) != errc::mapping_failed);
+    REQUIRE(make_error_code(errc::lock_limit_exceeded).message() ==
+            "memory lock limit exceeded (RLIMIT_MEMLOCK)");
+    REQUIRE(make_error_code(errc::working_set_quota_exceeded).message() ==
+            "working set quota exceeded");
+}
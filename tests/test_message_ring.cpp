@@ -0,0 +1,332 @@
+#include <catch2/catch_test_macros.hpp>
+#include <slick/shm/message_ring.hpp>
+
+#include <string>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <thread>
+
+using namespace slick::shm;
+
+namespace {
+
+std::string unique_name(const char* prefix) {
+    auto now = std::chrono::system_clock::now().time_since_epoch();
+    auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(now).count();
+    // Use modulo to keep the timestamp shorter while still being unique (macOS has 31-char limit)
+    return std::string(prefix) + std::to_string(millis % 100000000);
+}
+
+struct shm_cleanup {
+    std::string name;
+    ~shm_cleanup() {
+        shared_memory::remove(name.c_str());
+    }
+};
+
+// Message i has length (i * 7) % max_len + 1 and every byte equal to i & 0xFF
+std::size_t message_length(std::uint64_t i, std::size_t max_len) {
+    return static_cast<std::size_t>((i * 7) % max_len) + 1;
+}
+
+bool check_message(const message_view& view, std::uint64_t i, std::size_t max_len) {
+    if (view.size() != message_length(i, max_len)) {
+        return false;
+    }
+    for (unsigned char c : view) {
+        if (c != static_cast<unsigned char>(i)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
+TEST_CASE("message_ring claim/commit and read/release", "[message_ring]") {
+    std::string name = unique_name("test_msg_basic");
+    shm_cleanup cleanup{name};
+
+    message_ring producer(name.c_str(), 1000, create_only);
+    REQUIRE(producer.is_valid());
+    REQUIRE(producer.capacity() == 1024);
+    REQUIRE(producer.alignment() == 8);
+    REQUIRE(producer.empty());
+
+    message_ring consumer(name.c_str(), open_existing);
+    REQUIRE(consumer.is_valid());
+    REQUIRE(consumer.capacity() == 1024);
+    REQUIRE_FALSE(consumer.read());
+
+    message_span span = producer.claim(5);
+    REQUIRE(span);
+    REQUIRE(span.size() == 5);
+    std::memcpy(span.data(), "hello", 5);
+
+    // Nothing is visible before commit
+    REQUIRE_FALSE(consumer.read());
+    producer.commit(span);
+    REQUIRE(producer.bytes_used() == 16);  // 8-byte header + 5 bytes, rounded up
+
+    REQUIRE(producer.try_write("world!", 6));
+
+    message_view view = consumer.read();
+    REQUIRE(view);
+    REQUIRE(std::string(reinterpret_cast<const char*>(view.data()), view.size()) == "hello");
+
+    // read() is idempotent until release()
+    REQUIRE(consumer.read().data() == view.data());
+    consumer.release();
+
+    view = consumer.read();
+    REQUIRE(std::string(reinterpret_cast<const char*>(view.data()), view.size()) == "world!");
+    consumer.release();
+    REQUIRE_FALSE(consumer.read());
+    REQUIRE(consumer.empty());
+
+    SECTION("Zero-length message") {
+        message_span zero = producer.claim(0);
+        REQUIRE(zero);
+        REQUIRE(zero.empty());
+        producer.commit(zero);
+        message_view z = consumer.read();
+        REQUIRE(z);
+        REQUIRE(z.size() == 0);
+        consumer.release();
+        REQUIRE(consumer.empty());
+    }
+
+    SECTION("Commit fewer bytes than claimed") {
+        message_span big = producer.claim(100);
+        REQUIRE(big);
+        std::memcpy(big.data(), "abc", 3);
+        producer.commit(big, 3);
+        REQUIRE(producer.bytes_used() == 16);
+        message_view small = consumer.read();
+        REQUIRE(small.size() == 3);
+        REQUIRE(std::memcmp(small.data(), "abc", 3) == 0);
+        consumer.release();
+    }
+
+    SECTION("Uncommitted claim is abandoned") {
+        REQUIRE(producer.claim(10));
+        REQUIRE(producer.try_write("x", 1));
+        message_view x = consumer.read();
+        REQUIRE(x.size() == 1);
+        REQUIRE(x.data()[0] == 'x');
+    }
+}
+
+TEST_CASE("message_ring full ring and oversized messages", "[message_ring]") {
+    std::string name = unique_name("test_msg_full");
+    shm_cleanup cleanup{name};
+
+    message_ring ring(name.c_str(), 256, create_only);
+    REQUIRE(ring.max_message_size() == 120);
+    REQUIRE_FALSE(ring.claim(121));
+    REQUIRE(ring.claim(120));
+
+    // 256 bytes hold exactly 8 records of 32 bytes
+    unsigned char payload[24] = {};
+    for (int i = 0; i < 8; ++i) {
+        REQUIRE(ring.try_write(payload, sizeof(payload)));
+    }
+    REQUIRE_FALSE(ring.try_write(payload, 1));
+    REQUIRE(ring.bytes_used() == 256);
+
+    REQUIRE(ring.read());
+    ring.release();
+    REQUIRE(ring.try_write(payload, sizeof(payload)));
+}
+
+TEST_CASE("message_ring ignores commits of failed claims", "[message_ring]") {
+    std::string name = unique_name("test_msg_nocommit");
+    shm_cleanup cleanup{name};
+
+    message_ring ring(name.c_str(), 256, create_only);
+    unsigned char payload[24] = {1, 2, 3};
+    REQUIRE(ring.try_write(payload, sizeof(payload)));
+    REQUIRE(ring.bytes_used() == 32);
+
+    auto oversized = ring.claim(ring.max_message_size() + 1);
+    REQUIRE_FALSE(oversized);
+    ring.commit(oversized);
+    ring.commit(message_span{}, 8);
+    REQUIRE(ring.bytes_used() == 32);
+
+    // A full ring too: head doesn't move, and the queued messages stay intact
+    while (ring.try_write(payload, sizeof(payload))) {
+    }
+    auto full = ring.claim(sizeof(payload));
+    REQUIRE_FALSE(full);
+    ring.commit(full);
+    REQUIRE(ring.bytes_used() == 256);
+    for (int i = 0; i < 8; ++i) {
+        auto message = ring.read();
+        REQUIRE(message.size() == sizeof(payload));
+        REQUIRE(message.data()[2] == 3);
+        ring.release();
+    }
+    REQUIRE(ring.empty());
+}
+
+TEST_CASE("message_ring wraps with a padding record", "[message_ring]") {
+    std::string name = unique_name("test_msg_wrap");
+    shm_cleanup cleanup{name};
+
+    message_ring ring(name.c_str(), 256, create_only);
+
+    // Advance to position 192 and drain, leaving 64 bytes before the wrap point
+    unsigned char payload[120];
+    for (int i = 0; i < 3; ++i) {
+        std::memset(payload, i, sizeof(payload));
+        REQUIRE(ring.try_write(payload, 56));
+        REQUIRE(ring.read());
+        ring.release();
+    }
+
+    // A 100-byte message doesn't fit into the 64 bytes: padding + wrap to offset 0
+    std::memset(payload, 0x5A, sizeof(payload));
+    message_span span = ring.claim(100);
+    REQUIRE(span);
+    const unsigned char* area = span.data() - 8;
+    std::memcpy(span.data(), payload, 100);
+    ring.commit(span);
+    REQUIRE(ring.bytes_used() == 64 + 112);
+
+    message_view view = ring.read();
+    REQUIRE(view.size() == 100);
+    REQUIRE(view.data() == area + 8);
+    REQUIRE(std::memcmp(view.data(), payload, 100) == 0);
+    ring.release();
+    REQUIRE(ring.empty());
+}
+
+TEST_CASE("message_ring 64-byte alignment", "[message_ring]") {
+    std::string name = unique_name("test_msg_align");
+    shm_cleanup cleanup{name};
+
+    message_ring ring(name.c_str(), 4096, create_only, 64);
+    REQUIRE(ring.alignment() == 64);
+
+    for (std::size_t len : {1u, 56u, 57u, 200u}) {
+        message_span span = ring.claim(len);
+        REQUIRE(span);
+        // Every record header starts on a cache line
+        REQUIRE(reinterpret_cast<std::uintptr_t>(span.data() - 8) % 64 == 0);
+        ring.commit(span);
+    }
+    REQUIRE(ring.bytes_used() == 64 + 64 + 128 + 256);
+
+    SECTION("Invalid alignment") {
+        std::string bad = unique_name("test_msg_badal");
+        message_ring r(bad.c_str(), 4096, create_only, 24, segment_options(), std::nothrow);
+        REQUIRE_FALSE(r.is_valid());
+        REQUIRE(r.last_error() == errc::invalid_argument);
+        REQUIRE_FALSE(shared_memory::exists(bad.c_str()));
+    }
+
+    SECTION("Opener picks up the alignment") {
+        message_ring opener(name.c_str(), open_existing);
+        REQUIRE(opener.alignment() == 64);
+        REQUIRE(opener.capacity() == 4096);
+    }
+}
+
+TEST_CASE("message_ring layout validation", "[message_ring]") {
+    std::string name = unique_name("test_msg_layout");
+    shm_cleanup cleanup{name};
+
+    SECTION("Missing segment") {
+        message_ring ring(name.c_str(), open_existing, segment_options(), std::nothrow);
+        REQUIRE_FALSE(ring.is_valid());
+        REQUIRE(ring.last_error() == errc::not_found);
+    }
+
+    SECTION("Raw segment") {
+        shared_memory raw(name.c_str(), 4096, create_only);
+        REQUIRE_THROWS_AS(message_ring(name.c_str(), open_existing), shared_memory_error);
+    }
+
+    SECTION("Capacity too large to round up") {
+        message_ring ring(name.c_str(), std::numeric_limits<std::size_t>::max(), create_only,
+                          8, segment_options(), std::nothrow);
+        REQUIRE(ring.last_error() == errc::invalid_size);
+        REQUIRE_FALSE(shared_memory::exists(name.c_str()));
+    }
+}
+
+TEST_CASE("message_ring concurrent producer and consumer", "[message_ring]") {
+    std::string name = unique_name("test_msg_mt");
+    shm_cleanup cleanup{name};
+
+    constexpr std::uint64_t count = 100000;
+    constexpr std::size_t max_len = 300;
+    message_ring producer(name.c_str(), 8192, create_only);
+    message_ring consumer(name.c_str(), open_existing);
+
+    bool ok = true;
+    std::thread reader([&] {
+        for (std::uint64_t i = 0; i < count;) {
+            message_view view = consumer.read();
+            if (!view) {
+                std::this_thread::yield();
+                continue;
+            }
+            ok = ok && check_message(view, i, max_len);
+            consumer.release();
+            ++i;
+        }
+    });
+
+    for (std::uint64_t i = 0; i < count;) {
+        std::size_t len = message_length(i, max_len);
+        message_span span = producer.claim(len);
+        if (!span) {
+            std::this_thread::yield();
+            continue;
+        }
+        std::memset(span.data(), static_cast<unsigned char>(i), len);
+        producer.commit(span);
+        ++i;
+    }
+
+    reader.join();
+    REQUIRE(ok);
+    REQUIRE(consumer.empty());
+}
+
+#ifdef SLICK_SHM_LINUX
+TEST_CASE("message_ring records stay within 32-bit lengths", "[message_ring]") {
+    std::string name = unique_name("test_msg_huge");
+    shm_cleanup cleanup{name};
+
+    // 16 GiB of sparse tmpfs: only the pages of record headers are touched
+    constexpr std::size_t GiB = std::size_t(1) << 30;
+    message_ring producer(name.c_str(), 16 * GiB, create_only);
+    message_ring consumer(name.c_str(), open_existing);
+    REQUIRE(producer.max_message_size() == 4 * GiB - 8);
+
+    // Leave 16 bytes less than a maximum record before the wrap point
+    std::size_t lengths[] = {3 * GiB - 8, 3 * GiB - 8, 3 * GiB - 8, 3 * GiB + 8};
+    for (std::size_t length : lengths) {
+        message_span span = producer.claim(length);
+        REQUIRE(span);
+        producer.commit(span);
+        message_view view = consumer.read();
+        REQUIRE(view.size() == length);
+        consumer.release();
+    }
+
+    // Needs almost 4 GiB of padding, which must not be truncated
+    message_span span = producer.claim(producer.max_message_size());
+    REQUIRE(span);
+    producer.commit(span);
+    message_view view = consumer.read();
+    REQUIRE(view.size() == producer.max_message_size());
+    consumer.release();
+    REQUIRE(consumer.empty());
+}
+#endif
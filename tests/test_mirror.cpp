@@ -0,0 +1,164 @@
+#include <catch2/catch_test_macros.hpp>
+#include <slick/shm/shared_memory.hpp>
+#include <slick/shm/growable_segment.hpp>
+
+#include <string>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <vector>
+
+using namespace slick::shm;
+
+namespace {
+
+std::string unique_name(const char* prefix) {
+    auto now = std::chrono::system_clock::now().time_since_epoch();
+    auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(now).count();
+    // Use modulo to keep the timestamp shorter while still being unique (macOS has 31-char limit)
+    return std::string(prefix) + std::to_string(millis % 100000000);
+}
+
+struct shm_cleanup {
+    std::string name;
+    ~shm_cleanup() {
+        shared_memory::remove(name.c_str());
+    }
+};
+
+segment_options mirror_options() {
+    segment_options options;
+    options.mirror = true;
+    return options;
+}
+
+}  // namespace
+
+TEST_CASE("Segments are not mirrored by default", "[mirror]") {
+    std::string name = unique_name("test_mirror_off_");
+    shm_cleanup cleanup{name};
+
+    shared_memory shm(name.c_str(), 4096, create_only);
+    REQUIRE_FALSE(shm.is_mirrored());
+}
+
+TEST_CASE("Mirrored mapping aliases the second view", "[mirror]") {
+    std::string name = unique_name("test_mirror_alias_");
+    shm_cleanup cleanup{name};
+
+    shared_memory shm(name.c_str(), 64 * 1024, create_only, access_mode::read_write,
+                      mirror_options());
+    REQUIRE(shm.is_mirrored());
+    REQUIRE(shm.size() == 64 * 1024);
+
+    char* base = static_cast<char*>(shm.data());
+    base[0] = 'a';
+    REQUIRE(base[shm.size()] == 'a');
+    base[shm.size() + 100] = 'b';
+    REQUIRE(base[100] == 'b');
+
+    // A write across the end lands at the start, with a single memcpy
+    const char message[] = "wraps around the end";
+    std::size_t pos = shm.size() - 5;
+    std::memcpy(base + pos, message, sizeof(message));
+    REQUIRE(std::memcmp(base + pos, message, 5) == 0);
+    REQUIRE(std::memcmp(base, message + 5, sizeof(message) - 5) == 0);
+}
+
+TEST_CASE("Mirrored size is rounded up to the mapping granularity", "[mirror]") {
+    std::string name = unique_name("test_mirror_round_");
+    shm_cleanup cleanup{name};
+
+    shared_memory shm(name.c_str(), 1000, create_only, access_mode::read_write,
+                      mirror_options());
+    REQUIRE(shm.is_mirrored());
+    REQUIRE(shm.size() >= 1000);
+    REQUIRE(shm.size() % shm.page_size() == 0);
+
+    char* base = static_cast<char*>(shm.data());
+    base[shm.size() - 1] = 'z';
+    REQUIRE(base[2 * shm.size() - 1] == 'z');
+}
+
+TEST_CASE("Openers can map a segment mirrored or plain", "[mirror]") {
+    std::string name = unique_name("test_mirror_open_");
+    shm_cleanup cleanup{name};
+
+    shared_memory creator(name.c_str(), 64 * 1024, create_only);
+    REQUIRE_FALSE(creator.is_mirrored());
+
+    shared_memory mirrored(name.c_str(), open_existing, access_mode::read_only,
+                           mirror_options());
+    REQUIRE(mirrored.is_mirrored());
+    REQUIRE(mirrored.size() == creator.size());
+
+    static_cast<char*>(creator.data())[10] = 'x';
+    REQUIRE(static_cast<const char*>(mirrored.data())[mirrored.size() + 10] == 'x');
+}
+
+TEST_CASE("Mirrored byte stream never splits a copy", "[mirror]") {
+    std::string name = unique_name("test_mirror_stream_");
+    shm_cleanup cleanup{name};
+
+    shared_memory shm(name.c_str(), 64 * 1024, create_only, access_mode::read_write,
+                      mirror_options());
+    char* ring = static_cast<char*>(shm.data());
+    std::size_t capacity = shm.size();
+
+    // Odd-sized records written and read back at free-running positions
+    std::vector<char> record(3001);
+    std::vector<char> read(record.size());
+    std::uint64_t pos = 0;
+    bool all_match = true;
+    for (int i = 0; i < 200; ++i) {
+        for (std::size_t j = 0; j < record.size(); ++j) {
+            record[j] = static_cast<char>(i + j);
+        }
+        std::memcpy(ring + pos % capacity, record.data(), record.size());
+        std::memcpy(read.data(), ring + pos % capacity, read.size());
+        all_match = all_match && read == record;
+        pos += record.size();
+    }
+    REQUIRE(all_match);
+}
+
+TEST_CASE("Mirrored mapping with prefault and lock", "[mirror]") {
+    std::string name = unique_name("test_mirror_opts_");
+    shm_cleanup cleanup{name};
+
+    segment_options options = mirror_options();
+    options.prefault = true;
+    shared_memory shm(name.c_str(), 64 * 1024, create_only, access_mode::read_write, options);
+    REQUIRE(shm.is_mirrored());
+    REQUIRE_FALSE(shm.prefault(0, shm.size()));
+
+    std::error_code ec = shm.lock();
+    if (!ec) {
+        REQUIRE(shm.is_locked());
+        REQUIRE_FALSE(shm.unlock());
+    } else {
+        REQUIRE((ec == errc::lock_limit_exceeded || ec == errc::working_set_quota_exceeded));
+    }
+}
+
+TEST_CASE("Mirrored mapping of a moved segment", "[mirror]") {
+    std::string name = unique_name("test_mirror_move_");
+    shm_cleanup cleanup{name};
+
+    shared_memory a(name.c_str(), 64 * 1024, create_only, access_mode::read_write,
+                    mirror_options());
+    shared_memory b(std::move(a));
+    REQUIRE(b.is_mirrored());
+    static_cast<char*>(b.data())[0] = 'm';
+    REQUIRE(static_cast<char*>(b.data())[b.size()] == 'm');
+}
+
+TEST_CASE("Growable segments can't be mirrored", "[mirror]") {
+    std::string name = unique_name("test_mirror_grow_");
+
+    growable_segment seg(name.c_str(), 4096, 1 << 20, create_only, mirror_options(),
+                         std::nothrow);
+    REQUIRE_FALSE(seg.is_valid());
+    REQUIRE(seg.last_error() == errc::not_supported);
+}
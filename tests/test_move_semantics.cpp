@@ -1,9 +1,12 @@
 #include <catch2/catch_test_macros.hpp>
 #include <slick/shm/shared_memory.hpp>
+#include <slick/shm/shared_memory_view.hpp>
 
 #include <string>
 #include <chrono>
 #include <cstring>
+#include <memory>
+#include <type_traits>
 
 using namespace slick::shm;
 
@@ -163,3 +166,70 @@ TEST_CASE("Move enables return from function", "[move]") {
     const char* read_data = static_cast<const char*>(shm.data());
     REQUIRE(std::strcmp(read_data, "Returned from function") == 0);
 }
+
+TEST_CASE("Names survive moves", "[move]") {
+    std::string name = unique_name("test_move_name");
+    shm_cleanup cleanup{name};
+
+    shared_memory shm1(name.c_str(), 512, create_only);
+    shared_memory shm2(std::move(shm1));
+    REQUIRE(std::string(shm2.name()) == name);
+
+    shared_memory shm3;
+    shm3 = std::move(shm2);
+    REQUIRE(std::string(shm3.name()) == name);
+
+    // A leading '/' is kept as given
+    std::string slashed = "/" + name;
+    shared_memory opened(slashed.c_str(), open_existing);
+    REQUIRE(std::string(opened.name()) == slashed);
+}
+
+TEST_CASE("Longest valid name is stored inline", "[move]") {
+    std::string name = unique_name("test_move_long");
+    name.resize(255, 'x');
+    shm_cleanup cleanup{name};
+
+    shared_memory shm(name.c_str(), 512, create_only, access_mode::read_write,
+                      segment_options(), std::nothrow);
+    if (!shm.is_valid()) {
+        // Some platforms limit names further (31 characters on macOS)
+        REQUIRE(shm.last_error() != errc::invalid_name);
+        return;
+    }
+    REQUIRE(std::string(shm.name()) == name);
+    REQUIRE(shared_memory::exists(name.c_str()));
+
+    name.push_back('x');
+    REQUIRE_FALSE(shared_memory(name.c_str(), 512, create_only, access_mode::read_write,
+                                segment_options(), std::nothrow)
+                      .is_valid());
+}
+
+TEST_CASE("Views are trivially copyable", "[move][view]") {
+    STATIC_REQUIRE(std::is_trivially_copyable<shared_memory_view>::value);
+
+    std::string name = unique_name("test_view_copy");
+    shm_cleanup cleanup{name};
+
+    shared_memory shm(name.c_str(), 512, create_only);
+    shared_memory_view view(shm);
+    shared_memory_view copy = view;
+    REQUIRE(copy.data() == shm.data());
+    REQUIRE(copy.size() == shm.size());
+    REQUIRE(copy.name() == shm.name());  // Refers to the segment's name, no copy
+    REQUIRE(copy.mode() == access_mode::read_write);
+
+    // Mapping and name both outlive moves of the viewed object
+    auto moved = std::make_unique<shared_memory>(std::move(shm));
+    REQUIRE(copy.data() == moved->data());
+    REQUIRE(copy.name() == moved->name());
+    shm = shared_memory(name.c_str(), open_existing);
+    REQUIRE(shm.name() == copy.name());  // One interned copy per name
+    moved.reset();
+    REQUIRE(std::string(copy.name()) == name);
+
+    shared_memory_view empty;
+    REQUIRE_FALSE(empty.is_valid());
+    REQUIRE(std::string(empty.name()).empty());
+}
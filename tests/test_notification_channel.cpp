@@ -0,0 +1,307 @@
+#include <catch2/catch_test_macros.hpp>
+#include <slick/shm/notification_channel.hpp>
+#include <slick/shm/spsc_ring.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef SLICK_SHM_POSIX
+#include <poll.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+using namespace slick::shm;
+
+namespace {
+
+std::string unique_name(const char* prefix) {
+    auto now = std::chrono::system_clock::now().time_since_epoch();
+    auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(now).count();
+    // Use modulo to keep the timestamp shorter while still being unique (macOS has 31-char limit)
+    return std::string(prefix) + std::to_string(millis % 100000000);
+}
+
+struct shm_cleanup {
+    std::string name;
+    ~shm_cleanup() {
+        shared_memory::remove(name.c_str());
+    }
+};
+
+// What an event loop would see: is the handle readable / signaled?
+bool ready(notification_channel::native_handle_type handle, int timeout_ms) {
+#ifdef SLICK_SHM_WINDOWS
+    return WaitForSingleObject(handle, static_cast<DWORD>(timeout_ms)) == WAIT_OBJECT_0;
+#else
+    pollfd pfd;
+    pfd.fd = handle;
+    pfd.events = POLLIN;
+    pfd.revents = 0;
+    return poll(&pfd, 1, timeout_ms) == 1 && (pfd.revents & POLLIN) != 0;
+#endif
+}
+
+}  // namespace
+
+TEST_CASE("notification_channel wakes armed listeners", "[notification_channel]") {
+    std::string name = unique_name("test_notify_basic");
+    shm_cleanup cleanup{name};
+
+    notification_channel producer(name.c_str(), create_only);
+    REQUIRE(producer.is_valid());
+    REQUIRE(producer.is_creator());
+    REQUIRE(producer.notify() == 0);  // Nobody listens
+
+    notification_channel consumer(name.c_str(), open_existing);
+    REQUIRE_FALSE(consumer.is_creator());
+    REQUIRE_FALSE(consumer.is_listening());
+    REQUIRE_FALSE(consumer.listen());
+    REQUIRE(consumer.is_listening());
+    REQUIRE(consumer.native_handle() != notification_channel::native_handle_type());
+
+    // Not armed: notify() stays out of the kernel
+    REQUIRE(producer.notify() == 0);
+    REQUIRE_FALSE(ready(consumer.native_handle(), 0));
+
+    consumer.arm();
+    REQUIRE(producer.has_waiters());
+    REQUIRE(producer.notify() == 1);
+    REQUIRE_FALSE(producer.has_waiters());
+    REQUIRE(ready(consumer.native_handle(), 1000));
+
+    // The arm was used up
+    REQUIRE(producer.notify() == 0);
+
+    consumer.reset();
+    REQUIRE_FALSE(ready(consumer.native_handle(), 0));
+
+    consumer.stop_listening();
+    REQUIRE_FALSE(consumer.is_listening());
+    consumer.arm();  // No-op without a slot
+    REQUIRE(producer.notify() == 0);
+}
+
+TEST_CASE("notification_channel prepare_wait re-checks the data", "[notification_channel]") {
+    std::string name = unique_name("test_notify_prep");
+    shm_cleanup cleanup{name};
+
+    notification_channel producer(name.c_str(), open_or_create);
+    notification_channel consumer(name.c_str(), open_or_create);
+    REQUIRE(producer.is_creator());
+    REQUIRE_FALSE(consumer.is_creator());
+    REQUIRE_FALSE(consumer.listen());
+
+    bool has_data = true;
+    REQUIRE_FALSE(consumer.prepare_wait([&] { return has_data; }));
+    has_data = false;
+    REQUIRE(consumer.prepare_wait([&] { return has_data; }));
+    REQUIRE(producer.notify() == 1);
+    REQUIRE(ready(consumer.native_handle(), 1000));
+}
+
+TEST_CASE("notification_channel drives an event-loop consumer", "[notification_channel]") {
+    std::string ring_name = unique_name("test_notify_ring");
+    std::string name = ring_name + "_n";
+    shm_cleanup ring_cleanup{ring_name};
+    shm_cleanup cleanup{name};
+
+    spsc_ring<std::uint64_t> producer_ring(ring_name.c_str(), 1024, create_only);
+    spsc_ring<std::uint64_t> consumer_ring(ring_name.c_str(), open_existing);
+    notification_channel producer(name.c_str(), create_only);
+    notification_channel consumer(name.c_str(), open_existing);
+    REQUIRE_FALSE(consumer.listen());
+
+    constexpr std::uint64_t count = 20000;
+    std::atomic<bool> out_of_order(false);
+    std::atomic<std::uint64_t> received(0);
+    std::thread loop([&] {
+        std::uint64_t expected = 0;
+        auto drain = [&] {
+            std::uint64_t value = 0;
+            while (consumer_ring.try_pop(value)) {
+                if (value != expected++) {
+                    out_of_order = true;
+                }
+            }
+        };
+        while (expected < count) {
+            drain();
+            if (consumer.prepare_wait([&] { return !consumer_ring.empty(); })) {
+                // A lost wake-up would stall here until the timeout
+                ready(consumer.native_handle(), 5000);
+                consumer.reset();
+            }
+        }
+        received = expected;
+    });
+
+    for (std::uint64_t i = 0; i < count; ++i) {
+        while (!producer_ring.try_push(i)) {
+            std::this_thread::yield();
+        }
+        producer.notify();
+    }
+    loop.join();
+
+    REQUIRE(received == count);
+    REQUIRE_FALSE(out_of_order);
+}
+
+TEST_CASE("notification_channel notify() from several threads", "[notification_channel]") {
+    std::string name = unique_name("test_notify_mt");
+    shm_cleanup cleanup{name};
+
+    notification_channel producer(name.c_str(), create_only);
+    notification_channel consumer(name.c_str(), open_existing);
+    REQUIRE_FALSE(consumer.listen());
+
+    constexpr int threads = 4;
+    constexpr int rounds = 5000;
+    std::atomic<bool> done(false);
+    std::atomic<std::size_t> signaled(0);
+    std::vector<std::thread> notifiers;
+    for (int t = 0; t < threads; ++t) {
+        notifiers.emplace_back([&] {
+            for (int i = 0; i < rounds; ++i) {
+                signaled += producer.notify();  // Shared object, no extra locking
+            }
+        });
+    }
+    std::thread listener([&] {
+        while (!done) {
+            if (consumer.prepare_wait([] { return false; })) {
+                ready(consumer.native_handle(), 1);
+                consumer.reset();
+            }
+        }
+    });
+    for (auto& t : notifiers) {
+        t.join();
+    }
+    done = true;
+    listener.join();
+
+    // A final arm is still served
+    consumer.reset();
+    consumer.arm();
+    REQUIRE(producer.notify() == 1);
+    REQUIRE(ready(consumer.native_handle(), 1000));
+    REQUIRE(signaled.load() <= static_cast<std::size_t>(threads) * rounds);
+}
+
+TEST_CASE("notification_channel listener slots", "[notification_channel]") {
+    std::string name = unique_name("test_notify_slots");
+    shm_cleanup cleanup{name};
+
+    notification_channel producer(name.c_str(), create_only);
+    std::vector<std::unique_ptr<notification_channel>> listeners;
+    for (std::size_t i = 0; i < notification_channel::max_listeners; ++i) {
+        listeners.push_back(std::make_unique<notification_channel>(name.c_str(), open_existing));
+        REQUIRE_FALSE(listeners.back()->listen());
+        listeners.back()->arm();
+    }
+
+    notification_channel extra(name.c_str(), open_existing);
+    REQUIRE(extra.listen() == errc::too_many_readers);
+
+    REQUIRE(producer.notify() == notification_channel::max_listeners);
+    for (auto& listener : listeners) {
+        REQUIRE(ready(listener->native_handle(), 1000));
+    }
+
+    // Moving keeps the slot, destroying frees it
+    notification_channel moved(std::move(*listeners[3]));
+    REQUIRE(moved.is_listening());
+    REQUIRE_FALSE(listeners[3]->is_listening());
+    REQUIRE(extra.listen() == errc::too_many_readers);
+    { notification_channel gone(std::move(moved)); }
+    REQUIRE_FALSE(extra.listen());
+}
+
+TEST_CASE("notification_channel rejects other segments", "[notification_channel]") {
+    std::string name = unique_name("test_notify_bad");
+    shm_cleanup cleanup{name};
+
+    shared_memory other(name.c_str(), 4096, create_only);
+    notification_channel ch(name.c_str(), open_existing, segment_options(), std::nothrow);
+    REQUIRE_FALSE(ch.is_valid());
+    REQUIRE(ch.last_error() == errc::incompatible_layout);
+    REQUIRE(ch.listen() == errc::mapping_failed);
+    REQUIRE(ch.notify() == 0);
+
+    notification_channel missing("test_notify_missing", open_existing, segment_options(),
+                                 std::nothrow);
+    REQUIRE(missing.last_error() == errc::not_found);
+}
+
+#ifdef SLICK_SHM_POSIX
+TEST_CASE("notification_channel cross-process wake-up", "[notification_channel]") {
+    std::string name = unique_name("test_notify_xp");
+    shm_cleanup cleanup{name};
+
+    notification_channel producer(name.c_str(), create_only);
+
+    pid_t child = fork();
+    REQUIRE(child >= 0);
+    if (child == 0) {
+        notification_channel consumer(name.c_str(), open_existing, segment_options(),
+                                      std::nothrow);
+        if (consumer.listen()) {
+            _exit(1);
+        }
+        consumer.arm();
+        _exit(ready(consumer.native_handle(), 10000) ? 0 : 2);
+    }
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (!producer.has_waiters() && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    REQUIRE(producer.notify() == 1);
+
+    int status = 0;
+    REQUIRE(waitpid(child, &status, 0) == child);
+    REQUIRE(WIFEXITED(status));
+    REQUIRE(WEXITSTATUS(status) == 0);
+}
+
+TEST_CASE("notification_channel survives a dead listener", "[notification_channel]") {
+    std::string name = unique_name("test_notify_dead");
+    shm_cleanup cleanup{name};
+
+    notification_channel producer(name.c_str(), create_only);
+
+    pid_t child = fork();
+    REQUIRE(child >= 0);
+    if (child == 0) {
+        notification_channel consumer(name.c_str(), open_existing, segment_options(),
+                                      std::nothrow);
+        if (consumer.listen()) {
+            _exit(1);
+        }
+        consumer.arm();
+        _exit(0);  // Without stop_listening()
+    }
+    int status = 0;
+    REQUIRE(waitpid(child, &status, 0) == child);
+    REQUIRE(WEXITSTATUS(status) == 0);
+
+    // Signaling the dead listener fails quietly (no SIGPIPE)
+    REQUIRE(producer.has_waiters());
+    REQUIRE(producer.notify() == 1);
+
+    // Its slot is reclaimed
+    std::vector<std::unique_ptr<notification_channel>> listeners;
+    for (std::size_t i = 0; i < notification_channel::max_listeners; ++i) {
+        listeners.push_back(std::make_unique<notification_channel>(name.c_str(), open_existing));
+        REQUIRE_FALSE(listeners.back()->listen());
+    }
+}
+#endif
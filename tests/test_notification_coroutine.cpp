@@ -0,0 +1,181 @@
+// Built as C++20 (see CMakeLists.txt) for the co_await support of notification_channel
+#include <catch2/catch_test_macros.hpp>
+#include <slick/shm/notification_channel.hpp>
+#include <slick/shm/broadcast_ring.hpp>
+#include <slick/shm/spsc_ring.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifdef SLICK_SHM_POSIX
+#include <poll.h>
+#endif
+
+#if defined(__cpp_impl_coroutine) && defined(__cpp_lib_coroutine)
+
+using namespace slick::shm;
+
+namespace {
+
+std::string unique_name(const char* prefix) {
+    auto now = std::chrono::system_clock::now().time_since_epoch();
+    auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(now).count();
+    // Use modulo to keep the timestamp shorter while still being unique (macOS has 31-char limit)
+    return std::string(prefix) + std::to_string(millis % 100000000);
+}
+
+struct shm_cleanup {
+    std::string name;
+    ~shm_cleanup() {
+        shared_memory::remove(name.c_str());
+    }
+};
+
+// Fire-and-forget coroutine that starts right away
+struct task {
+    struct promise_type {
+        task get_return_object() noexcept { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept {}
+    };
+};
+
+// Smallest possible reactor: resumes a coroutine once its handle is ready
+class reactor {
+public:
+    void watch(notification_channel::native_handle_type handle, std::coroutine_handle<> h) {
+        waiting_.emplace_back(handle, h);
+    }
+
+    std::size_t waiting() const noexcept {
+        return waiting_.size();
+    }
+
+    // Resume the coroutines whose handles are ready; returns how many
+    std::size_t run_once(int timeout_ms) {
+        std::vector<std::pair<notification_channel::native_handle_type, std::coroutine_handle<>>>
+            ready;
+        std::vector<std::pair<notification_channel::native_handle_type, std::coroutine_handle<>>>
+            still_waiting;
+        for (auto& entry : waiting_) {
+            (is_ready(entry.first, timeout_ms) ? ready : still_waiting).push_back(entry);
+        }
+        waiting_ = std::move(still_waiting);
+        for (auto& entry : ready) {
+            entry.second.resume();
+        }
+        return ready.size();
+    }
+
+private:
+    std::vector<std::pair<notification_channel::native_handle_type, std::coroutine_handle<>>>
+        waiting_;
+
+    static bool is_ready(notification_channel::native_handle_type handle, int timeout_ms) {
+#ifdef SLICK_SHM_WINDOWS
+        return WaitForSingleObject(handle, static_cast<DWORD>(timeout_ms)) == WAIT_OBJECT_0;
+#else
+        pollfd pfd;
+        pfd.fd = handle;
+        pfd.events = POLLIN;
+        pfd.revents = 0;
+        return poll(&pfd, 1, timeout_ms) == 1;
+#endif
+    }
+};
+
+task consume(notification_channel& ch, spsc_ring<std::uint64_t>& ring, reactor& loop,
+             std::vector<std::uint64_t>& out, std::size_t count) {
+    std::uint64_t value = 0;
+    while (out.size() < count) {
+        co_await ch.readable(loop, ring);
+        while (ring.try_pop(value)) {
+            out.push_back(value);
+        }
+    }
+}
+
+task follow(notification_channel& ch, broadcast_ring<std::uint64_t>& ring, reactor& loop,
+            std::uint64_t& last) {
+    std::uint64_t value = 0;
+    for (;;) {
+        co_await ch.readable(loop, ring);
+        while (ring.try_read(value) == read_status::ok) {
+            last = value;
+        }
+        if (last == 3) {
+            co_return;
+        }
+    }
+}
+
+}  // namespace
+
+TEST_CASE("co_await readable() on an spsc_ring", "[notification_channel][coroutine]") {
+    std::string ring_name = unique_name("test_ncoro_ring");
+    std::string name = ring_name + "_n";
+    shm_cleanup ring_cleanup{ring_name};
+    shm_cleanup cleanup{name};
+
+    spsc_ring<std::uint64_t> producer_ring(ring_name.c_str(), 64, create_only);
+    spsc_ring<std::uint64_t> consumer_ring(ring_name.c_str(), open_existing);
+    notification_channel producer(name.c_str(), create_only);
+    notification_channel consumer(name.c_str(), open_existing);
+    REQUIRE_FALSE(consumer.listen());
+
+    reactor loop;
+    std::vector<std::uint64_t> received;
+
+    // Data already there: the first co_await doesn't suspend
+    REQUIRE(producer_ring.try_push(1));
+    consume(consumer, consumer_ring, loop, received, 3);
+    REQUIRE(received.size() == 1);
+    REQUIRE(loop.waiting() == 1);
+    REQUIRE(producer.has_waiters());
+
+    // Nothing ready until the producer notifies
+    REQUIRE(loop.run_once(0) == 0);
+    REQUIRE(producer_ring.try_push(2));
+    REQUIRE(producer.notify() == 1);
+    REQUIRE(loop.run_once(1000) == 1);
+    REQUIRE(received.size() == 2);
+
+    REQUIRE(producer_ring.try_push(3));
+    producer.notify();
+    REQUIRE(loop.run_once(1000) == 1);
+    REQUIRE(received == std::vector<std::uint64_t>{1, 2, 3});
+    REQUIRE(loop.waiting() == 0);  // The coroutine finished
+}
+
+TEST_CASE("co_await readable() on a broadcast_ring", "[notification_channel][coroutine]") {
+    std::string ring_name = unique_name("test_ncoro_bcast");
+    std::string name = ring_name + "_n";
+    shm_cleanup ring_cleanup{ring_name};
+    shm_cleanup cleanup{name};
+
+    broadcast_ring<std::uint64_t> writer(ring_name.c_str(), 16, create_only);
+    broadcast_ring<std::uint64_t> reader(ring_name.c_str(), open_existing);
+    notification_channel producer(name.c_str(), open_or_create);
+    notification_channel consumer(name.c_str(), open_or_create);
+    REQUIRE_FALSE(consumer.listen());
+
+    reactor loop;
+    std::uint64_t last = 0;
+    follow(consumer, reader, loop, last);
+    REQUIRE(loop.waiting() == 1);
+
+    for (std::uint64_t i = 1; i <= 3; ++i) {
+        writer.publish(i);
+    }
+    producer.notify();
+    REQUIRE(loop.run_once(1000) == 1);
+    REQUIRE(last == 3);
+    REQUIRE(loop.waiting() == 0);
+}
+
+#endif
@@ -0,0 +1,109 @@
+#include <catch2/catch_test_macros.hpp>
+#include <slick/shm/shared_memory.hpp>
+
+#include <string>
+#include <chrono>
+#include <numeric>
+#include <vector>
+
+using namespace slick::shm;
+
+namespace {
+
+std::string unique_name(const char* prefix) {
+    auto now = std::chrono::system_clock::now().time_since_epoch();
+    auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(now).count();
+    // Use modulo to keep the timestamp shorter while still being unique (macOS has 31-char limit)
+    return std::string(prefix) + std::to_string(millis % 100000000);
+}
+
+struct shm_cleanup {
+    std::string name;
+    ~shm_cleanup() {
+        shared_memory::remove(name.c_str());
+    }
+};
+
+segment_options numa_options(numa_policy policy, std::uint64_t nodes) {
+    segment_options options;
+    options.numa = policy;
+    options.numa_nodes = nodes;
+    options.prefault = true;
+    return options;
+}
+
+}  // namespace
+
+TEST_CASE("NUMA policy requires a node mask", "[numa]") {
+    std::string name = unique_name("test_numa_mask");
+    shm_cleanup cleanup{name};
+
+    shared_memory shm(name.c_str(), 64 * 1024, create_only, access_mode::read_write,
+                      numa_options(numa_policy::bind, 0), std::nothrow);
+    REQUIRE_FALSE(shm.is_valid());
+    REQUIRE(shm.last_error() == errc::invalid_argument);
+    REQUIRE_FALSE(shared_memory::exists(name.c_str()));
+}
+
+#ifndef SLICK_SHM_MACOS
+
+TEST_CASE("Bind to node 0 and query placement", "[numa]") {
+    std::string name = unique_name("test_numa_bind");
+    shm_cleanup cleanup{name};
+
+    // Every NUMA-capable system has node 0
+    shared_memory shm(name.c_str(), 64 * 1024, create_only, access_mode::read_write,
+                      numa_options(numa_policy::bind, 1));
+    REQUIRE(shm.is_valid());
+
+    std::vector<std::size_t> pages;
+    REQUIRE_FALSE(shm.numa_placement(pages));
+    REQUIRE(!pages.empty());
+    REQUIRE(pages[0] > 0);
+    REQUIRE(std::accumulate(pages.begin(), pages.end(), std::size_t(0)) == pages[0]);
+}
+
+TEST_CASE("Preferred node", "[numa]") {
+    std::string name = unique_name("test_numa_pref");
+    shm_cleanup cleanup{name};
+
+    shared_memory shm(name.c_str(), 64 * 1024, create_only, access_mode::read_write,
+                      numa_options(numa_policy::preferred, 1));
+    REQUIRE(shm.is_valid());
+
+    std::vector<std::size_t> pages;
+    REQUIRE_FALSE(shm.numa_placement(pages));
+    REQUIRE(std::accumulate(pages.begin(), pages.end(), std::size_t(0)) > 0);
+}
+
+TEST_CASE("Interleave across nodes", "[numa]") {
+    std::string name = unique_name("test_numa_intl");
+    shm_cleanup cleanup{name};
+
+    shared_memory shm(name.c_str(), 64 * 1024, create_only, access_mode::read_write,
+                      numa_options(numa_policy::interleave, 1), std::nothrow);
+#ifdef SLICK_SHM_WINDOWS
+    REQUIRE(shm.last_error() == errc::not_supported);
+#else
+    REQUIRE(shm.is_valid());
+#endif
+}
+
+#else
+
+TEST_CASE("NUMA is not supported on macOS", "[numa]") {
+    std::string name = unique_name("test_numa_mac");
+    shm_cleanup cleanup{name};
+
+    shared_memory shm(name.c_str(), 4096, create_only);
+    std::vector<std::size_t> pages;
+    REQUIRE(shm.numa_placement(pages) == errc::not_supported);
+}
+
+#endif
+
+TEST_CASE("NUMA placement of an unmapped segment", "[numa]") {
+    shared_memory shm;
+    std::vector<std::size_t> pages;
+    REQUIRE(shm.numa_placement(pages) == errc::mapping_failed);
+}
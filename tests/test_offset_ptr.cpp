@@ -0,0 +1,120 @@
+#include <catch2/catch_test_macros.hpp>
+#include <slick/shm/offset_ptr.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+using namespace slick::shm;
+
+namespace {
+
+struct node {
+    int value;
+    offset_ptr<node> next;
+};
+
+}  // namespace
+
+TEST_CASE("offset_ptr null semantics", "[offset_ptr]") {
+    offset_ptr<int> p;
+    REQUIRE_FALSE(p);
+    REQUIRE(p == nullptr);
+    REQUIRE(p.get() == nullptr);
+
+    // Zero-filled memory is a null offset_ptr
+    alignas(offset_ptr<int>) unsigned char raw[sizeof(offset_ptr<int>)];
+    std::memset(raw, 0, sizeof(raw));
+    REQUIRE(reinterpret_cast<offset_ptr<int>*>(raw)->get() == nullptr);
+
+    int x = 5;
+    p = &x;
+    REQUIRE(p);
+    REQUIRE(p != nullptr);
+    p = nullptr;
+    REQUIRE_FALSE(p);
+}
+
+TEST_CASE("offset_ptr dereference and arithmetic", "[offset_ptr]") {
+    int values[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+    offset_ptr<int> p(values);
+
+    REQUIRE(*p == 0);
+    REQUIRE(p[3] == 3);
+    ++p;
+    REQUIRE(*p == 1);
+    p += 4;
+    REQUIRE(*p == 5);
+    REQUIRE(*(p - 2) == 3);
+    REQUIRE((p + 2).get() == &values[7]);
+    REQUIRE(p - offset_ptr<int>(values) == 5);
+    REQUIRE(offset_ptr<int>(values) < p);
+    p--;
+    REQUIRE(*p == 4);
+
+    using traits = std::iterator_traits<offset_ptr<int>>;
+    REQUIRE(std::is_same<traits::iterator_category, std::random_access_iterator_tag>::value);
+    REQUIRE(std::distance(offset_ptr<int>(values), offset_ptr<int>(values + 8)) == 8);
+}
+
+TEST_CASE("offset_ptr stays valid when the memory moves", "[offset_ptr]") {
+    // Build a linked list in one buffer, copy the bytes to a buffer at another
+    // address (like a second mapping of the same segment) and walk it there
+    struct block {
+        node nodes[3];
+    };
+    alignas(block) unsigned char first[sizeof(block)];
+    alignas(block) unsigned char second[sizeof(block)];
+
+    auto* a = reinterpret_cast<block*>(first);
+    for (int i = 0; i < 3; ++i) {
+        new (&a->nodes[i]) node{i * 10, nullptr};
+    }
+    a->nodes[0].next = &a->nodes[1];
+    a->nodes[1].next = &a->nodes[2];
+    a->nodes[2].next = &a->nodes[0];  // Cycle, including a pointer back
+
+    std::memcpy(second, first, sizeof(block));
+    auto* b = reinterpret_cast<block*>(second);
+
+    REQUIRE(b->nodes[0].next.get() == &b->nodes[1]);
+    REQUIRE(b->nodes[1].next->value == 20);
+    REQUIRE(b->nodes[2].next.get() == &b->nodes[0]);
+}
+
+TEST_CASE("offset_ptr copies recompute the distance", "[offset_ptr]") {
+    int x = 42;
+    offset_ptr<int> a(&x);
+    offset_ptr<int> b(a);
+    offset_ptr<int> c;
+    c = a;
+    REQUIRE(b.get() == &x);
+    REQUIRE(c.get() == &x);
+    REQUIRE(a == b);
+
+    // Self-referencing pointer (object whose first member points to itself)
+    node n{1, nullptr};
+    n.next = &n;
+    REQUIRE(n.next.get() == &n);
+}
+
+TEST_CASE("offset_ptr conversions and casts", "[offset_ptr]") {
+    int x = 7;
+    offset_ptr<int> p(&x);
+    offset_ptr<const int> cp(p);
+    offset_ptr<void> vp(p);
+    REQUIRE(cp.get() == &x);
+    REQUIRE(vp.get() == &x);
+
+    offset_ptr<int> back = static_pointer_cast<int>(vp);
+    REQUIRE(*back == 7);
+    offset_ptr<int> mutable_again = const_pointer_cast<int>(cp);
+    *mutable_again = 8;
+    REQUIRE(x == 8);
+
+    REQUIRE(std::pointer_traits<offset_ptr<int>>::pointer_to(x).get() == &x);
+    REQUIRE(std::is_same<std::pointer_traits<offset_ptr<int>>::rebind<char>,
+                         offset_ptr<char>>::value);
+}
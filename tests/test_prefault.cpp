@@ -0,0 +1,113 @@
+#include <catch2/catch_test_macros.hpp>
+#include <slick/shm/shared_memory.hpp>
+
+#include <string>
+#include <chrono>
+#include <cstring>
+#include <vector>
+
+#ifdef SLICK_SHM_POSIX
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+using namespace slick::shm;
+
+namespace {
+
+std::string unique_name(const char* prefix) {
+    auto now = std::chrono::system_clock::now().time_since_epoch();
+    auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(now).count();
+    // Use modulo to keep the timestamp shorter while still being unique (macOS has 31-char limit)
+    return std::string(prefix) + std::to_string(millis % 100000000);
+}
+
+struct shm_cleanup {
+    std::string name;
+    ~shm_cleanup() {
+        shared_memory::remove(name.c_str());
+    }
+};
+
+#ifdef SLICK_SHM_LINUX
+// Number of resident pages in the mapping according to mincore()
+std::size_t resident_pages(const shared_memory& shm) {
+    std::size_t page = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+    std::vector<unsigned char> vec((shm.size() + page - 1) / page);
+    if (mincore(const_cast<void*>(shm.data()), shm.size(), vec.data()) != 0) {
+        return 0;
+    }
+    std::size_t count = 0;
+    for (unsigned char v : vec) {
+        count += v & 1;
+    }
+    return count;
+}
+
+std::size_t total_pages(const shared_memory& shm) {
+    std::size_t page = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+    return (shm.size() + page - 1) / page;
+}
+#endif
+
+}  // namespace
+
+TEST_CASE("Prefault option on construction", "[prefault]") {
+    std::string name = unique_name("test_prefault_opt");
+    shm_cleanup cleanup{name};
+
+    segment_options options;
+    options.prefault = true;
+
+    shared_memory shm(name.c_str(), 256 * 1024, create_only, access_mode::read_write, options);
+    REQUIRE(shm.is_valid());
+#ifdef SLICK_SHM_LINUX
+    REQUIRE(resident_pages(shm) == total_pages(shm));
+#endif
+
+    // Contents are untouched
+    const unsigned char* bytes = static_cast<const unsigned char*>(shm.data());
+    REQUIRE(bytes[0] == 0);
+    REQUIRE(bytes[shm.size() - 1] == 0);
+
+    SECTION("Read-only opener") {
+        shared_memory reader(name.c_str(), open_existing, access_mode::read_only, options);
+        REQUIRE(reader.is_valid());
+        REQUIRE(reader.size() == shm.size());
+    }
+}
+
+TEST_CASE("Explicit prefault of a range", "[prefault]") {
+    std::string name = unique_name("test_prefault_rng");
+    shm_cleanup cleanup{name};
+
+    shared_memory shm(name.c_str(), 256 * 1024, create_only);
+    REQUIRE(shm.is_valid());
+
+    const char* text = "keep me";
+    std::memcpy(shm.data(), text, std::strlen(text) + 1);
+
+    SECTION("Whole mapping") {
+        REQUIRE_FALSE(shm.prefault());
+#ifdef SLICK_SHM_LINUX
+        REQUIRE(resident_pages(shm) == total_pages(shm));
+#endif
+        REQUIRE(std::strcmp(static_cast<const char*>(shm.data()), text) == 0);
+    }
+
+    SECTION("Unaligned sub-range") {
+        REQUIRE_FALSE(shm.prefault(100, 10000));
+        REQUIRE_FALSE(shm.prefault(shm.size() - 1, 1));
+        REQUIRE_FALSE(shm.prefault(shm.size(), 0));
+    }
+
+    SECTION("Out of range") {
+        REQUIRE(shm.prefault(shm.size(), 1) == errc::invalid_argument);
+        REQUIRE(shm.prefault(1, shm.size()) == errc::invalid_argument);
+    }
+
+    SECTION("Unmapped") {
+        shm.unmap();
+        REQUIRE(shm.prefault() == errc::mapping_failed);
+    }
+}
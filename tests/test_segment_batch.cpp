@@ -0,0 +1,159 @@
+#include <catch2/catch_test_macros.hpp>
+#include <slick/shm/shared_memory.hpp>
+#include <slick/shm/segment_batch.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace slick::shm;
+
+namespace {
+
+std::string unique_name(const char* prefix) {
+    auto now = std::chrono::system_clock::now().time_since_epoch();
+    auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(now).count();
+    // Use modulo to keep the timestamp shorter while still being unique (macOS has 31-char limit)
+    return std::string(prefix) + std::to_string(millis % 100000000);
+}
+
+// Names of a batch, removed together
+struct batch_cleanup {
+    std::vector<std::string> names;
+
+    batch_cleanup(const char* prefix, std::size_t count) {
+        std::string base = unique_name(prefix);
+        for (std::size_t i = 0; i < count; ++i) {
+            names.push_back(base + "_" + std::to_string(i));
+        }
+    }
+
+    ~batch_cleanup() {
+        for (const std::string& name : names) {
+            shared_memory::remove(name.c_str());
+        }
+    }
+
+    std::vector<segment_spec> specs(std::size_t size) const {
+        std::vector<segment_spec> result(names.size());
+        for (std::size_t i = 0; i < names.size(); ++i) {
+            result[i].name = names[i].c_str();
+            result[i].size = size + i;
+        }
+        return result;
+    }
+};
+
+}  // namespace
+
+TEST_CASE("Create and open many segments", "[segment_batch]") {
+    batch_cleanup cleanup("batch", 100);
+    std::vector<segment_spec> specs = cleanup.specs(4096);
+
+    std::vector<shared_memory> created;
+    std::vector<std::error_code> errors;
+    REQUIRE(create_many(specs, created, errors) == 0);
+    REQUIRE(created.size() == specs.size());
+    for (std::size_t i = 0; i < created.size(); ++i) {
+        REQUIRE_FALSE(errors[i]);
+        REQUIRE(created[i].is_creator());
+        REQUIRE(created[i].size() == 4096 + i);
+        std::memcpy(created[i].data(), &i, sizeof(i));
+    }
+
+    for (segment_spec& spec : specs) {
+        spec.access = access_mode::read_only;
+    }
+    std::vector<shared_memory> opened;
+    REQUIRE(open_many(specs, opened, errors) == 0);
+    for (std::size_t i = 0; i < opened.size(); ++i) {
+        REQUIRE_FALSE(opened[i].is_creator());
+        REQUIRE(opened[i].mode() == access_mode::read_only);
+        REQUIRE(opened[i].size() == 4096 + i);
+        std::size_t value = 0;
+        std::memcpy(&value, opened[i].data(), sizeof(value));
+        REQUIRE(value == i);
+    }
+}
+
+TEST_CASE("Create many segments on several threads", "[segment_batch]") {
+    batch_cleanup cleanup("batchmt", 500);
+    std::vector<segment_spec> specs = cleanup.specs(1024);
+
+    batch_options batch;
+    batch.threads = 4;
+    std::vector<shared_memory> created;
+    std::vector<std::error_code> errors;
+    REQUIRE(create_many(specs, created, errors, batch) == 0);
+
+    std::vector<shared_memory> opened;
+    batch.threads = 0;  // One per hardware thread
+    REQUIRE(open_many(specs, opened, errors, batch) == 0);
+    for (std::size_t i = 0; i < opened.size(); ++i) {
+        REQUIRE(opened[i].is_valid());
+        REQUIRE(opened[i].size() == 1024 + i);
+    }
+}
+
+TEST_CASE("Batch entries fail independently", "[segment_batch]") {
+    batch_cleanup cleanup("batcherr", 4);
+    std::vector<segment_spec> specs = cleanup.specs(4096);
+    specs[1].name = "";
+    specs[2].size = 0;
+
+    shared_memory existing(specs[3].name, 4096, create_only);
+
+    std::vector<shared_memory> created;
+    std::vector<std::error_code> errors;
+    REQUIRE(create_many(specs, created, errors) == 3);
+    REQUIRE_FALSE(errors[0]);
+    REQUIRE(created[0].is_valid());
+    REQUIRE(errors[1] == errc::invalid_name);
+    REQUIRE(errors[2] == errc::invalid_size);
+    REQUIRE(errors[3] == errc::already_exists);
+    REQUIRE_FALSE(created[3].is_valid());
+
+    // Per-entry mode and options
+    specs[3].mode = create_mode::open_or_create;
+    segment_options prefaulted;
+    prefaulted.prefault = true;
+    specs[3].options = &prefaulted;
+    REQUIRE(create_many(specs.data() + 3, 1, created.data() + 3, errors.data() + 3) == 0);
+    REQUIRE_FALSE(created[3].is_creator());
+
+    std::vector<shared_memory> opened;
+    specs[2].name = "batch_missing_segment";
+    REQUIRE(open_many(specs, opened, errors) == 2);
+    REQUIRE(errors[1] == errc::invalid_name);
+    REQUIRE(errors[2] == errc::not_found);
+}
+
+TEST_CASE("Empty batch", "[segment_batch]") {
+    std::vector<segment_spec> specs;
+    std::vector<shared_memory> segments;
+    std::vector<std::error_code> errors;
+    batch_options batch;
+    batch.threads = 8;
+    REQUIRE(create_many(specs, segments, errors, batch) == 0);
+    REQUIRE(open_many(specs, segments, errors, batch) == 0);
+    REQUIRE(segments.empty());
+}
+
+TEST_CASE("open_always resizes an existing segment", "[segment_batch]") {
+    auto name = unique_name("batchsize");
+    struct cleanup_t {
+        std::string name;
+        ~cleanup_t() { shared_memory::remove(name.c_str()); }
+    } cleanup{name};
+
+    {
+        shared_memory first(name.c_str(), 8192, create_only);
+        REQUIRE(first.size() == 8192);
+    }
+    shared_memory again(name.c_str(), 12288, open_always);
+    REQUIRE(again.size() == 12288);
+    shared_memory opened(name.c_str(), open_existing);
+    REQUIRE(opened.size() == 12288);
+}
@@ -0,0 +1,265 @@
+#include <catch2/catch_test_macros.hpp>
+#include <slick/shm/shared_memory.hpp>
+#include <slick/shm/segment_cache.hpp>
+
+#include <string>
+#include <chrono>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+using namespace slick::shm;
+
+namespace {
+
+std::string unique_name(const char* prefix) {
+    auto now = std::chrono::system_clock::now().time_since_epoch();
+    auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(now).count();
+    // Use modulo to keep the timestamp shorter while still being unique (macOS has 31-char limit)
+    return std::string(prefix) + std::to_string(millis % 100000000);
+}
+
+struct shm_cleanup {
+    std::string name;
+    ~shm_cleanup() {
+        shared_memory::remove(name.c_str());
+    }
+};
+
+static_assert(segment_key("abc").hash() == slick::shm::detail::name_hash("abc"),
+              "keys can be hashed at compile time");
+static_assert(segment_key("abc").size() == 3, "keys are measured at compile time");
+
+}  // namespace
+
+TEST_CASE("segment_cache reuses mappings", "[segment_cache]") {
+    std::string name = unique_name("test_cache_reuse_");
+    shm_cleanup cleanup{name};
+    shared_memory shm(name.c_str(), 4096, create_only);
+    std::memcpy(shm.data(), "cached", 7);
+
+    segment_cache cache;
+    segment_key key(name.c_str());
+
+    cached_segment a;
+    REQUIRE_FALSE(cache.acquire(key, a));
+    REQUIRE(a.is_valid());
+    REQUIRE(a.size() == 4096);
+    REQUIRE(std::string(a.name()) == name);
+    REQUIRE(std::strcmp(static_cast<const char*>(a.data()), "cached") == 0);
+    REQUIRE(cache.misses() == 1);
+
+    // A second handle shares the mapping
+    cached_segment b;
+    REQUIRE_FALSE(cache.acquire(name.c_str(), b));
+    REQUIRE(b.data() == a.data());
+    REQUIRE(cache.hits() == 1);
+    REQUIRE(cache.cached_count() == 1);
+    REQUIRE(cache.mapped_bytes() == 4096);
+
+    // Released mappings stay cached
+    a.release();
+    b.release();
+    REQUIRE_FALSE(a.is_valid());
+    REQUIRE(cache.cached_count() == 1);
+    REQUIRE_FALSE(cache.acquire(key, a));
+    REQUIRE(cache.hits() == 2);
+    REQUIRE(cache.misses() == 1);
+
+    shared_memory_view view = a.view();
+    REQUIRE(view.data() == a.data());
+    REQUIRE(view.size() == a.size());
+}
+
+TEST_CASE("segment_cache keeps modes apart", "[segment_cache]") {
+    std::string name = unique_name("test_cache_mode_");
+    shm_cleanup cleanup{name};
+    shared_memory shm(name.c_str(), 4096, create_only);
+
+    segment_cache cache;
+    cached_segment writer;
+    cached_segment reader;
+    REQUIRE_FALSE(cache.acquire(name.c_str(), writer, access_mode::read_write));
+    REQUIRE_FALSE(cache.acquire(name.c_str(), reader, access_mode::read_only));
+    REQUIRE(reader.mode() == access_mode::read_only);
+    REQUIRE(writer.mode() == access_mode::read_write);
+    REQUIRE(reader.data() != writer.data());
+    REQUIRE(cache.cached_count() == 2);
+
+    static_cast<char*>(writer.data())[0] = 'w';
+    REQUIRE(static_cast<const char*>(reader.data())[0] == 'w');
+}
+
+TEST_CASE("segment_cache evicts idle mappings over the cap", "[segment_cache]") {
+    std::string names[4] = {unique_name("test_cache_lru0_"), unique_name("test_cache_lru1_"),
+                            unique_name("test_cache_lru2_"), unique_name("test_cache_lru3_")};
+    shm_cleanup cleanups[4] = {{names[0]}, {names[1]}, {names[2]}, {names[3]}};
+    std::vector<shared_memory> segments;
+    for (const std::string& name : names) {
+        segments.emplace_back(name.c_str(), 64 * 1024, create_only);
+    }
+    std::size_t segment_size = segments[0].size();
+
+    segment_cache cache(2 * segment_size);
+    REQUIRE(cache.capacity() == 2 * segment_size);
+    {
+        cached_segment a;
+        cached_segment b;
+        cached_segment c;
+        REQUIRE_FALSE(cache.acquire(names[0].c_str(), a));
+        REQUIRE_FALSE(cache.acquire(names[1].c_str(), b));
+        REQUIRE_FALSE(cache.acquire(names[2].c_str(), c));
+        // Held mappings are never evicted, even over the cap
+        REQUIRE(cache.cached_count() == 3);
+        REQUIRE(cache.mapped_bytes() == 3 * segment_size);
+
+        b.release();  // Least recently used
+        REQUIRE(cache.cached_count() == 2);
+        a.release();
+        c.release();
+    }
+    REQUIRE(cache.cached_count() == 2);
+    REQUIRE(cache.mapped_bytes() == 2 * segment_size);
+
+    // names[0] and names[2] are cached, names[1] was evicted
+    cached_segment handle;
+    std::uint64_t misses = cache.misses();
+    REQUIRE_FALSE(cache.acquire(names[2].c_str(), handle));
+    REQUIRE_FALSE(cache.acquire(names[0].c_str(), handle));
+    REQUIRE(cache.misses() == misses);
+    REQUIRE_FALSE(cache.acquire(names[1].c_str(), handle));
+    REQUIRE(cache.misses() == misses + 1);
+    handle.release();
+
+    // Opening names[1] evicted names[2]; names[3] evicts names[0]
+    REQUIRE_FALSE(cache.acquire(names[3].c_str(), handle));
+    handle.release();
+    REQUIRE(cache.cached_count() == 2);
+    REQUIRE_FALSE(cache.acquire(names[2].c_str(), handle));
+    REQUIRE(cache.misses() == misses + 3);
+    handle.release();
+
+    cache.trim();
+    REQUIRE(cache.cached_count() == 0);
+    REQUIRE(cache.mapped_bytes() == 0);
+
+    REQUIRE_FALSE(cache.acquire(names[0].c_str(), handle));
+    cache.set_capacity(1);
+    REQUIRE(cache.cached_count() == 1);
+    handle.release();
+    REQUIRE(cache.cached_count() == 0);
+}
+
+TEST_CASE("segment_cache invalidate reopens recreated segments", "[segment_cache]") {
+    std::string name = unique_name("test_cache_inval_");
+    shm_cleanup cleanup{name};
+
+    segment_cache cache;
+    cached_segment old_handle;
+    {
+        shared_memory first(name.c_str(), 4096, create_only);
+        std::memcpy(first.data(), "first", 6);
+        REQUIRE_FALSE(cache.acquire(name.c_str(), old_handle));
+    }
+    shared_memory::remove(name.c_str());
+    shared_memory second(name.c_str(), 8192, create_only);
+    std::memcpy(second.data(), "second", 7);
+
+    cache.invalidate(name.c_str());
+    REQUIRE(cache.cached_count() == 0);
+    // The held mapping stays valid
+    REQUIRE(std::strcmp(static_cast<const char*>(old_handle.data()), "first") == 0);
+
+    cached_segment new_handle;
+    REQUIRE_FALSE(cache.acquire(name.c_str(), new_handle));
+    REQUIRE(std::strcmp(static_cast<const char*>(new_handle.data()), "second") == 0);
+
+    old_handle.release();
+    REQUIRE(cache.mapped_bytes() == new_handle.size());
+
+    cache.clear();
+    REQUIRE(cache.cached_count() == 0);
+    REQUIRE(new_handle.is_valid());
+    new_handle.release();
+    REQUIRE(cache.mapped_bytes() == 0);
+}
+
+TEST_CASE("segment_cache errors and handles", "[segment_cache]") {
+    std::string name = unique_name("test_cache_err_");
+    segment_cache cache;
+
+    cached_segment handle;
+    REQUIRE(cache.acquire(name.c_str(), handle) == errc::not_found);
+    REQUIRE_FALSE(handle.is_valid());
+    REQUIRE(handle.data() == nullptr);
+    REQUIRE(handle.size() == 0);
+    REQUIRE_FALSE(handle.view().is_valid());
+    REQUIRE(cache.cached_count() == 0);
+
+    shm_cleanup cleanup{name};
+    shared_memory shm(name.c_str(), 4096, create_only);
+    REQUIRE_FALSE(cache.acquire(name.c_str(), handle));
+
+    cached_segment moved(std::move(handle));
+    REQUIRE_FALSE(handle.is_valid());
+    REQUIRE(moved.is_valid());
+    handle = std::move(moved);
+    REQUIRE(handle.is_valid());
+
+    REQUIRE(&segment_cache::instance() == &segment_cache::instance());
+}
+
+TEST_CASE("segment_cache concurrent acquire", "[segment_cache]") {
+    std::string name = unique_name("test_cache_mt_");
+    shm_cleanup cleanup{name};
+    shared_memory shm(name.c_str(), 4096, create_only);
+
+    segment_cache cache(1);  // Every release evicts
+    segment_key key(name.c_str());
+    std::vector<std::thread> threads;
+    std::vector<int> failures(4, 0);
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&, t] {
+            for (int i = 0; i < 500; ++i) {
+                cached_segment handle;
+                if (cache.acquire(key, handle) || handle.size() != 4096) {
+                    ++failures[t];
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (int f : failures) {
+        REQUIRE(f == 0);
+    }
+    REQUIRE(cache.cached_count() == 0);
+    REQUIRE(cache.hits() + cache.misses() == 2000);
+}
+
+TEST_CASE("segment_cache concurrent first acquire keeps one mapping", "[segment_cache]") {
+    std::string name = unique_name("test_cache_first_");
+    shm_cleanup cleanup{name};
+    shared_memory shm(name.c_str(), 4096, create_only);
+
+    segment_cache cache;
+    segment_key key(name.c_str());
+    std::vector<cached_segment> handles(4);
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < handles.size(); ++t) {
+        threads.emplace_back([&, t] { cache.acquire(key, handles[t]); });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // Threads that lost the race closed their own mapping and share the winner's
+    for (auto& handle : handles) {
+        REQUIRE(handle.is_valid());
+        REQUIRE(handle.data() == handles[0].data());
+    }
+    REQUIRE(cache.cached_count() == 1);
+    REQUIRE(cache.mapped_bytes() == 4096);
+    REQUIRE(cache.hits() + cache.misses() == 4);
+}
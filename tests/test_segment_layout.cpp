@@ -0,0 +1,161 @@
+#include <catch2/catch_test_macros.hpp>
+#include <slick/shm/shared_memory.hpp>
+#include <slick/shm/segment_layout.hpp>
+
+#include <atomic>
+#include <string>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+
+using namespace slick::shm;
+
+namespace {
+
+std::string unique_name(const char* prefix) {
+    auto now = std::chrono::system_clock::now().time_since_epoch();
+    auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(now).count();
+    // Use modulo to keep the timestamp shorter while still being unique (macOS has 31-char limit)
+    return std::string(prefix) + std::to_string(millis % 100000000);
+}
+
+struct shm_cleanup {
+    std::string name;
+    ~shm_cleanup() {
+        shared_memory::remove(name.c_str());
+    }
+};
+
+struct header {
+    std::uint64_t magic;
+    std::uint32_t version;
+};
+
+struct producer_block {
+    std::atomic<std::uint64_t> head;
+};
+
+struct consumer_block {
+    std::atomic<std::uint64_t> tail;
+};
+
+struct quote {
+    double bid;
+    double ask;
+    std::uint32_t sequence = 7;  // Non-zero initial state, set by construct()
+};
+
+struct alignas(256) wide_block {
+    char bytes[300];
+};
+
+constexpr std::size_t line = slick::shm::detail::cache_line_size;
+
+using feed_layout = segment_layout<region<header>, region<producer_block>,
+                                   region<consumer_block>, array_region<quote, 100>>;
+
+// Atomics are accepted everywhere, even where they aren't trivially copyable (MSVC)
+static_assert(slick::shm::detail::is_region_type<producer_block>::value, "");
+static_assert(slick::shm::detail::is_region_type<quote>::value, "");
+static_assert(!slick::shm::detail::is_region_type<std::string>::value, "");
+
+// Offsets are compile-time constants
+static_assert(feed_layout::region_count == 4, "");
+static_assert(feed_layout::offset_of<0>() == 0, "");
+static_assert(feed_layout::offset_of<1>() == line, "");
+static_assert(feed_layout::offset_of<2>() == 2 * line, "");
+static_assert(feed_layout::offset_of<3>() == 3 * line, "");
+static_assert(feed_layout::size == 3 * line + (100 * sizeof(quote) + line - 1) / line * line, "");
+static_assert(feed_layout::alignment == line, "");
+static_assert(feed_layout::index_of<consumer_block>() == 2, "");
+
+// Explicit alignments pack small regions together
+using packed_layout = segment_layout<region<std::uint32_t, 4>, region<std::uint64_t, 8>,
+                                     array_region<char, 3, 1>, region<std::uint16_t, 2>>;
+static_assert(packed_layout::offset_of<1>() == 8, "");
+static_assert(packed_layout::offset_of<2>() == 16, "");
+static_assert(packed_layout::offset_of<3>() == 20, "");
+static_assert(packed_layout::size == 24, "");
+
+// Over-aligned types keep their own alignment
+using wide_layout = segment_layout<region<header>, region<wide_block>, region<header, 8>>;
+static_assert(wide_layout::offset_of<1>() == (line > 256 ? line : 256), "");
+static_assert(wide_layout::offset_of<2>() == wide_layout::offset_of<1>() + 512, "");
+static_assert(wide_layout::alignment == (line > 256 ? line : 256), "");
+
+// Larger than the page a small segment is rounded up to
+using big_layout = segment_layout<array_region<quote, 1000>>;
+
+}  // namespace
+
+TEST_CASE("segment_layout accessors over a segment", "[segment_layout]") {
+    std::string name = unique_name("test_layout_bind_");
+    shm_cleanup cleanup{name};
+
+    shared_memory shm(name.c_str(), feed_layout::size, create_only);
+    auto feed = feed_layout::bind(shm);
+    REQUIRE(feed.is_valid());
+    REQUIRE(feed.data() == shm.data());
+
+    char* base = static_cast<char*>(shm.data());
+    REQUIRE(reinterpret_cast<char*>(feed.get<header>()) == base);
+    REQUIRE(reinterpret_cast<char*>(feed.get<producer_block>()) == base + line);
+    REQUIRE(reinterpret_cast<char*>(feed.get<2>()) == base + 2 * line);
+    REQUIRE(reinterpret_cast<char*>(feed.get<quote>()) == base + 3 * line);
+    REQUIRE(feed.get<3>() == feed.get<quote>());
+
+    // Static accessors on the raw base address
+    REQUIRE(feed_layout::get<consumer_block>(shm.data()) == feed.get<consumer_block>());
+    const void* const_base = shm.data();
+    REQUIRE(feed_layout::get<0>(const_base) == feed.get<header>());
+}
+
+TEST_CASE("segment_layout construct initializes every region", "[segment_layout]") {
+    std::string name = unique_name("test_layout_init_");
+    shm_cleanup cleanup{name};
+
+    shared_memory shm(name.c_str(), feed_layout::size, create_only);
+    std::memset(shm.data(), 0xff, shm.size());
+    feed_layout::construct(shm.data());
+
+    auto feed = feed_layout::bind(shm);
+    REQUIRE(feed.get<header>()->magic == 0);
+    REQUIRE(feed.get<producer_block>()->head.load() == 0);
+    quote* quotes = feed.get<quote>();
+    bool all_initialized = true;
+    for (std::size_t i = 0; i < 100; ++i) {
+        all_initialized = all_initialized && quotes[i].sequence == 7 && quotes[i].bid == 0.0;
+    }
+    REQUIRE(all_initialized);
+}
+
+TEST_CASE("segment_layout regions are shared across mappings", "[segment_layout]") {
+    std::string name = unique_name("test_layout_share_");
+    shm_cleanup cleanup{name};
+
+    shared_memory producer(name.c_str(), feed_layout::size, create_only);
+    shared_memory consumer(name.c_str(), open_existing);
+
+    auto out = feed_layout::bind(producer);
+    auto in = feed_layout::bind(consumer);
+    out.get<quote>()[42].bid = 101.25;
+    out.get<producer_block>()->head.store(43, std::memory_order_release);
+
+    REQUIRE(in.get<producer_block>()->head.load(std::memory_order_acquire) == 43);
+    REQUIRE(in.get<quote>()[42].bid == 101.25);
+}
+
+TEST_CASE("segment_layout rejects segments that are too small", "[segment_layout]") {
+    std::string name = unique_name("test_layout_small_");
+    shm_cleanup cleanup{name};
+
+    shared_memory shm(name.c_str(), 64, create_only);
+    REQUIRE(shm.size() < big_layout::size);
+    REQUIRE_FALSE(big_layout::bind(shm).is_valid());
+    REQUIRE_FALSE(big_layout::fits(shm.data(), shm.size()));
+    REQUIRE(packed_layout::fits(shm.data(), shm.size()));
+    REQUIRE_FALSE(packed_layout::fits(static_cast<char*>(shm.data()) + 1, 32));
+
+    shared_memory closed;
+    REQUIRE_FALSE(feed_layout::bind(closed).is_valid());
+}
@@ -0,0 +1,110 @@
+#include <catch2/catch_test_macros.hpp>
+#include <slick/shm/seqlock.hpp>
+#include <slick/shm/shared_memory.hpp>
+
+#include <string>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using namespace slick::shm;
+
+namespace {
+
+std::string unique_name(const char* prefix) {
+    auto now = std::chrono::system_clock::now().time_since_epoch();
+    auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(now).count();
+    // Use modulo to keep the timestamp shorter while still being unique (macOS has 31-char limit)
+    return std::string(prefix) + std::to_string(millis % 100000000);
+}
+
+struct shm_cleanup {
+    std::string name;
+    ~shm_cleanup() {
+        shared_memory::remove(name.c_str());
+    }
+};
+
+// All fields carry the same value so torn reads are easy to spot
+struct top_of_book {
+    std::uint64_t bid;
+    std::uint64_t ask;
+    std::uint64_t bid_size;
+    std::uint64_t ask_size;
+    std::uint64_t pad[4];
+};
+
+top_of_book make_book(std::uint64_t v) {
+    return top_of_book{v, v, v, v, {v, v, v, v}};
+}
+
+bool is_consistent(const top_of_book& b) {
+    return b.ask == b.bid && b.bid_size == b.bid && b.ask_size == b.bid && b.pad[0] == b.bid &&
+           b.pad[1] == b.bid && b.pad[2] == b.bid && b.pad[3] == b.bid;
+}
+
+}  // namespace
+
+TEST_CASE("seqlock in a zero-filled segment", "[seqlock]") {
+    std::string name = unique_name("test_seqlock_basic");
+    shm_cleanup cleanup{name};
+
+    shared_memory shm(name.c_str(), sizeof(seqlock<top_of_book>), create_only);
+    auto* book = static_cast<seqlock<top_of_book>*>(shm.data());
+
+    REQUIRE(book->version() == 0);
+    top_of_book initial = book->load();
+    REQUIRE(initial.bid == 0);
+    REQUIRE(is_consistent(initial));
+
+    book->store(make_book(7));
+    REQUIRE(book->version() == 1);
+
+    // Readers work through a read-only mapping
+    shared_memory reader(name.c_str(), open_existing, access_mode::read_only);
+    const auto* view = static_cast<const seqlock<top_of_book>*>(reader.data());
+    top_of_book out{};
+    REQUIRE(view->try_load(out));
+    REQUIRE(out.bid == 7);
+    REQUIRE(view->load().ask_size == 7);
+    REQUIRE(view->version() == 1);
+}
+
+TEST_CASE("seqlock readers never see torn values", "[seqlock]") {
+    std::string name = unique_name("test_seqlock_mt");
+    shm_cleanup cleanup{name};
+
+    shared_memory shm(name.c_str(), sizeof(seqlock<top_of_book>), create_only);
+    auto* book = static_cast<seqlock<top_of_book>*>(shm.data());
+
+    std::atomic<bool> done{false};
+    std::atomic<bool> consistent{true};
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 2; ++r) {
+        readers.emplace_back([&name, &done, &consistent] {
+            shared_memory mapping(name.c_str(), open_existing, access_mode::read_only);
+            const auto* view = static_cast<const seqlock<top_of_book>*>(mapping.data());
+            std::uint64_t last = 0;
+            while (!done.load(std::memory_order_acquire)) {
+                top_of_book b = view->load();
+                if (!is_consistent(b) || b.bid < last) {
+                    consistent.store(false);
+                }
+                last = b.bid;
+            }
+        });
+    }
+
+    for (std::uint64_t i = 1; i <= 200000; ++i) {
+        book->store(make_book(i));
+    }
+    done.store(true, std::memory_order_release);
+    for (auto& t : readers) {
+        t.join();
+    }
+
+    REQUIRE(consistent.load());
+    REQUIRE(book->version() == 200000);
+}
@@ -0,0 +1,250 @@
+#include <catch2/catch_test_macros.hpp>
+#include <slick/shm/shared_memory.hpp>
+#include <slick/shm/shared_memory_window.hpp>
+
+#include <string>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <new>
+
+using namespace slick::shm;
+
+namespace {
+
+std::string unique_name(const char* prefix) {
+    auto now = std::chrono::system_clock::now().time_since_epoch();
+    auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(now).count();
+    // Use modulo to keep the timestamp shorter while still being unique (macOS has 31-char limit)
+    return std::string(prefix) + std::to_string(millis % 100000000);
+}
+
+struct shm_cleanup {
+    std::string name;
+    ~shm_cleanup() {
+        shared_memory::remove(name.c_str());
+    }
+};
+
+constexpr std::size_t MiB = 1024 * 1024;
+
+// Segment filled with its own word offsets, so any slice can be checked
+void fill_offsets(shared_memory& shm) {
+    auto* words = static_cast<std::uint64_t*>(shm.data());
+    for (std::size_t i = 0; i < shm.size() / sizeof(std::uint64_t); ++i) {
+        words[i] = i * sizeof(std::uint64_t);
+    }
+}
+
+std::uint64_t word_at(const void* p) {
+    std::uint64_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+}  // namespace
+
+TEST_CASE("shared_memory_window maps a slice at any offset", "[window]") {
+    std::string name = unique_name("test_win_slice_");
+    shm_cleanup cleanup{name};
+
+    shared_memory shm(name.c_str(), 8 * MiB, create_only);
+    fill_offsets(shm);
+
+    // Unaligned offset in the middle of the segment
+    std::size_t offset = 5 * MiB + 3 * 4096 + 24;
+    shared_memory_window window(name.c_str(), open_existing, offset, 1000,
+                                access_mode::read_only);
+    REQUIRE(window.is_valid());
+    REQUIRE(window.offset() == offset);
+    REQUIRE(window.size() == 1000);
+    REQUIRE(window.segment_size() == shm.size());
+    REQUIRE(window.granularity() > 0);
+    REQUIRE(std::string(window.name()) == name);
+    REQUIRE(window.mode() == access_mode::read_only);
+    REQUIRE(word_at(window.data()) == offset);
+    REQUIRE(word_at(static_cast<const char*>(window.data()) + 992) == offset + 992);
+
+    REQUIRE(window.contains(offset, 1000));
+    REQUIRE(window.contains(offset + 500, 500));
+    REQUIRE_FALSE(window.contains(offset - 8, 8));
+    REQUIRE_FALSE(window.contains(offset + 500, 501));
+}
+
+TEST_CASE("shared_memory_window remaps to another slice", "[window]") {
+    std::string name = unique_name("test_win_remap_");
+    shm_cleanup cleanup{name};
+
+    shared_memory shm(name.c_str(), 4 * MiB, create_only);
+    fill_offsets(shm);
+
+    shared_memory_window window(name.c_str(), open_existing, 0, 64 * 1024,
+                                access_mode::read_only);
+    REQUIRE(word_at(window.data()) == 0);
+
+    // Smaller, larger, backwards and up to the last byte
+    std::size_t slices[][2] = {{MiB, 4096}, {2 * MiB + 8, 512 * 1024}, {64, 64},
+                               {4 * MiB - 8, 8}};
+    for (auto& slice : slices) {
+        REQUIRE_FALSE(window.remap(slice[0], slice[1]));
+        REQUIRE(window.offset() == slice[0]);
+        REQUIRE(window.size() == slice[1]);
+        REQUIRE(word_at(window.data()) == slice[0]);
+        REQUIRE(word_at(static_cast<const char*>(window.data()) + slice[1] - 8) ==
+                slice[0] + slice[1] - 8);
+    }
+}
+
+TEST_CASE("shared_memory_window writes are visible in the segment", "[window]") {
+    std::string name = unique_name("test_win_write_");
+    shm_cleanup cleanup{name};
+
+    shared_memory shm(name.c_str(), 2 * MiB, create_only);
+    std::memset(shm.data(), 0, shm.size());
+
+    shared_memory_window window(name.c_str(), open_existing, MiB + 100, 16);
+    REQUIRE(window.mode() == access_mode::read_write);
+    std::memcpy(window.data(), "window slice", 13);
+
+    REQUIRE(std::strcmp(static_cast<const char*>(shm.data()) + MiB + 100, "window slice") == 0);
+}
+
+TEST_CASE("shared_memory_window rejects slices outside the segment", "[window]") {
+    std::string name = unique_name("test_win_range_");
+    shm_cleanup cleanup{name};
+
+    shared_memory shm(name.c_str(), MiB, create_only);
+
+    shared_memory_window past(name.c_str(), open_existing, MiB - 8, 16,
+                              access_mode::read_only, segment_options(), std::nothrow);
+    REQUIRE_FALSE(past.is_valid());
+    REQUIRE(past.last_error() == errc::invalid_argument);
+
+    shared_memory_window empty(name.c_str(), open_existing, 0, 0, access_mode::read_only,
+                               segment_options(), std::nothrow);
+    REQUIRE_FALSE(empty.is_valid());
+    REQUIRE(empty.last_error() == errc::invalid_size);
+
+    REQUIRE_THROWS_AS(shared_memory_window(name.c_str(), open_existing, 2 * MiB, 1),
+                      shared_memory_error);
+
+    shared_memory_window window(name.c_str(), open_existing, 0, 4096, access_mode::read_only);
+    REQUIRE(window.remap(MiB, 1) == errc::invalid_argument);
+    // The failed remap was rejected before unmapping anything
+    REQUIRE(window.is_valid());
+    REQUIRE(window.offset() == 0);
+}
+
+TEST_CASE("shared_memory_window reports missing segments", "[window]") {
+    std::string name = unique_name("test_win_missing_");
+
+    shared_memory_window window(name.c_str(), open_existing, 0, 4096, access_mode::read_only,
+                                segment_options(), std::nothrow);
+    REQUIRE_FALSE(window.is_valid());
+    REQUIRE(window.last_error() == errc::not_found);
+    REQUIRE(window.data() == nullptr);
+    REQUIRE(window.size() == 0);
+}
+
+TEST_CASE("shared_memory_window move semantics", "[window]") {
+    std::string name = unique_name("test_win_move_");
+    shm_cleanup cleanup{name};
+
+    shared_memory shm(name.c_str(), MiB, create_only);
+    fill_offsets(shm);
+
+    shared_memory_window a(name.c_str(), open_existing, 8192, 64, access_mode::read_only);
+    shared_memory_window b(std::move(a));
+    REQUIRE_FALSE(a.is_valid());
+    REQUIRE(b.is_valid());
+    REQUIRE(word_at(b.data()) == 8192);
+
+    shared_memory_window c;
+    c = std::move(b);
+    REQUIRE_FALSE(b.is_valid());
+    REQUIRE(word_at(c.data()) == 8192);
+}
+
+TEST_CASE("sliding_window streams through a segment", "[window][sliding]") {
+    std::string name = unique_name("test_win_slide_");
+    shm_cleanup cleanup{name};
+
+    shared_memory shm(name.c_str(), 8 * MiB, create_only);
+    fill_offsets(shm);
+
+    sliding_window replay(name.c_str(), open_existing, MiB);
+    REQUIRE(replay.is_valid());
+    REQUIRE(replay.window_size() >= MiB);
+    REQUIRE(replay.segment_size() == shm.size());
+    REQUIRE(replay.mode() == access_mode::read_only);
+
+    // 24-byte records straddle window boundaries
+    constexpr std::size_t record = 24;
+    bool all_match = true;
+    for (std::size_t pos = 0; pos + record <= replay.segment_size(); pos += record) {
+        const void* p = replay.at(pos, record);
+        if (p == nullptr || word_at(static_cast<const char*>(p) + (8 - pos % 8) % 8) !=
+                                (pos + 7) / 8 * 8) {
+            all_match = false;
+            break;
+        }
+    }
+    REQUIRE(all_match);
+
+    // One remap per window, plus at most one per boundary-straddling record
+    REQUIRE(replay.remap_count() >= 7);
+    REQUIRE(replay.remap_count() <= 16);
+    REQUIRE(replay.window().size() <= replay.window_size() + replay.window().granularity());
+}
+
+TEST_CASE("sliding_window random access and long ranges", "[window][sliding]") {
+    std::string name = unique_name("test_win_rand_");
+    shm_cleanup cleanup{name};
+
+    shared_memory shm(name.c_str(), 4 * MiB, create_only);
+    fill_offsets(shm);
+
+    sliding_window view(name.c_str(), open_existing, 64 * 1024);
+
+    // Already mapped - no remap
+    REQUIRE(word_at(view.at(4096, 8)) == 4096);
+    REQUIRE(view.remap_count() == 0);
+
+    REQUIRE(word_at(view.at(3 * MiB, 8)) == 3 * MiB);
+    REQUIRE(view.remap_count() == 1);
+    REQUIRE(word_at(view.at(3 * MiB + 800, 8)) == 3 * MiB + 800);
+    REQUIRE(view.remap_count() == 1);
+
+    // A range longer than the window gets a bigger window
+    const void* big = view.at(MiB, 2 * MiB);
+    REQUIRE(big != nullptr);
+    REQUIRE(word_at(static_cast<const char*>(big) + 2 * MiB - 8) == 3 * MiB - 8);
+
+    // The window is clamped at the end of the segment
+    REQUIRE(word_at(view.at(4 * MiB - 8, 8)) == 4 * MiB - 8);
+    REQUIRE(view.window().offset() + view.window().size() <= view.segment_size());
+
+    REQUIRE(view.at(4 * MiB - 4, 8) == nullptr);
+    REQUIRE(view.last_error() == errc::invalid_argument);
+    // Still usable after a rejected range
+    REQUIRE(word_at(view.at(0, 8)) == 0);
+}
+
+TEST_CASE("sliding_window error handling", "[window][sliding]") {
+    std::string name = unique_name("test_win_slerr_");
+
+    sliding_window missing(name.c_str(), open_existing, MiB, access_mode::read_only,
+                           segment_options(), std::nothrow);
+    REQUIRE_FALSE(missing.is_valid());
+    REQUIRE(missing.last_error() == errc::not_found);
+    REQUIRE(missing.at(0, 1) == nullptr);
+
+    REQUIRE_THROWS_AS(sliding_window(name.c_str(), open_existing, MiB), shared_memory_error);
+
+    shm_cleanup cleanup{name};
+    shared_memory shm(name.c_str(), MiB, create_only);
+    sliding_window zero(name.c_str(), open_existing, 0, access_mode::read_only,
+                        segment_options(), std::nothrow);
+    REQUIRE_FALSE(zero.is_valid());
+    REQUIRE(zero.last_error() == errc::invalid_size);
+}
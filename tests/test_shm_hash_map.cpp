@@ -0,0 +1,203 @@
+#include <catch2/catch_test_macros.hpp>
+#include <slick/shm/shm_hash_map.hpp>
+#include <slick/shm/shared_memory.hpp>
+
+#include <string>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <thread>
+#include <vector>
+
+using namespace slick::shm;
+
+namespace {
+
+std::string unique_name(const char* prefix) {
+    auto now = std::chrono::system_clock::now().time_since_epoch();
+    auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(now).count();
+    // Use modulo to keep the timestamp shorter while still being unique (macOS has 31-char limit)
+    return std::string(prefix) + std::to_string(millis % 100000000);
+}
+
+struct shm_cleanup {
+    std::string name;
+    ~shm_cleanup() {
+        shared_memory::remove(name.c_str());
+    }
+};
+
+struct symbol {
+    char text[16];
+};
+
+struct symbol_hash {
+    std::size_t operator()(const symbol& s) const noexcept {
+        std::uint64_t h = 14695981039346656037ULL;  // FNV-1a
+        for (char c : s.text) {
+            h = (h ^ static_cast<unsigned char>(c)) * 1099511628211ULL;
+        }
+        return static_cast<std::size_t>(h);
+    }
+};
+
+struct symbol_equal {
+    bool operator()(const symbol& a, const symbol& b) const noexcept {
+        return std::memcmp(a.text, b.text, sizeof(a.text)) == 0;
+    }
+};
+
+symbol make_symbol(const char* text) {
+    symbol s{};
+    std::strncpy(s.text, text, sizeof(s.text) - 1);
+    return s;
+}
+
+// Every key hashes to the same bucket, to exercise probing into the next buckets
+struct constant_hash {
+    std::size_t operator()(std::uint64_t) const noexcept { return 42; }
+};
+
+}  // namespace
+
+TEST_CASE("shm_hash_map insert and find", "[shm_hash_map]") {
+    std::string name = unique_name("test_hmap_basic_");
+    shm_cleanup cleanup{name};
+
+    shm_hash_map<std::uint64_t, std::uint32_t> map(name.c_str(), 1000, create_only);
+    REQUIRE(map.is_valid());
+    REQUIRE(map.empty());
+    REQUIRE(map.capacity() >= 1000);
+
+    for (std::uint64_t id = 0; id < 1000; ++id) {
+        REQUIRE(map.insert(id * 7919, static_cast<std::uint32_t>(id)) == insert_status::inserted);
+    }
+    REQUIRE(map.size() == 1000);
+    REQUIRE(map.insert(7919, 99) == insert_status::exists);
+    REQUIRE(*map.find(7919) == 1);  // First value kept
+
+    for (std::uint64_t id = 0; id < 1000; ++id) {
+        const std::uint32_t* value = map.find(id * 7919);
+        REQUIRE(value != nullptr);
+        REQUIRE(*value == id);
+    }
+    REQUIRE(map.find(3) == nullptr);
+    REQUIRE_FALSE(map.contains(1000 * 7919));
+
+    std::uint64_t visited = 0;
+    map.for_each([&](std::uint64_t, std::uint32_t) { ++visited; });
+    REQUIRE(visited == 1000);
+}
+
+TEST_CASE("shm_hash_map readers attach read-only", "[shm_hash_map]") {
+    std::string name = unique_name("test_hmap_ro_");
+    shm_cleanup cleanup{name};
+
+    using map_type = shm_hash_map<symbol, std::uint32_t, symbol_hash, symbol_equal>;
+    map_type builder(name.c_str(), 100, create_only);
+    REQUIRE(builder.insert(make_symbol("AAPL"), 1) == insert_status::inserted);
+    REQUIRE(builder.insert(make_symbol("MSFT"), 2) == insert_status::inserted);
+    REQUIRE(builder.insert(make_symbol("ESZ6"), 3) == insert_status::inserted);
+
+    map_type reader(name.c_str(), open_existing);
+    REQUIRE(reader.is_valid());
+    REQUIRE(reader.segment().mode() == access_mode::read_only);
+    REQUIRE(reader.size() == 3);
+    REQUIRE(*reader.find(make_symbol("MSFT")) == 2);
+    REQUIRE(reader.find(make_symbol("GOOG")) == nullptr);
+
+    // Later inserts are visible to attached readers
+    REQUIRE(builder.insert(make_symbol("GOOG"), 4) == insert_status::inserted);
+    REQUIRE(*reader.find(make_symbol("GOOG")) == 4);
+}
+
+TEST_CASE("shm_hash_map probes past full buckets", "[shm_hash_map]") {
+    std::string name = unique_name("test_hmap_probe_");
+    shm_cleanup cleanup{name};
+
+    shm_hash_map<std::uint64_t, std::uint64_t, constant_hash> map(name.c_str(), 200, create_only);
+    const std::size_t slots = map.capacity();
+    for (std::uint64_t key = 0; key < slots; ++key) {
+        REQUIRE(map.insert(key, key * 2) == insert_status::inserted);
+    }
+    REQUIRE(map.insert(slots, 0) == insert_status::full);
+    REQUIRE(map.insert(5, 0) == insert_status::exists);
+    for (std::uint64_t key = 0; key < slots; ++key) {
+        REQUIRE(*map.find(key) == key * 2);
+    }
+    REQUIRE(map.find(slots) == nullptr);
+}
+
+TEST_CASE("shm_hash_map concurrent writers", "[shm_hash_map]") {
+    std::string name = unique_name("test_hmap_mt_");
+    shm_cleanup cleanup{name};
+
+    shm_hash_map<std::uint64_t, std::uint64_t> map(name.c_str(), 20000, create_only);
+    constexpr int writers = 4;
+    constexpr std::uint64_t keys = 10000;
+    std::atomic<std::uint64_t> inserted{0};
+
+    // All writers insert the same keys; each key must be stored exactly once
+    std::vector<std::thread> threads;
+    for (int t = 0; t < writers; ++t) {
+        threads.emplace_back([&, t] {
+            shm_hash_map<std::uint64_t, std::uint64_t> writer(name.c_str(), open_existing,
+                                                              access_mode::read_write);
+            for (std::uint64_t i = 0; i < keys; ++i) {
+                std::uint64_t key = (i * 31 + static_cast<std::uint64_t>(t) * 7) % keys;
+                if (writer.insert(key, key + 1) == insert_status::inserted) {
+                    ++inserted;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    REQUIRE(inserted == keys);
+    REQUIRE(map.size() == keys);
+    std::uint64_t visited = 0;
+    map.for_each([&](std::uint64_t key, std::uint64_t value) {
+        ++visited;
+        REQUIRE(value == key + 1);
+    });
+    REQUIRE(visited == keys);
+}
+
+TEST_CASE("shm_hash_map open errors", "[shm_hash_map]") {
+    std::string name = unique_name("test_hmap_err_");
+    shm_cleanup cleanup{name};
+
+    SECTION("Missing segment") {
+        shm_hash_map<std::uint64_t, std::uint32_t> map(name.c_str(), open_existing,
+                                                       access_mode::read_only, segment_options(),
+                                                       std::nothrow);
+        REQUIRE_FALSE(map.is_valid());
+        REQUIRE(map.last_error() == errc::not_found);
+    }
+
+    SECTION("Different value type") {
+        shm_hash_map<std::uint64_t, std::uint32_t> map(name.c_str(), 16, create_only);
+        shm_hash_map<std::uint64_t, std::uint64_t> other(name.c_str(), open_existing,
+                                                         access_mode::read_only, segment_options(),
+                                                         std::nothrow);
+        REQUIRE_FALSE(other.is_valid());
+        REQUIRE(other.last_error() == errc::incompatible_layout);
+    }
+
+    SECTION("Zero capacity") {
+        shm_hash_map<std::uint64_t, std::uint32_t> map(name.c_str(), 0, create_only,
+                                                       segment_options(), std::nothrow);
+        REQUIRE(map.last_error() == errc::invalid_size);
+    }
+
+    SECTION("Capacity too large") {
+        shm_hash_map<std::uint64_t, std::uint32_t> map(
+            name.c_str(), std::numeric_limits<std::size_t>::max() / 4, create_only,
+            segment_options(), std::nothrow);
+        REQUIRE(map.last_error() == errc::invalid_size);
+    }
+}
@@ -0,0 +1,186 @@
+#include <catch2/catch_test_macros.hpp>
+#include <slick/shm/spsc_ring.hpp>
+
+#include <string>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <thread>
+#include <vector>
+
+using namespace slick::shm;
+
+namespace {
+
+std::string unique_name(const char* prefix) {
+    auto now = std::chrono::system_clock::now().time_since_epoch();
+    auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(now).count();
+    // Use modulo to keep the timestamp shorter while still being unique (macOS has 31-char limit)
+    return std::string(prefix) + std::to_string(millis % 100000000);
+}
+
+struct shm_cleanup {
+    std::string name;
+    ~shm_cleanup() {
+        shared_memory::remove(name.c_str());
+    }
+};
+
+struct tick {
+    std::uint64_t seq;
+    double price;
+};
+
+}  // namespace
+
+TEST_CASE("spsc_ring basic push/pop", "[spsc_ring]") {
+    std::string name = unique_name("test_spsc_basic");
+    shm_cleanup cleanup{name};
+
+    spsc_ring<tick> producer(name.c_str(), 5, create_only);
+    REQUIRE(producer.is_valid());
+    REQUIRE(producer.capacity() == 8);  // Rounded up to a power of two
+    REQUIRE(producer.empty());
+
+    spsc_ring<tick> consumer(name.c_str(), open_existing);
+    REQUIRE(consumer.is_valid());
+    REQUIRE(consumer.capacity() == 8);
+
+    tick out{};
+    REQUIRE_FALSE(consumer.try_pop(out));
+
+    for (std::uint64_t i = 0; i < 8; ++i) {
+        REQUIRE(producer.try_push(tick{i, 1.5 * static_cast<double>(i)}));
+    }
+    REQUIRE_FALSE(producer.try_push(tick{99, 0.0}));  // Full
+    REQUIRE(consumer.size_approx() == 8);
+
+    for (std::uint64_t i = 0; i < 8; ++i) {
+        REQUIRE(consumer.try_pop(out));
+        REQUIRE(out.seq == i);
+        REQUIRE(out.price == 1.5 * static_cast<double>(i));
+    }
+    REQUIRE_FALSE(consumer.try_pop(out));
+    REQUIRE(producer.try_push(tick{8, 0.0}));
+}
+
+TEST_CASE("spsc_ring batch push/pop wraps around", "[spsc_ring]") {
+    std::string name = unique_name("test_spsc_batch");
+    shm_cleanup cleanup{name};
+
+    spsc_ring<std::uint32_t> producer(name.c_str(), 16, create_only);
+    spsc_ring<std::uint32_t> consumer(name.c_str(), open_existing);
+
+    std::vector<std::uint32_t> in(40);
+    for (std::uint32_t i = 0; i < in.size(); ++i) {
+        in[i] = i;
+    }
+    std::vector<std::uint32_t> out(40, 0);
+
+    // Move the indices so the next batch straddles the end of the buffer
+    REQUIRE(producer.try_push_n(in.data(), 10) == 10);
+    REQUIRE(consumer.try_pop_n(out.data(), 10) == 10);
+
+    REQUIRE(producer.try_push_n(in.data() + 10, 30) == 16);  // Only 16 fit
+    REQUIRE(producer.try_push_n(in.data() + 26, 1) == 0);
+    REQUIRE(consumer.try_pop_n(out.data() + 10, 5) == 5);
+    REQUIRE(consumer.try_pop_n(out.data() + 15, 100) == 11);
+    REQUIRE(consumer.try_pop_n(out.data(), 1) == 0);
+
+    for (std::uint32_t i = 0; i < 26; ++i) {
+        REQUIRE(out[i] == i);
+    }
+}
+
+TEST_CASE("spsc_ring open validates layout", "[spsc_ring]") {
+    std::string name = unique_name("test_spsc_layout");
+    shm_cleanup cleanup{name};
+
+    SECTION("Element size mismatch") {
+        spsc_ring<std::uint32_t> producer(name.c_str(), 16, create_only);
+        spsc_ring<tick> consumer(name.c_str(), open_existing, segment_options(), std::nothrow);
+        REQUIRE_FALSE(consumer.is_valid());
+        REQUIRE(consumer.last_error() == errc::incompatible_layout);
+    }
+
+    SECTION("Plain segment") {
+        shared_memory shm(name.c_str(), 4096, create_only);
+        REQUIRE_THROWS_AS(spsc_ring<tick>(name.c_str(), open_existing), shared_memory_error);
+    }
+
+    SECTION("Missing segment") {
+        spsc_ring<tick> consumer(name.c_str(), open_existing, segment_options(), std::nothrow);
+        REQUIRE(consumer.last_error() == errc::not_found);
+    }
+
+    SECTION("Zero capacity") {
+        spsc_ring<tick> producer(name.c_str(), 0, create_only, segment_options(), std::nothrow);
+        REQUIRE(producer.last_error() == errc::invalid_size);
+    }
+
+    SECTION("Capacity too large to round up") {
+        const std::size_t huge = (std::numeric_limits<std::size_t>::max() >> 1) + 2;
+        spsc_ring<char> bytes(name.c_str(), huge, create_only, segment_options(), std::nothrow);
+        REQUIRE(bytes.last_error() == errc::invalid_size);
+        // Rounds up fine, but the slots would overflow the segment size
+        spsc_ring<tick> producer(name.c_str(), huge / 2, create_only, segment_options(),
+                                 std::nothrow);
+        REQUIRE(producer.last_error() == errc::invalid_size);
+        REQUIRE_FALSE(shared_memory::exists(name.c_str()));
+    }
+}
+
+TEST_CASE("spsc_ring move leaves source invalid", "[spsc_ring]") {
+    std::string name = unique_name("test_spsc_move");
+    shm_cleanup cleanup{name};
+
+    spsc_ring<int> ring(name.c_str(), 4, create_only);
+    spsc_ring<int> moved(std::move(ring));
+    REQUIRE_FALSE(ring.is_valid());
+    REQUIRE(moved.is_valid());
+    REQUIRE(moved.try_push(42));
+}
+
+TEST_CASE("spsc_ring concurrent producer and consumer", "[spsc_ring]") {
+    std::string name = unique_name("test_spsc_threads");
+    shm_cleanup cleanup{name};
+
+    constexpr std::uint64_t count = 200000;
+    spsc_ring<std::uint64_t> producer(name.c_str(), 1024, create_only);
+    spsc_ring<std::uint64_t> consumer(name.c_str(), open_existing);
+
+    std::thread writer([&] {
+        std::uint64_t batch[7];
+        std::uint64_t next = 0;
+        while (next < count) {
+            std::size_t n = 0;
+            while (n < 7 && next + n < count) {
+                batch[n] = next + n;
+                ++n;
+            }
+            std::size_t pushed = producer.try_push_n(batch, n);
+            if (pushed == 0) {
+                std::this_thread::yield();
+            }
+            next += pushed;
+        }
+    });
+
+    std::uint64_t expected = 0;
+    bool ordered = true;
+    std::uint64_t buf[16];
+    while (expected < count) {
+        std::size_t n = consumer.try_pop_n(buf, 16);
+        if (n == 0) {
+            std::this_thread::yield();
+        }
+        for (std::size_t i = 0; i < n; ++i) {
+            ordered = ordered && buf[i] == expected;
+            ++expected;
+        }
+    }
+    writer.join();
+
+    REQUIRE(ordered);
+    REQUIRE(consumer.empty());
+}
@@ -0,0 +1,165 @@
+// Built into slick_shm_stats_tests with SLICK_SHM_ENABLE_STATS defined
+#include <catch2/catch_test_macros.hpp>
+#include <slick/shm/stats.hpp>
+#include <slick/shm/spsc_ring.hpp>
+#include <slick/shm/broadcast_ring.hpp>
+#include <slick/shm/message_ring.hpp>
+#include <slick/shm/managed_segment.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <thread>
+
+using namespace slick::shm;
+
+namespace {
+
+std::string unique_name(const char* prefix) {
+    auto now = std::chrono::system_clock::now().time_since_epoch();
+    auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(now).count();
+    // Use modulo to keep the timestamp shorter while still being unique (macOS has 31-char limit)
+    return std::string(prefix) + std::to_string(millis % 100000000);
+}
+
+struct shm_cleanup {
+    std::string name;
+    ~shm_cleanup() {
+        shared_memory::remove(name.c_str());
+    }
+};
+
+}  // namespace
+
+TEST_CASE("Stats are compiled in", "[stats]") {
+    STATIC_REQUIRE(stats_enabled);
+}
+
+TEST_CASE("spsc_ring counters", "[stats][spsc_ring]") {
+    auto name = unique_name("statspsc");
+    shm_cleanup cleanup{name};
+
+    spsc_ring<int> ring(name.c_str(), 4, create_only);
+    int value = 0;
+    REQUIRE_FALSE(ring.try_pop(value));
+    for (int i = 0; i < 4; ++i) {
+        REQUIRE(ring.try_push(i));
+    }
+    REQUIRE_FALSE(ring.try_push(4));
+    int out[4];
+    REQUIRE(ring.try_pop_n(out, 4) == 4);
+
+    segment_stats stats = ring.stats_snapshot();
+    REQUIRE(stats.attaches == 1);
+    REQUIRE(stats.detaches == 0);
+    REQUIRE(stats.enqueues == 4);
+    REQUIRE(stats.dequeues == 4);
+    REQUIRE(stats.full_events == 1);
+    REQUIRE(stats.empty_events == 1);
+    REQUIRE(stats.max_consumer_lag == 4);
+
+    {
+        spsc_ring<int> consumer(name.c_str(), open_existing);
+        REQUIRE(consumer.stats_snapshot().attaches == 2);
+    }
+    REQUIRE(ring.stats_snapshot().detaches == 1);
+}
+
+TEST_CASE("Moving a ring doesn't count as a detach", "[stats][spsc_ring]") {
+    auto name = unique_name("statmove");
+    shm_cleanup cleanup{name};
+
+    spsc_ring<int> ring(name.c_str(), 4, create_only);
+    spsc_ring<int> moved(std::move(ring));
+    REQUIRE(moved.stats_snapshot().detaches == 0);
+
+    spsc_ring<int> other(name.c_str(), open_existing);
+    moved = std::move(other);  // Closes the creator's attachment
+    REQUIRE(moved.stats_snapshot().attaches == 2);
+    REQUIRE(moved.stats_snapshot().detaches == 1);
+}
+
+TEST_CASE("message_ring counters", "[stats][message_ring]") {
+    auto name = unique_name("statmsg");
+    shm_cleanup cleanup{name};
+
+    message_ring ring(name.c_str(), 256, create_only);
+    REQUIRE_FALSE(ring.read());
+
+    char payload[40] = {};
+    std::size_t written = 0;
+    while (ring.try_write(payload, sizeof(payload))) {
+        ++written;
+    }
+    REQUIRE(written > 0);
+
+    std::size_t used = ring.bytes_used();
+    REQUIRE(ring.read());
+    ring.release();
+
+    segment_stats stats = ring.stats_snapshot();
+    REQUIRE(stats.enqueues == written);
+    REQUIRE(stats.full_events == 1);
+    REQUIRE(stats.dequeues == 1);
+    REQUIRE(stats.empty_events == 1);
+    REQUIRE(stats.max_consumer_lag == used);
+}
+
+TEST_CASE("broadcast_ring counters", "[stats][broadcast_ring]") {
+    auto name = unique_name("statbcast");
+    shm_cleanup cleanup{name};
+
+    broadcast_ring<std::uint64_t> writer(name.c_str(), 8, create_only);
+    broadcast_ring<std::uint64_t> quiet(name.c_str(), open_existing);
+    broadcast_ring<std::uint64_t> counted(name.c_str(), open_existing, access_mode::read_write);
+
+    for (std::uint64_t i = 0; i < 3; ++i) {
+        writer.publish(i);
+    }
+    std::uint64_t value = 0;
+    quiet.seek_latest();
+    REQUIRE(quiet.try_read(value) == read_status::empty);
+    REQUIRE(counted.try_read(value) == read_status::ok);
+    REQUIRE(counted.try_read(value) == read_status::ok);
+
+    segment_stats stats = writer.stats_snapshot();
+    REQUIRE(stats.attaches == 2);  // The read_only reader doesn't write to the segment
+    REQUIRE(stats.enqueues == 3);
+    REQUIRE(stats.dequeues == 2);
+    REQUIRE(stats.empty_events == 0);
+    REQUIRE(stats.max_consumer_lag == 3);
+}
+
+TEST_CASE("managed_segment counters", "[stats][managed_segment]") {
+    auto name = unique_name("statmgd");
+    shm_cleanup cleanup{name};
+
+    managed_segment creator(name.c_str(), 4096, create_only);
+    managed_segment opener(name.c_str(), open_existing);
+
+    wait_policy policy;
+    policy.spin_count = 0;
+    std::error_code waited;
+    std::thread waiter([&] { waited = opener.wait_ready(std::chrono::seconds(10), policy); });
+
+    // The wait is counted right before the waiter blocks
+    while (creator.stats_snapshot().waits == 0) {
+        std::this_thread::yield();
+    }
+    creator.mark_ready();
+    waiter.join();
+    REQUIRE_FALSE(waited);
+
+    segment_stats stats = creator.stats_snapshot();
+    REQUIRE(stats.attaches == 2);
+    REQUIRE(stats.waits >= 1);
+    REQUIRE(stats.wakes == 1);
+
+    {
+        managed_segment viewer(name.c_str(), open_existing, 0, access_mode::read_only);
+        REQUIRE(viewer.stats_snapshot().attaches == 2);
+    }
+    REQUIRE(creator.stats_snapshot().detaches == 0);
+    { managed_segment moved(std::move(opener)); }
+    REQUIRE(creator.stats_snapshot().detaches == 1);
+}
@@ -0,0 +1,126 @@
+#include <catch2/catch_test_macros.hpp>
+#include <slick/shm/shared_memory.hpp>
+#include <slick/shm/shared_memory_view.hpp>
+#include <slick/shm/typed_view.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+using namespace slick::shm;
+
+namespace {
+
+std::string unique_name(const char* prefix) {
+    auto now = std::chrono::system_clock::now().time_since_epoch();
+    auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(now).count();
+    // Use modulo to keep the timestamp shorter while still being unique (macOS has 31-char limit)
+    return std::string(prefix) + std::to_string(millis % 100000000);
+}
+
+struct shm_cleanup {
+    std::string name;
+    ~shm_cleanup() {
+        shared_memory::remove(name.c_str());
+    }
+};
+
+struct quote {
+    double bid;
+    double ask;
+};
+
+}  // namespace
+
+TEST_CASE("as<T>() checks size and alignment", "[typed_view]") {
+    auto name = unique_name("typedas");
+    shm_cleanup cleanup{name};
+
+    shared_memory shm(name.c_str(), 4096, create_only);
+    quote* q = shm.as<quote>();
+    REQUIRE(q == shm.data());
+    q->bid = 1.5;
+
+    REQUIRE(shm.as<quote>(64)->bid == 0.0);
+    REQUIRE(shm.as<quote>(4096 - sizeof(quote)) != nullptr);
+    REQUIRE(shm.as<quote>(4096 - sizeof(quote) + 8) == nullptr);  // Runs past the end
+    REQUIRE(shm.as<quote>(4) == nullptr);                          // Misaligned
+    REQUIRE(shm.as<quote, 64>(64) != nullptr);
+    REQUIRE(shm.as<quote, 64>(32) == nullptr);
+
+    const shared_memory& ref = shm;
+    REQUIRE(ref.as<quote>()->bid == 1.5);
+
+    shared_memory invalid;
+    REQUIRE(invalid.as<quote>() == nullptr);
+}
+
+TEST_CASE("as_array<T>() covers the segment or a range", "[typed_view]") {
+    auto name = unique_name("typedarr");
+    shm_cleanup cleanup{name};
+
+    shared_memory shm(name.c_str(), 4096, create_only);
+    array_view<double, 64> prices = shm.as_array<double, 64>();
+    REQUIRE(prices.size() == 4096 / sizeof(double));
+    REQUIRE(prices.size_bytes() == 4096);
+    for (std::size_t i = 0; i < prices.size(); ++i) {
+        prices[i] = static_cast<double>(i);
+    }
+
+    double sum = 0;
+    for (double p : shm.as_array<const double>()) {
+        sum += p;
+    }
+    REQUIRE(sum == 511.0 * 512.0 / 2.0);
+
+    array_view<std::uint32_t> tail = shm.as_array<std::uint32_t>(4092);
+    REQUIRE(tail.size() == 1);
+    REQUIRE(shm.as_array<std::uint32_t>(4096).empty());
+
+    array_view<double> range = shm.as_array<double>(80, 4);
+    REQUIRE(range.size() == 4);
+    REQUIRE(range[0] == 10.0);
+    REQUIRE(shm.as_array<double>(4088, 2).empty());  // Doesn't fit
+    REQUIRE(shm.as_array<double>(0, SIZE_MAX).empty());
+    REQUIRE(shm.as_array<double, 64>(8).data() == nullptr);
+
+    // Read-only conversion
+    array_view<const double, 8> readonly = prices;
+    REQUIRE(readonly.data() == prices.data());
+}
+
+TEST_CASE("as_matrix<T>() maps rows x cols", "[typed_view]") {
+    auto name = unique_name("typedmat");
+    shm_cleanup cleanup{name};
+
+    shared_memory shm(name.c_str(), 4096, create_only);
+    matrix_view<float, 64> ticks = shm.as_matrix<float, 64>(16, 8, 64);
+    REQUIRE(ticks.is_valid());
+    REQUIRE(ticks.rows() == 16);
+    REQUIRE(ticks.cols() == 8);
+    for (std::size_t r = 0; r < ticks.rows(); ++r) {
+        for (std::size_t c = 0; c < ticks.cols(); ++c) {
+            ticks(r, c) = static_cast<float>(r * 100 + c);
+        }
+    }
+    REQUIRE(ticks.row(3)[2] == 302.0f);
+    REQUIRE(ticks.elements().size() == 128);
+    REQUIRE(shm.as<float>(64 + (3 * 8 + 2) * sizeof(float))[0] == 302.0f);
+
+    REQUIRE_FALSE(shm.as_matrix<float>(1024, 2).is_valid());
+    REQUIRE_FALSE(shm.as_matrix<float>(SIZE_MAX, 2).is_valid());  // Overflows
+}
+
+TEST_CASE("Views of a view", "[typed_view][view]") {
+    auto name = unique_name("typedview");
+    shm_cleanup cleanup{name};
+
+    shared_memory shm(name.c_str(), 4096, create_only);
+    shared_memory_view view(shm);
+    view.as_array<std::uint64_t>()[7] = 42;
+    REQUIRE(shm.as<std::uint64_t>(56)[0] == 42);
+
+    const shared_memory_view& ref = view;
+    REQUIRE(ref.as_matrix<std::uint64_t>(8, 64).is_valid());
+    REQUIRE(shared_memory_view().as_array<int>().empty());
+}
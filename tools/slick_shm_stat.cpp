@@ -0,0 +1,143 @@
+// slick-shm-stat: print the counters of managed segments, rings and epoch buffers
+// (see stats.hpp)
+//
+// Segments are mapped read_only, so running the tool never writes to a segment
+// or disturbs the processes using it.
+
+#include <slick/shm/shared_memory.hpp>
+#include <slick/shm/managed_segment.hpp>
+#include <slick/shm/spsc_ring.hpp>
+#include <slick/shm/broadcast_ring.hpp>
+#include <slick/shm/message_ring.hpp>
+#include <slick/shm/epoch_buffer.hpp>
+#include <slick/shm/stats.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace slick::shm;
+
+namespace {
+
+void usage() {
+    std::cerr << "Usage: slick-shm-stat [--file] [--interval <seconds>] <name>...\n"
+                 "  --file        names are paths of file-backed segments\n"
+                 "  --interval N  print again every N seconds until interrupted\n";
+}
+
+template <typename Header>
+const Header* header_of(const shared_memory& shm, std::uint64_t magic) {
+    if (shm.size() < sizeof(Header)) {
+        return nullptr;
+    }
+    auto* header = static_cast<const Header*>(shm.data());
+    return header->magic.load(std::memory_order_acquire) == magic ? header : nullptr;
+}
+
+// Kind of segment and its counters, or nullptr if it carries no stats
+const char* read_stats(const shared_memory& shm, segment_stats& stats) {
+    if (auto* header = header_of<detail::managed_header>(shm, detail::MANAGED_SEGMENT_MAGIC)) {
+        stats = detail::load_stats(header->stats);
+        stats.waits += header->ready.kernel_waits();
+        stats.wakes += header->ready.kernel_wakes();
+        return "managed_segment";
+    }
+    if (auto* header = header_of<detail::spsc_ring_header>(shm, detail::SPSC_RING_MAGIC)) {
+        stats = detail::load_stats(header->stats);
+        return "spsc_ring";
+    }
+    if (auto* header = header_of<detail::broadcast_ring_header>(shm,
+                                                               detail::BROADCAST_RING_MAGIC)) {
+        stats = detail::load_stats(header->stats);
+        return "broadcast_ring";
+    }
+    if (auto* header = header_of<detail::message_ring_header>(shm, detail::MESSAGE_RING_MAGIC)) {
+        stats = detail::load_stats(header->stats);
+        return "message_ring";
+    }
+    if (auto* header = header_of<detail::epoch_buffer_header>(shm, detail::EPOCH_BUFFER_MAGIC)) {
+        stats = detail::load_stats(header->stats);
+        return "epoch_buffer";
+    }
+    return nullptr;
+}
+
+void print_counter(const char* label, std::uint64_t value) {
+    std::cout << "  " << std::left << std::setw(18) << label << value << '\n';
+}
+
+bool print(const std::string& name, const segment_options& options) {
+    shared_memory shm(name.c_str(), open_existing, access_mode::read_only, options,
+                      std::nothrow);
+    if (!shm.is_valid()) {
+        std::cerr << name << ": " << shm.last_error().message() << '\n';
+        return false;
+    }
+
+    segment_stats stats;
+    const char* kind = read_stats(shm, stats);
+    if (kind == nullptr) {
+        std::cerr << name << ": not a managed segment or ring\n";
+        return false;
+    }
+
+    std::cout << name << " (" << kind << ", " << shm.size() << " bytes)\n";
+    print_counter("attaches", stats.attaches);
+    print_counter("detaches", stats.detaches);
+    print_counter("enqueues", stats.enqueues);
+    print_counter("dequeues", stats.dequeues);
+    print_counter("full", stats.full_events);
+    print_counter("empty", stats.empty_events);
+    print_counter("kernel waits", stats.waits);
+    print_counter("kernel wakes", stats.wakes);
+    print_counter("max consumer lag", stats.max_consumer_lag);
+    return true;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    segment_options options;
+    long interval = 0;
+    std::vector<std::string> names;
+
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--file") == 0) {
+            options.file_backed = true;
+        } else if (std::strcmp(argv[i], "--interval") == 0 && i + 1 < argc) {
+            interval = std::strtol(argv[++i], nullptr, 10);
+            if (interval <= 0) {
+                usage();
+                return 2;
+            }
+        } else if (argv[i][0] == '-') {
+            usage();
+            return 2;
+        } else {
+            names.push_back(argv[i]);
+        }
+    }
+    if (names.empty()) {
+        usage();
+        return 2;
+    }
+
+    for (;;) {
+        bool ok = true;
+        for (const std::string& name : names) {
+            ok = print(name, options) && ok;
+        }
+        if (interval == 0) {
+            return ok ? 0 : 1;
+        }
+        std::cout << std::endl;
+        std::this_thread::sleep_for(std::chrono::seconds(interval));
+    }
+}